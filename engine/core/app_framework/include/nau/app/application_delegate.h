@@ -38,6 +38,11 @@ namespace nau
 
         virtual void onApplicationStep(std::chrono::milliseconds dt);
 
+        /**
+            @brief The application does not create the platform window: see runHeadlessApplication.
+         */
+        virtual bool isHeadless() const;
+
     protected:
         Result<> initializeApplication() override;
     };
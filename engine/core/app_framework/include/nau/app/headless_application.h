@@ -0,0 +1,75 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include "nau/app/application_delegate.h"
+#include "nau/meta/class_info.h"
+
+namespace nau
+{
+    /**
+        @brief Headless application settings ("/app/headless" global property).
+     */
+    struct HeadlessAppConfig
+    {
+        /**
+            @brief Game steps per second. 0: the steps are not paced (as the windowed application).
+         */
+        uint32_t tickRate = 30;
+
+        /**
+            @brief Between the ticks the host thread waits on the application work queue: the async work is processed as soon as it arrives,
+            the game step is still executed only at the tick time.
+            Otherwise the async work waits for the next tick and the pacing is precise: the host thread sleeps and then spins until the tick time.
+         */
+        bool processWorkBetweenTicks = true;
+
+        /**
+            @brief Logical CPUs the host thread is restricted to (empty: no restriction).
+         */
+        eastl::vector<uint32_t> cpuAffinity;
+
+        /**
+            @brief Every reportInterval ticks the tick timing (min/average/max and the ticks over the budget) is logged. 0: no report.
+         */
+        uint32_t reportInterval = 0;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(tickRate),
+            CLASS_FIELD(processWorkBetweenTicks),
+            CLASS_FIELD(cpuAffinity),
+            CLASS_FIELD(reportInterval))
+    };
+
+    /**
+        @brief The minimal modules set of the dedicated server: no platform window, render or audio.
+     */
+    inline constexpr const char* HeadlessModulesList = "CoreAssets,CoreAssetFormats,CoreScene,Animation,Physics,PhysicsJolt,Network,ScriptsLua";
+
+    /**
+        @brief The client side modules (platform window, render and graphics, audio, input) that the headless application never loads.
+     */
+    inline constexpr const char* HeadlessExcludedModules = "PlatformApp,Render,Graphics,GraphicsAssets,DebugRenderer,VFX,ui,Audio,CoreInput";
+
+    /**
+        @brief Removes HeadlessExcludedModules from the comma separated modules list.
+        The headless application delegate applies it to its modules list, so the full (client) list can be passed as is.
+     */
+    eastl::string filterHeadlessModulesList(eastl::string_view modulesList);
+
+    /**
+        @brief The default application delegate that does not create the platform window.
+     */
+    ApplicationDelegate::Ptr createHeadlessApplicationDelegate(eastl::string dynModulesList = HeadlessModulesList);
+
+    /**
+        @brief Runs the application without the platform window (the delegate must be headless) at the fixed tick rate:
+        see HeadlessAppConfig.
+     */
+    int runHeadlessApplication(ApplicationDelegate::Ptr appDelegate);
+}  // namespace nau
@@ -5,6 +5,7 @@
 #include "./application_impl.h"
 
 #include "nau/diag/device_error.h"
+#include "nau/diag/startup_trace.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service_provider.h"
 #include "nau/ui.h"
@@ -78,6 +79,8 @@ namespace nau
         // TODO: check init result
         NauCheckResult(waitTaskAndPoll(serviceProviderInit.initServices()))
 
+        NAU_LOG_VERBOSE("{}", diag::formatStartupTraceReport());
+
         m_mainLoop = &serviceProvider.get<MainLoopService>();
 
         if (getServiceProvider().has<ui::UiManager>())
@@ -90,6 +93,8 @@ namespace nau
             m_vfxManager = &getServiceProvider().get<vfx::VFXManager>();
         }
 
+        registerFramePhases();
+
         return {};
     }
 
@@ -188,19 +193,45 @@ namespace nau
         shutdownCoreServices();
     }
 
-    void ApplicationImpl::mainGameStep(float dt)
+    void ApplicationImpl::registerFramePhases()
     {
+        using namespace nau::string_literals;
+
         NAU_FATAL(m_mainLoop);
 
+        // ui and vfx are updated before the game systems (as they were updated before the frame graph):
+        // the ui runs the cocos main loop (and the user callbacks) and stays on the host thread, vfx runs on the worker thread
         if (m_uiManager)
         {
-            m_uiManager->update(dt);
+            FramePhaseDesc uiPhase;
+            uiPhase.name = "ui update"_name;
+            uiPhase.writes = {"ui"_name};
+            uiPhase.mainThreadOnly = true;
+            uiPhase.callback = [uiManager = m_uiManager](float dt)
+            {
+                uiManager->update(dt);
+            };
+
+            m_mainLoop->addFramePhase(std::move(uiPhase));
         }
 
         if (m_vfxManager)
         {
-            m_vfxManager->update(dt);
+            FramePhaseDesc vfxPhase;
+            vfxPhase.name = "vfx update"_name;
+            vfxPhase.writes = {"vfx"_name};
+            vfxPhase.callback = [vfxManager = m_vfxManager](float dt)
+            {
+                vfxManager->update(dt);
+            };
+
+            m_mainLoop->addFramePhase(std::move(vfxPhase));
         }
+    }
+
+    void ApplicationImpl::mainGameStep(float dt)
+    {
+        NAU_FATAL(m_mainLoop);
 
         m_mainLoop->doGameStep(dt);
 #if 0
@@ -66,6 +66,8 @@ namespace nau
 
         void completeShutdown();
 
+        void registerFramePhases();
+
         void mainGameStep(float dt);
 
         RuntimeState::Ptr m_runtime = RuntimeState::create();
@@ -8,6 +8,7 @@
 #include "nau/app/application_services.h"
 #include "nau/app/background_work_service.h"
 #include "nau/diag/device_error.h"
+#include "nau/io/async_file_reader.h"
 #include "nau/io/special_paths.h"
 #include "nau/io/virtual_file_system.h"
 #include "nau/string/string_conv.h"
@@ -33,6 +34,7 @@ namespace nau
         serviceProvider.addService(createBackgroundWorkService());
         serviceProvider.addService(std::move(loggingService));
         serviceProvider.addService(io::createVirtualFileSystem());
+        serviceProvider.addService(io::createAsyncFileReader());
         serviceProvider.addService(AsyncMessageSource::create());
         serviceProvider.addService(eastl::make_unique<GlobalPropertiesImpl>());
 
@@ -6,11 +6,13 @@
 
 #include "nau/app/application_delegate.h"
 #include "nau/app/global_properties.h"
+#include "nau/app/headless_application.h"
 #include "nau/app/platform_window.h"
 #include "nau/app/window_manager.h"
 #include "nau/assets/asset_manager.h"
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/scene_asset.h"
+#include "nau/diag/startup_trace.h"
 #include "nau/input.h"
 #include "nau/io/asset_pack_file_system.h"
 #include "nau/io/virtual_file_system.h"
@@ -23,12 +25,18 @@ namespace nau
     class DefaultAppDelegate final : public ApplicationDelegate
     {
     public:
-        DefaultAppDelegate(eastl::string&& modulesList) :
-            m_modulesList(std::move(modulesList))
+        DefaultAppDelegate(eastl::string&& modulesList, bool isHeadless = false) :
+            m_modulesList(std::move(modulesList)),
+            m_isHeadless(isHeadless)
         {
         }
 
     private:
+        bool isHeadless() const override
+        {
+            return m_isHeadless;
+        }
+
         eastl::string getModulesListString() const override
         {
 #if !defined(NAU_STATIC_RUNTIME)
@@ -45,6 +53,7 @@ namespace nau
 
         Result<> initializeServices() override
         {
+            diag::StartupTraceScope traceScope{diag::StartupStage::Application, "Virtual file system and asset database"};
             configureVirtualFileSystem();
 
             return ResultSuccess;
@@ -52,6 +61,11 @@ namespace nau
 
         void onApplicationInitialized() override
         {
+            if (m_isHeadless)
+            {
+                return;
+            }
+
             auto& windowService = getServiceProvider().get<IWindowManager>();
             auto& window = windowService.getActiveWindow();
             window.setVisible(true);
@@ -129,10 +143,16 @@ namespace nau
         }
 
         [[maybe_unused]] eastl::string m_modulesList;
+        const bool m_isHeadless;
     };
 
     ApplicationDelegate::Ptr createDefaultApplicationDelegate(eastl::string dynModulesList)
     {
         return eastl::make_unique<DefaultAppDelegate>(std::move(dynModulesList));
     }
+
+    ApplicationDelegate::Ptr createHeadlessApplicationDelegate(eastl::string dynModulesList)
+    {
+        return eastl::make_unique<DefaultAppDelegate>(std::move(dynModulesList), true);
+    }
 }  // namespace nau
\ No newline at end of file
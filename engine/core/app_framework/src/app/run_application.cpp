@@ -7,11 +7,20 @@
 #include "nau/app/application.h"
 #include "nau/app/application_services.h"
 #include "nau/app/core_window_manager.h"
+#include "nau/app/global_properties.h"
+#include "nau/app/headless_application.h"
+#include "nau/app/main_loop/fixed_step_scheduler.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/app/platform_window.h"
+#include "nau/async/work_queue.h"
+#include "nau/diag/cpu_profiler.h"
+#include "nau/diag/logging.h"
+#include "nau/diag/process_memory.h"
 #include "nau/input.h"
 #include "nau/module/module_manager.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/string/string_utils.h"
+#include "nau/threading/thread_affinity.h"
 
 namespace nau
 {
@@ -59,22 +68,133 @@ namespace nau
             ApplicationDelegate& m_appDelegate;
             async::Task<> m_appStartupTask;
         };
+
+        /**
+            Paces the headless application ticks and collects the tick timing.
+         */
+        class HeadlessTickLoop
+        {
+        public:
+            using Clock = FixedStepScheduler::Clock;
+
+            HeadlessTickLoop(const HeadlessAppConfig& config, WorkQueue& appWorkQueue) :
+                m_config(config),
+                m_appWorkQueue(appWorkQueue)
+            {
+                if (m_config.tickRate > 0)
+                {
+                    m_scheduler.emplace(FixedStepScheduler::Settings{
+                        .step = std::chrono::nanoseconds{1'000'000'000 / m_config.tickRate},
+                        .maxStepsPerAdvance = 1,
+                        .pacing = FixedStepPacing::SpinThenSleep});
+
+                    m_scheduler->reset();
+                }
+            }
+
+            /**
+                Returns when the next tick is due: the time that is left is spent waiting on the application work queue
+                (the async work is processed, but the game step is not executed) or sleeping, see HeadlessAppConfig::processWorkBetweenTicks.
+             */
+            void waitForNextTick()
+            {
+                if (!m_scheduler)
+                {
+                    return;
+                }
+
+                while (m_scheduler->advance() == 0)
+                {
+                    if (!m_config.processWorkBetweenTicks)
+                    {
+                        m_scheduler->waitForNextStep();
+                        continue;
+                    }
+
+                    const auto timeLeft = m_scheduler->getNextStepTime() - Clock::now();
+                    if (timeLeft > Clock::duration::zero())
+                    {
+                        const auto timeout = std::chrono::ceil<std::chrono::milliseconds>(timeLeft);
+                        m_appWorkQueue.poll(eastl::chrono::milliseconds{timeout.count()});
+                    }
+                }
+            }
+
+            void onTickCompleted(std::chrono::nanoseconds tickTime)
+            {
+                diag::CpuProfiler::recordCounter("Server tick (us)", tickTime.count() / 1000);
+
+                if (m_config.reportInterval == 0)
+                {
+                    return;
+                }
+
+                m_minTickTime = std::min(m_minTickTime, tickTime);
+                m_maxTickTime = std::max(m_maxTickTime, tickTime);
+                m_totalTickTime += tickTime;
+                if (m_scheduler && tickTime > m_scheduler->getStep())
+                {
+                    ++m_overBudgetTicks;
+                }
+
+                if (++m_ticksCount < m_config.reportInterval)
+                {
+                    return;
+                }
+
+                using namespace std::chrono;
+
+                NAU_LOG_INFO("Ticks ({}): min ({}) us, avg ({}) us, max ({}) us, over budget ({}), resident memory ({}) KB",
+                             m_ticksCount,
+                             duration_cast<microseconds>(m_minTickTime).count(),
+                             duration_cast<microseconds>(m_totalTickTime / m_ticksCount).count(),
+                             duration_cast<microseconds>(m_maxTickTime).count(),
+                             m_overBudgetTicks,
+                             diag::getProcessMemoryInfo().residentBytes / 1024);
+
+                m_ticksCount = 0;
+                m_overBudgetTicks = 0;
+                m_minTickTime = std::chrono::nanoseconds::max();
+                m_maxTickTime = std::chrono::nanoseconds{0};
+                m_totalTickTime = std::chrono::nanoseconds{0};
+            }
+
+        private:
+            const HeadlessAppConfig& m_config;
+            WorkQueue& m_appWorkQueue;
+            eastl::optional<FixedStepScheduler> m_scheduler;
+
+            uint32_t m_ticksCount = 0;
+            uint32_t m_overBudgetTicks = 0;
+            std::chrono::nanoseconds m_minTickTime = std::chrono::nanoseconds::max();
+            std::chrono::nanoseconds m_maxTickTime{0};
+            std::chrono::nanoseconds m_totalTickTime{0};
+        };
     }  // namespace
 
     void ApplicationDelegate::onApplicationStep([[maybe_unused]] std::chrono::milliseconds dt)
     {
     }
 
+    bool ApplicationDelegate::isHeadless() const
+    {
+        return false;
+    }
+
     Result<> ApplicationDelegate::initializeApplication()
     {
 #if !defined(NAU_STATIC_RUNTIME)
-        const eastl::string moduleList = getModulesListString();
+        // the statically linked runtime initializes the modules it is linked with: the headless executable must not link the client modules
+        const eastl::string moduleList = isHeadless() ? filterHeadlessModulesList(getModulesListString()) : getModulesListString();
         if (!moduleList.empty())
         {
             NauCheckResult(loadModulesList(moduleList));
         }
 #endif
-        getServiceProvider().addService(createPlatformWindowService());
+        if (!isHeadless())
+        {
+            getServiceProvider().addService(createPlatformWindowService());
+        }
 
         getServiceProvider().addService(eastl::make_unique<DelegateLoop>(*this));
 
@@ -105,4 +225,94 @@ namespace nau
 
         return 0;
     }
+
+    eastl::string filterHeadlessModulesList(eastl::string_view modulesList)
+    {
+        const auto isExcluded = [](eastl::string_view moduleName)
+        {
+            for (const eastl::string_view excludedName : strings::split(eastl::string_view{HeadlessExcludedModules}, eastl::string_view{","}))
+            {
+                if (strings::icaseEqual(moduleName, excludedName))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        eastl::string result;
+        for (const eastl::string_view entry : strings::split(modulesList, eastl::string_view{","}))
+        {
+            const eastl::string_view moduleName = strings::trim(entry);
+            if (moduleName.empty())
+            {
+                continue;
+            }
+
+            if (isExcluded(moduleName))
+            {
+                NAU_LOG_VERBOSE("Module ({}) is not loaded by the headless application", moduleName);
+                continue;
+            }
+
+            if (!result.empty())
+            {
+                result.append(",");
+            }
+            result.append(moduleName.data(), moduleName.size());
+        }
+
+        return result;
+    }
+
+    int runHeadlessApplication(ApplicationDelegate::Ptr appDelegate)
+    {
+        using namespace std::chrono;
+
+        NAU_FATAL(appDelegate);
+        NAU_FATAL(appDelegate->isHeadless(), "Headless application delegate is expected");
+
+        const auto startupTime = steady_clock::now();
+
+        auto app = createApplication(*appDelegate);
+        if (!app)
+        {
+            return -1;
+        }
+
+        app->startupOnCurrentThread();
+
+        const HeadlessAppConfig config = getServiceProvider().get<GlobalProperties>().getValue<HeadlessAppConfig>("/app/headless").value_or(HeadlessAppConfig{});
+        if (!config.cpuAffinity.empty())
+        {
+            if (Result<> affinityResult = threading::setThisThreadAffinity(config.cpuAffinity); !affinityResult)
+            {
+                NAU_LOG_WARNING("Fail to apply cpu affinity: ({})", affinityResult.getError()->getMessage());
+            }
+        }
+
+        appDelegate->onApplicationInitialized();
+        getServiceProvider().get<DelegateLoop>().startupAppDelegate();
+
+        NAU_LOG_INFO("Headless application started in ({}) ms, resident memory ({}) KB",
+                     duration_cast<milliseconds>(steady_clock::now() - startupTime).count(),
+                     diag::getProcessMemoryInfo().residentBytes / 1024);
+
+        WorkQueue* const appWorkQueue = app->getExecutor()->as<WorkQueue*>();
+        NAU_FATAL(appWorkQueue);
+
+        HeadlessTickLoop tickLoop{config, *appWorkQueue};
+
+        for (bool keepRunning = true; keepRunning;)
+        {
+            tickLoop.waitForNextTick();
+
+            const auto tickStart = steady_clock::now();
+            keepRunning = app->step();
+            tickLoop.onTickCompleted(duration_cast<nanoseconds>(steady_clock::now() - tickStart));
+        }
+
+        return 0;
+    }
 }  // namespace nau
@@ -4,9 +4,12 @@
 #include "concurrent_execution_container.h"
 
 #include "nau/app/application.h"
+#include "nau/app/global_properties.h"
 #include "nau/app/main_loop/game_system.h"
+#include "nau/diag/cpu_profiler.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service.h"
+#include "nau/threading/lock_guard.h"
 #include "nau/threading/set_thread_name.h"
 
 namespace nau
@@ -15,14 +18,14 @@ namespace nau
     {
         struct Timer
         {
-            std::chrono::system_clock::time_point lastTimePoint = std::chrono::system_clock::now();
+            std::chrono::steady_clock::time_point lastTimePoint = std::chrono::steady_clock::now();
 
-            std::chrono::milliseconds getDt()
+            std::chrono::nanoseconds getDt()
             {
                 using namespace std::chrono;
 
-                const auto currentTimePoint = system_clock::now();
-                const milliseconds dt = duration_cast<milliseconds>(currentTimePoint - lastTimePoint);
+                const auto currentTimePoint = steady_clock::now();
+                const nanoseconds dt = duration_cast<nanoseconds>(currentTimePoint - lastTimePoint);
                 lastTimePoint = currentTimePoint;
                 return dt;
             }
@@ -60,19 +63,32 @@ namespace nau
 
             getServiceProvider().addService(eastl::unique_ptr<IRttiObject>{m_gameSystemInstance});
 
-            // If game system requires fixed time step update then WorkQueue::poll() will use blocking mode:
-            // to maintain the required refresh rate, it may be necessary to skip some time - in this case,
-            // the poll will block the thread (if there are no active tasks).
+            if (m_gameSystemInstance->is<IGameScenePipelinedSync>())
+            {
+                GlobalProperties* const globalProperties = getServiceProvider().find<GlobalProperties>();
+                m_isPipelinedSync = globalProperties && globalProperties->getValue<bool>("/app/pipelinedSceneSync").value_or(false);
+
+                const std::string counterName = ::fmt::format("Scene state latency ({}), us", m_systemClass->getClassName());
+                m_latencyCounterName = NameId{eastl::string_view{counterName.data(), counterName.size()}};
+            }
+
+            // If game system requires fixed time step update then the thread waits (pumping the work queue) until the next step is due:
+            // see waitForNextFixedStep.
             //
             // If a fixed update frequency is not required, then the poll will work without thread blocking and time gaps,
             // ensuring the maximum speed of calling the game system update
-            const std::optional<eastl::chrono::milliseconds> BlockingTimeout = std::nullopt;
             const std::optional<eastl::chrono::milliseconds> NonBlockingTimeout = eastl::chrono::milliseconds(0);
 
             for (m_executionTask = executeGameSystem(); !m_executionTask.isReady();)
             {
-                const bool isFixedGameStep = m_gameSystemInstance->as<IGameSceneUpdate&>().getFixedUpdateTimeStep().has_value();
-                m_workQueue->poll((isFixedGameStep && m_isAlive) ? BlockingTimeout : NonBlockingTimeout);
+                if (m_nextFixedStepSignal && !m_nextFixedStepSignal.isReady())
+                {
+                    waitForNextFixedStep();
+                }
+                else
+                {
+                    m_workQueue->poll(NonBlockingTimeout);
+                }
             }
 
             while (!m_isShutdownCompleted)
@@ -106,6 +122,15 @@ namespace nau
 
         m_isAlive = false;
 
+        {
+            // the system thread can wait for the scene state that will never be published
+            lock_(m_publishMutex);
+            if (m_scenePublishedSignal && !m_scenePublishedSignal.isReady())
+            {
+                m_scenePublishedSignal.resolve();
+            }
+        }
+
         if (IServiceShutdown* gameSystemShutdown = m_gameSystemInstance->as<IServiceShutdown*>())
         {
             scope_on_leave
@@ -160,69 +185,176 @@ namespace nau
         Timer timer;
         do
         {
-            const std::chrono::milliseconds updateStep = timer.getDt();
+            const auto fixedTimeStep = gameSceneUpdate.getFixedUpdateTimeStep();
+            if (!fixedTimeStep)
+            {
+                m_fixedStepScheduler.reset();
+
+                const bool doContinueUpdate = co_await gameSceneUpdate.update(timer.getDt());
+                if (!doContinueUpdate)
+                {
+                    m_workQueue->notify();
+                    break;
+                }
+
+                if (m_isAlive && m_isPipelinedSync)
+                {
+                    recordSceneStateLatency();
+
+                    // do not wait for the host thread: only for the next published state (if it is not published yet)
+                    co_await waitForPublishedSceneState();
+                }
+                else if (m_isAlive)
+                {
+                    co_await syncSceneState();
+                }
+                else
+                {
+                    // gameSceneUpdate.update can be finished in synchronous fashion.
+                    // but there is a need to always pump work queue - forcefully yield execution to polling async messages
+                    co_await m_workQueue;
+                }
 
-            const bool doContinueUpdate = co_await gameSceneUpdate.update(updateStep);
-            if (!doContinueUpdate)
+                continue;
+            }
+
+            // with fixed time step the game system simulates the accumulated real time by the fixed steps:
+            // the steps that are due are executed one after another (limited by the scheduler's catch-up settings),
+            // then the thread waits (pumping the work queue) until the next step.
+            if (!m_fixedStepScheduler || m_fixedStepScheduler->getStep() != *fixedTimeStep)
             {
-                m_workQueue->notify();
-                break;
+                m_fixedStepScheduler.emplace(FixedStepScheduler::Settings{.step = *fixedTimeStep});
+                m_fixedStepScheduler->reset();
+                timer.getDt();
             }
 
-            if (m_isAlive)
+            const uint32_t stepsCount = m_fixedStepScheduler->advance();
+            for (uint32_t i = 0; i < stepsCount; ++i)
             {
+                const bool doContinueUpdate = co_await gameSceneUpdate.update(*fixedTimeStep);
+                if (!doContinueUpdate)
+                {
+                    m_workQueue->notify();
+                    co_return;
+                }
+            }
+
+            if (stepsCount > 0 && m_isAlive)
+            {
+                gameSceneUpdate.setInterpolationAlpha(m_fixedStepScheduler->getInterpolationAlpha());
                 co_await syncSceneState();
             }
+
+            if (m_isAlive)
+            {
+                m_nextFixedStepSignal = async::TaskSource<>{};
+                co_await m_nextFixedStepSignal.getTask();
+            }
             else
             {
-                // gameSceneUpdate.update can be finished in synchronous fashion.
-                // but there is a need to always pump work queue - forcefully yield execution to polling async messages
+                // the system must be updated until it completes: do not wait, only pump the work queue
                 co_await m_workQueue;
             }
 
-            // with fixed time step the game system will simulate for fixed time duration.
-            // If the simulation calculation took less than the target time,
-            // then in this case we simply fall asleep for a while to maintain the specified system update rate.
-            //
-            // f the simulation takes longer, then
-            // 1) most likely the target update rate needs to be revised (but this can be done only by game system itself
-            // 2) give control (yield) to the queue - so that there is an opportunity to pump the accumulated asynchronous messages
-            //    and immediately proceed to the next step of the simulation
-            if (const auto fixedTimeStep = gameSceneUpdate.getFixedUpdateTimeStep(); fixedTimeStep.has_value())
-            {
-                const auto updateDuration = duration_cast<milliseconds>(system_clock::now() - timer.lastTimePoint);
+        } while (true);
+    }
 
-                if (updateDuration < *fixedTimeStep)
-                {
-                    const auto sleepTime = *fixedTimeStep - updateDuration;
-
-                    // TODO: add async delay(timeout) -> Task<>.
-                    // Or revise the implementation of the timer manager so as not to terminate the current coroutine with an error, 
-                    // but to immediately complete the co_await without waiting.
-                    // 
-                    // Currently co_await timeout will automatically completed current coroutine.
-                    // But to complete gracefully, the game system expects gameSceneUpdate to always be called
-                    // otherwise it will never complete its execution: executeGameSystem will only stops after gameSceneUpdate.update() returns false.
-                    //
-                    // As a workaround, a "proxy" task is used to catch-up an error.
-                    auto sleepTask = [&]() -> Task<>
-                    {
-                        co_await sleepTime;
-                    }();
-
-                    Result<> waitRes = co_await sleepTask.doTry();
-                    if (!waitRes)
-                    {
-                        m_workQueue->notify();
-                    }
-                }
-                else
-                {
-                    co_await m_workQueue;
-                }
+    bool ConcurrentExecutionContainer::isPipelinedSync() const
+    {
+        return m_isPipelinedSync;
+    }
+
+    void ConcurrentExecutionContainer::publishSceneState(uint64_t frameIndex)
+    {
+        NAU_ASSERT(m_isPipelinedSync);
+        if (!m_isAlive)
+        {
+            return;
+        }
+
+        m_gameSystemInstance->as<IGameScenePipelinedSync&>().publishSceneState(frameIndex);
+
+        lock_(m_publishMutex);
+        m_publishedFrame = frameIndex;
+        m_publishTime = std::chrono::steady_clock::now();
+        if (m_scenePublishedSignal && !m_scenePublishedSignal.isReady())
+        {
+            m_scenePublishedSignal.resolve();
+        }
+    }
+
+    std::chrono::nanoseconds ConcurrentExecutionContainer::getSceneStateLatency() const
+    {
+        return std::chrono::nanoseconds{m_sceneStateLatencyNs.load(std::memory_order_relaxed)};
+    }
+
+    async::Task<> ConcurrentExecutionContainer::waitForPublishedSceneState()
+    {
+        async::Task<> publishedTask;
+        {
+            lock_(m_publishMutex);
+            if (m_publishedFrame == m_consumedFrame)
+            {
+                m_scenePublishedSignal = async::TaskSource<>{};
+                publishedTask = m_scenePublishedSignal.getTask();
             }
+        }
 
-        } while (true);
+        if (publishedTask)
+        {
+            co_await publishedTask;
+        }
+        else
+        {
+            // always pump the work queue
+            co_await m_workQueue;
+        }
+
+        lock_(m_publishMutex);
+        m_consumedFrame = m_publishedFrame;
+        m_consumedPublishTime = m_publishTime;
+    }
+
+    void ConcurrentExecutionContainer::recordSceneStateLatency()
+    {
+        if (m_consumedFrame == 0)
+        {
+            return;
+        }
+
+        const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_consumedPublishTime);
+        m_sceneStateLatencyNs.store(latency.count(), std::memory_order_relaxed);
+        diag::CpuProfiler::recordCounter(m_latencyCounterName.c_str(), latency.count() / 1000);
+    }
+
+    void ConcurrentExecutionContainer::waitForNextFixedStep()
+    {
+        using namespace std::chrono;
+
+        NAU_FATAL(m_fixedStepScheduler);
+
+        // the messages are processed while waiting, but the poll can overshoot its timeout by the timer resolution:
+        // the rest of the time (including the spin threshold) is waited by the scheduler pacing
+        const FixedStepScheduler::Settings& settings = m_fixedStepScheduler->getSettings();
+        const nanoseconds pacingTime = (settings.pacing == FixedStepPacing::SpinThenSleep ? settings.spinThreshold : nanoseconds{0}) + milliseconds{1};
+        const nanoseconds pollTime = duration_cast<nanoseconds>(m_fixedStepScheduler->getNextStepTime() - FixedStepScheduler::Clock::now()) - pacingTime;
+
+        if (pollTime >= milliseconds{1})
+        {
+            m_workQueue->poll(eastl::chrono::milliseconds{duration_cast<milliseconds>(pollTime).count()});
+        }
+
+        if (!m_isAlive)
+        {
+            m_nextFixedStepSignal.resolve();
+            return;
+        }
+
+        if (FixedStepScheduler::Clock::now() + pacingTime >= m_fixedStepScheduler->getNextStepTime())
+        {
+            m_fixedStepScheduler->waitForNextStep();
+            m_nextFixedStepSignal.resolve();
+        }
     }
 
 }  // namespace nau
@@ -4,8 +4,10 @@
 #pragma once
 #include "nau/async/task_base.h"
 #include "nau/async/work_queue.h"
+#include "nau/app/main_loop/fixed_step_scheduler.h"
 #include "nau/dispatch/class_descriptor.h"
 #include "nau/service/service.h"
+#include "nau/string/name_id.h"
 #include "nau/threading/event.h"
 
 namespace nau
@@ -20,10 +22,28 @@ namespace nau
 
         async::Task<> preInitService() override;
 
+        /**
+            @brief The system implements IGameScenePipelinedSync and the pipelined sync is enabled: publishSceneState must be called every game step.
+         */
+        bool isPipelinedSync() const;
+
+        /**
+            @brief Host thread: publishes the scene state of the pipelined system and wakes up the system thread if it waits for the new state.
+         */
+        void publishSceneState(uint64_t frameIndex);
+
+        /**
+            @brief The time from the scene state publication to the end of the system update that consumed it.
+         */
+        std::chrono::nanoseconds getSceneStateLatency() const;
+
     private:
         async::Task<> initService() override;
         async::Task<> shutdownService() override;
         async::Task<> executeGameSystem();
+        void waitForNextFixedStep();
+        async::Task<> waitForPublishedSceneState();
+        void recordSceneStateLatency();
 
         const IClassDescriptor::Ptr m_systemClass;
         std::thread m_thread;
@@ -36,6 +56,20 @@ namespace nau
         std::atomic<bool> m_isShutdownCompleted = false;
         eastl::optional<threading::Event> m_initSignal;
         IRttiObject* m_gameSystemInstance = nullptr;
+
+        // the scheduler and the signal are used only from the system thread
+        eastl::optional<FixedStepScheduler> m_fixedStepScheduler;
+        async::TaskSource<> m_nextFixedStepSignal = nullptr;
+
+        bool m_isPipelinedSync = false;
+        NameId m_latencyCounterName;
+        std::mutex m_publishMutex;
+        uint64_t m_publishedFrame = 0;
+        std::chrono::steady_clock::time_point m_publishTime;
+        async::TaskSource<> m_scenePublishedSignal = nullptr;
+        uint64_t m_consumedFrame = 0;
+        std::chrono::steady_clock::time_point m_consumedPublishTime;
+        std::atomic<int64_t> m_sceneStateLatencyNs = 0;
     };
 
 }  // namespace nau
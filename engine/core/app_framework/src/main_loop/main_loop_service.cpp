@@ -5,6 +5,7 @@
 #include "main_loop_service.h"
 
 #include "nau/gui/dag_imgui.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
@@ -88,6 +89,9 @@ namespace nau
 
     async::Task<> MainLoopService::preInitService()
     {
+        NAU_ASSERT(FrameArenaAllocator::getFrameArena() == nullptr, "Frame arena is already installed");
+        FrameArenaAllocator::setFrameArena(&m_frameArena);
+
         if (auto serviceWithPreUpdate = getServiceProvider().getAll<IGamePreUpdate>(); !serviceWithPreUpdate.empty())
         {
             const auto offset = m_preUpdate.size();
@@ -130,6 +134,11 @@ namespace nau
 
     async::Task<> MainLoopService::shutdownService()
     {
+        if (FrameArenaAllocator::getFrameArena() == &m_frameArena)
+        {
+            FrameArenaAllocator::setFrameArena(nullptr);
+        }
+
         return async::makeResolvedTask();
     }
 
@@ -141,32 +150,145 @@ namespace nau
         }
     }
 
-    void MainLoopService::doGameStep(float dt)
+    void MainLoopService::addFramePhase(FramePhaseDesc phase)
+    {
+        NAU_ASSERT(!m_frameGraphIsBuilt, "Frame phases can not be added after the first game step");
+        m_leadingPhases.push_back(std::move(phase));
+    }
+
+    const FrameTaskGraph& MainLoopService::getFrameGraph() const
+    {
+        return m_frameGraph;
+    }
+
+    void MainLoopService::buildFrameGraph()
     {
         using namespace std::chrono;
+        using namespace nau::string_literals;
 
-        const milliseconds msDt{static_cast<milliseconds::rep>(1000.f * dt)};
+        NAU_ASSERT(!m_frameGraphIsBuilt);
+        m_frameGraphIsBuilt = true;
 
-        for (IGamePreUpdate* const preUpdate : m_preUpdate)
+        for (FramePhaseDesc& phase : m_leadingPhases)
         {
-            preUpdate->gamePreUpdate(msDt);
+            m_frameGraph.addPhase(std::move(phase));
+        }
+        m_leadingPhases.clear();
+
+        // the systems that do not declare the data they access are updated exclusively on the host thread (as before)
+        const auto makeSystemPhase = [](std::string_view prefix, size_t index, eastl::optional<GameSystemDataAccess> dataAccess)
+        {
+            const std::string name = ::fmt::format("{}[{}]", prefix, index);
+
+            FramePhaseDesc phase;
+            phase.name = NameId{eastl::string_view{name.data(), name.size()}};
+            phase.exclusive = !dataAccess;
+            phase.mainThreadOnly = !dataAccess;
+            if (dataAccess)
+            {
+                phase.reads = std::move(dataAccess->reads);
+                phase.writes = std::move(dataAccess->writes);
+            }
+
+            return phase;
+        };
+
+        for (size_t i = 0; i < m_preUpdate.size(); ++i)
+        {
+            IGamePreUpdate* const preUpdate = m_preUpdate[i];
+            FramePhaseDesc phase = makeSystemPhase("gamePreUpdate", i, preUpdate->getPreUpdateDataAccess());
+            phase.callback = [preUpdate](float dt)
+            {
+                preUpdate->gamePreUpdate(round<milliseconds>(duration<float>{dt}));
+            };
+
+            m_frameGraph.addPhase(std::move(phase));
         }
 
         if (m_sceneManager != nullptr)
         {
-            m_sceneManager->update(dt);
+            // the scene components also create and remove the vfx instances
+            FramePhaseDesc scenePhase;
+            scenePhase.name = "sceneManager update"_name;
+            scenePhase.writes = {"scene"_name, "vfx"_name};
+            scenePhase.mainThreadOnly = true;
+            scenePhase.callback = [this](float dt)
+            {
+                m_sceneManager->update(dt);
+            };
+
+            m_frameGraph.addPhase(std::move(scenePhase));
+        }
+
+        for (size_t i = 0; i < m_postUpdate.size(); ++i)
+        {
+            IGamePostUpdate* const postUpdate = m_postUpdate[i];
+            FramePhaseDesc phase = makeSystemPhase("gamePostUpdate", i, postUpdate->getPostUpdateDataAccess());
+            phase.callback = [postUpdate](float dt)
+            {
+                postUpdate->gamePostUpdate(round<milliseconds>(duration<float>{dt}));
+            };
+
+            m_frameGraph.addPhase(std::move(phase));
         }
 
-        for (IGamePostUpdate* const postUpdate : m_postUpdate)
+        FramePhaseDesc imguiPhase;
+        imguiPhase.name = "imgui"_name;
+        imguiPhase.exclusive = true;
+        imguiPhase.mainThreadOnly = true;
+        imguiPhase.callback = [](float)
         {
-            postUpdate->gamePostUpdate(msDt);
+            if (imgui_get_state() != ImGuiState::OFF)
+            {
+                imgui_cache_render_data();
+                imgui_update();
+            }
+        };
+
+        m_frameGraph.addPhase(std::move(imguiPhase));
+
+        // the pipelined systems get the scene state (and the imgui draw data) only at this sync point, the host thread is not blocked
+        eastl::vector<ConcurrentExecutionContainer*> pipelinedContainers;
+        for (auto& container : m_concurrentContainers)
+        {
+            if (container->isPipelinedSync())
+            {
+                pipelinedContainers.push_back(container.get());
+            }
         }
 
-        if (imgui_get_state() != ImGuiState::OFF)
+        if (!pipelinedContainers.empty())
         {
-            imgui_cache_render_data();
-            imgui_update();
+            FramePhaseDesc publishPhase;
+            publishPhase.name = "publishSceneState"_name;
+            publishPhase.reads = {"scene"_name};
+            publishPhase.mainThreadOnly = true;
+            publishPhase.callback = [this, containers = std::move(pipelinedContainers)](float)
+            {
+                ++m_publishedFrameIndex;
+                for (ConcurrentExecutionContainer* const container : containers)
+                {
+                    container->publishSceneState(m_publishedFrameIndex);
+                }
+            };
+
+            m_frameGraph.addPhase(std::move(publishPhase));
+        }
+    }
+
+    void MainLoopService::doGameStep(float dt)
+    {
+        NAU_PROFILING_FRAME_END;
+        NAU_CPU_SCOPED;
+
+        if (!m_frameGraphIsBuilt)
+        {
+            buildFrameGraph();
         }
-        
+
+        // the memory of the frame that was started MaxFramesInFlight frames ago is reused by this frame
+        [[maybe_unused]] const bool frameIsPrepared = m_frameArena.prepareFrame();
+
+        m_frameGraph.run(dt);
     }
 }  // namespace nau
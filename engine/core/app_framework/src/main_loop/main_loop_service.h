@@ -5,7 +5,9 @@
 
 #include "app/platform_window_service.h"
 #include "concurrent_execution_container.h"
+#include "nau/app/main_loop/frame_task_graph.h"
 #include "nau/app/main_loop/game_system.h"
+#include "nau/memory/frame_allocator.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/scene/internal/scene_manager_internal.h"
 #include "nau/service/service.h"
@@ -20,6 +22,14 @@ namespace nau
     public:
         void doGameStep(float dt);
 
+        /**
+            @brief Adds the phase that runs before the game systems updates (the conflicting phases keep this order).
+            Must be called before the first game step.
+         */
+        void addFramePhase(FramePhaseDesc phase);
+
+        const FrameTaskGraph& getFrameGraph() const;
+
         async::Task<> shutdownMainLoop();
 
     private:
@@ -33,12 +43,22 @@ namespace nau
         }
         async::Task<> shutdownService() override;
 
+        void buildFrameGraph();
+
         eastl::vector<IGamePreUpdate*> m_preUpdate;
         eastl::vector<IGamePostUpdate*> m_postUpdate;
         eastl::vector<IGameSceneUpdate*> m_sceneUpdate;
         eastl::vector<eastl::unique_ptr<ConcurrentExecutionContainer> > m_concurrentContainers;
 
         scene::ISceneManagerInternal* m_sceneManager = nullptr;
+
+        eastl::vector<FramePhaseDesc> m_leadingPhases;
+        FrameTaskGraph m_frameGraph;
+        bool m_frameGraphIsBuilt = false;
+        uint64_t m_publishedFrameIndex = 0;
+
+        // the frame data can be read by the pipelined systems while the next frames are updated
+        FrameArenaAllocator m_frameArena{FrameArenaAllocator::MaxFramesInFlight};
     };
 
 }  // namespace nau
@@ -0,0 +1,180 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/app/application.h"
+#include "nau/app/global_properties.h"
+#include "nau/app/headless_application.h"
+#include "nau/diag/process_memory.h"
+#include "nau/diag/startup_trace.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/service/service_provider.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        struct HeadlessAppBenchmarkResults
+        {
+            std::chrono::microseconds startupTime{0};
+            diag::ProcessMemoryInfo memoryBeforeStartup;
+            diag::ProcessMemoryInfo memoryAfterStartup;
+            uint32_t stepsCount = 0;
+            eastl::vector<uint64_t> frameArenaFrames;
+        };
+
+        /**
+            The headless application without modules: runs the specified ticks count and stops.
+            Collects the startup time and the memory footprint.
+         */
+        class BenchmarkHeadlessAppDelegate final : public ApplicationDelegate
+        {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            BenchmarkHeadlessAppDelegate(HeadlessAppConfig config, uint32_t ticksCount, HeadlessAppBenchmarkResults& results) :
+                m_config(std::move(config)),
+                m_ticksCount(ticksCount),
+                m_results(results)
+            {
+            }
+
+        private:
+            bool isHeadless() const override
+            {
+                return true;
+            }
+
+            eastl::string getModulesListString() const override
+            {
+                return {};
+            }
+
+            Result<> configureApplication() override
+            {
+                m_startTime = Clock::now();
+                m_results.memoryBeforeStartup = diag::getProcessMemoryInfo();
+
+                return getServiceProvider().get<GlobalProperties>().setValue("/app/headless", m_config);
+            }
+
+            Result<> initializeServices() override
+            {
+                return ResultSuccess;
+            }
+
+            void onApplicationInitialized() override
+            {
+                m_results.startupTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_startTime);
+                m_results.memoryAfterStartup = diag::getProcessMemoryInfo();
+            }
+
+            async::Task<> startupApplication() override
+            {
+                return async::Task<>::makeResolved();
+            }
+
+            void onApplicationStep([[maybe_unused]] std::chrono::milliseconds dt) override
+            {
+                if (FrameArenaAllocator* const frameArena = FrameArenaAllocator::getFrameArena())
+                {
+                    // fire and forget: the memory is released with the frame
+                    auto* const values = new (frameArena->allocate(sizeof(FrameArenaVector<uint32_t>))) FrameArenaVector<uint32_t>;
+                    values->push_back(m_results.stepsCount);
+
+                    m_results.frameArenaFrames.push_back(frameArena->getStatistics().frame);
+                }
+
+                if (++m_results.stepsCount == m_ticksCount)
+                {
+                    getApplication().stop();
+                }
+            }
+
+            const HeadlessAppConfig m_config;
+            const uint32_t m_ticksCount;
+            HeadlessAppBenchmarkResults& m_results;
+            Clock::time_point m_startTime;
+        };
+    }  // namespace
+
+    /**
+        Test:
+            The services initialization is recorded by the startup trace.
+            The startup time (no modules) is reported as the test property only:
+            the application runs inside the test process that is already warmed up by the other tests,
+            so the number is not a cold start and is not compared against a budget.
+     */
+    TEST(TestHeadlessApp, StartupTrace)
+    {
+        diag::resetStartupTrace();
+
+        HeadlessAppBenchmarkResults results;
+        ASSERT_EQ(runHeadlessApplication(eastl::make_unique<BenchmarkHeadlessAppDelegate>(HeadlessAppConfig{.tickRate = 100}, 1, results)), 0);
+
+        const auto trace = diag::getStartupTrace();
+        const bool hasServicesInit = std::any_of(trace.begin(), trace.end(), [](const diag::StartupTraceEntry& entry)
+        {
+            return entry.stage == diag::StartupStage::ServiceInit;
+        });
+
+        ASSERT_TRUE(hasServicesInit);
+        RecordProperty("startup_us", static_cast<int>(results.startupTime.count()));
+    }
+
+    /**
+        Test:
+            The main loop installs the frame arena for the application lifetime and starts the new arena frame every game step.
+     */
+    TEST(TestHeadlessApp, MainLoopAdvancesFrameArena)
+    {
+        constexpr uint32_t TicksCount = 5;
+
+        HeadlessAppBenchmarkResults results;
+        ASSERT_EQ(runHeadlessApplication(eastl::make_unique<BenchmarkHeadlessAppDelegate>(HeadlessAppConfig{.tickRate = 1000}, TicksCount, results)), 0);
+
+        ASSERT_EQ(results.frameArenaFrames.size(), TicksCount);
+        for (size_t i = 1; i < results.frameArenaFrames.size(); ++i)
+        {
+            ASSERT_EQ(results.frameArenaFrames[i], results.frameArenaFrames[i - 1] + 1);
+        }
+
+        ASSERT_EQ(FrameArenaAllocator::getFrameArena(), nullptr);
+    }
+
+    /**
+        Test:
+            The client modules (window, render and graphics, audio, input) are removed from the headless modules list.
+     */
+    TEST(TestHeadlessApp, ClientModulesAreExcluded)
+    {
+        ASSERT_EQ(filterHeadlessModulesList("CoreScene, Graphics,Audio , coreinput,PlatformApp,Render,Network,"), eastl::string{"CoreScene,Network"});
+        ASSERT_EQ(filterHeadlessModulesList(HeadlessModulesList), eastl::string{HeadlessModulesList});
+        ASSERT_TRUE(filterHeadlessModulesList(HeadlessExcludedModules).empty());
+    }
+
+    /**
+        Benchmark:
+            The headless application startup time and memory footprint (reported as the test properties).
+     */
+    TEST(TestHeadlessApp, StartupTimeAndMemory)
+    {
+        constexpr uint32_t TickRate = 100;
+        constexpr uint32_t TicksCount = 20;
+
+        HeadlessAppBenchmarkResults results;
+        const HeadlessAppConfig config{.tickRate = TickRate, .reportInterval = TicksCount / 2};
+
+        ASSERT_EQ(runHeadlessApplication(eastl::make_unique<BenchmarkHeadlessAppDelegate>(config, TicksCount, results)), 0);
+        ASSERT_EQ(results.stepsCount, TicksCount);
+
+        const size_t residentBefore = results.memoryBeforeStartup.residentBytes;
+        const size_t residentAfter = results.memoryAfterStartup.residentBytes;
+
+        RecordProperty("startup_us", static_cast<int>(results.startupTime.count()));
+        RecordProperty("startup_resident_kb", static_cast<int>(residentAfter / 1024));
+        RecordProperty("startup_memory_growth_kb", static_cast<int>((residentAfter - std::min(residentAfter, residentBefore)) / 1024));
+        RecordProperty("peak_resident_kb", static_cast<int>(results.memoryAfterStartup.peakResidentBytes / 1024));
+    }
+
+}  // namespace nau::test
@@ -0,0 +1,110 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <chrono>
+#include <optional>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau
+{
+    /**
+     * @brief How FixedStepScheduler::waitForNextStep waits for the time of the next step.
+     */
+    enum class FixedStepPacing
+    {
+        /**
+         * @brief Only sleeps: the step can start later by the OS timer resolution (up to the several milliseconds on Windows).
+         */
+        Sleep,
+
+        /**
+         * @brief Sleeps until the spin threshold before the step time, and then spins (yielding the thread) until the exact time.
+         */
+        SpinThenSleep
+    };
+
+    /**
+     * @brief Fixed time step accumulator: the real time is accumulated with nanosecond precision and consumed by the fixed steps.
+     *
+     * The steady clock is used by default, but all methods that depend on the time accept the time point explicitly:
+     * the game system can be stepped by the virtual clock (deterministically in the tests).
+     */
+    class NAU_KERNEL_EXPORT FixedStepScheduler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Settings
+        {
+            std::chrono::nanoseconds step = std::chrono::nanoseconds{1'000'000'000 / 60};
+
+            /**
+             * @brief The maximum steps advance() can return: if the simulation can not keep up, the rest of the time is dropped
+             * (the game slows down instead of the spiral of death).
+             */
+            uint32_t maxStepsPerAdvance = 4;
+
+            /**
+             * @brief The longer time between the advances (the debugger break, the window dragging) is clamped.
+             */
+            std::chrono::nanoseconds maxElapsedTime = std::chrono::milliseconds{250};
+
+            FixedStepPacing pacing = FixedStepPacing::SpinThenSleep;
+            std::chrono::nanoseconds spinThreshold = std::chrono::milliseconds{2};
+        };
+
+        explicit FixedStepScheduler(Settings settings = {});
+
+        /**
+         * @brief Drops the accumulated time and starts the accumulation from the specified time.
+         */
+        void reset(Clock::time_point now = Clock::now());
+
+        /**
+         * @brief Accumulates the time elapsed since the last advance and returns how many fixed steps must be executed now.
+         *
+         * The first advance (without reset) only starts the accumulation and returns 0.
+         */
+        uint32_t advance(Clock::time_point now = Clock::now());
+
+        /**
+         * @brief The part of the step accumulated but not simulated yet [0, 1): the state to render can be interpolated
+         * between the previous and the last step states with this factor.
+         */
+        float getInterpolationAlpha() const;
+
+        std::chrono::nanoseconds getStep() const;
+
+        const Settings& getSettings() const;
+
+        /**
+         * @brief Total steps returned by all advances.
+         */
+        uint64_t getStepsCount() const;
+
+        /**
+         * @brief Total time that was dropped because of maxStepsPerAdvance and maxElapsedTime limits.
+         */
+        std::chrono::nanoseconds getDroppedTime() const;
+
+        /**
+         * @brief The time point when the next step becomes due.
+         */
+        Clock::time_point getNextStepTime() const;
+
+        /**
+         * @brief Blocks the calling thread until the next step time (by the real steady clock) according to the pacing mode.
+         */
+        void waitForNextStep() const;
+
+    private:
+        Settings m_settings;
+        std::optional<Clock::time_point> m_lastTime;
+        std::chrono::nanoseconds m_accumulator{0};
+        std::chrono::nanoseconds m_droppedTime{0};
+        uint64_t m_stepsCount = 0;
+    };
+}  // namespace nau
@@ -0,0 +1,139 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include "nau/async/executor.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/string/name_id.h"
+#include "nau/utils/functor.h"
+
+namespace nau
+{
+    /**
+     * @brief Describes a phase of the frame: the work and the data it accesses.
+     */
+    struct FramePhaseDesc
+    {
+        /**
+         * @brief The name the phase is shown with in the profiler and the statistics.
+         */
+        NameId name;
+
+        /**
+         * @brief The data (any names agreed by the systems: "scene", "ui", "input" ...) the phase only reads.
+         */
+        eastl::vector<NameId> reads;
+
+        /**
+         * @brief The data the phase modifies.
+         */
+        eastl::vector<NameId> writes;
+
+        /**
+         * @brief The phase that does not declare its data access conflicts with every other phase.
+         */
+        bool exclusive = false;
+
+        /**
+         * @brief The phase runs on the thread that calls FrameTaskGraph::run (the host thread).
+         */
+        bool mainThreadOnly = false;
+
+        Functor<void(float dt)> callback;
+    };
+
+    /**
+     * @brief Per frame graph of the phases: the phases that do not conflict over the data run concurrently on the default executor.
+     *
+     * The phases conflict when one of them writes the data the other reads or writes (or one of them is exclusive).
+     * Conflicting phases run in the order they were added, so adding the phases in the former serial order keeps the behavior
+     * for the phases that declare nothing. Frame time approaches the critical path of the graph instead of the sum of the phases.
+     */
+    class NAU_KERNEL_EXPORT FrameTaskGraph
+    {
+    public:
+        using PhaseId = uint32_t;
+
+        struct PhaseTiming
+        {
+            NameId name;
+            uint64_t beginNs = 0;
+            uint64_t durationNs = 0;
+        };
+
+        struct FrameStatistics
+        {
+            uint64_t wallNs = 0;
+
+            /**
+             * @brief The sum of the phases durations: the frame time of the serial execution.
+             */
+            uint64_t sumNs = 0;
+
+            /**
+             * @brief The longest chain of dependent phases: the lower bound of the frame time.
+             */
+            uint64_t criticalPathNs = 0;
+
+            /**
+             * @brief In the order the phases were added.
+             */
+            eastl::vector<PhaseTiming> phases;
+        };
+
+        FrameTaskGraph();
+        ~FrameTaskGraph();
+
+        FrameTaskGraph(const FrameTaskGraph&) = delete;
+        FrameTaskGraph& operator=(const FrameTaskGraph&) = delete;
+
+        /**
+         * @brief Adds the phase after all phases added before it. Must not be called while the graph is running.
+         */
+        PhaseId addPhase(FramePhaseDesc desc);
+
+        size_t getPhasesCount() const;
+
+        /**
+         * @brief Runs all phases and returns when all of them are completed.
+         *
+         * Without the default executor all phases run on the calling thread in the order they were added.
+         */
+        void run(float dt);
+
+        const FrameStatistics& getLastFrameStatistics() const;
+
+    private:
+        struct Phase;
+
+        static void executePhaseInvocation(void* graph, void* phaseIndex) noexcept;
+
+        void schedulePhase(uint32_t phaseIndex);
+
+        void runPhases(uint32_t phaseIndex);
+
+        bool runsOnMainThread(const Phase& phase) const;
+
+        void collectStatistics(uint64_t frameBeginNs, uint64_t frameEndNs);
+
+        eastl::vector<std::unique_ptr<Phase>> m_phases;
+        eastl::vector<uint32_t> m_rootPhases;
+
+        float m_dt = 0.f;
+        async::Executor::Ptr m_executor;
+
+        std::mutex m_mutex;
+        std::condition_variable m_signal;
+        eastl::vector<uint32_t> m_mainThreadQueue;
+        size_t m_completedCount = 0;
+
+        FrameStatistics m_lastFrameStatistics;
+    };
+}  // namespace nau
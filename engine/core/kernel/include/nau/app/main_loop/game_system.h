@@ -3,12 +3,14 @@
 
 #pragma once
 #include <EASTL/optional.h>
+#include <EASTL/vector.h>
 
 #include <chrono>
 
 #include "nau/async/task_base.h"
 #include "nau/meta/attribute.h"
 #include "nau/rtti/type_info.h"
+#include "nau/string/name_id.h"
 #include "nau/utils/enum/enum_reflection.h"
 
 namespace nau
@@ -39,6 +41,15 @@ namespace nau
      */
     NAU_DEFINE_ATTRIBUTE_(GameSystemName)
 
+    /**
+        @brief The data (names agreed by the systems) the pre/post update accesses.
+     */
+    struct GameSystemDataAccess
+    {
+        eastl::vector<NameId> reads;
+        eastl::vector<NameId> writes;
+    };
+
     struct NAU_ABSTRACT_TYPE IGamePreUpdate
     {
         NAU_TYPEID(nau::IGamePreUpdate)
@@ -46,6 +57,15 @@ namespace nau
         virtual ~IGamePreUpdate() = default;
 
         virtual void gamePreUpdate(std::chrono::milliseconds dt) = 0;
+
+        /**
+            @brief The updates that do not conflict over the data run concurrently on the worker threads (see FrameTaskGraph).
+            The update of the system that does not declare the data runs exclusively on the host thread.
+         */
+        virtual eastl::optional<GameSystemDataAccess> getPreUpdateDataAccess() const
+        {
+            return eastl::nullopt;
+        }
     };
 
     struct NAU_ABSTRACT_TYPE IGamePostUpdate
@@ -55,6 +75,14 @@ namespace nau
         virtual ~IGamePostUpdate() = default;
 
         virtual void gamePostUpdate(std::chrono::milliseconds dt) = 0;
+
+        /**
+            @brief See IGamePreUpdate::getPreUpdateDataAccess.
+         */
+        virtual eastl::optional<GameSystemDataAccess> getPostUpdateDataAccess() const
+        {
+            return eastl::nullopt;
+        }
     };
 
     /**
@@ -64,16 +92,47 @@ namespace nau
         NAU_TYPEID(nau::IGameSceneUpdate)
 
         /**
+            @brief Updates the system. With the fixed time step dt is always equal to the step.
          */
-        virtual async::Task<bool> update(std::chrono::milliseconds dt) = 0;
+        virtual async::Task<bool> update(std::chrono::nanoseconds dt) = 0;
 
         /**
+            @brief The step the system is updated with (see FixedStepScheduler), or nullopt to update as fast as possible with the real dt.
          */
-        virtual eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() = 0;
+        virtual eastl::optional<std::chrono::nanoseconds> getFixedUpdateTimeStep() = 0;
 
         /**
          */
         virtual void syncSceneState() = 0;
+
+        /**
+            @brief Called (for the fixed time step systems) before syncSceneState with the part of the step that was accumulated but not simulated yet.
+            The state passed to the scene (and to the rendering) can be interpolated between the two last steps with this factor.
+         */
+        virtual void setInterpolationAlpha([[maybe_unused]] float alpha)
+        {
+        }
+    };
+
+    /**
+        @brief Optional interface of the concurrent scene update system: the pipelined scene state sync.
+
+        When the pipelined sync is enabled ("/app/pipelinedSceneSync" global property), the system thread does not wait for the host thread
+        to call syncSceneState: the host thread publishes the scene state (into the system's snapshot buffer) at the end of every game step,
+        and the system consumes the latest published state in its update. The simulation of the next frame runs while the system processes
+        the previous one. Without the pipelined sync the system is synchronized with syncSceneState as usual.
+     */
+    struct NAU_ABSTRACT_TYPE IGameScenePipelinedSync
+    {
+        NAU_TYPEID(nau::IGameScenePipelinedSync)
+
+        virtual ~IGameScenePipelinedSync() = default;
+
+        /**
+            @brief Called on the host thread after the scene update (and the post updates) of every game step.
+            Can read the scene (and reset the components change tracking), but must not touch the data that the system thread uses.
+         */
+        virtual void publishSceneState(uint64_t frameIndex) = 0;
     };
 
 }  // namespace nau
@@ -0,0 +1,88 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/diag/assertion.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/rtti/ptr.h"
+#include "nau/rtti/rtti_object.h"
+
+namespace nau::async
+{
+    /**
+        @brief Value that flows with an asynchronous operation (i.e. the asset load started on behalf of the scene).
+
+        The Task<> coroutine captures the context that is current when the coroutine starts
+        and makes it current again each time the coroutine is resumed, so the context survives co_await and executor switches.
+        When the coroutine suspends or finishes the context of the resuming thread is restored.
+
+        Contexts are chained: an implementation keeps the context that was current at its creation as the parent,
+        find<T>() returns the nearest context of the requested type.
+     */
+    class NAU_ABSTRACT_TYPE AsyncContext : public virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::async::AsyncContext, IRefCounted)
+
+    public:
+        using Ptr = nau::Ptr<AsyncContext>;
+
+        /**
+            @brief Returns the context that is current on this thread or nullptr.
+         */
+        NAU_KERNEL_EXPORT static AsyncContext* getCurrent();
+
+        /**
+            @brief Makes the context current on this thread. The caller keeps the context alive while it is current.
+
+            @return The previously current context.
+         */
+        NAU_KERNEL_EXPORT static AsyncContext* setCurrent(AsyncContext* context);
+
+        template <typename T>
+        static T* find()
+        {
+            for (AsyncContext* context = getCurrent(); context; context = context->getParent())
+            {
+                if (T* const value = context->as<T*>())
+                {
+                    return value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        virtual AsyncContext* getParent() const = 0;
+    };
+
+    /**
+        @brief Makes the context current on this thread for the lifetime of the scope.
+        Within the Task<> coroutine the scope can span co_await: the context is kept by the coroutine while it is suspended.
+     */
+    class AsyncContextScope
+    {
+    public:
+        AsyncContextScope(AsyncContext::Ptr context) :
+            m_context(std::move(context)),
+            m_previousContext(AsyncContext::setCurrent(m_context.get()))
+        {
+        }
+
+        AsyncContextScope(const AsyncContextScope&) = delete;
+
+        ~AsyncContextScope()
+        {
+            [[maybe_unused]] AsyncContext* const context = AsyncContext::setCurrent(m_previousContext.get());
+            NAU_ASSERT(context == m_context.get(), "Async contexts must be restored in the reverse order");
+        }
+
+        AsyncContextScope& operator=(const AsyncContextScope&) = delete;
+
+    private:
+        const AsyncContext::Ptr m_context;
+        const AsyncContext::Ptr m_previousContext;
+    };
+
+}  // namespace nau::async
@@ -118,6 +118,14 @@ namespace nau::async
 
         virtual void waitAnyActivity() noexcept = 0;
 
+        /**
+            @brief Number of the threads that run invocations concurrently.
+         */
+        virtual size_t getConcurrency() const noexcept
+        {
+            return 1;
+        }
+
     protected:
         NAU_KERNEL_EXPORT static void invoke(Executor&, Invocation) noexcept;
 
@@ -7,6 +7,7 @@
 #include <optional>
 #include <tuple>
 
+#include "nau/async/async_context.h"
 #include "nau/async/async_timer.h"
 #include "nau/async/core/core_task_linked_list.h"
 #include "nau/async/cpp_coroutine.h"
@@ -254,6 +255,82 @@ namespace nau::async_detail
         }
     };
 
+    /**
+        Keeps the async context of the coroutine (see async::AsyncContext).
+        The coroutine starts in the context of the caller. When the coroutine suspends its current context is remembered
+        and the context of the thread is restored, when the coroutine is resumed the remembered context is made current again.
+     */
+    class TaskAsyncContextState
+    {
+    public:
+        TaskAsyncContextState() = default;
+        TaskAsyncContextState(const TaskAsyncContextState&) = delete;
+
+        ~TaskAsyncContextState()
+        {
+            leave();
+        }
+
+        TaskAsyncContextState& operator=(const TaskAsyncContextState&) = delete;
+
+        /**
+            Is called when the coroutine is resumed and before the suspended coroutine is destroyed:
+            the destructors of the coroutine's locals (i.e. AsyncContextScope) must run in its context.
+         */
+        void enter() noexcept
+        {
+            if (!m_isEntered)
+            {
+                m_outerContext = async::AsyncContext::setCurrent(m_context.get());
+                m_isEntered = true;
+            }
+        }
+
+        void leave() noexcept
+        {
+            if (m_isEntered)
+            {
+                m_context = async::AsyncContext::setCurrent(m_outerContext);
+                m_outerContext = nullptr;
+                m_isEntered = false;
+            }
+        }
+
+    private:
+        async::AsyncContext::Ptr m_context;
+        async::AsyncContext* m_outerContext = async::AsyncContext::getCurrent();
+        bool m_isEntered = true;
+    };
+
+    /**
+        Wraps the awaiter of the Task<> coroutine: leaves the coroutine's async context before suspension and enters it on resume.
+     */
+    template <typename Awaiter>
+    struct AsyncContextAwaiter
+    {
+        Awaiter awaiter;
+        TaskAsyncContextState& contextState;
+
+        bool await_ready()
+        {
+            return awaiter.await_ready();
+        }
+
+        template <typename Promise>
+        decltype(auto) await_suspend(std::coroutine_handle<Promise> coroutine)
+        {
+            // Must be done before the suspension: the awaiter can resume (on other thread) or destroy the coroutine.
+            contextState.leave();
+            return awaiter.await_suspend(coroutine);
+        }
+
+        decltype(auto) await_resume()
+        {
+            contextState.enter();
+            return awaiter.await_resume();
+        }
+    };
+
     /**
 
     */
@@ -262,6 +339,8 @@ namespace nau::async_detail
     {
         async::TaskSource<T> taskSource;
 
+        TaskAsyncContextState asyncContext;
+
         // There is need to reject task ONLY when coroutine will be actually destroyed.
         Error::Ptr errorOnDestroy;
 
@@ -324,90 +403,97 @@ namespace nau::async_detail
             Task<>&& awaiter
         */
         template <typename U>
-        static TaskAwaiter<U> await_transform(async::Task<U>&& task) noexcept
+        AsyncContextAwaiter<TaskAwaiter<U>> await_transform(async::Task<U>&& task) noexcept
         {
-            return {std::move(task)};
+            return withAsyncContext(TaskAwaiter<U>{std::move(task)});
         }
 
         /**
             Task<> awaiter
         */
         template <typename U>
-        static TaskAwaiter<U> await_transform(async::Task<U>& task) noexcept
+        AsyncContextAwaiter<TaskAwaiter<U>> await_transform(async::Task<U>& task) noexcept
         {
-            return {task};
+            return withAsyncContext(TaskAwaiter<U>{task});
         }
 
         template <typename U>
-        static TaskTryAwaiter<U> await_transform(async::TaskTryWrapper<U> tryWrapper)
+        AsyncContextAwaiter<TaskTryAwaiter<U>> await_transform(async::TaskTryWrapper<U> tryWrapper)
         {
-            return TaskTryAwaiter<U>{std::move(tryWrapper).getCoreTaskPtr()};
+            return withAsyncContext(TaskTryAwaiter<U>{std::move(tryWrapper).getCoreTaskPtr()});
         }
 
         /**
             Scheduler awaiter:
         */
-        static async::ExecutorAwaiter await_transform(async::ExecutorAwaiter awaiter) noexcept
+        AsyncContextAwaiter<async::ExecutorAwaiter> await_transform(async::ExecutorAwaiter awaiter) noexcept
         {
-            return awaiter;
+            return withAsyncContext(std::move(awaiter));
         }
 
         /**
             Scheduler awaiter:
         */
-        static async::ExecutorAwaiter await_transform(async::Executor::Ptr scheduler) noexcept
+        AsyncContextAwaiter<async::ExecutorAwaiter> await_transform(async::Executor::Ptr scheduler) noexcept
         {
-            return std::move(scheduler);
+            return withAsyncContext(async::ExecutorAwaiter{std::move(scheduler)});
         }
 
         /**
             Scheduler awaiter:
         */
-        static async::ExecutorAwaiter await_transform(async::Executor::WeakPtr scheduler) noexcept
+        AsyncContextAwaiter<async::ExecutorAwaiter> await_transform(async::Executor::WeakPtr scheduler) noexcept
         {
-            return scheduler.acquire();
+            return withAsyncContext(async::ExecutorAwaiter{scheduler.acquire()});
         }
 
         /**
             timeout
         */
         template <typename Rep, typename Period>
-        static DelayAwaiter await_transform(std::chrono::duration<Rep, Period> delay) noexcept
+        AsyncContextAwaiter<DelayAwaiter> await_transform(std::chrono::duration<Rep, Period> delay) noexcept
         {
-            return delay;
+            return withAsyncContext(DelayAwaiter{delay});
         }
 
         /**
             Expiration
         */
-        static ExpirationAwaiter await_transform(Expiration expiration) noexcept
+        AsyncContextAwaiter<ExpirationAwaiter> await_transform(Expiration expiration) noexcept
         {
-            return ExpirationAwaiter{std::move(expiration)};
+            return withAsyncContext(ExpirationAwaiter{std::move(expiration)});
         }
 
         /**
             Result<T>&&
         */
         template <typename U>
-        static RvTaskResultAwaiter<U> await_transform(Result<U>&& result) noexcept
+        AsyncContextAwaiter<RvTaskResultAwaiter<U>> await_transform(Result<U>&& result) noexcept
         {
-            return std::move(result);
+            return withAsyncContext(RvTaskResultAwaiter<U>{std::move(result)});
         }
 
         /**
             Result<T>&
         */
         template <typename U>
-        static LvTaskResultAwaiter<U> await_transform(const Result<U>& result) noexcept
+        AsyncContextAwaiter<LvTaskResultAwaiter<U>> await_transform(const Result<U>& result) noexcept
         {
-            return (result);
+            return withAsyncContext(LvTaskResultAwaiter<U>{result});
         }
 
         template <typename U,
                   std::enable_if_t<async_detail::HasTaskAwait<std::decay_t<U>>, int> = 0>
-        static decltype(auto) await_transform(U&& awaitable)
+        auto await_transform(U&& awaitable)
+        {
+            return withAsyncContext(GetTaskAwait(std::forward<U>(awaitable)));
+        }
+
+    private:
+        template <typename Awaiter>
+        AsyncContextAwaiter<Awaiter> withAsyncContext(Awaiter&& awaiter) noexcept
         {
-            return GetTaskAwait(std::forward<U>(awaitable));
+            return {std::forward<Awaiter>(awaiter), asyncContext};
         }
     };
 
@@ -450,6 +536,7 @@ namespace nau::async_detail
             if (auto error = coreTask->getError())
             {
                 promiseTaskSource.reject(std::move(error));
+                promise.asyncContext.enter();
                 coroutine.destroy();
                 return;
             }
@@ -473,6 +560,7 @@ namespace nau::async_detail
             {
                 auto& adPromise = coro.promise();
                 adPromise.errorOnDestroy = std::move(error);
+                adPromise.asyncContext.enter();
                 coro.destroy();
             }
             else
@@ -520,6 +608,7 @@ namespace nau::async_detail
 
         auto& promise = continuation.promise();
         promise.taskSource.reject(this->result.getError());
+        promise.asyncContext.enter();
         continuation.destroy();
     }
 
@@ -533,6 +622,7 @@ namespace nau::async_detail
 
         auto& promise = continuation.promise();
         promise.taskSource.reject(this->result.getError());
+        promise.asyncContext.enter();
         continuation.destroy();
     }
 
@@ -551,6 +641,7 @@ namespace nau::async_detail
 
             auto& promise = coroutine.promise();
             promise.errorOnDestroy = std::move(error);
+            promise.asyncContext.enter();
             coroutine.destroy();
         }, continuation.address());
     }
@@ -0,0 +1,121 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file cpu_profiler.h
+ * @brief Definition of the CpuProfiler class.
+ */
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/io/stream.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/result.h"
+
+namespace nau::diag
+{
+    /**
+     * @brief Built-in CPU profiler: per thread zones, frame markers, counters and async task events.
+     *
+     * Each thread records its events into its own ring buffer (single writer, no locks), the oldest events are overwritten.
+     * Event names are not copied: they must be string literals or other strings that live until the profiler output is written
+     * (NameId::c_str() can be used for the dynamic names).
+     *
+     * While the profiler is disabled, recording costs a single relaxed atomic load.
+     */
+    class NAU_KERNEL_EXPORT CpuProfiler
+    {
+    public:
+        static constexpr size_t DefaultThreadBufferSize = 64 * 1024;
+        static constexpr size_t MaxFramesHistory = 4096;
+
+        enum class TaskEvent : uint8_t
+        {
+            Begin,
+            Suspend,
+            Resume,
+            End
+        };
+
+        struct ZoneStatistics
+        {
+            const char* name = nullptr;
+            uint64_t count = 0;
+            uint64_t totalNs = 0;
+            uint64_t maxNs = 0;
+        };
+
+        struct FrameStatistics
+        {
+            uint64_t index = 0;
+            uint64_t beginNs = 0;
+            uint64_t durationNs = 0;
+        };
+
+        /**
+         * @brief Records the zone from the construction till the destruction. The zone with the null name is not recorded.
+         */
+        class NAU_KERNEL_EXPORT Zone
+        {
+        public:
+            explicit Zone(const char* name) noexcept;
+            ~Zone();
+
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+
+        private:
+            const char* const m_name;
+            const uint64_t m_beginNs;
+        };
+
+        static void setEnabled(bool enabled);
+
+        [[nodiscard]] static bool isEnabled();
+
+        /**
+         * @brief Sets the capacity (in events) of the thread buffers created after the call.
+         */
+        static void setThreadBufferSize(size_t eventsCount);
+
+        /**
+         * @brief Sets the name the calling thread is shown with in the trace.
+         */
+        static void setThreadName(const char* name);
+
+        /**
+         * @brief Marks the beginning of the next frame. Must be called from the one (main) thread.
+         */
+        static void markFrame();
+
+        static void recordCounter(const char* name, int64_t value);
+
+        /**
+         * @param task Identifies the task in the trace (the events of the same task are shown on the one async track).
+         */
+        static void recordTaskEvent(TaskEvent event, const void* task);
+
+        /**
+         * @brief Drops all recorded events and frames.
+         */
+        static void reset();
+
+        /**
+         * @brief Returns the completed frames (at most MaxFramesHistory last ones), the oldest first.
+         */
+        [[nodiscard]] static eastl::vector<FrameStatistics> getFrames();
+
+        /**
+         * @brief Aggregates the zones kept in the thread buffers by name.
+         */
+        [[nodiscard]] static eastl::vector<ZoneStatistics> getZoneStatistics();
+
+        /**
+         * @brief Writes all kept events in the Chrome trace event format (can be opened by chrome://tracing or Perfetto).
+         */
+        static Result<> writeChromeTrace(io::IStreamWriter& stream);
+
+        [[nodiscard]] static uint64_t getTimeNs();
+    };
+}  // namespace nau::diag
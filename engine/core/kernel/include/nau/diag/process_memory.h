@@ -0,0 +1,29 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/diag/process_memory.h
+
+
+#pragma once
+
+#include <cstddef>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::diag
+{
+    struct ProcessMemoryInfo
+    {
+        /**
+            @brief The physical memory currently used by the process (working set/resident set).
+         */
+        size_t residentBytes = 0;
+
+        /**
+            @brief The maximum of residentBytes since the process start.
+         */
+        size_t peakResidentBytes = 0;
+    };
+
+    NAU_KERNEL_EXPORT ProcessMemoryInfo getProcessMemoryInfo();
+
+}  // namespace nau::diag
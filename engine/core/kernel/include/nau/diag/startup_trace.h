@@ -0,0 +1,91 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/diag/startup_trace.h
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/enum/enum_reflection.h"
+
+namespace nau::diag
+{
+    /**
+     */
+    NAU_DEFINE_ENUM_(
+        StartupStage,
+        ModuleLoad,
+        ModuleInit,
+        ServicePreInit,
+        ServiceInit,
+        Application)
+
+    /**
+        @brief The single traced startup operation: loading of the module, initialization of the service, etc.
+     */
+    struct StartupTraceEntry
+    {
+        using Clock = std::chrono::steady_clock;
+
+        StartupStage stage;
+        eastl::string name;
+        Clock::time_point startTime;
+        std::chrono::nanoseconds duration;
+    };
+
+    /**
+        @brief Records the startup operation (thread safe). The entries are kept until resetStartupTrace() is called.
+     */
+    NAU_KERNEL_EXPORT void recordStartupTrace(StartupStage stage, eastl::string_view name, StartupTraceEntry::Clock::time_point startTime, StartupTraceEntry::Clock::time_point endTime = StartupTraceEntry::Clock::now());
+
+    /**
+        @brief The recorded entries in the recording order.
+     */
+    NAU_KERNEL_EXPORT eastl::vector<StartupTraceEntry> getStartupTrace();
+
+    /**
+        @brief The wall clock time from the start of the first recorded operation to the end of the last one.
+     */
+    NAU_KERNEL_EXPORT std::chrono::nanoseconds getStartupTraceTotalTime();
+
+    NAU_KERNEL_EXPORT void resetStartupTrace();
+
+    /**
+        @brief Human readable report: the total time, the time spent per stage and the slowest operations (at most maxEntries).
+     */
+    NAU_KERNEL_EXPORT eastl::string formatStartupTraceReport(size_t maxEntries = 10);
+
+    /**
+        @brief Records the operation that lasts until the end of the scope.
+     */
+    class StartupTraceScope
+    {
+    public:
+        StartupTraceScope(StartupStage stage, eastl::string_view name) :
+            m_stage(stage),
+            m_name(name),
+            m_startTime(StartupTraceEntry::Clock::now())
+        {
+        }
+
+        StartupTraceScope(const StartupTraceScope&) = delete;
+        StartupTraceScope& operator=(const StartupTraceScope&) = delete;
+
+        ~StartupTraceScope()
+        {
+            recordStartupTrace(m_stage, m_name, m_startTime);
+        }
+
+    private:
+        const StartupStage m_stage;
+        const eastl::string_view m_name;
+        const StartupTraceEntry::Clock::time_point m_startTime;
+    };
+
+}  // namespace nau::diag
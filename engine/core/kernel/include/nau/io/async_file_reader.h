@@ -0,0 +1,131 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/async/task.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/rtti/ptr.h"
+#include "nau/rtti/rtti_object.h"
+#include "nau/utils/cancellation.h"
+#include "nau/utils/result.h"
+
+/**
+ * @brief Provides an engine for issuing many positional file reads at once and awaiting them as tasks.
+ */
+
+namespace nau::io
+{
+    /**
+     * @brief Defines the order in which pending read requests are dispatched to the OS.
+     */
+    enum class AsyncReadPriority : uint8_t
+    {
+        Low,
+        Normal,
+        High
+    };
+
+    /**
+     * @brief Handle of the file opened with IAsyncFileReader::openFile.
+     */
+    enum class AsyncFileHandle : intptr_t
+    {
+        Invalid = -1
+    };
+
+    /**
+     * @brief Describes a single positional read.
+     *
+     * The buffer must stay valid until the task returned for the request is completed.
+     * The cancelled request is rejected if it is still queued, the read that is already issued is completed as usual.
+     */
+    struct AsyncReadRequest
+    {
+        AsyncFileHandle file = AsyncFileHandle::Invalid;
+        uint64_t offset = 0;
+        void* buffer = nullptr;
+        size_t size = 0;
+        AsyncReadPriority priority = AsyncReadPriority::Normal;
+        Cancellation cancellation = Cancellation::none();
+    };
+
+    /**
+     * @brief Settings used to create an async file reader.
+     */
+    struct AsyncFileReaderSettings
+    {
+        /**
+         * @brief Maximum number of native read operations in flight.
+         */
+        unsigned queueDepth = 64;
+
+        /**
+         * @brief Number of threads used by the thread pool backend (0 means default).
+         */
+        unsigned workerThreads = 0;
+
+        /**
+         * @brief Adjacent requests are merged into a single native read while the merged size does not exceed this value.
+         */
+        size_t maxMergedReadSize = 1024 * 1024;
+    };
+
+    /**
+     * @struct IAsyncFileReader
+     * @brief Interface of the engine that keeps many positional reads in flight.
+     *
+     * Requests are dispatched in priority order. Requests of one batch that target adjacent ranges of the same file
+     * are merged into a single vectored read. Each returned task is completed directly from the I/O completion
+     * with the number of bytes read into the request's buffer (less than the requested size only at the end of the file).
+     */
+    struct NAU_ABSTRACT_TYPE IAsyncFileReader : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::io::IAsyncFileReader, IRefCounted)
+
+        using Ptr = nau::Ptr<IAsyncFileReader>;
+
+        /**
+         * @brief Opens the file for reading.
+         * @param path Native path to the file.
+         */
+        virtual Result<AsyncFileHandle> openFile(const char* path) = 0;
+
+        /**
+         * @brief Closes the file. All reads of the file must be completed before the call.
+         */
+        virtual void closeFile(AsyncFileHandle file) = 0;
+
+        /**
+         * @brief Retrieves the size of the opened file.
+         */
+        virtual Result<uint64_t> getFileSize(AsyncFileHandle file) = 0;
+
+        /**
+         * @brief Schedules a single read.
+         */
+        virtual async::Task<size_t> read(const AsyncReadRequest& request) = 0;
+
+        /**
+         * @brief Schedules a batch of reads.
+         * @return Tasks in the same order as the requests.
+         */
+        virtual Vector<async::Task<size_t>> readBatch(eastl::span<const AsyncReadRequest> requests) = 0;
+
+        /**
+         * @brief Returns the name of the backend that performs native reads.
+         */
+        virtual const char* getBackendName() const = 0;
+    };
+
+    /**
+     * @brief Creates an async file reader.
+     *
+     * Reads are performed by a dedicated pool of threads doing blocking positional reads.
+     */
+    NAU_KERNEL_EXPORT
+    IAsyncFileReader::Ptr createAsyncFileReader(const AsyncFileReaderSettings& settings = {});
+}  // namespace nau::io
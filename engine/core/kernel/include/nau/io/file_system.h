@@ -225,6 +225,17 @@ namespace nau::io
          */
         virtual bool isReadOnly() const = 0;
 
+        /**
+         * @brief Checks if the content of the file system can not change while it is mounted (packs, archives).
+         * Read-only does not imply immutable: a read-only native directory can be changed on disk by anyone else.
+         * The lookup results of the immutable file systems can be cached by the virtual file system.
+         * @return True if immutable, otherwise false.
+         */
+        virtual bool isImmutable() const
+        {
+            return false;
+        }
+
         /**
          * @brief Checks if a path exists in the file system.
          * @param path Path to check.
@@ -20,12 +20,15 @@ namespace nau::io
      * @struct IMemoryStream
      * @brief An abstract interface for in-memory streams that support both reading and writing.
      *
-     * `IMemoryStream` provides methods for accessing and manipulating data in memory. It inherits from both `IStreamReader` and `IStreamWriter`.
+     * `IMemoryStream` provides methods for accessing and manipulating data in memory. It inherits from both `IStreamReader` and `IStreamWriter`,
+     * reads without copies through `IStreamSpanReader` and completes `IAsyncStreamReader` reads immediately.
      */
     struct NAU_ABSTRACT_TYPE IMemoryStream : IStreamReader,
-                                             IStreamWriter
+                                             IStreamWriter,
+                                             IStreamSpanReader,
+                                             IAsyncStreamReader
     {
-        NAU_INTERFACE(nau::io::IMemoryStream, IStreamReader, IStreamWriter)
+        NAU_INTERFACE(nau::io::IMemoryStream, IStreamReader, IStreamWriter, IStreamSpanReader, IAsyncStreamReader)
 
         using Ptr = nau::Ptr<IMemoryStream>; /**< A smart pointer type for `IMemoryStream`. */
 
@@ -65,4 +68,13 @@ namespace nau::io
      */
     NAU_KERNEL_EXPORT
     IMemoryStream::Ptr createMemoryStream(BytesBuffer buffer, AccessModeFlag accessMode = AccessMode::Write | AccessMode::Read, IMemAllocator::Ptr allocator = nullptr);
+
+    /**
+     * @brief Reads the rest of the stream into memory without blocking the calling thread (see `readStreamToBufferAsync`).
+     * @param src The `IStreamReader` instance to read from.
+     * @param cancellation Cancels the read.
+     * @return The task with the stream over the read data, or `src` itself if it already is a memory stream.
+     */
+    NAU_KERNEL_EXPORT
+    async::Task<IStreamReader::Ptr> readStreamToMemoryAsync(IStreamReader::Ptr src, Cancellation cancellation = Cancellation::none());
 }  // namespace nau::io
@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
 #include "nau/async/task.h"
 #include "nau/io/io_constants.h"
 #include "nau/kernel/kernel_config.h"
+#include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/ptr.h"
 #include "nau/rtti/rtti_object.h"
+#include "nau/utils/cancellation.h"
 #include "nau/utils/result.h"
 
 /**
@@ -64,14 +68,49 @@ namespace nau::io
         virtual Result<size_t> read(std::byte* buffer, size_t count) = 0;
     };
 
-    // struct NAU_ABSTRACT_TYPE IAsyncStreamReader : virtual IStreamBase
-    // {
-    //     NAU_INTERFACE(nau::io::IAsyncStreamReader, IStreamBase)
+    /**
+     * @struct IStreamSpanReader
+     * @brief Optional extension of the readers whose data is already in memory (memory streams, mapped files).
+     *
+     * Hands out read-only views of the stream data instead of copying it into the caller's buffer.
+     * Query it with `reader.as<IStreamSpanReader*>()` or use `readStreamAsSpan` that falls back to the copy.
+     */
+    struct NAU_ABSTRACT_TYPE IStreamSpanReader : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::io::IStreamSpanReader, IRefCounted)
+
+        /**
+         * @brief Returns a view of the data at the current position and advances the position past it.
+         * @param count The maximum number of bytes to view.
+         * @return The view of at most `count` bytes. It can be shorter (e.g. at the mapped region boundary) and is empty at the end of the stream.
+         *         The view is borrowed: it is valid while the stream is alive and its data is not modified.
+         */
+        virtual Result<eastl::span<const std::byte>> readSpan(size_t count) = 0;
+    };
 
-    //     using Ptr = nau::Ptr<IAsyncStreamReader>;
+    /**
+     * @struct IAsyncStreamReader
+     * @brief Optional extension of the readers that can read without blocking the calling thread.
+     *
+     * The reads are positional: they neither use nor change the stream position, so several reads of the same stream can be in flight.
+     * The stream must be kept alive until its reads are completed.
+     * Query it with `reader.as<IAsyncStreamReader*>()` or use `readStreamAsync` that falls back to the synchronous read.
+     */
+    struct NAU_ABSTRACT_TYPE IAsyncStreamReader : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::io::IAsyncStreamReader, IRefCounted)
 
-    //     virtual Result<size_t> read(std::byte*, size_t count) = 0;
-    // };
+        using Ptr = nau::Ptr<IAsyncStreamReader>; /**< A smart pointer type for `IAsyncStreamReader`. */
+
+        /**
+         * @brief Reads the stream data starting at `offset` into the buffers one after another (scatter read).
+         * @param offset The offset from the beginning of the stream.
+         * @param buffers The destination buffers. The list is used only during the call, but the buffers memory must stay valid until the task is completed.
+         * @param cancellation Cancels the reads that are not issued yet. The task of the cancelled read is rejected, the buffers can be partially filled.
+         * @return The task with the total number of bytes read: less than the size of the buffers only at the end of the stream.
+         */
+        virtual async::Task<size_t> readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation = Cancellation::none()) = 0;
+    };
 
     /**
      * @struct IStreamWriter
@@ -127,4 +166,35 @@ namespace nau::io
      */
     NAU_KERNEL_EXPORT
     Result<size_t> copyStream(IStreamWriter& dst, IStreamReader& src);
+
+    /**
+     * @brief Reads `count` bytes (or all bytes up to the end of the stream) as a single contiguous view.
+     * @param src The `IStreamReader` instance to read from.
+     * @param count The number of bytes to read. `std::numeric_limits<size_t>::max()` reads the rest of the stream.
+     * @param fallbackBuffer The buffer the data is copied to when the stream can not provide a view (see `IStreamSpanReader`).
+     * @return A `Result` containing the view of the read data: borrowed from the stream or pointing to the `fallbackBuffer`.
+     */
+    NAU_KERNEL_EXPORT
+    Result<eastl::span<const std::byte>> readStreamAsSpan(IStreamReader& src, size_t count, BytesBuffer& fallbackBuffer);
+
+    /**
+     * @brief Reads data from the current stream position and advances the position by the number of bytes read.
+     * @param src The `IStreamReader` instance to read from. It must not be used by anyone else until the task is completed.
+     * @param buffer The destination buffer. It must stay valid until the task is completed.
+     * @param cancellation Cancels the read (see `IAsyncStreamReader`).
+     * @return The task with the number of bytes read.
+     *
+     * When the stream does not support `IAsyncStreamReader` the data is read synchronously within the call.
+     */
+    NAU_KERNEL_EXPORT
+    async::Task<size_t> readStreamAsync(IStreamReader::Ptr src, eastl::span<std::byte> buffer, Cancellation cancellation = Cancellation::none());
+
+    /**
+     * @brief Reads the stream from the current position to the end into a new buffer.
+     * @param src The `IStreamReader` instance to read from. It must not be used by anyone else until the task is completed.
+     * @param cancellation Cancels the read (see `IAsyncStreamReader`).
+     * @return The task with the buffer holding the read data.
+     */
+    NAU_KERNEL_EXPORT
+    async::Task<BytesBuffer> readStreamToBufferAsync(IStreamReader::Ptr src, Cancellation cancellation = Cancellation::none());
 }  // namespace nau::io
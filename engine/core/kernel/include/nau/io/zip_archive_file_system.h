@@ -0,0 +1,28 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "nau/io/file_system.h"
+#include "nau/kernel/kernel_config.h"
+
+/**
+ * @brief Provides a function to create a read-only file system over a zip archive.
+ */
+
+namespace nau::io
+{
+    /**
+     * @brief Creates a read-only file system that exposes the content of a zip archive.
+     * @param archiveFile File containing the zip archive.
+     * @return Pointer to the created file system or `nullptr` if the archive's central directory can not be read.
+     *
+     * @details The central directory is parsed once into a hashed index, so lookups do not touch the archive.
+     *          Each opened entry stream reads the archive through its own stream (or through the memory mapping,
+     *          if `archiveFile` supports it), so entries can be read concurrently without any shared lock.
+     *          Stored entries are served directly from the archive data, large deflated entries are decompressed on demand while reading.
+     *          Only `stored` and `deflate` compression methods are supported, encrypted entries are skipped.
+     */
+    NAU_KERNEL_EXPORT
+    IFileSystem::Ptr createZipArchiveFileSystem(IFile::Ptr archiveFile);
+}  // namespace nau::io
@@ -0,0 +1,134 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file allocation_profiler.h
+ * @brief Definition of the AllocationProfiler class.
+ */
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include "nau/io/stream.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * @brief Sampling allocation profiler of the memory sections.
+     *
+     * The allocators report their allocations under the section kind (the same kind they use for HeapAllocator::getSection).
+     * Per section counters are kept per thread, so recording never contends between threads.
+     * Each Nth allocation of a thread (see setSamplingInterval) captures the call stack, the samples are aggregated by call site
+     * and weighted by the interval, so the call site counters estimate the real allocations count and bytes.
+     *
+     * While the profiler is disabled, recording costs a single relaxed atomic load.
+     */
+    class NAU_KERNEL_EXPORT AllocationProfiler
+    {
+    public:
+        using SectionId = uint32_t;
+
+        static constexpr SectionId MaxSections = 256;
+
+        /**
+         * @brief The section that collects the allocations of the kinds registered over MaxSections.
+         */
+        static constexpr SectionId OtherSection = 0;
+
+        static constexpr uint32_t DefaultSamplingInterval = 1024;
+        static constexpr size_t MaxStackFrames = 32;
+
+        struct SectionStatistics
+        {
+            eastl::string kind;
+            uint64_t allocations = 0;
+            uint64_t deallocations = 0;
+            uint64_t allocatedBytes = 0;
+            uint64_t freedBytes = 0;
+
+            int64_t getLiveAllocations() const
+            {
+                return static_cast<int64_t>(allocations - deallocations);
+            }
+
+            int64_t getLiveBytes() const
+            {
+                return static_cast<int64_t>(allocatedBytes - freedBytes);
+            }
+        };
+
+        struct CallSiteStatistics
+        {
+            eastl::string section;
+            eastl::vector<uintptr_t> frames;  ///< Return addresses, the innermost first. Valid within the process that captured them.
+            uint64_t samples = 0;
+            uint64_t allocations = 0;  ///< Estimated allocations (samples weighted by the sampling interval).
+            uint64_t bytes = 0;        ///< Estimated allocated bytes.
+        };
+
+        /**
+         * @brief Counters of all sections and call sites at some point of the session.
+         *
+         * The counters only grow, so the difference of two snapshots gives the activity between them
+         * (e.g. the snapshots taken at the frame boundaries show which sections churn memory each frame).
+         */
+        struct NAU_KERNEL_EXPORT Snapshot
+        {
+            uint64_t timeNs = 0;  ///< Time since the profiler start, or the interval length for the diff.
+            eastl::vector<SectionStatistics> sections;
+            eastl::vector<CallSiteStatistics> callSites;
+
+            /**
+             * @brief Computes the activity between the base snapshot and this one. Sections and call sites with no activity are dropped.
+             */
+            [[nodiscard]] Snapshot diff(const Snapshot& base) const;
+
+            [[nodiscard]] const SectionStatistics* findSection(eastl::string_view kind) const;
+
+            /**
+             * @brief Returns the call sites with the most allocated bytes, in descending order.
+             */
+            [[nodiscard]] eastl::vector<CallSiteStatistics> getTopCallSites(size_t count) const;
+
+            /**
+             * @brief Writes the snapshot as JSON. Two exported snapshots of a session can be diffed by a viewer, call sites are matched by the frames.
+             */
+            Result<> writeJson(io::IStreamWriter& stream) const;
+        };
+
+        /**
+         * @brief Registers the section kind. Kinds are never released: the same kind always gets the same id.
+         */
+        static SectionId registerSection(eastl::string_view kind);
+
+        static void setEnabled(bool enabled);
+
+        [[nodiscard]] static bool isEnabled();
+
+        /**
+         * @param interval Every interval-th allocation of a thread captures the stack. 0 disables the stack sampling.
+         */
+        static void setSamplingInterval(uint32_t interval);
+
+        [[nodiscard]] static uint32_t getSamplingInterval();
+
+        static void recordAllocation(SectionId section, size_t size);
+
+        /**
+         * @param count Number of the released blocks (the arena allocators release all blocks of the frame at once).
+         */
+        static void recordDeallocation(SectionId section, size_t size, size_t count = 1);
+
+        [[nodiscard]] static Snapshot makeSnapshot();
+
+        /**
+         * @brief Drops the collected call sites. The section counters are kept, use the snapshot diff to reset them.
+         */
+        static void resetCallSites();
+    };
+
+}  // namespace nau
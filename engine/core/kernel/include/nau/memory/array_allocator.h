@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "nau/memory/allocation_profiler.h"
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/mem_section_ptr.h"
 #include "nau/memory/heap_allocator.h"
@@ -107,6 +108,7 @@ namespace nau
             }
 
             m_allocs.value()++;
+            AllocationProfiler::recordAllocation(m_profilerSection, size);
             return ptr;
         }
 
@@ -126,6 +128,8 @@ namespace nau
             void* newPtr = ptr;
             if (pagePtr->reserve > size)
             {
+                AllocationProfiler::recordDeallocation(m_profilerSection, pagePtr->size);
+                AllocationProfiler::recordAllocation(m_profilerSection, size);
                 updateHeadAndSignature(pagePtr, size);
             }
             else
@@ -145,6 +149,7 @@ namespace nau
         void deallocate(void* ptr) override
         {
             Head* const pagePtr = getHead(ptr);
+            AllocationProfiler::recordDeallocation(m_profilerSection, pagePtr->size);
 
             pagePtr->next = getFreePointer();
             getFreePointer() = pagePtr;
@@ -196,12 +201,14 @@ namespace nau
         using ConstBytePtr = const std::byte*;
 
         bool m_readyToRelease = false;
+        const AllocationProfiler::SectionId m_profilerSection;
         ThreadLocalValue<int> m_allocs;
         ThreadLocalValue<eastl::shared_ptr<Head*>> m_freePointersPool;
         ThreadLocalValue<MemSectionPtr> m_memSection;
 
         ArrayAllocator()
-            : m_allocs([](auto& val) {val = 0; })
+            : m_profilerSection(AllocationProfiler::registerSection(getSectionKind()))
+            , m_allocs([](auto& val) {val = 0; })
         {};
         ArrayAllocator(const ArrayAllocator&) = delete;
         ArrayAllocator& operator=(const ArrayAllocator&) = delete;
@@ -212,7 +219,7 @@ namespace nau
         {
             auto& memSection = m_memSection.value();
             if(!memSection.valid())
-                memSection = HeapAllocator::instance().getSection("ArrayAllocator<" + eastl::to_string(MinimumArraySize) + ">");
+                memSection = HeapAllocator::instance().getSection(getSectionKind());
 
             auto sizeRequest = MinimumArraySize + sizeof(Head) + sizeof(Signature);
             if (memSection->getPageSize() < sizeRequest)
@@ -220,6 +227,11 @@ namespace nau
             return memSection;
         }
 
+        static eastl::string getSectionKind()
+        {
+            return "ArrayAllocator<" + eastl::to_string(MinimumArraySize) + ">";
+        }
+
         Head*& getFreePointer()
         {
             auto& val = m_freePointersPool.value();
@@ -10,7 +10,11 @@
 #include "EASTL/unordered_map.h"
 #include "EASTL/unordered_set.h"
 #include "EASTL/vector.h"
+
+#include <algorithm>
+
 #include "nau/memory/fixed_blocks.h"
+#include "nau/memory/frame_allocator.h"
 #include "nau/memory/string_allocator.h"
 
 namespace nau
@@ -58,6 +62,79 @@ namespace nau
     protected:
     };
 
+    /**
+     * EASTL allocator of the frame arena (FrameArenaAllocator::getFrameArena() by default).
+     * Containers don't need to be destroyed: the memory is released with the frame.
+     * Without the installed frame arena (no main loop is running) the default allocator is used:
+     * such containers must be destroyed as usual.
+     */
+    class EastlFrameArenaAllocator
+    {
+    public:
+        EastlFrameArenaAllocator([[maybe_unused]] const char* name = "NAU") :
+            m_arena(FrameArenaAllocator::getFrameArena())
+        {
+        }
+
+        explicit EastlFrameArenaAllocator(FrameArenaAllocator& arena) :
+            m_arena(&arena)
+        {
+        }
+
+        EastlFrameArenaAllocator(const EastlFrameArenaAllocator& src) = default;
+
+        EastlFrameArenaAllocator(const EastlFrameArenaAllocator& src, [[maybe_unused]] const char* name) :
+            m_arena(src.m_arena)
+        {
+        }
+
+        EastlFrameArenaAllocator& operator=(const EastlFrameArenaAllocator& src) = default;
+
+        void* allocate(size_t n, [[maybe_unused]] int flags = 0)
+        {
+            return m_arena ? m_arena->allocate(n) : getDefaultAllocator()->allocateAligned(n, FrameArenaAllocator::BlockAlignment);
+        }
+
+        void* allocate(size_t n, size_t alignment, [[maybe_unused]] size_t offset, [[maybe_unused]] int flags = 0)
+        {
+            return m_arena ? m_arena->allocateAligned(n, alignment) : getDefaultAllocator()->allocateAligned(n, std::max(alignment, FrameArenaAllocator::BlockAlignment));
+        }
+
+        void deallocate(void* p, [[maybe_unused]] size_t n)
+        {
+            if (!m_arena)
+            {
+                getDefaultAllocator()->deallocateAligned(p);
+            }
+        }
+
+        const char* get_name() const
+        {
+            return m_arena ? m_arena->getName() : getDefaultAllocator()->getName();
+        }
+
+        void set_name(const char* name)
+        {
+            if (m_arena)
+            {
+                m_arena->setName(name);
+            }
+        }
+
+        bool operator==(const EastlFrameArenaAllocator& other) const
+        {
+            return m_arena == other.m_arena;
+        }
+
+        bool operator!=(const EastlFrameArenaAllocator& other) const
+        {
+            return m_arena != other.m_arena;
+        }
+
+    private:
+        FrameArenaAllocator* m_arena;
+    };
+
     class NAU_KERNEL_EXPORT EastlVectorAllocator
     {
         using allocator = ArrayAllocator<1024 * 1024>;
@@ -149,6 +226,8 @@ namespace nau
     using StackVector = eastl::vector<T, EastlStackAllocator>;
     template <typename T>
     using FrameVector = eastl::vector<T, EastlFrameAllocator>;
+    template <typename T>
+    using FrameArenaVector = eastl::vector<T, EastlFrameArenaAllocator>;
 
     template <typename Key, typename T, typename Compare = eastl::less<Key>>
     using Map = eastl::map<Key, T, Compare, EastlBlockAllocatorTyped<typename eastl::map<Key, T, Compare>::node_type>>;
@@ -156,6 +235,8 @@ namespace nau
     using StackMap = eastl::map<Key, T, Compare, EastlStackAllocator>;
     template <typename Key, typename T, typename Compare = eastl::less<Key>>
     using FrameMap = eastl::map<Key, T, Compare, EastlFrameAllocator>;
+    template <typename Key, typename T, typename Compare = eastl::less<Key>>
+    using FrameArenaMap = eastl::map<Key, T, Compare, EastlFrameArenaAllocator>;
 
     template <typename T>
     using List = eastl::list<T, EastlBlockAllocatorTyped<typename eastl::list<T>::node_type>>;
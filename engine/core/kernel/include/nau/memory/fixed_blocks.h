@@ -9,6 +9,7 @@
 
 
 #include <type_traits>
+#include "nau/memory/allocation_profiler.h"
 #include "nau/memory/heap_allocator.h"
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/mem_section_ptr.h"
@@ -91,6 +92,7 @@ namespace nau
             
             getFreePointer() = next;
             m_allocs.value()++;
+            AllocationProfiler::recordAllocation(m_profilerSection, BlockSize);
             return out;            
         }
 
@@ -119,6 +121,7 @@ namespace nau
          */
         void deallocate(void* p) override
         {            
+            AllocationProfiler::recordDeallocation(m_profilerSection, BlockSize);
             static_cast<PtrPtr>(p)->next = getFreePointer();
             getFreePointer() = p;
             m_allocs.value()--;
@@ -159,12 +162,14 @@ namespace nau
         };
 
         bool m_readyToRelease = false;
+        const AllocationProfiler::SectionId m_profilerSection;
         ThreadLocalValue<int> m_allocs;
         ThreadLocalValue<eastl::shared_ptr<FreePointer>> m_freePointersPool;
         ThreadLocalValue<MemSectionPtr> m_memSection;
 
         FixedBlocksAllocator()
-            : m_allocs([](auto& val) {val = 0; })
+            : m_profilerSection(AllocationProfiler::registerSection(getSectionKind()))
+            , m_allocs([](auto& val) {val = 0; })
         {
             getFreePointer() = getSection()->allocate(BlockSize);
             static_cast<PtrPtr>(getFreePointer())->next = nullptr;
@@ -174,10 +179,15 @@ namespace nau
         {
             auto& memSection = m_memSection.value();
             if(!memSection.valid())
-                memSection = HeapAllocator::instance().getSection("FixedBlocksAllocator<" + eastl::to_string(BlockSize) + ">");
+                memSection = HeapAllocator::instance().getSection(getSectionKind());
             return memSection;
         }
 
+        static eastl::string getSectionKind()
+        {
+            return "FixedBlocksAllocator<" + eastl::to_string(BlockSize) + ">";
+        }
+
         void*& getFreePointer()
         {
             auto& val = m_freePointersPool.value();
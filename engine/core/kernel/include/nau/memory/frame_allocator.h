@@ -7,12 +7,17 @@
  */
 #pragma once
 
+#include "nau/memory/allocation_profiler.h"
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/mem_section_ptr.h"
 #include "nau/memory/aligned_allocator_debug.h"
 #include "nau/threading/thread_local_value.h"
 #include "nau/rtti/rtti_impl.h"
 
+#include <EASTL/unique_ptr.h>
+
+#include <atomic>
+
 namespace nau
 {
 
@@ -135,6 +140,101 @@ namespace nau
         ThreadLocalValue<MemSectionPtr> m_memSection;
         ThreadLocalValue<int> m_numAllocs;
     };
+
+    /**
+     * @brief Frame arena: per-thread bump pages without the block headers, released in bulk.
+     *
+     * Memory allocated during the frame stays valid for framesInFlight frames (the frame itself and framesInFlight - 1 following frames),
+     * so the data of the previous frame can still be read (e.g. by the render thread) with the double buffering.
+     * deallocate() does nothing: the frame memory is released all at once, so the blocks can be "fired and forgotten".
+     * Each thread rewinds its own pages on the first allocation in the new frame: prepareFrame() only advances the frame counter.
+     *
+     * Blocks have no headers: reallocation of the existing block and getSize() are not supported.
+     */
+    class NAU_KERNEL_EXPORT FrameArenaAllocator final : public IFrameAllocator
+    {
+    public:
+        static constexpr uint32_t MaxFramesInFlight = 3;
+        static constexpr size_t BlockAlignment = 16;
+
+        struct Statistics
+        {
+            uint64_t frame = 0;            ///< Index of the current frame.
+            size_t lastFrameBytes = 0;     ///< Memory allocated during the last finished frame (all threads).
+            size_t peakFrameBytes = 0;     ///< High-water mark of the memory allocated per frame.
+        };
+
+        /**
+         * @param framesInFlight Number of frames the allocated memory is kept for (2 - double buffering, 3 - triple buffering).
+         * @param pageSize Size of the bump pages.
+         */
+        explicit FrameArenaAllocator(uint32_t framesInFlight = 2, size_t pageSize = 256 * 1024);
+
+        ~FrameArenaAllocator();
+
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+
+        /**
+         * @brief Finishes the current frame: updates the statistics and starts the new frame.
+         * Memory of the frame that was started framesInFlight frames ago is reused.
+         *
+         * @return Always true: frame arena does not require deallocations.
+         */
+        [[nodiscard]] bool prepareFrame() override;
+
+        /**
+         * @brief Allocates memory (BlockAlignment aligned) from the calling thread's page of the current frame. Thread safe.
+         */
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        /**
+         * @brief Only ptr == nullptr is supported (the same as allocate()).
+         */
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        /**
+         * @brief Does nothing: memory is released with the frame.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Not supported: blocks have no headers.
+         */
+        size_t getSize(const void* ptr) const override;
+
+        [[nodiscard]] void* allocateAligned(size_t size, size_t alignment) override;
+
+        [[nodiscard]] void* reallocateAligned(void* ptr, size_t size, size_t alignment) override;
+
+        void deallocateAligned(void* ptr) override;
+
+        [[nodiscard]] Statistics getStatistics() const;
+
+        /**
+         * @brief Sets the frame arena used by the default constructed EastlFrameArenaAllocator.
+         * The application's frame arena is installed and advanced every frame by the main loop.
+         */
+        static void setFrameArena(FrameArenaAllocator* allocator);
+
+        /**
+         * @brief The installed frame arena, nullptr if no frame arena is installed (no main loop is running).
+         */
+        [[nodiscard]] static FrameArenaAllocator* getFrameArena();
+
+    private:
+        struct ThreadArena;
+
+        ThreadArena& getThreadArena(uint64_t frame);
+
+        const uint32_t m_framesInFlight;
+        const size_t m_pageSize;
+        const AllocationProfiler::SectionId m_profilerSection;
+        std::atomic<uint64_t> m_frame = 0;
+        size_t m_lastFrameBytes = 0;
+        size_t m_peakFrameBytes = 0;
+        ThreadLocalValue<eastl::unique_ptr<ThreadArena>> m_arenas;
+    };
 }
 
 
@@ -0,0 +1,76 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file size_class_allocator.h
+ * @brief Definition of the SizeClassAllocator class.
+ */
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/memory/aligned_allocator_debug.h"
+
+namespace nau
+{
+    /**
+     * @brief General purpose allocator with the thread-local caches of size classes.
+     *
+     * Small blocks (up to MaxSmallSize) are rounded up to one of the size classes and taken from the thread-local free list of that class
+     * without any synchronization. Thread caches exchange blocks with the central (per size class) lists in batches:
+     * blocks freed by a thread other than the allocating one are returned to the central lists together with the other blocks, not one by one.
+     * Central lists carve blocks from 64KB spans of the page heap (MemSection with large pages); the span that has no used blocks is returned to the page heap
+     * and can be reused by any size class.
+     * Large blocks are allocated as the separate memory pages.
+     *
+     * All the instances share the same heap, so blocks can be freed through any instance.
+     */
+    class NAU_KERNEL_EXPORT SizeClassAllocator final : public IAlignedAllocatorDebug
+    {
+    public:
+        static constexpr size_t MaxSmallSize = 4096;
+
+        struct SizeClassStatistics
+        {
+            size_t blockSize = 0;
+            size_t spansCount = 0;  ///< Spans owned by the size class.
+            size_t usedBlocks = 0;  ///< Blocks given out to threads (allocated or kept in the thread caches).
+        };
+
+        struct Statistics
+        {
+            eastl::vector<SizeClassStatistics> sizeClasses;
+            size_t largeBlocks = 0;
+            size_t largeBytes = 0;
+            size_t freeSpans = 0;      ///< Spans returned to the page heap and not reused yet.
+            size_t reservedBytes = 0;  ///< Page heap memory (including free spans) and large blocks.
+
+            /**
+             * Counters of the thread caches are accumulated on the batch exchange, so they lag behind by at most a batch per thread.
+             */
+            uint64_t allocations = 0;
+            uint64_t deallocations = 0;
+        };
+
+        SizeClassAllocator();
+
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Retrieves the usable size of the block (the size of its size class for the small blocks).
+         */
+        size_t getSize(const void* ptr) const override;
+
+        /**
+         * @brief Returns the blocks cached by the calling thread to the central lists.
+         */
+        static void flushThreadCache();
+
+        [[nodiscard]] static Statistics getStatistics();
+    };
+
+}  // namespace nau
@@ -13,6 +13,7 @@
 #include "nau/runtime/async_disposable.h"
 #include "nau/runtime/disposable.h"
 #include "nau/serialization/runtime_value.h"
+#include "nau/string/name_id.h"
 #include "nau/utils/functor.h"
 
 namespace nau
@@ -99,12 +100,21 @@ namespace nau
 
         virtual bool hasSubscribers(eastl::string_view) const = 0;
 
+        /**
+            Streams are keyed by the interned names: the NameId overloads do not hash or copy the stream name.
+         */
+        virtual bool hasSubscribers(NameId streamName) const = 0;
+
         virtual AsyncMessageStream getStream(eastl::string_view streamName) = 0;
 
+        virtual AsyncMessageStream getStream(NameId streamName) = 0;
+
         // virtual subscribeInplace(Functor<void (const Runtime::Ptr&)) = 0;
 
         virtual void post(eastl::string_view streamName, RuntimeValue::Ptr = nullptr) = 0;
 
+        virtual void post(NameId streamName, RuntimeValue::Ptr = nullptr) = 0;
+
         /**
                 template <typename T>
                 TypedMessageStream<T> getTypedStream(const std::string& streamName);
@@ -45,7 +45,8 @@ namespace nau::nau_detail
         using ValueType = T;
 
         MessageDeclaration(const char streamName[]) :
-            m_streamName(streamName)
+            m_streamName(streamName),
+            m_streamId(m_streamName)
         {
         }
 
@@ -54,6 +55,14 @@ namespace nau::nau_detail
             return m_streamName;
         }
 
+        /**
+            Stream name interned on declaration: posting does not hash the name.
+         */
+        NameId getStreamId() const
+        {
+            return m_streamId;
+        }
+
         operator eastl::string_view() const
         {
             return m_streamName;
@@ -61,6 +70,7 @@ namespace nau::nau_detail
 
     private:
         const eastl::string_view m_streamName;
+        const NameId m_streamId;
     };
 
 }  // namespace nau::nau_detail
@@ -123,7 +133,7 @@ namespace nau
 
         inline void post(AsyncMessageSource& broadcaster, T value) const
         {
-            broadcaster.post(this->getStreamName(), nau::makeValueCopy(std::move(value)));
+            broadcaster.post(this->getStreamId(), nau::makeValueCopy(std::move(value)));
         }
 
         template <typename Callable>
@@ -144,7 +154,7 @@ namespace nau
 
         inline void post(AsyncMessageSource& broadcaster = getBroadcaster()) const
         {
-            broadcaster.post(this->getStreamName());
+            broadcaster.post(this->getStreamId());
         }
 
         template <typename Callable>
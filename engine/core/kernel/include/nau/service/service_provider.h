@@ -109,6 +109,11 @@ namespace nau
         virtual void* getApi(const rtti::TypeInfo&, GetApiMode = GetApiMode::AllowLazyCreation) = 0;
 
         virtual bool hasApi(const rtti::TypeInfo&) = 0;
+
+        /**
+            @brief The service implementation type name (used for diagnostics only).
+         */
+        virtual std::string_view getServiceTypeName() const = 0;
     };
 
 }  // namespace nau
@@ -142,6 +147,11 @@ namespace nau::core_detail
             return ServiceAccessorHelper<T>::hasApi(type);
         }
 
+        std::string_view getServiceTypeName() const override
+        {
+            return rtti::getTypeInfo<T>().getTypeName();
+        }
+
     private:
         const SmartPtr m_instance;
     };
@@ -154,7 +164,8 @@ namespace nau::core_detail
     public:
         template <typename T>
         RttiServiceAccessor(SmartPtrT<T> instance) :
-            m_instance(rtti::pointer_cast<IRttiObject>(std::move(instance)))
+            m_instance(rtti::pointer_cast<IRttiObject>(std::move(instance))),
+            m_typeName(rtti::getTypeInfo<T>().getTypeName())
         {
         }
 
@@ -170,8 +181,14 @@ namespace nau::core_detail
             return this->m_instance->is(type);
         }
 
+        std::string_view getServiceTypeName() const override
+        {
+            return m_typeName;
+        }
+
     private:
         const SmartPtrT<IRttiObject> m_instance;
+        const std::string_view m_typeName;
     };
 
     /**
@@ -225,6 +242,11 @@ namespace nau::core_detail
             return m_classDescriptor->findInterface(type) != nullptr;
         }
 
+        std::string_view getServiceTypeName() const override
+        {
+            return m_classDescriptor->getClassTypeInfo().getTypeName();
+        }
+
         IClassDescriptor::Ptr getClassDescriptor() const
         {
             return m_classDescriptor;
@@ -291,6 +313,11 @@ namespace nau::core_detail
             return m_classDescriptor->findInterface(type) != nullptr;
         }
 
+        std::string_view getServiceTypeName() const override
+        {
+            return m_classDescriptor->getClassTypeInfo().getTypeName();
+        }
+
         IClassDescriptor::Ptr getClassDescriptor() const
         {
             return m_classDescriptor;
@@ -337,6 +364,16 @@ namespace nau
         [[nodiscard]]
         eastl::vector<T*> getAll();
 
+        /**
+            @brief
+                all services that provide T, without allocations and locks (while the services registry is not changed).
+                The result is the immutable snapshot: it remains valid for the service provider lifetime,
+                but does not include the services registered after the call.
+        */
+        template <rtti::WithTypeInfo T>
+        [[nodiscard]]
+        eastl::span<T* const> getAllCached();
+
         template <rtti::WithTypeInfo T, typename Predicate>
         T* findIf(Predicate);
 
@@ -386,6 +423,8 @@ namespace nau
 
         virtual void findAllInternal(const rtti::TypeInfo&, void (*)(void* instancePtr, void*), void*, ServiceAccessor::GetApiMode = ServiceAccessor::GetApiMode::AllowLazyCreation) = 0;
 
+        virtual eastl::span<void* const> findAllCachedInternal(const rtti::TypeInfo&) = 0;
+
         virtual void addServiceAccessorInternal(ServiceAccessor::Ptr, IClassDescriptor::Ptr = nullptr) = 0;
 
         virtual bool hasApiInternal(const rtti::TypeInfo&) = 0;
@@ -415,16 +454,15 @@ namespace nau
     template <rtti::WithTypeInfo T>
     eastl::vector<T*> ServiceProvider::getAll()
     {
-        eastl::vector<T*> services;
-        findAllInternal(rtti::getTypeInfo<T>(), [](void* ptr, void* data)
-        {
-            T* const instance = reinterpret_cast<T*>(ptr);
-            auto& container = *reinterpret_cast<decltype(services)*>(data);
-
-            container.push_back(instance);
-        }, &services);
+        const eastl::span<T* const> services = getAllCached<T>();
+        return eastl::vector<T*>(services.begin(), services.end());
+    }
 
-        return services;
+    template <rtti::WithTypeInfo T>
+    eastl::span<T* const> ServiceProvider::getAllCached()
+    {
+        const eastl::span<void* const> services = findAllCachedInternal(rtti::getTypeInfo<T>());
+        return {reinterpret_cast<T* const*>(services.data()), services.size()};
     }
 
     template <rtti::WithTypeInfo T, typename Predicate>
@@ -432,7 +470,7 @@ namespace nau
     {
         static_assert(std::is_invocable_r_v<bool, Predicate, T&>, "Invalid predicate callback: expected (T&) -> bool");
 
-        for (T* const instance : getAll<std::remove_const_t<T>>())
+        for (T* const instance : getAllCached<std::remove_const_t<T>>())
         {
             if (predicate(*instance))
             {
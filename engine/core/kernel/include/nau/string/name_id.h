@@ -0,0 +1,146 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/string/name_id.h
+
+
+#pragma once
+
+#include <EASTL/functional.h>
+#include <EASTL/string_view.h>
+
+#include <cstdint>
+#include <functional>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau
+{
+    /**
+        @brief Name literal with the hash computed at compile time. Converts to NameId without hashing the string.
+     */
+    struct NameLiteral
+    {
+        const char* str;
+        uint32_t length;
+        uint32_t hash;
+    };
+
+    /**
+        @brief Interned name: 32-bit id in the engine-wide names table.
+
+        The id (and the string and the hash it refers to) stays valid until the program exit, so NameId can be copied, compared and hashed
+        as an integer. Looking up already interned names, getString() and getHash() do not take any lock and do not allocate.
+        Default constructed NameId is invalid (empty name).
+     */
+    class NAU_KERNEL_EXPORT NameId
+    {
+    public:
+        /**
+            @brief 32-bit FNV-1a, the hash that is stored with the interned name.
+         */
+        static constexpr uint32_t constHash(const char* str, size_t length)
+        {
+            uint32_t hash = 0x811c9dc5;
+            for (size_t i = 0; i < length; ++i)
+            {
+                hash ^= static_cast<uint8_t>(str[i]);
+                hash *= 0x01000193;
+            }
+
+            return hash;
+        }
+
+        /**
+            @brief Finds the name without interning it.
+            @return Invalid NameId if the name was not interned yet.
+         */
+        static NameId find(eastl::string_view name);
+
+        NameId() = default;
+
+        /**
+            @brief Interns the name (the empty name gives invalid NameId).
+         */
+        explicit NameId(eastl::string_view name);
+
+        NameId(const NameLiteral& literal);
+
+        eastl::string_view getString() const;
+
+        /**
+            @brief Null-terminated name ("" for invalid NameId).
+         */
+        const char* c_str() const;
+
+        uint32_t getHash() const;
+
+        uint32_t getId() const
+        {
+            return m_id;
+        }
+
+        explicit operator bool() const
+        {
+            return m_id != 0;
+        }
+
+        bool operator==(const NameId& other) const
+        {
+            return m_id == other.m_id;
+        }
+
+        bool operator!=(const NameId& other) const
+        {
+            return m_id != other.m_id;
+        }
+
+        bool operator<(const NameId& other) const
+        {
+            return m_id < other.m_id;
+        }
+
+    private:
+        explicit NameId(uint32_t id) :
+            m_id(id)
+        {
+        }
+
+        uint32_t m_id = 0;
+    };
+
+    namespace string_literals
+    {
+        constexpr NameLiteral operator""_name(const char* str, size_t length)
+        {
+            return NameLiteral{str, static_cast<uint32_t>(length), NameId::constHash(str, length)};
+        }
+    }  // namespace string_literals
+}  // namespace nau
+
+/**
+    Interns the literal once (on the first execution) and then returns the cached NameId.
+ */
+#define NAU_NAME(literal)                                                                                                                  \
+    ([]() -> ::nau::NameId                                                                                                                 \
+    {                                                                                                                                      \
+        static const ::nau::NameId nameId{::nau::NameLiteral{literal, sizeof(literal) - 1, ::nau::NameId::constHash(literal, sizeof(literal) - 1)}}; \
+        return nameId;                                                                                                                     \
+    }())
+
+template <>
+struct eastl::hash<nau::NameId>
+{
+    size_t operator()(const nau::NameId& name) const
+    {
+        return name.getId();
+    }
+};
+
+template <>
+struct std::hash<nau::NameId>
+{
+    size_t operator()(const nau::NameId& name) const
+    {
+        return name.getId();
+    }
+};
@@ -0,0 +1,48 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/threading/parallel_for.h
+
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::threading
+{
+    /**
+        @brief Processes [begin, end) range of the items.
+        workerIndex is 0 for the caller thread and [1, jobs count] for the helpers, can be used to address per worker data.
+     */
+    using ParallelForCallback = void (*)(void* context, uint32_t begin, uint32_t end, uint32_t workerIndex);
+
+    /**
+        @brief Number of the default executor's threads that can help the caller (0 if there is no default executor).
+     */
+    NAU_KERNEL_EXPORT uint32_t getParallelForWorkersCount();
+
+    /**
+        @brief Fork-join loop over [0, count) items in ranges of at most quant items.
+
+        Nothing is allocated per call: helper jobs are scheduled on the default executor as plain invocations of the preallocated job.
+        The caller thread processes the ranges as well and returns as soon as all ranges are processed:
+        helpers that were not started by that time do not touch the job, so nested calls from the pool threads can not dead-lock.
+
+        @param maxJobs Max number of the helper jobs (the caller is not counted). 0 means the number of the executor's threads.
+     */
+    NAU_KERNEL_EXPORT void parallelFor(uint32_t count, uint32_t quant, ParallelForCallback callback, void* context, uint32_t maxJobs = 0);
+
+    template <typename F>
+    requires(std::is_invocable_v<F&, uint32_t, uint32_t, uint32_t>)
+    void parallelFor(uint32_t count, uint32_t quant, F&& callback, uint32_t maxJobs = 0)
+    {
+        using Callback = std::remove_reference_t<F>;
+
+        parallelFor(count, quant, [](void* context, uint32_t begin, uint32_t end, uint32_t workerIndex)
+        {
+            (*reinterpret_cast<Callback*>(context))(begin, end, workerIndex);
+        }, const_cast<void*>(reinterpret_cast<const void*>(&callback)), maxJobs);
+    }
+}  // namespace nau::threading
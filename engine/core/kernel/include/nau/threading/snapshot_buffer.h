@@ -0,0 +1,114 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::threading
+{
+    /**
+        @brief Hands the state snapshots over from one producer thread to one consumer thread without locks and without waiting.
+
+        The producer writes the back snapshot and publishes it, the consumer acquires the latest published snapshot and reads it
+        while the producer writes the next one: double buffering, plus the third (pending) slot so neither side ever waits for the other.
+        If the producer publishes faster than the consumer acquires, the consumer gets only the latest snapshot (the older ones are skipped).
+
+        The slots are reused: the snapshot returned by getWriteSnapshot() contains the data written three publishes ago,
+        so the containers inside the snapshot keep their allocations.
+     */
+    template <typename T>
+    class SnapshotBuffer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Snapshot
+        {
+            T value;
+            uint64_t frameIndex = 0;
+            Clock::time_point publishTime;
+        };
+
+        SnapshotBuffer() = default;
+        SnapshotBuffer(const SnapshotBuffer&) = delete;
+        SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+        /**
+            @brief Producer: the snapshot to write the next state into.
+         */
+        Snapshot& getWriteSnapshot()
+        {
+            return m_slots[m_writeSlot];
+        }
+
+        /**
+            @brief Producer: makes the written snapshot the latest one.
+         */
+        void publish(uint64_t frameIndex, Clock::time_point publishTime = Clock::now())
+        {
+            NAU_ASSERT(frameIndex > m_publishedFrame.load(std::memory_order_relaxed), "Frame index must increase");
+
+            Snapshot& snapshot = m_slots[m_writeSlot];
+            snapshot.frameIndex = frameIndex;
+            snapshot.publishTime = publishTime;
+
+            const uint8_t previousPending = m_pendingSlot.exchange(m_writeSlot | NewSnapshotFlag, std::memory_order_acq_rel);
+            m_writeSlot = previousPending & SlotMask;
+            m_publishedFrame.store(frameIndex, std::memory_order_relaxed);
+        }
+
+        /**
+            @brief Consumer: the latest published snapshot, or nullptr if nothing was published since the last acquire.
+            The snapshot stays valid (and can be modified by the consumer) until the next successful acquire.
+         */
+        Snapshot* acquire()
+        {
+            if ((m_pendingSlot.load(std::memory_order_relaxed) & NewSnapshotFlag) == 0)
+            {
+                return nullptr;
+            }
+
+            const uint8_t previousPending = m_pendingSlot.exchange(m_readSlot, std::memory_order_acq_rel);
+            m_readSlot = previousPending & SlotMask;
+
+            Snapshot& snapshot = m_slots[m_readSlot];
+            m_acquiredFrame.store(snapshot.frameIndex, std::memory_order_relaxed);
+
+            return &snapshot;
+        }
+
+        /**
+            @brief The frame of the latest published snapshot (0 if nothing was published). Can be called from any thread.
+         */
+        uint64_t getPublishedFrame() const
+        {
+            return m_publishedFrame.load(std::memory_order_relaxed);
+        }
+
+        /**
+            @brief The frame of the latest acquired snapshot (0 if nothing was acquired). Can be called from any thread.
+         */
+        uint64_t getAcquiredFrame() const
+        {
+            return m_acquiredFrame.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr uint8_t SlotMask = 3;
+        static constexpr uint8_t NewSnapshotFlag = 4;
+
+        Snapshot m_slots[3];
+        uint8_t m_writeSlot = 0;
+        std::atomic<uint8_t> m_pendingSlot = 1;
+        uint8_t m_readSlot = 2;
+
+        std::atomic<uint64_t> m_publishedFrame = 0;
+        std::atomic<uint64_t> m_acquiredFrame = 0;
+    };
+}  // namespace nau::threading
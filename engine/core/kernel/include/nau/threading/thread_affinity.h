@@ -0,0 +1,21 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/threading/thread_affinity.h
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/result.h"
+
+namespace nau::threading
+{
+    /**
+        @brief Restricts the calling thread to the specified logical CPUs (zero based indices).
+        The threads created later by the calling thread do not inherit the affinity.
+     */
+    NAU_KERNEL_EXPORT Result<> setThisThreadAffinity(eastl::span<const uint32_t> cpuIndices);
+
+}  // namespace nau::threading
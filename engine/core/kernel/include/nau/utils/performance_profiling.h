@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <nau/diag/cpu_profiler.h>
+#include <nau/string/name_id.h>
+#include <nau/utils/preprocessor.h>
 #include <nau/utils/typed_flag.h>
 //#include "tracy/Tracy.hpp"
 
@@ -22,10 +25,15 @@ namespace nau
 
 static const nau::PerfTagFlag NAU_PERFTAGS = nau::PerfTagFlag{nau::PerfTag::Core, nau::PerfTag::Physics, nau::PerfTag::Render, nau::PerfTag::Platform};
 
-#define NAU_CPU_SCOPED ZoneScoped
-#define NAU_CPU_SCOPED_NAME ZoneScopedN
+// Zone names are not copied: they must be string literals (use NAU_CPU_SCOPED_DYNAMIC_NAME for the other strings).
+#define NAU_CPU_SCOPED NAU_CPU_SCOPED_NAME(__FUNCTION__)
+#define NAU_CPU_SCOPED_NAME(Name) const ::nau::diag::CpuProfiler::Zone ANONYMOUS_VAR(nauCpuZone){Name}
 
-#define NAU_CPU_SCOPED_TAG(TagName) ZoneNamed(__tracy, NAU_PERFTAGS.has(TagName));
-#define NAU_CPU_SCOPED_TAG_NAME(Name, TagName) ZoneNamedN(__tracy, Name, NAU_PERFTAGS.has(TagName));
+// The name is interned only while the profiler is enabled.
+#define NAU_CPU_SCOPED_DYNAMIC_NAME(Name) \
+    const ::nau::diag::CpuProfiler::Zone ANONYMOUS_VAR(nauCpuZone){::nau::diag::CpuProfiler::isEnabled() ? ::nau::NameId{Name}.c_str() : nullptr}
 
-#define NAU_PROFILING_FRAME_END FrameMark
+#define NAU_CPU_SCOPED_TAG(TagName) NAU_CPU_SCOPED_TAG_NAME(__FUNCTION__, TagName)
+#define NAU_CPU_SCOPED_TAG_NAME(Name, TagName) NAU_CPU_SCOPED_NAME(NAU_PERFTAGS.has(TagName) ? (Name) : nullptr)
+
+#define NAU_PROFILING_FRAME_END ::nau::diag::CpuProfiler::markFrame()
@@ -0,0 +1,119 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/app/main_loop/fixed_step_scheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "nau/diag/assertion.h"
+
+namespace nau
+{
+    FixedStepScheduler::FixedStepScheduler(Settings settings) :
+        m_settings(settings)
+    {
+        NAU_ASSERT(m_settings.step.count() > 0);
+        NAU_ASSERT(m_settings.maxStepsPerAdvance > 0);
+
+        m_settings.maxStepsPerAdvance = std::max(m_settings.maxStepsPerAdvance, 1u);
+    }
+
+    void FixedStepScheduler::reset(Clock::time_point now)
+    {
+        m_lastTime = now;
+        m_accumulator = std::chrono::nanoseconds{0};
+    }
+
+    uint32_t FixedStepScheduler::advance(Clock::time_point now)
+    {
+        using namespace std::chrono;
+
+        if (!m_lastTime)
+        {
+            reset(now);
+            return 0;
+        }
+
+        nanoseconds elapsed = std::max(duration_cast<nanoseconds>(now - *m_lastTime), nanoseconds{0});
+        m_lastTime = now;
+
+        if (elapsed > m_settings.maxElapsedTime)
+        {
+            m_droppedTime += elapsed - m_settings.maxElapsedTime;
+            elapsed = m_settings.maxElapsedTime;
+        }
+
+        m_accumulator += elapsed;
+
+        const auto dueSteps = static_cast<uint64_t>(m_accumulator / m_settings.step);
+        const auto steps = static_cast<uint32_t>(std::min<uint64_t>(dueSteps, m_settings.maxStepsPerAdvance));
+
+        m_accumulator -= m_settings.step * steps;
+
+        // can not catch up: keep only the fraction of the step, so the next advance does not try to catch up again
+        if (dueSteps > steps)
+        {
+            const nanoseconds fraction = m_accumulator % m_settings.step;
+            m_droppedTime += m_accumulator - fraction;
+            m_accumulator = fraction;
+        }
+
+        m_stepsCount += steps;
+        return steps;
+    }
+
+    float FixedStepScheduler::getInterpolationAlpha() const
+    {
+        return static_cast<float>(static_cast<double>(m_accumulator.count()) / static_cast<double>(m_settings.step.count()));
+    }
+
+    std::chrono::nanoseconds FixedStepScheduler::getStep() const
+    {
+        return m_settings.step;
+    }
+
+    const FixedStepScheduler::Settings& FixedStepScheduler::getSettings() const
+    {
+        return m_settings;
+    }
+
+    uint64_t FixedStepScheduler::getStepsCount() const
+    {
+        return m_stepsCount;
+    }
+
+    std::chrono::nanoseconds FixedStepScheduler::getDroppedTime() const
+    {
+        return m_droppedTime;
+    }
+
+    FixedStepScheduler::Clock::time_point FixedStepScheduler::getNextStepTime() const
+    {
+        const Clock::time_point lastTime = m_lastTime.value_or(Clock::now());
+        return lastTime + std::chrono::duration_cast<Clock::duration>(m_settings.step - m_accumulator);
+    }
+
+    void FixedStepScheduler::waitForNextStep() const
+    {
+        const Clock::time_point nextStepTime = getNextStepTime();
+
+        if (m_settings.pacing == FixedStepPacing::Sleep)
+        {
+            std::this_thread::sleep_until(nextStepTime);
+            return;
+        }
+
+        // the sleep can oversleep by the timer resolution, so the last part is spun
+        if (const Clock::time_point sleepUntil = nextStepTime - std::chrono::duration_cast<Clock::duration>(m_settings.spinThreshold); Clock::now() < sleepUntil)
+        {
+            std::this_thread::sleep_until(sleepUntil);
+        }
+
+        while (Clock::now() < nextStepTime)
+        {
+            std::this_thread::yield();
+        }
+    }
+}  // namespace nau
@@ -0,0 +1,275 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/app/main_loop/frame_task_graph.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/optional.h>
+#include <EASTL/string.h>
+
+#include <atomic>
+
+#include "nau/diag/assertion.h"
+#include "nau/diag/cpu_profiler.h"
+
+namespace nau
+{
+    namespace
+    {
+        bool containsAny(const eastl::vector<NameId>& names, const eastl::vector<NameId>& otherNames)
+        {
+            return eastl::any_of(names.begin(), names.end(), [&otherNames](const NameId& name)
+            {
+                return eastl::find(otherNames.begin(), otherNames.end(), name) != otherNames.end();
+            });
+        }
+
+        bool phasesConflict(const FramePhaseDesc& phase1, const FramePhaseDesc& phase2)
+        {
+            if (phase1.exclusive || phase2.exclusive)
+            {
+                return true;
+            }
+
+            return containsAny(phase1.writes, phase2.writes) ||
+                   containsAny(phase1.writes, phase2.reads) ||
+                   containsAny(phase2.writes, phase1.reads);
+        }
+    }  // namespace
+
+    struct FrameTaskGraph::Phase
+    {
+        FramePhaseDesc desc;
+        NameId counterName;
+
+        /**
+            Earlier phases this phase waits for.
+         */
+        eastl::vector<uint32_t> dependencies;
+
+        /**
+            Later phases that wait for this phase.
+         */
+        eastl::vector<uint32_t> dependents;
+
+        std::atomic<uint32_t> pendingDependencies = 0;
+        uint64_t beginNs = 0;
+        uint64_t endNs = 0;
+
+        Phase(FramePhaseDesc inDesc) :
+            desc(std::move(inDesc))
+        {
+            eastl::string name = "Frame phase: ";
+            name.append(desc.name.getString().data(), desc.name.getString().size());
+            counterName = NameId{eastl::string_view{name.data(), name.size()}};
+        }
+    };
+
+    FrameTaskGraph::FrameTaskGraph() = default;
+
+    FrameTaskGraph::~FrameTaskGraph() = default;
+
+    FrameTaskGraph::PhaseId FrameTaskGraph::addPhase(FramePhaseDesc desc)
+    {
+        NAU_ASSERT(desc.name, "Frame phase must have a name");
+        NAU_ASSERT(desc.callback, "Frame phase ({}) has no callback", desc.name.getString());
+
+        const auto phaseIndex = static_cast<uint32_t>(m_phases.size());
+        auto& phase = m_phases.emplace_back(std::make_unique<Phase>(std::move(desc)));
+
+        // the edges to all conflicting phases (not only to the nearest ones): the graph is built once and is small
+        for (uint32_t i = 0; i < phaseIndex; ++i)
+        {
+            if (phasesConflict(m_phases[i]->desc, phase->desc))
+            {
+                phase->dependencies.push_back(i);
+                m_phases[i]->dependents.push_back(phaseIndex);
+            }
+        }
+
+        if (phase->dependencies.empty())
+        {
+            m_rootPhases.push_back(phaseIndex);
+        }
+
+        return phaseIndex;
+    }
+
+    size_t FrameTaskGraph::getPhasesCount() const
+    {
+        return m_phases.size();
+    }
+
+    void FrameTaskGraph::run(float dt)
+    {
+        if (m_phases.empty())
+        {
+            m_lastFrameStatistics = {};
+            return;
+        }
+
+        m_dt = dt;
+        m_executor = async::Executor::getDefault();
+        m_completedCount = 0;
+        NAU_ASSERT(m_mainThreadQueue.empty());
+
+        for (auto& phase : m_phases)
+        {
+            phase->pendingDependencies.store(static_cast<uint32_t>(phase->dependencies.size()), std::memory_order_relaxed);
+        }
+
+        const uint64_t frameBeginNs = diag::CpuProfiler::getTimeNs();
+
+        for (const uint32_t phaseIndex : m_rootPhases)
+        {
+            schedulePhase(phaseIndex);
+        }
+
+        while (true)
+        {
+            uint32_t phaseIndex = 0;
+            {
+                std::unique_lock lock{m_mutex};
+                m_signal.wait(lock, [this]
+                {
+                    return !m_mainThreadQueue.empty() || m_completedCount == m_phases.size();
+                });
+
+                if (m_mainThreadQueue.empty())
+                {
+                    break;
+                }
+
+                // the earliest added phase first: without the executor the phases run in the order they were added
+                auto nextPhase = eastl::min_element(m_mainThreadQueue.begin(), m_mainThreadQueue.end());
+                phaseIndex = *nextPhase;
+                m_mainThreadQueue.erase(nextPhase);
+            }
+
+            runPhases(phaseIndex);
+        }
+
+        m_executor.reset();
+        collectStatistics(frameBeginNs, diag::CpuProfiler::getTimeNs());
+    }
+
+    const FrameTaskGraph::FrameStatistics& FrameTaskGraph::getLastFrameStatistics() const
+    {
+        return m_lastFrameStatistics;
+    }
+
+    void FrameTaskGraph::executePhaseInvocation(void* graph, void* phaseIndex) noexcept
+    {
+        reinterpret_cast<FrameTaskGraph*>(graph)->runPhases(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(phaseIndex)));
+    }
+
+    bool FrameTaskGraph::runsOnMainThread(const Phase& phase) const
+    {
+        return phase.desc.mainThreadOnly || !m_executor;
+    }
+
+    void FrameTaskGraph::schedulePhase(uint32_t phaseIndex)
+    {
+        if (runsOnMainThread(*m_phases[phaseIndex]))
+        {
+            const std::lock_guard lock{m_mutex};
+            m_mainThreadQueue.push_back(phaseIndex);
+            m_signal.notify_all();
+        }
+        else
+        {
+            m_executor->execute(executePhaseInvocation, this, reinterpret_cast<void*>(static_cast<uintptr_t>(phaseIndex)));
+        }
+    }
+
+    void FrameTaskGraph::runPhases(uint32_t phaseIndex)
+    {
+        while (true)
+        {
+            Phase& phase = *m_phases[phaseIndex];
+
+            phase.beginNs = diag::CpuProfiler::getTimeNs();
+            {
+                const diag::CpuProfiler::Zone zone{phase.desc.name.c_str()};
+                phase.desc.callback(m_dt);
+            }
+            phase.endNs = diag::CpuProfiler::getTimeNs();
+
+            // one of the ready dependents (that can run on this thread) is run right here instead of scheduling it
+            eastl::optional<uint32_t> nextPhaseIndex;
+            for (const uint32_t dependentIndex : phase.dependents)
+            {
+                Phase& dependent = *m_phases[dependentIndex];
+                if (dependent.pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                {
+                    continue;
+                }
+
+                if (!nextPhaseIndex && runsOnMainThread(dependent) == runsOnMainThread(phase))
+                {
+                    nextPhaseIndex = dependentIndex;
+                }
+                else
+                {
+                    schedulePhase(dependentIndex);
+                }
+            }
+
+            // the frame can not be completed while this thread holds the next phase,
+            // otherwise run() can return right after the unlock: the graph must not be touched after that
+            {
+                const std::lock_guard lock{m_mutex};
+                ++m_completedCount;
+                if (m_completedCount == m_phases.size())
+                {
+                    m_signal.notify_all();
+                }
+            }
+
+            if (!nextPhaseIndex)
+            {
+                return;
+            }
+
+            phaseIndex = *nextPhaseIndex;
+        }
+    }
+
+    void FrameTaskGraph::collectStatistics(uint64_t frameBeginNs, uint64_t frameEndNs)
+    {
+        FrameStatistics& statistics = m_lastFrameStatistics;
+        statistics.wallNs = frameEndNs - frameBeginNs;
+        statistics.sumNs = 0;
+        statistics.criticalPathNs = 0;
+        statistics.phases.resize(m_phases.size());
+
+        // dependencies are always added earlier, so the phases are already in the topological order
+        eastl::vector<uint64_t> pathNs(m_phases.size(), 0);
+
+        for (size_t i = 0; i < m_phases.size(); ++i)
+        {
+            const Phase& phase = *m_phases[i];
+            const uint64_t durationNs = phase.endNs - phase.beginNs;
+
+            uint64_t dependenciesPathNs = 0;
+            for (const uint32_t dependencyIndex : phase.dependencies)
+            {
+                dependenciesPathNs = eastl::max(dependenciesPathNs, pathNs[dependencyIndex]);
+            }
+
+            pathNs[i] = dependenciesPathNs + durationNs;
+            statistics.criticalPathNs = eastl::max(statistics.criticalPathNs, pathNs[i]);
+            statistics.sumNs += durationNs;
+            statistics.phases[i] = PhaseTiming{
+                .name = phase.desc.name,
+                .beginNs = phase.beginNs - frameBeginNs,
+                .durationNs = durationNs};
+
+            diag::CpuProfiler::recordCounter(phase.counterName.c_str(), static_cast<int64_t>(durationNs / 1000));
+        }
+
+        diag::CpuProfiler::recordCounter("Frame graph: wall (us)", static_cast<int64_t>(statistics.wallNs / 1000));
+        diag::CpuProfiler::recordCounter("Frame graph: critical path (us)", static_cast<int64_t>(statistics.criticalPathNs / 1000));
+    }
+}  // namespace nau
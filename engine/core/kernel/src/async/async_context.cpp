@@ -0,0 +1,26 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <utility>
+
+#include "nau/async/async_context.h"
+
+namespace nau::async
+{
+    namespace
+    {
+        static thread_local AsyncContext* s_currentContext = nullptr;
+    }
+
+    AsyncContext* AsyncContext::getCurrent()
+    {
+        return s_currentContext;
+    }
+
+    AsyncContext* AsyncContext::setCurrent(AsyncContext* context)
+    {
+        return std::exchange(s_currentContext, context);
+    }
+
+}  // namespace nau::async
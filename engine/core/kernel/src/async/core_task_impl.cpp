@@ -6,6 +6,7 @@
 
 #include <iostream>
 
+#include "nau/diag/cpu_profiler.h"
 #include "nau/memory/general_allocator.h"
 #include "nau/utils/scope_guard.h"
 
@@ -130,6 +131,8 @@ namespace nau::async
     {
         lock_(g_aliveTasksMutex);
         g_aliveTasks.emplace(this, TaskCreationInfo{});
+
+        diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::Begin, this);
     }
 
     CoreTaskImpl::~CoreTaskImpl()
@@ -188,6 +191,8 @@ namespace nau::async
             setFlagsOnce(m_flags, TaskFlag_Ready);
         }
 
+        diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::End, this);
+
         invokeReadyCallback();
         tryScheduleContinuation();
 
@@ -230,6 +235,12 @@ namespace nau::async
         }
 
         setFlagsOnce(m_flags, TaskFlag_HasContinuation);
+        if (!isReady())
+        {
+            // the awaiter is suspended until the task is ready
+            diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::Suspend, this);
+        }
+
         tryScheduleContinuation();
     }
 
@@ -316,6 +327,8 @@ namespace nau::async
         NAU_ASSERT(continuation);
         NAU_ASSERT(!m_continuation);
 
+        diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::Resume, this);
+
         Executor::Ptr executor = continuation.executor ? std::move(continuation.executor) : Executor::getCurrent();
         if (executor && m_isContinueOnCapturedExecutor.load(std::memory_order_acquire))
         {
@@ -7,6 +7,7 @@
 #include "osApiWrappers/dag_cpuJobs.h"
 #include "nau/async/executor.h"
 #include "nau/diag/assertion.h"
+#include "nau/diag/cpu_profiler.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/threading/lock_guard.h"
 #include "nau/threading/spin_lock.h"
@@ -55,6 +56,7 @@ namespace nau::async
                 lock_(m_mutex);
                 m_invocations.emplace_back(std::move(invocation));
                 ++m_taskCounter;
+                diag::CpuProfiler::recordCounter("DagThreadPoolExecutor queue", static_cast<int64_t>(m_invocations.size()));
             }
 
             threadpool::add(this);
@@ -86,6 +88,7 @@ namespace nau::async
 
                 auto i = std::move(*head);
                 eraseInvocation(head);
+                diag::CpuProfiler::recordCounter("DagThreadPoolExecutor queue", static_cast<int64_t>(m_invocations.size()));
                 return i;
             };
 
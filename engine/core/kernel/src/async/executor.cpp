@@ -4,6 +4,7 @@
 
 #include "nau/async/executor.h"
 
+#include "nau/diag/cpu_profiler.h"
 #include "nau/utils/scope_guard.h"
 
 namespace nau::async
@@ -204,6 +205,7 @@ namespace nau::async
         NAU_ASSERT(getThisThreadInvokedExecutor() == &executor, "Invalid executor.");
         NAU_ASSERT(invocation);
 
+        const diag::CpuProfiler::Zone zone{"Executor::invoke"};
         invocation();
     }
 
@@ -214,6 +216,7 @@ namespace nau::async
 
         for(auto& invocation : invocations)
         {
+            const diag::CpuProfiler::Zone zone{"Executor::invoke"};
             invocation();
         }
     }
@@ -4,6 +4,7 @@
 
 #include "nau/async/thread_pool_executor.h"
 
+#include "nau/diag/cpu_profiler.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/runtime/internal/runtime_object_registry.h"
@@ -79,6 +80,7 @@ namespace nau::async
             const std::lock_guard lock{m_mutex};
 
             m_invocations.emplace_back(std::move(invocation));
+            diag::CpuProfiler::recordCounter("ThreadPoolExecutor queue", static_cast<int64_t>(m_invocations.size()));
             m_signal.notify_all();
         }
 
@@ -94,6 +96,11 @@ namespace nau::async
             }
         }
 
+        size_t getConcurrency() const noexcept override
+        {
+            return m_threads.size();
+        }
+
         bool hasWorks() override
         {
             return m_taskCounter.load() > 0;
@@ -112,6 +119,7 @@ namespace nau::async
                     auto head = m_invocations.begin();
                     invocation = std::move(*head);
                     eraseInvocation(head);
+                    diag::CpuProfiler::recordCounter("ThreadPoolExecutor queue", static_cast<int64_t>(m_invocations.size()));
                 }
                 else if (m_isActive)
                 {
@@ -5,6 +5,7 @@
 #include "nau/async/work_queue.h"
 
 #include "nau/async/task_base.h"
+#include "nau/diag/cpu_profiler.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/runtime/internal/runtime_object_registry.h"
@@ -137,6 +138,7 @@ namespace nau
 
             if (!m_invocations.empty())
             {
+                diag::CpuProfiler::recordCounter("WorkQueue queue", 0);
                 invocations.resize(m_invocations.size());
                 std::move(m_invocations.begin(), m_invocations.end(), invocations.begin());
                 m_invocations.clear();
@@ -209,6 +211,7 @@ namespace nau
     {
         lock_(m_mutex);
         m_invocations.emplace_back(std::move(invocation));
+        diag::CpuProfiler::recordCounter("WorkQueue queue", static_cast<int64_t>(m_invocations.size()));
 
         notifyInternal();
     }
@@ -0,0 +1,561 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/diag/cpu_profiler.h"
+
+#include <EASTL/deque.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::diag
+{
+    namespace
+    {
+        enum class EventType : uint8_t
+        {
+            Zone,
+            Frame,
+            Counter,
+            Task
+        };
+
+        struct Event
+        {
+            uint64_t timeNs;
+            uint64_t value;  ///< Zone duration, frame index, counter value or task id.
+            const char* name;
+            EventType type;
+            CpuProfiler::TaskEvent taskEvent;
+        };
+
+        /**
+            Single writer ring buffer. The reader copies the events without locking the writer
+            and drops the ones that could be overwritten while they were copied.
+         */
+        class ThreadBuffer
+        {
+        public:
+            ThreadBuffer(uint32_t threadId, size_t capacity) :
+                threadId(threadId),
+                m_mask(capacity - 1),
+                m_events(new Event[capacity])
+            {
+                NAU_ASSERT(std::has_single_bit(capacity));
+            }
+
+            void push(const Event& event)
+            {
+                const uint64_t index = m_writeIndex.load(std::memory_order_relaxed);
+                m_events[index & m_mask] = event;
+                m_writeIndex.store(index + 1, std::memory_order_release);
+            }
+
+            void read(eastl::vector<Event>& events) const
+            {
+                const uint64_t capacity = m_mask + 1;
+                const uint64_t end = m_writeIndex.load(std::memory_order_acquire);
+                const uint64_t begin = std::max(m_readStart.load(std::memory_order_relaxed), end > capacity ? end - capacity : 0);
+
+                const size_t offset = events.size();
+                for (uint64_t index = begin; index < end; ++index)
+                {
+                    events.push_back(m_events[index & m_mask]);
+                }
+
+                // the writer can be writing the slot of the index newEnd, that overwrites the event (newEnd - capacity)
+                std::atomic_thread_fence(std::memory_order_acquire);
+                const uint64_t newEnd = m_writeIndex.load(std::memory_order_relaxed);
+                if (newEnd + 1 > begin + capacity)
+                {
+                    const uint64_t dropCount = std::min(end - begin, newEnd + 1 - capacity - begin);
+                    events.erase(events.begin() + offset, events.begin() + offset + dropCount);
+                }
+            }
+
+            void reset()
+            {
+                m_readStart.store(m_writeIndex.load(std::memory_order_acquire), std::memory_order_relaxed);
+            }
+
+            const uint32_t threadId;
+            eastl::string name;
+            bool isFinished = false;
+
+        private:
+            const uint64_t m_mask;
+            const eastl::unique_ptr<Event[]> m_events;
+            std::atomic<uint64_t> m_writeIndex = 0;
+            std::atomic<uint64_t> m_readStart = 0;
+        };
+
+        class ProfilerState
+        {
+        public:
+            ThreadBuffer* attachThread(const char* name)
+            {
+                const size_t capacity = std::bit_ceil(std::max<size_t>(threadBufferSize.load(std::memory_order_relaxed), 1024));
+
+                const std::lock_guard lock{m_mutex};
+                ThreadBuffer* const buffer = m_threads.emplace_back(eastl::make_unique<ThreadBuffer>(m_nextThreadId++, capacity)).get();
+                buffer->name = name;
+                return buffer;
+            }
+
+            /**
+                The buffer of the finished thread is kept till the next reset: its events are still written to the trace.
+             */
+            void detachThread(ThreadBuffer* buffer)
+            {
+                const std::lock_guard lock{m_mutex};
+                buffer->isFinished = true;
+            }
+
+            void setThreadName(ThreadBuffer* buffer, const char* name)
+            {
+                const std::lock_guard lock{m_mutex};
+                buffer->name = name;
+            }
+
+            void addFrame(uint64_t timeNs)
+            {
+                const std::lock_guard lock{m_framesMutex};
+
+                if (m_hasFrameBegin)
+                {
+                    m_frames.push_back({m_frameIndex - 1, m_frameBeginNs, timeNs - m_frameBeginNs});
+                    if (m_frames.size() > CpuProfiler::MaxFramesHistory)
+                    {
+                        m_frames.pop_front();
+                    }
+                }
+
+                m_frameBeginNs = timeNs;
+                m_hasFrameBegin = true;
+                ++m_frameIndex;
+            }
+
+            eastl::vector<CpuProfiler::FrameStatistics> getFrames()
+            {
+                const std::lock_guard lock{m_framesMutex};
+                return {m_frames.begin(), m_frames.end()};
+            }
+
+            void reset()
+            {
+                {
+                    const std::lock_guard lock{m_mutex};
+
+                    m_threads.erase(eastl::remove_if(m_threads.begin(), m_threads.end(), [](const eastl::unique_ptr<ThreadBuffer>& buffer)
+                    {
+                        return buffer->isFinished;
+                    }), m_threads.end());
+
+                    for (auto& buffer : m_threads)
+                    {
+                        buffer->reset();
+                    }
+                }
+
+                const std::lock_guard lock{m_framesMutex};
+                m_frames.clear();
+                m_frameIndex = 0;
+                m_hasFrameBegin = false;
+            }
+
+            template <typename F>
+            void visitThreads(F&& callback)
+            {
+                eastl::vector<Event> events;
+
+                const std::lock_guard lock{m_mutex};
+                for (const auto& buffer : m_threads)
+                {
+                    events.clear();
+                    buffer->read(events);
+                    callback(*buffer, events);
+                }
+            }
+
+            std::atomic<bool> enabled = false;
+            std::atomic<size_t> threadBufferSize = CpuProfiler::DefaultThreadBufferSize;
+
+        private:
+            std::mutex m_mutex;
+            eastl::vector<eastl::unique_ptr<ThreadBuffer>> m_threads;
+            uint32_t m_nextThreadId = 1;
+
+            std::mutex m_framesMutex;
+            eastl::deque<CpuProfiler::FrameStatistics> m_frames;
+            uint64_t m_frameIndex = 0;
+            uint64_t m_frameBeginNs = 0;
+            bool m_hasFrameBegin = false;
+        };
+
+        ProfilerState& getProfilerState()
+        {
+            // never destroyed: zones can be recorded by the other static objects destructors
+            static ProfilerState& state = *new ProfilerState;
+            return state;
+        }
+
+        struct ThreadState
+        {
+            static constexpr size_t MaxNameLength = 63;
+
+            ThreadBuffer* buffer = nullptr;
+            bool released = false;
+            char name[MaxNameLength + 1] = {};
+        };
+
+        thread_local constinit ThreadState t_threadState = {};
+
+        struct ThreadStateGuard
+        {
+            bool initialized = false;
+
+            ~ThreadStateGuard()
+            {
+                if (t_threadState.buffer)
+                {
+                    getProfilerState().detachThread(t_threadState.buffer);
+                    t_threadState.buffer = nullptr;
+                }
+                t_threadState.released = true;
+            }
+        };
+
+        thread_local ThreadStateGuard t_threadStateGuard;
+
+        /**
+            @return The buffer of the calling thread or nullptr if the thread is finishing.
+         */
+        inline ThreadBuffer* getThreadBuffer()
+        {
+            ThreadState& thread = t_threadState;
+            if (thread.buffer || thread.released)
+            {
+                return thread.buffer;
+            }
+
+            // registers the guard destructor for the thread
+            t_threadStateGuard.initialized = true;
+            thread.buffer = getProfilerState().attachThread(thread.name);
+            return thread.buffer;
+        }
+
+        inline void pushEvent(const Event& event)
+        {
+            if (ThreadBuffer* const buffer = getThreadBuffer())
+            {
+                buffer->push(event);
+            }
+        }
+
+        class TraceWriter
+        {
+        public:
+            static constexpr size_t FlushSize = 64 * 1024;
+
+            explicit TraceWriter(io::IStreamWriter& stream) :
+                m_stream(stream)
+            {
+            }
+
+            template <typename... Args>
+            void append(const char* format, Args... args)
+            {
+                m_buffer.append_sprintf(format, args...);
+                flushIfNeeded();
+            }
+
+            void appendString(eastl::string_view str)
+            {
+                m_buffer.push_back('"');
+                for (const char c : str)
+                {
+                    if (c == '"' || c == '\\')
+                    {
+                        m_buffer.push_back('\\');
+                        m_buffer.push_back(c);
+                    }
+                    else if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        m_buffer.append_sprintf("\\u%04x", static_cast<unsigned>(c));
+                    }
+                    else
+                    {
+                        m_buffer.push_back(c);
+                    }
+                }
+                m_buffer.push_back('"');
+            }
+
+            void beginEvent()
+            {
+                m_buffer.append(m_hasEvents ? ",\n" : "\n");
+                m_hasEvents = true;
+            }
+
+            Result<> finish()
+            {
+                flush();
+                if (m_error)
+                {
+                    return m_error;
+                }
+
+                return ResultSuccess;
+            }
+
+        private:
+            void flushIfNeeded()
+            {
+                if (m_buffer.size() >= FlushSize)
+                {
+                    flush();
+                }
+            }
+
+            void flush()
+            {
+                if (!m_error && !m_buffer.empty())
+                {
+                    auto result = m_stream.write(reinterpret_cast<const std::byte*>(m_buffer.data()), m_buffer.size());
+                    if (result.isError())
+                    {
+                        m_error = result.getError();
+                    }
+                }
+
+                m_buffer.clear();
+            }
+
+            io::IStreamWriter& m_stream;
+            eastl::string m_buffer;
+            bool m_hasEvents = false;
+            Error::Ptr m_error;
+        };
+
+        inline double toMicroseconds(uint64_t timeNs)
+        {
+            return static_cast<double>(timeNs) / 1000.0;
+        }
+
+        const char* getTaskPhase(CpuProfiler::TaskEvent event)
+        {
+            switch (event)
+            {
+                case CpuProfiler::TaskEvent::Begin:
+                    return "b";
+                case CpuProfiler::TaskEvent::End:
+                    return "e";
+                default:
+                    return "n";
+            }
+        }
+
+        const char* getTaskEventName(CpuProfiler::TaskEvent event)
+        {
+            switch (event)
+            {
+                case CpuProfiler::TaskEvent::Suspend:
+                    return "Suspend";
+                case CpuProfiler::TaskEvent::Resume:
+                    return "Resume";
+                default:
+                    return "Task";
+            }
+        }
+    }  // namespace
+
+    CpuProfiler::Zone::Zone(const char* name) noexcept :
+        m_name(name && CpuProfiler::isEnabled() ? name : nullptr),
+        m_beginNs(m_name ? CpuProfiler::getTimeNs() : 0)
+    {
+    }
+
+    CpuProfiler::Zone::~Zone()
+    {
+        if (m_name)
+        {
+            pushEvent({m_beginNs, CpuProfiler::getTimeNs() - m_beginNs, m_name, EventType::Zone});
+        }
+    }
+
+    void CpuProfiler::setEnabled(bool enabled)
+    {
+        getProfilerState().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool CpuProfiler::isEnabled()
+    {
+        return getProfilerState().enabled.load(std::memory_order_relaxed);
+    }
+
+    void CpuProfiler::setThreadBufferSize(size_t eventsCount)
+    {
+        getProfilerState().threadBufferSize.store(eventsCount, std::memory_order_relaxed);
+    }
+
+    void CpuProfiler::setThreadName(const char* name)
+    {
+        ThreadState& thread = t_threadState;
+        strncpy(thread.name, name ? name : "", ThreadState::MaxNameLength);
+
+        if (thread.buffer)
+        {
+            getProfilerState().setThreadName(thread.buffer, thread.name);
+        }
+    }
+
+    void CpuProfiler::markFrame()
+    {
+        ProfilerState& state = getProfilerState();
+        if (!state.enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const uint64_t timeNs = getTimeNs();
+        pushEvent({timeNs, 0, "Frame", EventType::Frame});
+        state.addFrame(timeNs);
+    }
+
+    void CpuProfiler::recordCounter(const char* name, int64_t value)
+    {
+        if (isEnabled())
+        {
+            pushEvent({getTimeNs(), static_cast<uint64_t>(value), name, EventType::Counter});
+        }
+    }
+
+    void CpuProfiler::recordTaskEvent(TaskEvent event, const void* task)
+    {
+        if (isEnabled())
+        {
+            pushEvent({getTimeNs(), reinterpret_cast<uintptr_t>(task), getTaskEventName(event), EventType::Task, event});
+        }
+    }
+
+    void CpuProfiler::reset()
+    {
+        getProfilerState().reset();
+    }
+
+    eastl::vector<CpuProfiler::FrameStatistics> CpuProfiler::getFrames()
+    {
+        return getProfilerState().getFrames();
+    }
+
+    eastl::vector<CpuProfiler::ZoneStatistics> CpuProfiler::getZoneStatistics()
+    {
+        eastl::unordered_map<eastl::string_view, ZoneStatistics> zones;
+
+        getProfilerState().visitThreads([&zones](const ThreadBuffer&, const eastl::vector<Event>& events)
+        {
+            for (const Event& event : events)
+            {
+                if (event.type != EventType::Zone)
+                {
+                    continue;
+                }
+
+                ZoneStatistics& zone = zones[event.name];
+                zone.name = event.name;
+                ++zone.count;
+                zone.totalNs += event.value;
+                zone.maxNs = std::max(zone.maxNs, event.value);
+            }
+        });
+
+        eastl::vector<ZoneStatistics> result;
+        result.reserve(zones.size());
+        for (const auto& [name, zone] : zones)
+        {
+            result.push_back(zone);
+        }
+
+        return result;
+    }
+
+    Result<> CpuProfiler::writeChromeTrace(io::IStreamWriter& stream)
+    {
+        TraceWriter writer{stream};
+        writer.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+        // frames are shown on the separate track
+        writer.beginEvent();
+        writer.append("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}");
+        for (const FrameStatistics& frame : getFrames())
+        {
+            writer.beginEvent();
+            writer.append("{\"ph\":\"X\",\"name\":\"Frame\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"index\":%llu}}",
+                          toMicroseconds(frame.beginNs), toMicroseconds(frame.durationNs), static_cast<unsigned long long>(frame.index));
+        }
+
+        getProfilerState().visitThreads([&writer](const ThreadBuffer& buffer, const eastl::vector<Event>& events)
+        {
+            const unsigned tid = buffer.threadId;
+
+            writer.beginEvent();
+            writer.append("{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", tid);
+            if (buffer.name.empty())
+            {
+                writer.append("\"Thread %u\"}}", tid);
+            }
+            else
+            {
+                writer.appendString(buffer.name);
+                writer.append("}}");
+            }
+
+            for (const Event& event : events)
+            {
+                writer.beginEvent();
+                writer.append("{\"name\":");
+                writer.appendString(event.name);
+
+                switch (event.type)
+                {
+                    case EventType::Zone:
+                        writer.append(",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", tid, toMicroseconds(event.timeNs), toMicroseconds(event.value));
+                        break;
+                    case EventType::Frame:
+                        writer.append(",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", tid, toMicroseconds(event.timeNs));
+                        break;
+                    case EventType::Counter:
+                        writer.append(",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%lld}}", tid, toMicroseconds(event.timeNs),
+                                      static_cast<long long>(event.value));
+                        break;
+                    case EventType::Task:
+                        writer.append(",\"cat\":\"task\",\"ph\":\"%s\",\"id\":\"0x%llx\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", getTaskPhase(event.taskEvent),
+                                      static_cast<unsigned long long>(event.value), tid, toMicroseconds(event.timeNs));
+                        break;
+                }
+            }
+        });
+
+        writer.append("\n]}\n");
+        return writer.finish();
+    }
+
+    uint64_t CpuProfiler::getTimeNs()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        static const Clock::time_point startTime = Clock::now();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count());
+    }
+}  // namespace nau::diag
@@ -0,0 +1,108 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/diag/startup_trace.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+#include "nau/threading/lock_guard.h"
+
+namespace nau::diag
+{
+    namespace
+    {
+        std::mutex s_startupTraceMutex;
+        eastl::vector<StartupTraceEntry> s_startupTrace;
+
+        double toMilliseconds(std::chrono::nanoseconds time)
+        {
+            return std::chrono::duration<double, std::milli>{time}.count();
+        }
+    }  // namespace
+
+    void recordStartupTrace(StartupStage stage, eastl::string_view name, StartupTraceEntry::Clock::time_point startTime, StartupTraceEntry::Clock::time_point endTime)
+    {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+
+        lock_(s_startupTraceMutex);
+        s_startupTrace.push_back({stage, eastl::string{name}, startTime, std::max(duration, std::chrono::nanoseconds{0})});
+    }
+
+    eastl::vector<StartupTraceEntry> getStartupTrace()
+    {
+        lock_(s_startupTraceMutex);
+        return s_startupTrace;
+    }
+
+    std::chrono::nanoseconds getStartupTraceTotalTime()
+    {
+        lock_(s_startupTraceMutex);
+        if (s_startupTrace.empty())
+        {
+            return std::chrono::nanoseconds{0};
+        }
+
+        auto firstStart = s_startupTrace.front().startTime;
+        auto lastEnd = firstStart;
+        for (const StartupTraceEntry& entry : s_startupTrace)
+        {
+            firstStart = std::min(firstStart, entry.startTime);
+            lastEnd = std::max(lastEnd, entry.startTime + std::chrono::duration_cast<StartupTraceEntry::Clock::duration>(entry.duration));
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(lastEnd - firstStart);
+    }
+
+    void resetStartupTrace()
+    {
+        lock_(s_startupTraceMutex);
+        s_startupTrace.clear();
+    }
+
+    eastl::string formatStartupTraceReport(size_t maxEntries)
+    {
+        eastl::vector<StartupTraceEntry> entries = getStartupTrace();
+        eastl::string report;
+        auto out = std::back_inserter(report);
+
+        ::fmt::format_to(out, "Startup time: {:.2f} ms", toMilliseconds(getStartupTraceTotalTime()));
+
+        // the stage time is the sum of the operations durations: the operations that run concurrently are counted separately
+        for (const StartupStage stage : EnumTraits<StartupStage>::getValues())
+        {
+            std::chrono::nanoseconds stageTime{0};
+            size_t count = 0;
+            for (const StartupTraceEntry& entry : entries)
+            {
+                if (entry.stage == stage)
+                {
+                    stageTime += entry.duration;
+                    ++count;
+                }
+            }
+
+            if (count > 0)
+            {
+                ::fmt::format_to(out, "\n  {}: {:.2f} ms ({})", EnumTraits<StartupStage>::toString(stage), toMilliseconds(stageTime), count);
+            }
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const StartupTraceEntry& left, const StartupTraceEntry& right)
+        {
+            return left.duration > right.duration;
+        });
+
+        for (size_t i = 0, count = std::min(maxEntries, entries.size()); i < count; ++i)
+        {
+            const StartupTraceEntry& entry = entries[i];
+            ::fmt::format_to(out, "\n  {:.2f} ms: {} ({})", toMilliseconds(entry.duration), entry.name.c_str(), EnumTraits<StartupStage>::toString(entry.stage));
+        }
+
+        return report;
+    }
+}  // namespace nau::diag
@@ -0,0 +1,395 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/io/async_file_reader.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/deque.h>
+#include <EASTL/sort.h>
+
+#include "./async_file_reader_backend.h"
+#include "nau/diag/logging.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/service/service_provider.h"
+
+namespace nau::io
+{
+    namespace
+    {
+        /**
+            Upper bound of the chunks count of the merged read.
+         */
+        constexpr size_t MaxChunksPerOperation = 64;
+
+        constexpr size_t PrioritiesCount = static_cast<size_t>(AsyncReadPriority::High) + 1;
+
+        Result<size_t> readNativeFileSync(intptr_t nativeFile, uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers)
+        {
+            io_detail::AsyncReadOperation operation{.nativeFile = nativeFile, .offset = offset};
+            for (const eastl::span<std::byte>& buffer : buffers)
+            {
+                operation.chunks.push_back({.buffer = buffer.data(), .size = buffer.size()});
+                operation.size += buffer.size();
+            }
+
+            while (operation.bytesRead < operation.size)
+            {
+                const Result<size_t> readResult = io_detail::readNativeFileAt(nativeFile, operation);
+                if (readResult.isError())
+                {
+                    operation.complete(readResult);
+                    return readResult;
+                }
+
+                if (*readResult == 0)
+                {
+                    break;
+                }
+
+                operation.bytesRead += *readResult;
+            }
+
+            operation.complete(operation.bytesRead);
+            return operation.bytesRead;
+        }
+    }  // namespace
+
+    void io_detail::AsyncReadOperation::complete(Result<size_t> result)
+    {
+        if (result.isError())
+        {
+            for (AsyncReadChunk& chunk : chunks)
+            {
+                chunk.completion.reject(result.getError());
+            }
+
+            return;
+        }
+
+        size_t remaining = *result;
+        for (AsyncReadChunk& chunk : chunks)
+        {
+            const size_t chunkBytesRead = std::min(remaining, chunk.size);
+            remaining -= chunkBytesRead;
+            chunk.completion.resolve(chunkBytesRead);
+        }
+    }
+
+    bool io_detail::AsyncReadOperation::isCancelled() const
+    {
+        return eastl::all_of(chunks.begin(), chunks.end(), [](const AsyncReadChunk& chunk)
+        {
+            return chunk.cancellation.isCancelled();
+        });
+    }
+
+    /**
+     */
+    class AsyncFileReader final : public IAsyncFileReader,
+                                  public io_detail::AsyncReadCompletionHandler
+    {
+        NAU_CLASS_(nau::io::AsyncFileReader, IAsyncFileReader)
+
+    public:
+        AsyncFileReader(const AsyncFileReaderSettings& settings) :
+            m_settings(settings)
+        {
+            if (m_settings.queueDepth == 0)
+            {
+                m_settings.queueDepth = 1;
+            }
+
+            m_backend = io_detail::createThreadPoolAsyncReadBackend(m_settings, *this);
+            NAU_LOG_DEBUG("Async file reader uses ({}) backend", m_backend->getName());
+        }
+
+        ~AsyncFileReader()
+        {
+            Vector<io_detail::AsyncReadOperationPtr> pendingOperations;
+            {
+                const std::lock_guard lock{m_mutex};
+                m_isShuttingDown = true;
+                for (auto& queue : m_pendingOperations)
+                {
+                    for (auto& operation : queue)
+                    {
+                        pendingOperations.emplace_back(std::move(operation));
+                    }
+                    queue.clear();
+                }
+            }
+
+            for (auto& operation : pendingOperations)
+            {
+                operation->complete(NauMakeError("Async file reader is destroyed"));
+            }
+
+            // backend waits for all in-flight operations
+            m_backend.reset();
+        }
+
+    private:
+        Result<AsyncFileHandle> openFile(const char* path) override
+        {
+            const Result<intptr_t> nativeFile = io_detail::openNativeFileForAsyncRead(path);
+            NauCheckResult(nativeFile);
+
+            return static_cast<AsyncFileHandle>(*nativeFile);
+        }
+
+        void closeFile(AsyncFileHandle file) override
+        {
+            if (file != AsyncFileHandle::Invalid)
+            {
+                io_detail::closeNativeFileForAsyncRead(static_cast<intptr_t>(file));
+            }
+        }
+
+        Result<uint64_t> getFileSize(AsyncFileHandle file) override
+        {
+            NAU_ASSERT(file != AsyncFileHandle::Invalid);
+            return io_detail::getNativeFileSize(static_cast<intptr_t>(file));
+        }
+
+        async::Task<size_t> read(const AsyncReadRequest& request) override
+        {
+            auto tasks = readBatch({&request, 1});
+            return std::move(tasks.front());
+        }
+
+        Vector<async::Task<size_t>> readBatch(eastl::span<const AsyncReadRequest> requests) override
+        {
+            Vector<async::Task<size_t>> tasks(requests.size());
+            if (requests.empty())
+            {
+                return tasks;
+            }
+
+            // Requests are grouped by priority and file and ordered by offset: so adjacent ranges become neighbours.
+            Vector<size_t> order(requests.size());
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                order[i] = i;
+            }
+
+            eastl::sort(order.begin(), order.end(), [&requests](size_t left, size_t right)
+            {
+                const AsyncReadRequest& l = requests[left];
+                const AsyncReadRequest& r = requests[right];
+                if (l.priority != r.priority)
+                {
+                    return l.priority > r.priority;
+                }
+
+                if (l.file != r.file)
+                {
+                    return l.file < r.file;
+                }
+
+                return l.offset < r.offset;
+            });
+
+            Vector<io_detail::AsyncReadOperationPtr> operations;
+            for (const size_t index : order)
+            {
+                const AsyncReadRequest& request = requests[index];
+                NAU_ASSERT(request.file != AsyncFileHandle::Invalid);
+                NAU_ASSERT(request.buffer != nullptr || request.size == 0);
+
+                if (request.size == 0)
+                {
+                    tasks[index] = async::Task<size_t>::makeResolved(0);
+                    continue;
+                }
+
+                const intptr_t nativeFile = static_cast<intptr_t>(request.file);
+                io_detail::AsyncReadOperation* operation = operations.empty() ? nullptr : operations.back().get();
+
+                const bool canMerge = operation != nullptr &&
+                                      operation->nativeFile == nativeFile &&
+                                      operation->priority == request.priority &&
+                                      operation->offset + operation->size == request.offset &&
+                                      operation->size + request.size <= m_settings.maxMergedReadSize &&
+                                      operation->chunks.size() < MaxChunksPerOperation;
+
+                if (!canMerge)
+                {
+                    operation = operations.emplace_back(eastl::make_unique<io_detail::AsyncReadOperation>()).get();
+                    operation->nativeFile = nativeFile;
+                    operation->offset = request.offset;
+                    operation->priority = request.priority;
+                }
+
+                io_detail::AsyncReadChunk& chunk = operation->chunks.emplace_back();
+                chunk.buffer = reinterpret_cast<std::byte*>(request.buffer);
+                chunk.size = request.size;
+                chunk.cancellation = request.cancellation;
+                tasks[index] = chunk.completion.getTask();
+                operation->size += request.size;
+            }
+
+            if (!operations.empty())
+            {
+                enqueueAndDispatch(operations);
+            }
+
+            return tasks;
+        }
+
+        const char* getBackendName() const override
+        {
+            return m_backend->getName();
+        }
+
+        void onReadCompleted(io_detail::AsyncReadOperationPtr operation, Result<size_t> result) override
+        {
+            // Dispatching the next operations before completing the tasks keeps the device busy while the continuations run.
+            {
+                Vector<io_detail::AsyncReadOperationPtr> nextOperations;
+                Vector<io_detail::AsyncReadOperationPtr> cancelledOperations;
+                {
+                    const std::lock_guard lock{m_mutex};
+                    NAU_FATAL(m_inFlightCount > 0);
+                    --m_inFlightCount;
+                    takeOperationsToSubmit(nextOperations, cancelledOperations);
+                }
+
+                if (!nextOperations.empty())
+                {
+                    m_backend->submit(nextOperations);
+                }
+
+                completeCancelled(cancelledOperations);
+            }
+
+            operation->complete(std::move(result));
+        }
+
+        void enqueueAndDispatch(Vector<io_detail::AsyncReadOperationPtr>& operations)
+        {
+            Vector<io_detail::AsyncReadOperationPtr> operationsToSubmit;
+            Vector<io_detail::AsyncReadOperationPtr> cancelledOperations;
+            {
+                const std::lock_guard lock{m_mutex};
+                if (!m_isShuttingDown)
+                {
+                    for (auto& operation : operations)
+                    {
+                        m_pendingOperations[static_cast<size_t>(operation->priority)].emplace_back(std::move(operation));
+                    }
+                    operations.clear();
+
+                    takeOperationsToSubmit(operationsToSubmit, cancelledOperations);
+                }
+            }
+
+            for (auto& operation : operations)
+            {
+                operation->complete(NauMakeError("Async file reader is destroyed"));
+            }
+
+            if (!operationsToSubmit.empty())
+            {
+                m_backend->submit(operationsToSubmit);
+            }
+
+            completeCancelled(cancelledOperations);
+        }
+
+        /**
+            Must be called under m_mutex.
+            The cancelled operations are taken out of the queue without occupying the in-flight slots.
+         */
+        void takeOperationsToSubmit(Vector<io_detail::AsyncReadOperationPtr>& operations, Vector<io_detail::AsyncReadOperationPtr>& cancelledOperations)
+        {
+            for (size_t i = PrioritiesCount; i > 0 && m_inFlightCount < m_settings.queueDepth; --i)
+            {
+                auto& queue = m_pendingOperations[i - 1];
+                while (!queue.empty() && m_inFlightCount < m_settings.queueDepth)
+                {
+                    io_detail::AsyncReadOperationPtr operation = std::move(queue.front());
+                    queue.pop_front();
+
+                    if (operation->isCancelled())
+                    {
+                        cancelledOperations.emplace_back(std::move(operation));
+                        continue;
+                    }
+
+                    operations.emplace_back(std::move(operation));
+                    ++m_inFlightCount;
+                }
+            }
+        }
+
+        static void completeCancelled(Vector<io_detail::AsyncReadOperationPtr>& operations)
+        {
+            for (auto& operation : operations)
+            {
+                operation->complete(NauMakeError("Read is cancelled"));
+            }
+        }
+
+        AsyncFileReaderSettings m_settings;
+        eastl::unique_ptr<io_detail::IAsyncReadBackend> m_backend;
+
+        std::mutex m_mutex;
+        eastl::deque<io_detail::AsyncReadOperationPtr> m_pendingOperations[PrioritiesCount];
+        size_t m_inFlightCount = 0;
+        bool m_isShuttingDown = false;
+    };
+
+    IAsyncFileReader::Ptr createAsyncFileReader(const AsyncFileReaderSettings& settings)
+    {
+        return rtti::createInstance<AsyncFileReader, IAsyncFileReader>(settings);
+    }
+
+    async::Task<size_t> io_detail::readNativeFileAsync(intptr_t nativeFile, uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        if (cancellation.isCancelled())
+        {
+            co_return NauMakeError("Read is cancelled");
+        }
+
+        IAsyncFileReader* const reader = hasServiceProvider() ? getServiceProvider().find<IAsyncFileReader>() : nullptr;
+        if (!reader)
+        {
+            co_return readNativeFileSync(nativeFile, offset, buffers);
+        }
+
+        // The buffers list is copied into the requests before the first suspension: the caller's list can be temporary.
+        Vector<AsyncReadRequest> requests;
+        requests.reserve(buffers.size());
+
+        uint64_t requestOffset = offset;
+        for (const eastl::span<std::byte>& buffer : buffers)
+        {
+            requests.push_back({static_cast<AsyncFileHandle>(nativeFile), requestOffset, buffer.data(), buffer.size(), AsyncReadPriority::Normal, cancellation});
+            requestOffset += buffer.size();
+        }
+
+        Vector<async::Task<size_t>> tasks = reader->readBatch(requests);
+
+        // Even if one of the reads fails, the others still write into the buffers: all of them must be completed before returning.
+        co_await async::whenAll(tasks);
+
+        size_t totalBytesRead = 0;
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            if (tasks[i].isRejected())
+            {
+                co_return tasks[i].getError();
+            }
+
+            const size_t bytesRead = *tasks[i];
+            totalBytesRead += bytesRead;
+            if (bytesRead < requests[i].size)
+            {
+                break;
+            }
+        }
+
+        co_return totalBytesRead;
+    }
+}  // namespace nau::io
@@ -0,0 +1,95 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/fixed_vector.h>
+#include <EASTL/unique_ptr.h>
+
+#include "nau/async/task_base.h"
+#include "nau/io/async_file_reader.h"
+
+namespace nau::io::io_detail
+{
+    /**
+     */
+    struct AsyncReadChunk
+    {
+        std::byte* buffer;
+        size_t size;
+        Cancellation cancellation;
+        async::TaskSource<size_t> completion;
+    };
+
+    /**
+        Single native read: one request or a run of adjacent requests of the same file that are read with one vectored call.
+     */
+    struct AsyncReadOperation
+    {
+        intptr_t nativeFile;
+        uint64_t offset;
+        size_t size = 0;
+        size_t bytesRead = 0;
+        AsyncReadPriority priority;
+        eastl::fixed_vector<AsyncReadChunk, 4> chunks;
+
+        /**
+            Distributes the read bytes among the chunks and completes their tasks.
+         */
+        void complete(Result<size_t> result);
+
+        /**
+            The operation is not issued when all of its chunks are cancelled.
+         */
+        bool isCancelled() const;
+    };
+
+    using AsyncReadOperationPtr = eastl::unique_ptr<AsyncReadOperation>;
+
+    /**
+        Performs native reads. Each submitted operation must be passed back with AsyncReadCompletionHandler exactly once.
+     */
+    class NAU_ABSTRACT_TYPE IAsyncReadBackend
+    {
+    public:
+        virtual ~IAsyncReadBackend() = default;
+
+        virtual const char* getName() const = 0;
+
+        virtual void submit(eastl::span<AsyncReadOperationPtr> operations) = 0;
+    };
+
+    /**
+     */
+    struct NAU_ABSTRACT_TYPE AsyncReadCompletionHandler
+    {
+        virtual ~AsyncReadCompletionHandler() = default;
+
+        virtual void onReadCompleted(AsyncReadOperationPtr operation, Result<size_t> result) = 0;
+    };
+
+    /**
+        Platform specific primitives, implemented under src/platform.
+     */
+    Result<intptr_t> openNativeFileForAsyncRead(const char* path);
+
+    void closeNativeFileForAsyncRead(intptr_t nativeFile);
+
+    Result<uint64_t> getNativeFileSize(intptr_t nativeFile);
+
+    /**
+        Synchronous positional read into the operation's chunks, starting from operation.bytesRead.
+        Returns the number of bytes read by the call: 0 means the end of the file.
+     */
+    Result<size_t> readNativeFileAt(intptr_t nativeFile, const AsyncReadOperation& operation);
+
+    eastl::unique_ptr<IAsyncReadBackend> createThreadPoolAsyncReadBackend(const AsyncFileReaderSettings& settings, AsyncReadCompletionHandler& completionHandler);
+
+    /**
+        Reads the native file (opened as by openNativeFileForAsyncRead, the file pointer is not used) into the buffers one after another.
+        The reads are issued with the IAsyncFileReader service: the calling thread is not blocked.
+        Without the service (no application is running) the file is read synchronously.
+     */
+    async::Task<size_t> readNativeFileAsync(intptr_t nativeFile, uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation);
+
+}  // namespace nau::io::io_detail
@@ -0,0 +1,147 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <EASTL/deque.h>
+
+#include <condition_variable>
+
+#include "./async_file_reader_backend.h"
+#include "nau/threading/set_thread_name.h"
+
+namespace nau::io::io_detail
+{
+    namespace
+    {
+        unsigned getDefaultWorkerThreadsCount()
+        {
+            constexpr unsigned MinThreadsCount = 2;
+            constexpr unsigned MaxThreadsCount = 8;
+
+            return std::clamp(std::thread::hardware_concurrency() / 2, MinThreadsCount, MaxThreadsCount);
+        }
+    }  // namespace
+
+    /**
+        Performs blocking positional reads on its own threads: the default executor's threads are never blocked with I/O.
+     */
+    class ThreadPoolAsyncReadBackend final : public IAsyncReadBackend
+    {
+    public:
+        ThreadPoolAsyncReadBackend(const AsyncFileReaderSettings& settings, AsyncReadCompletionHandler& completionHandler) :
+            m_completionHandler(completionHandler)
+        {
+            const unsigned threadsCount = settings.workerThreads > 0 ? settings.workerThreads : getDefaultWorkerThreadsCount();
+            m_threads.reserve(threadsCount);
+
+            for (unsigned i = 0; i < threadsCount; ++i)
+            {
+                m_threads.emplace_back([this, i]
+                {
+                    threading::setThisThreadName(std::format("Nau AsyncRead-{}", i + 1));
+                    threadWork();
+                });
+            }
+        }
+
+        ~ThreadPoolAsyncReadBackend()
+        {
+            {
+                const std::lock_guard lock{m_mutex};
+                m_isStopped = true;
+            }
+
+            m_signal.notify_all();
+
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+
+            NAU_ASSERT(m_operations.empty());
+        }
+
+        const char* getName() const override
+        {
+            return "thread_pool";
+        }
+
+        void submit(eastl::span<AsyncReadOperationPtr> operations) override
+        {
+            {
+                const std::lock_guard lock{m_mutex};
+                for (auto& operation : operations)
+                {
+                    m_operations.emplace_back(std::move(operation));
+                }
+            }
+
+            if (operations.size() == 1)
+            {
+                m_signal.notify_one();
+            }
+            else
+            {
+                m_signal.notify_all();
+            }
+        }
+
+    private:
+        static Result<size_t> performRead(AsyncReadOperation& operation)
+        {
+            while (operation.bytesRead < operation.size)
+            {
+                const Result<size_t> readResult = readNativeFileAt(operation.nativeFile, operation);
+                NauCheckResult(readResult);
+
+                if (*readResult == 0)
+                {
+                    break;
+                }
+
+                operation.bytesRead += *readResult;
+            }
+
+            return operation.bytesRead;
+        }
+
+        void threadWork()
+        {
+            while (true)
+            {
+                AsyncReadOperationPtr operation;
+                {
+                    std::unique_lock lock{m_mutex};
+                    // pending operations are always drained before the thread exits: the reader relies on every operation being completed
+                    m_signal.wait(lock, [this]
+                    {
+                        return m_isStopped || !m_operations.empty();
+                    });
+
+                    if (m_operations.empty())
+                    {
+                        return;
+                    }
+
+                    operation = std::move(m_operations.front());
+                    m_operations.pop_front();
+                }
+
+                Result<size_t> result = performRead(*operation);
+                m_completionHandler.onReadCompleted(std::move(operation), std::move(result));
+            }
+        }
+
+        AsyncReadCompletionHandler& m_completionHandler;
+        std::vector<std::thread> m_threads;
+        std::mutex m_mutex;
+        std::condition_variable m_signal;
+        eastl::deque<AsyncReadOperationPtr> m_operations;
+        bool m_isStopped = false;
+    };
+
+    eastl::unique_ptr<IAsyncReadBackend> createThreadPoolAsyncReadBackend(const AsyncFileReaderSettings& settings, AsyncReadCompletionHandler& completionHandler)
+    {
+        return eastl::make_unique<ThreadPoolAsyncReadBackend>(settings, completionHandler);
+    }
+}  // namespace nau::io::io_detail
@@ -10,6 +10,40 @@
 
 namespace nau::io
 {
+    namespace
+    {
+        /**
+            The memory stream data is already available: the read is completed within the call.
+         */
+        async::Task<size_t> readMemoryAsync(eastl::span<const std::byte> data, uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, const Cancellation& cancellation)
+        {
+            if (cancellation.isCancelled())
+            {
+                return async::Task<size_t>::makeRejected(NauMakeError("Read is cancelled"));
+            }
+
+            size_t readOffset = static_cast<size_t>(std::min<uint64_t>(offset, data.size()));
+            size_t totalRead = 0;
+            for (const eastl::span<std::byte>& buffer : buffers)
+            {
+                const size_t readCount = std::min(data.size() - readOffset, buffer.size());
+                if (readCount > 0)
+                {
+                    memcpy(buffer.data(), data.data() + readOffset, readCount);
+                }
+
+                readOffset += readCount;
+                totalRead += readCount;
+                if (readCount < buffer.size())
+                {
+                    break;
+                }
+            }
+
+            return async::Task<size_t>::makeResolved(totalRead);
+        }
+    }  // namespace
+
     /**
      */
     class MemoryStream final : public IMemoryStream
@@ -32,6 +66,10 @@ namespace nau::io
 
         eastl::span<const std::byte> getBufferAsSpan(size_t offset, std::optional<size_t> size) const override;
 
+        Result<eastl::span<const std::byte>> readSpan(size_t count) override;
+
+        async::Task<size_t> readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation) override;
+
     private:
         BytesBuffer m_buffer;
         size_t m_pos = 0;
@@ -120,6 +158,22 @@ namespace nau::io
     {
     }
 
+    Result<eastl::span<const std::byte>> MemoryStream::readSpan(size_t count)
+    {
+        NAU_FATAL(m_pos <= m_buffer.size());
+
+        const size_t actualReadCount = std::min(m_buffer.size() - m_pos, count);
+        const eastl::span<const std::byte> data{m_buffer.data() + m_pos, actualReadCount};
+        m_pos += actualReadCount;
+
+        return data;
+    }
+
+    async::Task<size_t> MemoryStream::readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        return readMemoryAsync({m_buffer.data(), m_buffer.size()}, offset, buffers, cancellation);
+    }
+
     eastl::span<const std::byte> MemoryStream::getBufferAsSpan(size_t offset, std::optional<size_t> size) const
     {
         NAU_ASSERT(offset >= 0 && offset <= m_buffer.size(), "Invalid offset");
@@ -151,6 +205,10 @@ namespace nau::io
 
         eastl::span<const std::byte> getBufferAsSpan(size_t offset, std::optional<size_t> size) const override;
 
+        Result<eastl::span<const std::byte>> readSpan(size_t count) override;
+
+        async::Task<size_t> readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation) override;
+
     private:
         eastl::span<const std::byte> m_buffer;
         size_t m_pos = 0;
@@ -228,6 +286,22 @@ namespace nau::io
     {
     }
 
+    Result<eastl::span<const std::byte>> ReadOnlyMemoryStream::readSpan(size_t count)
+    {
+        NAU_FATAL(m_pos <= m_buffer.size());
+
+        const size_t actualReadCount = std::min(m_buffer.size() - m_pos, count);
+        const eastl::span<const std::byte> data{m_buffer.data() + m_pos, actualReadCount};
+        m_pos += actualReadCount;
+
+        return data;
+    }
+
+    async::Task<size_t> ReadOnlyMemoryStream::readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        return readMemoryAsync(m_buffer, offset, buffers, cancellation);
+    }
+
     eastl::span<const std::byte> ReadOnlyMemoryStream::getBufferAsSpan(size_t offset, std::optional<size_t> size) const
     {
         NAU_ASSERT(offset >= 0 && offset <= m_buffer.size(), "Invalid offset");
@@ -253,4 +327,16 @@ namespace nau::io
     {
         return rtti::createInstanceWithAllocator<MemoryStream, IMemoryStream>(std::move(allocator), std::move(buffer));
     }
-}  // namespace nau::io
\ No newline at end of file
+
+    async::Task<IStreamReader::Ptr> readStreamToMemoryAsync(IStreamReader::Ptr src, Cancellation cancellation)
+    {
+        NAU_ASSERT(src);
+        if (src->as<IMemoryStream*>())
+        {
+            co_return src;
+        }
+
+        BytesBuffer content = co_await readStreamToBufferAsync(src, std::move(cancellation));
+        co_return createMemoryStream(std::move(content), AccessMode::Read);
+    }
+}  // namespace nau::io
@@ -89,9 +89,10 @@ namespace nau::io
         }
         NAU_ASSERT(contentLength != 0);
         
-        BytesBuffer buffer(contentLength);
-        NAU_VERIFY(*stream->read(buffer.data(), contentLength) == contentLength);
-        RuntimeValue::Ptr result = *serialization::jsonParseString(strings::toU8StringView(asStringView(buffer)));
+        BytesBuffer buffer;
+        const eastl::span<const std::byte> content = *io::readStreamAsSpan(*stream, contentLength, buffer);
+        NAU_VERIFY(content.size() == contentLength);
+        RuntimeValue::Ptr result = *serialization::jsonParseString(eastl::string_view{reinterpret_cast<const char*>(content.data()), content.size()});
         
         return eastl::make_tuple(result, contentLength + headerLength);
     }
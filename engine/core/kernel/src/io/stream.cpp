@@ -49,30 +49,38 @@ namespace nau::io
             return 0;
         }
 
-        size_t readOffset = 0;
-        BytesBuffer buffer(size);
-        for(; readOffset < size;)
-        {
-            const size_t readCount = size - readOffset;
-            const auto readResult = src.read(reinterpret_cast<std::byte*>(buffer.data()) + readOffset, readCount);
-            NauCheckResult(readResult);
+        BytesBuffer buffer;
+        const auto data = readStreamAsSpan(src, size, buffer);
+        NauCheckResult(data);
 
-            if(*readResult == 0)
-            {
-                break;
-            }
-
-            readOffset += *readResult;
-            NAU_ASSERT(readOffset <= size);
-        }
-
-        return *dst.write(buffer.data(), size);
+        return dst.write(data->data(), data->size());
     }
 
     Result<size_t> copyStream(IStreamWriter& dst, IStreamReader& src)
     {
         constexpr size_t BlockSize = 4096;
 
+        if(auto* const spanReader = src.as<IStreamSpanReader*>())
+        {
+            size_t totalRead = 0;
+            do
+            {
+                const auto data = spanReader->readSpan(std::numeric_limits<size_t>::max());
+                NauCheckResult(data);
+                if(data->empty())
+                {
+                    break;
+                }
+
+                totalRead += data->size();
+
+                const auto writeResult = dst.write(data->data(), data->size());
+                NauCheckResult(writeResult);
+            } while(true);
+
+            return totalRead;
+        }
+
         BytesBuffer buffer(BlockSize);
         size_t totalRead = 0;
 
@@ -99,4 +107,123 @@ namespace nau::io
 
         return totalRead;
     }
+
+    Result<eastl::span<const std::byte>> readStreamAsSpan(IStreamReader& src, size_t count, BytesBuffer& fallbackBuffer)
+    {
+        constexpr size_t BlockSize = 4096;
+
+        if(count == 0)
+        {
+            return eastl::span<const std::byte>{};
+        }
+
+        size_t readOffset = 0;
+
+        if(auto* const spanReader = src.as<IStreamSpanReader*>())
+        {
+            const auto data = spanReader->readSpan(count);
+            NauCheckResult(data);
+            if(data->size() == count || data->empty())
+            {
+                return *data;
+            }
+
+            const auto nextData = spanReader->readSpan(count - data->size());
+            NauCheckResult(nextData);
+            if(nextData->empty())
+            {
+                // the view covers the rest of the stream
+                return *data;
+            }
+
+            // the data is not contiguous (e.g. spans the mapped regions): the rest goes through the copy
+            readOffset = data->size() + nextData->size();
+            fallbackBuffer.resize(readOffset);
+            memcpy(fallbackBuffer.data(), data->data(), data->size());
+            memcpy(fallbackBuffer.data() + data->size(), nextData->data(), nextData->size());
+        }
+
+        while(readOffset < count)
+        {
+            // the unknown (up to the end of the stream) size is read with the growing blocks
+            const size_t readCount = std::min(count - readOffset, std::max(BlockSize, readOffset));
+            if(fallbackBuffer.size() < readOffset + readCount)
+            {
+                fallbackBuffer.resize(readOffset + readCount);
+            }
+
+            const auto readResult = src.read(fallbackBuffer.data() + readOffset, readCount);
+            NauCheckResult(readResult);
+
+            if(*readResult == 0)
+            {
+                break;
+            }
+
+            readOffset += *readResult;
+        }
+
+        fallbackBuffer.resize(readOffset);
+        return eastl::span<const std::byte>{fallbackBuffer.data(), readOffset};
+    }
+
+    async::Task<size_t> readStreamAsync(IStreamReader::Ptr src, eastl::span<std::byte> buffer, Cancellation cancellation)
+    {
+        NAU_ASSERT(src);
+        if(cancellation.isCancelled())
+        {
+            co_return NauMakeError("Read is cancelled");
+        }
+
+        auto* const asyncReader = src->as<IAsyncStreamReader*>();
+        if(!asyncReader)
+        {
+            co_return copyFromStream(buffer.data(), buffer.size(), *src);
+        }
+
+        const size_t position = src->getPosition();
+        const eastl::span<std::byte> buffers[] = {buffer};
+
+        const size_t bytesRead = co_await asyncReader->readAsync(position, buffers, std::move(cancellation));
+        src->setPosition(OffsetOrigin::Begin, static_cast<int64_t>(position + bytesRead));
+
+        co_return bytesRead;
+    }
+
+    async::Task<BytesBuffer> readStreamToBufferAsync(IStreamReader::Ptr src, Cancellation cancellation)
+    {
+        NAU_ASSERT(src);
+        if(cancellation.isCancelled())
+        {
+            co_return NauMakeError("Read is cancelled");
+        }
+
+        if(!src->as<IAsyncStreamReader*>())
+        {
+            BytesBuffer buffer;
+            const auto data = readStreamAsSpan(*src, std::numeric_limits<size_t>::max(), buffer);
+            if(data.isError())
+            {
+                co_return data.getError();
+            }
+
+            if(data->data() != buffer.data())
+            {
+                buffer.resize(data->size());
+                memcpy(buffer.data(), data->data(), data->size());
+            }
+
+            co_return std::move(buffer);
+        }
+
+        const size_t position = src->getPosition();
+        const size_t endPosition = src->setPosition(OffsetOrigin::End, 0);
+        src->setPosition(OffsetOrigin::Begin, static_cast<int64_t>(position));
+
+        BytesBuffer buffer(endPosition > position ? endPosition - position : 0);
+        const size_t bytesRead = co_await readStreamAsync(src, {buffer.data(), buffer.size()}, std::move(cancellation));
+        buffer.resize(bytesRead);
+
+        co_return std::move(buffer);
+    }
 }  // namespace nau::io
@@ -5,11 +5,35 @@
 #include "./virtual_file_system_impl.h"
 
 #include "nau/threading/lock_guard.h"
+#include "nau/utils/scope_guard.h"
 
 namespace nau::io
 {
     namespace
     {
+        size_t getLookupKindIndex(std::optional<FsEntryKind> kind)
+        {
+            return kind ? static_cast<size_t>(*kind) + 1 : 0;
+        }
+
+        IFile::Ptr openMountedFile(IFileSystem& fileSystem, const FsPath& relativePath, const FsPath& vfsPath, AccessModeFlag accessMode, OpenFileMode openMode)
+        {
+            auto file = fileSystem.openFile(relativePath, accessMode, openMode);
+            if(!file)
+            {
+                return nullptr;
+            }
+
+            auto* const fileInternal = file->as<io_detail::IFileInternal*>();
+            NAU_ASSERT(fileInternal, "io_detail::IFileInternal must be implemented");
+            if(fileInternal)
+            {
+                fileInternal->setVfsPath(vfsPath);
+            }
+
+            return file;
+        }
+
         struct NAU_ABSTRACT_TYPE DirIteratorImplBase
         {
             using FsNode = VirtualFileSystemImpl::FsNode;
@@ -174,14 +198,19 @@ namespace nau::io
         return m_name;
     }
 
+    VirtualFileSystemImpl::FsNode* VirtualFileSystemImpl::FsNode::findChildNoLock(std::string_view name) const
+    {
+        auto iter = m_childrenByName.find(eastl::string_view{name.data(), name.size()});
+        return iter != m_childrenByName.end() ? iter->second : nullptr;
+    }
+
     Result<VirtualFileSystemImpl::FsNode*> VirtualFileSystemImpl::FsNode::getChild(std::string_view name)
     {
         lock_(m_mutex);
 
-        auto iter = findChildIter(name);
-        if(iter != m_children.end())
+        if(FsNode* const child = findChildNoLock(name))
         {
-            return &(*iter);
+            return child;
         }
 
         NAU_ASSERT(m_mountedFs.empty());
@@ -190,18 +219,17 @@ namespace nau::io
             return NauMakeError("Already has mounted fs");
         }
 
-        m_children.emplace_back(std::string{name});
+        FsNode* const child = m_children.emplace_back(eastl::make_unique<FsNode>(std::string{name})).get();
+        // key references the child's own name, which lives as long as the child
+        m_childrenByName.emplace(eastl::string_view{child->m_name.data(), child->m_name.size()}, child);
 
-        return &m_children.back();
+        return child;
     }
 
     VirtualFileSystemImpl::FsNode* VirtualFileSystemImpl::FsNode::findChild(std::string_view name)
     {
         lock_(m_mutex);
-
-        auto iter = findChildIter(name);
-
-        return iter != m_children.end() ? &(*iter) : nullptr;
+        return findChildNoLock(name);
     }
 
     VirtualFileSystemImpl::FsNode* VirtualFileSystemImpl::FsNode::getNextChild(const FsNode* current)
@@ -209,21 +237,20 @@ namespace nau::io
         lock_(m_mutex);
         if(current == nullptr)
         {
-            return !m_children.empty() ? &m_children.front() : nullptr;
+            return !m_children.empty() ? m_children.front().get() : nullptr;
         }
 
-        auto nextChild = m_children.end();
+        auto iter = eastl::find_if(m_children.begin(), m_children.end(), [current](const eastl::unique_ptr<FsNode>& child)
+        {
+            return child.get() == current;
+        });
 
-        for(auto iter = m_children.begin(); iter != m_children.end(); ++iter)
+        if(iter == m_children.end() || ++iter == m_children.end())
         {
-            if(&(*iter) == current)
-            {
-                nextChild = ++iter;
-                break;
-            }
+            return nullptr;
         }
 
-        return nextChild != m_children.end() ? &(*nextChild) : nullptr;
+        return iter->get();
     }
 
     IFileSystem::Ptr VirtualFileSystemImpl::FsNode::getNextMountedFs(IFileSystem* current)
@@ -271,11 +298,39 @@ namespace nau::io
             }
         }
 
-        m_mountedFs.emplace_back(std::move(fileSystem), priority);
+        m_hasOnlyImmutableFs = m_hasOnlyImmutableFs && fileSystem->isImmutable();
+
+        // keep higher priority first, file systems with the same priority are looked up in the mount order
+        auto position = std::upper_bound(m_mountedFs.begin(), m_mountedFs.end(), priority, [](unsigned value, const FileSystemEntry& entry)
+        {
+            return value > entry.priority;
+        });
+
+        m_mountedFs.insert(position, FileSystemEntry{std::move(fileSystem), priority});
         return {};
     }
-    void VirtualFileSystemImpl::FsNode::unmount(const IFileSystem::Ptr&)
+
+    bool VirtualFileSystemImpl::FsNode::unmount(const IFileSystem::Ptr& fileSystem)
     {
+        lock_(m_mutex);
+
+        auto iter = eastl::remove_if(m_mountedFs.begin(), m_mountedFs.end(), [&fileSystem](const FileSystemEntry& entry)
+        {
+            return entry.fs.get() == fileSystem.get();
+        });
+
+        if(iter == m_mountedFs.end())
+        {
+            return false;
+        }
+
+        m_mountedFs.erase(iter, m_mountedFs.end());
+        m_hasOnlyImmutableFs = std::all_of(m_mountedFs.begin(), m_mountedFs.end(), [](const FileSystemEntry& entry)
+        {
+            return entry.fs->isImmutable();
+        });
+
+        return true;
     }
 
     eastl::vector<VirtualFileSystemImpl::FileSystemEntry> VirtualFileSystemImpl::FsNode::getMountedFs()
@@ -290,6 +345,12 @@ namespace nau::io
         return !m_mountedFs.empty();
     }
 
+    bool VirtualFileSystemImpl::FsNode::hasOnlyImmutableMounts()
+    {
+        lock_(m_mutex);
+        return m_hasOnlyImmutableFs;
+    }
+
     VirtualFileSystemImpl::VirtualFileSystemImpl() :
         m_root("")
     {
@@ -302,25 +363,45 @@ namespace nau::io
 
     bool VirtualFileSystemImpl::exists(const FsPath& path, std::optional<FsEntryKind> kind)
     {
+        const uint64_t generation = m_mountGeneration.load(std::memory_order_acquire);
+        if(auto resolved = findResolvedPath(path, kind, generation))
+        {
+            return resolved->found;
+        }
+
+        ResolvedPath resolved{.generation = generation};
+        bool cacheable = true;
+
         auto [basePath, fsNode] = findFsNodeForPath(path);
 
         // first check only vurtual path (can be only directory)
         if(basePath == path)
         {
-            return !kind || (*kind == FsEntryKind::Directory);
+            resolved.found = !kind || (*kind == FsEntryKind::Directory);
         }
-
-        if(!fsNode || !fsNode->hasMounts())
+        else if(fsNode && fsNode->hasMounts())
         {
-            return false;
-        }
+            cacheable = fsNode->hasOnlyImmutableMounts();
+            resolved.relativePath = path.getRelativePath(basePath);
 
-        auto mountedFs = fsNode->getMountedFs();
+            for(auto& mountedFs : fsNode->getMountedFs())
+            {
+                if(mountedFs.fs->exists(resolved.relativePath, kind))
+                {
+                    resolved.fs = std::move(mountedFs.fs);
+                    resolved.found = true;
+                    break;
+                }
+            }
+        }
 
-        return std::any_of(mountedFs.begin(), mountedFs.end(), [relativePath = path.getRelativePath(basePath), kind](const FileSystemEntry& fsEntry)
+        const bool found = resolved.found;
+        if(cacheable)
         {
-            return fsEntry.fs->exists(relativePath, kind);
-        });
+            storeResolvedPath(path, kind, std::move(resolved));
+        }
+
+        return found;
     }
 
     size_t VirtualFileSystemImpl::getLastWriteTime(const FsPath&)
@@ -332,39 +413,72 @@ namespace nau::io
     {
         NAU_ASSERT((openMode == OpenFileMode::OpenExisting || accessMode && AccessMode::Write), "Specified openMode requires write access also");
 
+        const bool requireMutableAccess =
+            accessMode && AccessMode::Write ||
+            openMode != OpenFileMode::OpenExisting;
+
+        const uint64_t generation = m_mountGeneration.load(std::memory_order_acquire);
+        if(!requireMutableAccess)
+        {
+            if(auto resolved = findResolvedPath(path, FsEntryKind::File, generation))
+            {
+                if(!resolved->found)
+                {
+                    return nullptr;
+                }
+
+                if(auto file = openMountedFile(*resolved->fs, resolved->relativePath, path, accessMode, openMode))
+                {
+                    return file;
+                }
+
+                // the file can not be opened (even though the file system is immutable): do the full lookup again
+                dropResolvedPath(path, FsEntryKind::File);
+            }
+        }
+
         auto [basePath, fsNode] = findFsNodeForPath(path);
 
         if(!fsNode)
         {
+            if(!requireMutableAccess)
+            {
+                storeResolvedPath(path, FsEntryKind::File, ResolvedPath{.generation = generation});
+            }
+
             return nullptr;
         }
 
         auto relativePath = path.getRelativePath(basePath);
+        const bool cacheable = !requireMutableAccess && fsNode->hasOnlyImmutableMounts();
 
-        const bool requireMutableAccess =
-            accessMode && AccessMode::Write ||
-            openMode != OpenFileMode::OpenExisting;
-
-        for(const auto& mountedFs : fsNode->getMountedFs())
+        for(auto& mountedFs : fsNode->getMountedFs())
         {
             if(requireMutableAccess && mountedFs.fs->isReadOnly())
             {
                 continue;
             }
 
-            if(auto file = mountedFs.fs->openFile(relativePath, accessMode, openMode))
+            if(auto file = openMountedFile(*mountedFs.fs, relativePath, path, accessMode, openMode))
             {
-                auto* const fileInternal = file->as<io_detail::IFileInternal*>();
-                NAU_ASSERT(fileInternal, "io_detail::IFileInternal must be implemented");
-                if(fileInternal)
+                if(cacheable)
                 {
-                    fileInternal->setVfsPath(path);
+                    storeResolvedPath(path, FsEntryKind::File, ResolvedPath{
+                                                                   .fs = std::move(mountedFs.fs),
+                                                                   .relativePath = std::move(relativePath),
+                                                                   .found = true,
+                                                                   .generation = generation});
                 }
 
                 return file;
             }
         }
 
+        if(cacheable)
+        {
+            storeResolvedPath(path, FsEntryKind::File, ResolvedPath{.generation = generation});
+        }
+
         return nullptr;
     }
 
@@ -442,6 +556,12 @@ namespace nau::io
 
     Result<> VirtualFileSystemImpl::mount(const FsPath& path, IFileSystem::Ptr fileSystem, unsigned priority)
     {
+        // new (even empty) virtual directories also change the lookup results
+        scope_on_leave
+        {
+            invalidateResolvedPaths();
+        };
+
         FsNode* fsNode = &m_root;
 
         for(auto name : path.splitElements())
@@ -455,8 +575,34 @@ namespace nau::io
         return fsNode->mount(std::move(fileSystem), priority);
     }
 
-    void VirtualFileSystemImpl::unmount(IFileSystem::Ptr)
+    void VirtualFileSystemImpl::unmount(IFileSystem::Ptr fileSystem)
     {
+        if(!fileSystem)
+        {
+            return;
+        }
+
+        // nodes are never removed: they can be referenced by the opened directory iterators
+        eastl::vector<FsNode*> nodes{&m_root};
+        bool unmounted = false;
+
+        while(!nodes.empty())
+        {
+            FsNode* const fsNode = nodes.back();
+            nodes.pop_back();
+
+            unmounted = fsNode->unmount(fileSystem) || unmounted;
+
+            for(FsNode* child = fsNode->getNextChild(); child; child = fsNode->getNextChild(child))
+            {
+                nodes.push_back(child);
+            }
+        }
+
+        if(unmounted)
+        {
+            invalidateResolvedPaths();
+        }
     }
 
     std::wstring VirtualFileSystemImpl::resolveToNativePath(const FsPath& path)
@@ -506,6 +652,71 @@ namespace nau::io
         return std::tuple{std::move(basePath), fsNode};
     }
 
+    auto VirtualFileSystemImpl::getResolvedPathCacheShard(const FsPath& path) -> ResolvedPathCacheShard&
+    {
+        return m_resolvedPaths[path.getHashCode() % ResolvedPathCacheShards];
+    }
+
+    auto VirtualFileSystemImpl::findResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind, uint64_t generation) -> std::optional<ResolvedPath>
+    {
+        auto& shard = getResolvedPathCacheShard(path);
+        const auto& paths = shard.paths[getLookupKindIndex(kind)];
+
+        shared_lock_(shard.mutex);
+
+        auto iter = paths.find(path);
+        if(iter == paths.end() || iter->second.generation != generation)
+        {
+            return std::nullopt;
+        }
+
+        return iter->second;
+    }
+
+    void VirtualFileSystemImpl::storeResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind, ResolvedPath resolved)
+    {
+        // the lookup has started before the mount table change: its result can be already stale
+        if(resolved.generation != m_mountGeneration.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        auto& shard = getResolvedPathCacheShard(path);
+        auto& paths = shard.paths[getLookupKindIndex(kind)];
+
+        lock_(shard.mutex);
+
+        if(paths.size() >= MaxResolvedPathsPerShard)
+        {
+            paths.clear();
+        }
+
+        paths.insert_or_assign(path, std::move(resolved));
+    }
+
+    void VirtualFileSystemImpl::dropResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind)
+    {
+        auto& shard = getResolvedPathCacheShard(path);
+
+        lock_(shard.mutex);
+        shard.paths[getLookupKindIndex(kind)].erase(path);
+    }
+
+    void VirtualFileSystemImpl::invalidateResolvedPaths()
+    {
+        // entries of the previous generations are never returned, clearing only releases the memory and the unmounted file systems
+        m_mountGeneration.fetch_add(1, std::memory_order_acq_rel);
+
+        for(auto& shard : m_resolvedPaths)
+        {
+            lock_(shard.mutex);
+            for(auto& paths : shard.paths)
+            {
+                paths.clear();
+            }
+        }
+    }
+
     IVirtualFileSystem::Ptr createVirtualFileSystem()
     {
         return rtti::createInstance<VirtualFileSystemImpl>();
@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+#include <atomic>
+#include <shared_mutex>
+
 #include "nau/io/virtual_file_system.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/threading/spin_lock.h"
@@ -41,26 +46,32 @@ namespace nau::io
 
             Result<> mount(IFileSystem::Ptr&&, unsigned priority);
 
-            void unmount(const IFileSystem::Ptr&);
+            /**
+                @return true if the file system was mounted to this node.
+            */
+            bool unmount(const IFileSystem::Ptr&);
 
+            /**
+                Returns mounted file systems in the lookup order (higher priority first).
+            */
             eastl::vector<FileSystemEntry> getMountedFs();
 
             bool hasMounts();
 
-        private:
-            
-            decltype(auto) findChildIter(std::string_view name)
-            {
-                return std::find_if(m_children.begin(), m_children.end(), [name](const FsNode& c)
-                    {
-                        return c.m_name == name;
-                    });
-            }
+            /**
+                Returns true if all file systems mounted to this node are immutable (see IFileSystem::isImmutable),
+                i.e. lookup results within the node can change only through mount/unmount.
+            */
+            bool hasOnlyImmutableMounts();
 
+        private:
+            FsNode* findChildNoLock(std::string_view name) const;
 
             const std::string m_name;
-            eastl::list<FsNode> m_children;
+            eastl::vector<eastl::unique_ptr<FsNode>> m_children;  // creation order, used for the directory iteration
+            eastl::unordered_map<eastl::string_view, FsNode*> m_childrenByName;
             eastl::vector<FileSystemEntry> m_mountedFs;
+            bool m_hasOnlyImmutableFs = true;
             threading::SpinLock m_mutex;
         };
 
@@ -91,11 +102,42 @@ namespace nau::io
         std::wstring resolveToNativePath(const FsPath& path) override;
 
     private:
-      
+        static constexpr size_t ResolvedPathCacheShards = 16;
+        static constexpr size_t MaxResolvedPathsPerShard = 8192;
+
+        /**
+            Lookup result for the virtual path: the file system that wins the lookup and the path relative to it.
+            fs is null for the virtual directories (found == true) and for the negative lookups (found == false).
+        */
+        struct ResolvedPath
+        {
+            IFileSystem::Ptr fs;
+            FsPath relativePath;
+            bool found = false;
+            uint64_t generation = 0;
+        };
+
+        struct ResolvedPathCacheShard
+        {
+            std::shared_mutex mutex;
+            // indexed by the lookup kind: any, file, directory
+            eastl::unordered_map<FsPath, ResolvedPath> paths[3];
+        };
 
         std::tuple<FsPath, FsNode*> findFsNodeForPath(const FsPath& path);
 
-        FsNode m_root;
+        std::optional<ResolvedPath> findResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind, uint64_t generation);
+
+        void storeResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind, ResolvedPath resolved);
+
+        void dropResolvedPath(const FsPath& path, std::optional<FsEntryKind> kind);
 
+        void invalidateResolvedPaths();
+
+        ResolvedPathCacheShard& getResolvedPathCacheShard(const FsPath& path);
+
+        FsNode m_root;
+        std::atomic<uint64_t> m_mountGeneration = 0;
+        ResolvedPathCacheShard m_resolvedPaths[ResolvedPathCacheShards];
     };
 }  // namespace nau::io
\ No newline at end of file
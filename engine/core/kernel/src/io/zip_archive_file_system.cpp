@@ -2,345 +2,856 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
-#include "nau/io/file_system.h"
+#include "nau/io/zip_archive_file_system.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <limits>
+
+#include "nau/diag/logging.h"
+#include "nau/io/memory_stream.h"
+#include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/rtti_impl.h"
-#include "nau/utils/scope_guard.h"
-
-#if 0
 
 namespace nau::io
 {
+    namespace
+    {
+        constexpr uint32_t ZipLocalHeaderSignature = 0x04034b50;
+        constexpr uint32_t ZipCentralHeaderSignature = 0x02014b50;
+        constexpr uint32_t ZipEndOfCentralDirSignature = 0x06054b50;
+        constexpr uint32_t Zip64EndOfCentralDirSignature = 0x06064b50;
+        constexpr uint32_t Zip64EndOfCentralDirLocatorSignature = 0x07064b50;
+
+        constexpr size_t ZipLocalHeaderSize = 30;
+        constexpr size_t ZipCentralHeaderSize = 46;
+        constexpr size_t ZipEndOfCentralDirSize = 22;
+        constexpr size_t ZipMaxCommentSize = UINT16_MAX;
+        constexpr size_t Zip64EndOfCentralDirSize = 56;
+        constexpr size_t Zip64EndOfCentralDirLocatorSize = 20;
+        constexpr uint16_t Zip64ExtraFieldId = 0x0001;
+
+        constexpr uint16_t ZipMethodStored = 0;
+        constexpr uint16_t ZipMethodDeflated = 8;
+        constexpr uint16_t ZipFlagEncrypted = 0x0001;
+
+        /**
+            Deflated entries up to this size are inflated at once into the memory stream,
+            larger entries are decompressed on demand by the stream itself.
+         */
+        constexpr size_t ZipInflateAtOnceMaxSize = 256 * 1024;
+        constexpr size_t ZipInflateInputChunkSize = 64 * 1024;
+
+        inline uint16_t readU16(const std::byte* ptr)
+        {
+            const auto* const bytes = reinterpret_cast<const uint8_t*>(ptr);
+            return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+        }
+
+        inline uint32_t readU32(const std::byte* ptr)
+        {
+            return static_cast<uint32_t>(readU16(ptr)) | (static_cast<uint32_t>(readU16(ptr + 2)) << 16);
+        }
+
+        inline uint64_t readU64(const std::byte* ptr)
+        {
+            return static_cast<uint64_t>(readU32(ptr)) | (static_cast<uint64_t>(readU32(ptr + 4)) << 32);
+        }
+
+        /**
+            Converts the MS-DOS date/time of the entry (local time, low word is the time, high word is the date)
+            to the seconds since the epoch (as st_mtime), 0 if the value is not set.
+         */
+        size_t dosDateTimeToTime(uint32_t dosDateTime)
+        {
+            const uint32_t dosTime = dosDateTime & 0xFFFF;
+            const uint32_t dosDate = dosDateTime >> 16;
+            if (dosDate == 0)
+            {
+                return 0;
+            }
+
+            std::tm time{};
+            time.tm_sec = static_cast<int>((dosTime & 0x1F) * 2);
+            time.tm_min = static_cast<int>((dosTime >> 5) & 0x3F);
+            time.tm_hour = static_cast<int>(dosTime >> 11);
+            time.tm_mday = static_cast<int>(dosDate & 0x1F);
+            time.tm_mon = static_cast<int>((dosDate >> 5) & 0x0F) - 1;
+            time.tm_year = static_cast<int>(dosDate >> 9) + 80;
+            time.tm_isdst = -1;
+
+            const std::time_t result = std::mktime(&time);
+            return result > 0 ? static_cast<size_t>(result) : 0;
+        }
+
+        /**
+            Archive entries are addressed by the normalized relative path: elements are separated by '/', without leading/trailing separators.
+            The root directory has an empty key.
+         */
+        eastl::string makeEntryKey(std::string_view path)
+        {
+            eastl::string key;
+            key.reserve(path.size());
+
+            size_t elementStart = 0;
+            for (size_t i = 0; i <= path.size(); ++i)
+            {
+                if (i < path.size() && path[i] != '/' && path[i] != '\\')
+                {
+                    continue;
+                }
+
+                const std::string_view element = path.substr(elementStart, i - elementStart);
+                elementStart = i + 1;
+
+                if (element.empty() || element == ".")
+                {
+                    continue;
+                }
+
+                if (!key.empty())
+                {
+                    key.push_back('/');
+                }
+
+                key.append(element.data(), element.size());
+            }
+
+            return key;
+        }
+
+        inline eastl::string makeEntryKey(const FsPath& path)
+        {
+            return makeEntryKey(std::string_view{path.getCStr()});
+        }
+    }  // namespace
+
+    /**
+        Positional reader over the archive data.
+        Each entry stream owns its own reader, so there is no shared read position between the streams.
+     */
+    class ZipSourceReader
+    {
+    public:
+        ZipSourceReader(const std::byte* mappedData, size_t size) :
+            m_mappedData(mappedData),
+            m_size(size)
+        {
+        }
+
+        ZipSourceReader(IStreamReader::Ptr stream, size_t size) :
+            m_stream(std::move(stream)),
+            m_size(size)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_mappedData != nullptr || m_stream;
+        }
+
+        size_t getSize() const
+        {
+            return m_size;
+        }
+
+        /**
+            Returns pointer into the archive data if the archive is memory mapped, or nullptr.
+         */
+        const std::byte* getMappedData(size_t offset) const
+        {
+            NAU_ASSERT(offset <= m_size);
+            return m_mappedData ? m_mappedData + offset : nullptr;
+        }
+
+        Result<> readAt(size_t offset, std::byte* buffer, size_t count)
+        {
+            if (offset + count > m_size)
+            {
+                return NauMakeError("Read beyond zip archive size");
+            }
+
+            if (m_mappedData)
+            {
+                memcpy(buffer, m_mappedData + offset, count);
+                return ResultSuccess;
+            }
+
+            NAU_FATAL(m_stream);
+            m_stream->setPosition(OffsetOrigin::Begin, static_cast<int64_t>(offset));
+
+            const Result<size_t> readResult = copyFromStream(buffer, count, *m_stream);
+            NauCheckResult(readResult);
+
+            if (*readResult != count)
+            {
+                return NauMakeError("Unexpected end of zip archive");
+            }
+
+            return ResultSuccess;
+        }
+
+    private:
+        const std::byte* m_mappedData = nullptr;
+        IStreamReader::Ptr m_stream;
+        size_t m_size = 0;
+    };
+
+    /**
+     */
     class ZipArchiveFileSystem final : public IFileSystem
     {
         NAU_CLASS_(nau::io::ZipArchiveFileSystem, IFileSystem)
 
     public:
-        ZipArchiveFileSystem(IStreamReader::Ptr);
+        struct ZipEntry
+        {
+            size_t localHeaderOffset = 0;
+            size_t compressedSize = 0;
+            size_t uncompressedSize = 0;
+            uint16_t compressionMethod = ZipMethodStored;
+            uint32_t dosDateTime = 0;
+        };
+
+        ZipArchiveFileSystem(IFile::Ptr archiveFile);
         ~ZipArchiveFileSystem();
 
+        Result<> readCentralDirectory();
+
+        ZipSourceReader createSourceReader() const;
+
         bool isReadOnly() const override;
+
+        bool isImmutable() const override;
+
         bool exists(const FsPath&, std::optional<FsEntryKind>) override;
+
         size_t getLastWriteTime(const FsPath&) override;
+
         IFile::Ptr openFile(const FsPath&, AccessModeFlag accessMode, OpenFileMode openMode) override;
 
         OpenDirResult openDirIterator(const FsPath& path) override;
+
         void closeDirIterator(void*) override;
+
         FsEntry incrementDirIterator(void*) override;
 
     private:
-        struct ZipFsEntry : io::FsEntry
-        {
-            ::unz64_file_pos zipPos;
-            std::vector<std::byte> buffer;
-        };
-
         struct DirIteratorState
         {
-            const std::vector<const ZipFsEntry*> entries;
+            const eastl::vector<eastl::string>& children;
+            const eastl::string directoryKey;
             const FsPath path;
             size_t currentIndex = 0;
+        };
 
+        void addEntry(std::string_view entryName, const ZipEntry& entry);
 
-            DirIteratorState(std::vector<const ZipFsEntry*>&& inEntries, FsPath inPath) :
-                entries(std::move(inEntries)),
-                path(std::move(inPath))
-            {}
+        FsEntry makeFsEntry(const DirIteratorState& state) const;
 
-            FsEntry getCurrentFsEntry() const
-            {
-                if (entries.size() <= currentIndex)
-                {
-                    return {};
-                }
+        const IFile::Ptr m_archiveFile;
+        IMemoryMappableObject* m_mappableArchive = nullptr;
+        const std::byte* m_mappedData = nullptr;
+        size_t m_archiveSize = 0;
+
+        // The index is built once at construction and never modified after, so lookups do not require any locks.
+        eastl::unordered_map<eastl::string, ZipEntry> m_files;
+        eastl::unordered_map<eastl::string, eastl::vector<eastl::string>> m_directories;
+    };
+
+    /**
+     */
+    class ZipStoredEntryStream : public IStreamReader
+    {
+        NAU_CLASS_(nau::io::ZipStoredEntryStream, IStreamReader)
+
+    public:
+        ZipStoredEntryStream(nau::Ptr<ZipArchiveFileSystem> fileSystem, ZipSourceReader reader, size_t dataOffset, size_t size) :
+            m_fileSystem(std::move(fileSystem)),
+            m_reader(std::move(reader)),
+            m_dataOffset(dataOffset),
+            m_size(size)
+        {
+        }
 
-                const ZipFsEntry& zipEntry = *entries[currentIndex];
+        size_t getPosition() const override
+        {
+            return m_position;
+        }
 
-                //FsEntry entry = zipEntry;
-                //entry.path = path / zipEntry.path;
+        size_t setPosition(OffsetOrigin origin, int64_t offset) override
+        {
+            m_position = computeNewPosition(m_position, m_size, origin, offset);
+            return m_position;
+        }
 
-                return zipEntry;
+        Result<size_t> read(std::byte* buffer, size_t count) override
+        {
+            NAU_FATAL(m_position <= m_size);
+
+            const size_t actualReadCount = std::min(m_size - m_position, count);
+            if (actualReadCount == 0)
+            {
+                return 0;
             }
-        };
 
+            NauCheckResult(m_reader.readAt(m_dataOffset + m_position, buffer, actualReadCount));
+            m_position += actualReadCount;
 
-        static void* zipOpen(void* opaque, const void*, int mode) noexcept
+            return actualReadCount;
+        }
+
+        static size_t computeNewPosition(size_t currentPosition, size_t size, OffsetOrigin origin, int64_t offset)
         {
-            NAU_ASSERT(opaque);
-            auto& self = *reinterpret_cast<ZipArchiveFileSystem*>(opaque);
+            int64_t newPos = offset;
+            const int64_t currentSize = static_cast<int64_t>(size);
 
-            NAU_ASSERT(self.m_stream);
-            return self.m_stream.get();
+            if (origin == OffsetOrigin::Current)
+            {
+                newPos = static_cast<int64_t>(currentPosition) + offset;
+            }
+            else if (origin == OffsetOrigin::End)
+            {
+                newPos = currentSize + offset;
+            }
+#ifdef NAU_ASSERT_ENABLED
+            else
+            {
+                NAU_ASSERT(origin == OffsetOrigin::Begin);
+            }
+#endif
+
+            return static_cast<size_t>(std::clamp<int64_t>(newPos, 0, currentSize));
         }
 
-        static int zipClose([[maybe_unused]] void* opaque, [[maybe_unused]] void* streamPtr) noexcept
+    protected:
+        const nau::Ptr<ZipArchiveFileSystem> m_fileSystem;
+        ZipSourceReader m_reader;
+        const size_t m_dataOffset;
+        const size_t m_size;
+        size_t m_position = 0;
+    };
+
+    /**
+        Stored entry of the memory mapped archive: the data is handed out as views of the mapping,
+        which is kept alive by the file system the stream references.
+     */
+    class ZipMappedStoredEntryStream final : public ZipStoredEntryStream,
+                                             public IStreamSpanReader
+    {
+        NAU_CLASS_(nau::io::ZipMappedStoredEntryStream, ZipStoredEntryStream, IStreamSpanReader)
+
+    public:
+        ZipMappedStoredEntryStream(nau::Ptr<ZipArchiveFileSystem> fileSystem, ZipSourceReader reader, size_t dataOffset, size_t size) :
+            ZipStoredEntryStream(std::move(fileSystem), std::move(reader), dataOffset, size)
+        {
+            NAU_ASSERT(m_reader.getMappedData(m_dataOffset) != nullptr);
+        }
+
+        Result<eastl::span<const std::byte>> readSpan(size_t count) override
         {
-            NAU_ASSERT(opaque);
-            NAU_ASSERT(streamPtr);
+            NAU_FATAL(m_position <= m_size);
+
+            const size_t actualReadCount = std::min(m_size - m_position, count);
+            const eastl::span<const std::byte> data{m_reader.getMappedData(m_dataOffset + m_position), actualReadCount};
+            m_position += actualReadCount;
 
-            return 0;
+            return data;
         }
+    };
+
+    /**
+        Decompresses deflated entry while reading.
+        Seeking is lazy: forward seek skips the decompressed data on the next read, backward seek restarts decompression.
+     */
+    class ZipInflateEntryStream final : public IStreamReader
+    {
+        NAU_CLASS_(nau::io::ZipInflateEntryStream, IStreamReader)
 
-        static uint32_t zipRead(void*, void* streamPtr, void* buf, uint32_t count) noexcept
+    public:
+        ZipInflateEntryStream(nau::Ptr<ZipArchiveFileSystem> fileSystem, ZipSourceReader reader, size_t dataOffset, size_t compressedSize, size_t uncompressedSize) :
+            m_fileSystem(std::move(fileSystem)),
+            m_reader(std::move(reader)),
+            m_dataOffset(dataOffset),
+            m_compressedSize(compressedSize),
+            m_uncompressedSize(uncompressedSize)
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            m_zstream.zalloc = Z_NULL;
+            m_zstream.zfree = Z_NULL;
+            m_zstream.opaque = Z_NULL;
 
-            auto& streamReader = stream->as<IStreamReader&>();
+            // zip entries are stored as raw deflate data (without zlib header)
+            m_zstreamInitialized = ::inflateInit2(&m_zstream, -MAX_WBITS) == Z_OK;
+            NAU_ASSERT(m_zstreamInitialized);
+        }
 
-            const auto actualRead = streamReader.read(reinterpret_cast<std::byte*>(buf), static_cast<size_t>(count));
-            if(!actualRead)
-            {  // report error ?
-                return 0;
+        ~ZipInflateEntryStream()
+        {
+            if (m_zstreamInitialized)
+            {
+                ::inflateEnd(&m_zstream);
             }
+        }
 
-            return static_cast<uint32_t>(*actualRead);
+        size_t getPosition() const override
+        {
+            return m_position;
         }
 
-        static uint32_t zipWrite(void*, void*, const void*, uint32_t) noexcept
+        size_t setPosition(OffsetOrigin origin, int64_t offset) override
         {
-            NAU_ASSERT("Zip write is not supported");
-            return 0;
+            m_position = ZipStoredEntryStream::computeNewPosition(m_position, m_uncompressedSize, origin, offset);
+            return m_position;
+        }
+
+        Result<size_t> read(std::byte* buffer, size_t count) override
+        {
+            if (!m_zstreamInitialized)
+            {
+                return NauMakeError("Zip inflate stream is not initialized");
+            }
+
+            NAU_FATAL(m_position <= m_uncompressedSize);
+
+            if (m_position < m_inflatedPosition)
+            {
+                NauCheckResult(restart());
+            }
+
+            while (m_inflatedPosition < m_position)
+            {
+                std::array<std::byte, 4096> skipBuffer;
+                const size_t skipCount = std::min(skipBuffer.size(), m_position - m_inflatedPosition);
+                const Result<size_t> skipResult = inflateTo(skipBuffer.data(), skipCount);
+                NauCheckResult(skipResult);
+
+                if (*skipResult == 0)
+                {
+                    return NauMakeError("Unexpected end of deflated zip entry");
+                }
+            }
+
+            const size_t actualReadCount = std::min(m_uncompressedSize - m_position, count);
+            if (actualReadCount == 0)
+            {
+                return 0;
+            }
+
+            const Result<size_t> readResult = inflateTo(buffer, actualReadCount);
+            NauCheckResult(readResult);
+
+            m_position += *readResult;
+            return *readResult;
         }
 
-        static uint64_t zipTell(void*, void* streamPtr) noexcept
+    private:
+        Result<> restart()
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            if (::inflateReset(&m_zstream) != Z_OK)
+            {
+                return NauMakeError("Fail to reset zip inflate stream");
+            }
+
+            m_zstream.avail_in = 0;
+            m_inputOffset = 0;
+            m_inflatedPosition = 0;
 
-            return stream->getOffset();
+            return ResultSuccess;
         }
 
-        static long zipSeek(void*, void* streamPtr, uint64_t offset, int origin) noexcept
+        Result<size_t> inflateTo(std::byte* buffer, size_t count)
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            count = std::min<size_t>(count, std::numeric_limits<uInt>::max());
 
-            const auto seekOrigin = EXPR_Block -> OffsetOrigin
+            m_zstream.next_out = reinterpret_cast<Bytef*>(buffer);
+            m_zstream.avail_out = static_cast<uInt>(count);
+
+            while (m_zstream.avail_out > 0)
             {
-                if(origin == ZLIB_FILEFUNC_SEEK_END)
+                if (m_zstream.avail_in == 0 && m_inputOffset < m_compressedSize)
                 {
-                    return OffsetOrigin::End;
+                    if (const std::byte* const mappedInput = m_reader.getMappedData(m_dataOffset + m_inputOffset))
+                    {
+                        // Mapped archive: inflate directly from the archive memory.
+                        const size_t inputCount = std::min<size_t>(m_compressedSize - m_inputOffset, std::numeric_limits<uInt>::max());
+                        m_zstream.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(mappedInput));
+                        m_zstream.avail_in = static_cast<uInt>(inputCount);
+                        m_inputOffset += inputCount;
+                    }
+                    else
+                    {
+                        const size_t inputCount = std::min(m_compressedSize - m_inputOffset, ZipInflateInputChunkSize);
+                        m_inputBuffer.resize(ZipInflateInputChunkSize);
+                        NauCheckResult(m_reader.readAt(m_dataOffset + m_inputOffset, m_inputBuffer.data(), inputCount));
+
+                        m_zstream.next_in = reinterpret_cast<Bytef*>(m_inputBuffer.data());
+                        m_zstream.avail_in = static_cast<uInt>(inputCount);
+                        m_inputOffset += inputCount;
+                    }
                 }
-                else if(origin == ZLIB_FILEFUNC_SEEK_CUR)
+
+                const int inflateResult = ::inflate(&m_zstream, Z_NO_FLUSH);
+                if (inflateResult == Z_STREAM_END)
                 {
-                    return OffsetOrigin::Current;
+                    break;
                 }
 
-                NAU_ASSERT(origin == ZLIB_FILEFUNC_SEEK_SET);
-                return OffsetOrigin::Begin;
-            };
+                if (inflateResult != Z_OK)
+                {
+                    const bool inputExhausted = inflateResult == Z_BUF_ERROR && m_zstream.avail_in == 0 && m_inputOffset == m_compressedSize;
+                    if (inputExhausted)
+                    {
+                        break;
+                    }
 
-            [[maybe_unused]]
-            const auto newOffset = stream->setOffset(seekOrigin, offset);
+                    return NauMakeError("Inflate zip entry error ({})", inflateResult);
+                }
+            }
+
+            const size_t inflatedCount = count - static_cast<size_t>(m_zstream.avail_out);
+            m_inflatedPosition += inflatedCount;
 
-            return 0;
+            return inflatedCount;
         }
 
-        static int zipError(void*, void*) noexcept
+        const nau::Ptr<ZipArchiveFileSystem> m_fileSystem;
+        ZipSourceReader m_reader;
+        const size_t m_dataOffset;
+        const size_t m_compressedSize;
+        const size_t m_uncompressedSize;
+
+        z_stream m_zstream{};
+        bool m_zstreamInitialized = false;
+        eastl::vector<std::byte> m_inputBuffer;
+        size_t m_inputOffset = 0;
+        size_t m_inflatedPosition = 0;
+        size_t m_position = 0;
+    };
+
+    /**
+     */
+    class ZipArchiveFile final : public IFile,
+                                 public io_detail::IFileInternal
+    {
+        NAU_CLASS_(nau::io::ZipArchiveFile, IFile, io_detail::IFileInternal)
+
+    public:
+        ZipArchiveFile(nau::Ptr<ZipArchiveFileSystem> fileSystem, const ZipArchiveFileSystem::ZipEntry& entry) :
+            m_fileSystem(std::move(fileSystem)),
+            m_entry(entry)
         {
-            return 0;
+            NAU_FATAL(m_fileSystem);
         }
 
-        static zlib_filefunc64_def_s getZipFileFuncs(void* opaque)
+        bool supports(FileFeature) const override
         {
-            zlib_filefunc64_def_s fileFuncs{};
-
-            fileFuncs.zopen64_file = zipOpen;
-            fileFuncs.zread_file = zipRead;
-            fileFuncs.zwrite_file = zipWrite;
-            fileFuncs.ztell64_file = zipTell;
-            fileFuncs.zseek64_file = zipSeek;
-            fileFuncs.zclose_file = zipClose;
-            fileFuncs.zerror_file = zipError;
-            fileFuncs.opaque = opaque;
-
-            return fileFuncs;
+            return false;
         }
 
-        IStreamBase::Ptr m_stream;
-        ::unzFile m_zipArchive = nullptr;
+        bool isOpened() const override
+        {
+            return true;
+        }
 
-        std::vector<ZipFsEntry> m_index;
-        std::mutex m_mutex;
+        AccessModeFlag getAccessMode() const override
+        {
+            return AccessMode::Read;
+        }
 
-        friend class ArchiveFile;
-    };
+        size_t getSize() const override
+        {
+            return m_entry.uncompressedSize;
+        }
 
-    ZipArchiveFileSystem::ZipArchiveFileSystem(IStreamReader::Ptr stream) :
-        m_stream(std::move(stream))
-    {
-        auto fileFuncs = getZipFileFuncs(this);
-        m_zipArchive = ::unzOpen2_64("internal", &fileFuncs);
-        NAU_ASSERT(m_zipArchive);
-        if(!m_zipArchive)
+        FsPath getPath() const override
         {
-            return;
+            return m_vfsPath;
         }
 
-        const auto makeForwardSlashPath = [](char* path, size_t pathLen)
+        IStreamBase::Ptr createStream(std::optional<AccessModeFlag>) override
         {
-            for(size_t i = 0; i < pathLen; ++i)
+            ZipSourceReader reader = m_fileSystem->createSourceReader();
+            if (!reader)
             {
-                if(path[i] == '\\')
+                return nullptr;
+            }
+
+            // Local header's name and extra fields may differ from the central directory ones, so data offset is resolved here.
+            std::array<std::byte, ZipLocalHeaderSize> localHeader;
+            if (!reader.readAt(m_entry.localHeaderOffset, localHeader.data(), localHeader.size()) || readU32(localHeader.data()) != ZipLocalHeaderSignature)
+            {
+                NAU_LOG_ERROR("Invalid zip local header for ({})", m_vfsPath.getString());
+                return nullptr;
+            }
+
+            const size_t dataOffset = m_entry.localHeaderOffset + ZipLocalHeaderSize + readU16(localHeader.data() + 26) + readU16(localHeader.data() + 28);
+            if (dataOffset + m_entry.compressedSize > reader.getSize())
+            {
+                NAU_LOG_ERROR("Zip entry data is out of archive bounds ({})", m_vfsPath.getString());
+                return nullptr;
+            }
+
+            if (m_entry.compressionMethod == ZipMethodStored)
+            {
+                if (reader.getMappedData(dataOffset))
                 {
-                    path[i] = '/';
+                    return rtti::createInstance<ZipMappedStoredEntryStream>(m_fileSystem, std::move(reader), dataOffset, m_entry.uncompressedSize);
                 }
+
+                return rtti::createInstance<ZipStoredEntryStream>(m_fileSystem, std::move(reader), dataOffset, m_entry.uncompressedSize);
             }
-        };
 
-        m_index.reserve(10);
+            NAU_ASSERT(m_entry.compressionMethod == ZipMethodDeflated);
 
-        constexpr size_t NameLenMax = 500;
-        std::array<char, NameLenMax + 1> nameBuffer;
+            auto inflateStream = rtti::createInstance<ZipInflateEntryStream>(m_fileSystem, std::move(reader), dataOffset, m_entry.compressedSize, m_entry.uncompressedSize);
+            if (m_entry.uncompressedSize > ZipInflateAtOnceMaxSize)
+            {
+                return inflateStream;
+            }
 
-        for(int code = ::unzGoToFirstFile(m_zipArchive); code == UNZ_OK; code = ::unzGoToNextFile(m_zipArchive))
-        {
-            unz_file_info64 zipFileInfo;
-            if(::unzGetCurrentFileInfo64(m_zipArchive, &zipFileInfo, nameBuffer.data(), static_cast<uint16_t>(nameBuffer.size()), nullptr, 0, nullptr, 0) != UNZ_OK)
+            BytesBuffer buffer(m_entry.uncompressedSize);
+            const Result<size_t> readResult = copyFromStream(buffer.data(), buffer.size(), *inflateStream);
+            if (!readResult || *readResult != buffer.size())
             {
-                break;
+                NAU_LOG_ERROR("Fail to inflate zip entry ({})", m_vfsPath.getString());
+                return nullptr;
             }
 
-            const size_t fileNameLen = static_cast<size_t>(zipFileInfo.size_filename);
-            makeForwardSlashPath(nameBuffer.data(), fileNameLen);
+            return createMemoryStream(std::move(buffer), AccessMode::Read);
+        }
 
-            ZipFsEntry& arcEntry = m_index.emplace_back();
-            arcEntry.size = static_cast<size_t>(zipFileInfo.uncompressed_size);
-            arcEntry.kind = (arcEntry.size > 0) ? FsEntryKind::File : FsEntryKind::Directory;
-            arcEntry.lastWriteTime = static_cast<size_t>(zipFileInfo.dos_date);
+    private:
+        void setVfsPath(io::FsPath vfsPath) override
+        {
+            m_vfsPath = std::move(vfsPath);
+        }
 
-            std::string_view innerPath = {nameBuffer.data(), fileNameLen};
-            if (innerPath.ends_with('/'))
+        const nau::Ptr<ZipArchiveFileSystem> m_fileSystem;
+        const ZipArchiveFileSystem::ZipEntry& m_entry;
+        FsPath m_vfsPath;
+    };
+
+    ZipArchiveFileSystem::ZipArchiveFileSystem(IFile::Ptr archiveFile) :
+        m_archiveFile(std::move(archiveFile))
+    {
+        NAU_FATAL(m_archiveFile);
+        m_archiveSize = m_archiveFile->getSize();
+
+        if (m_archiveFile->supports(IFile::FileFeature::MemoryMapping))
+        {
+            m_mappableArchive = m_archiveFile->as<IMemoryMappableObject*>();
+            if (m_mappableArchive)
             {
-                innerPath.remove_suffix(1);
+                m_mappedData = reinterpret_cast<const std::byte*>(m_mappableArchive->memMap(0, 0));
             }
-            
-            arcEntry.path = innerPath;
-
-            ::unzGetFilePos64(m_zipArchive, &arcEntry.zipPos);
         }
+    }
 
-        std::sort(m_index.begin(), m_index.end());
+    ZipArchiveFileSystem::~ZipArchiveFileSystem()
+    {
+        if (m_mappedData)
+        {
+            m_mappableArchive->memUnmap(m_mappedData);
+        }
     }
 
-    class ArchiveFile final : public io::IFile, public io_detail::IFileInternal
+    ZipSourceReader ZipArchiveFileSystem::createSourceReader() const
     {
-        NAU_CLASS_(nau::io::ArchiveFile, io::IFile, io_detail::IFileInternal)
+        if (m_mappedData)
+        {
+            return {m_mappedData, m_archiveSize};
+        }
 
-    public:
-        ArchiveFile(nau::Ptr<ZipArchiveFileSystem>&& archiveFileSystem, const ZipArchiveFileSystem::ZipFsEntry& fsEntry) :
-            m_archiveFileSystem(std::move(archiveFileSystem)),
-            m_fsEntry(fsEntry)
+        IStreamReader::Ptr stream = m_archiveFile->createStream(AccessMode::Read);
+        return {std::move(stream), m_archiveSize};
+    }
+
+    Result<> ZipArchiveFileSystem::readCentralDirectory()
+    {
+        ZipSourceReader reader = createSourceReader();
+        if (!reader)
         {
+            return NauMakeError("Fail to read zip archive");
         }
 
-        ~ArchiveFile()
+        if (m_archiveSize < ZipEndOfCentralDirSize)
         {
+            return NauMakeError("Invalid zip archive size");
         }
 
-        bool supports(FileFeature) const override
+        // End of central directory record is located at the end of the archive, followed by the (optional) comment.
+        const size_t tailSize = std::min(m_archiveSize, ZipEndOfCentralDirSize + ZipMaxCommentSize);
+        eastl::vector<std::byte> tail(tailSize);
+        NauCheckResult(reader.readAt(m_archiveSize - tailSize, tail.data(), tailSize));
+
+        std::optional<size_t> eocdPos;
+        for (size_t i = tailSize - ZipEndOfCentralDirSize + 1; i-- > 0;)
         {
-            return false;
+            if (readU32(tail.data() + i) == ZipEndOfCentralDirSignature)
+            {
+                eocdPos = i;
+                break;
+            }
         }
 
-        bool isOpened() const override
+        if (!eocdPos)
         {
-            return true;
+            return NauMakeError("Zip end of central directory not found");
         }
 
-        AccessModeFlag getAccessMode() const override
+        const std::byte* const eocd = tail.data() + *eocdPos;
+        uint64_t entriesCount = readU16(eocd + 10);
+        uint64_t centralDirSize = readU32(eocd + 12);
+        uint64_t centralDirOffset = readU32(eocd + 16);
+
+        const bool mayBeZip64 = entriesCount == UINT16_MAX || centralDirSize == UINT32_MAX || centralDirOffset == UINT32_MAX;
+        if (mayBeZip64 && *eocdPos >= Zip64EndOfCentralDirLocatorSize)
         {
-            return AccessMode::Read;
+            const std::byte* const locator = eocd - Zip64EndOfCentralDirLocatorSize;
+            if (readU32(locator) == Zip64EndOfCentralDirLocatorSignature)
+            {
+                std::array<std::byte, Zip64EndOfCentralDirSize> eocd64;
+                NauCheckResult(reader.readAt(static_cast<size_t>(readU64(locator + 8)), eocd64.data(), eocd64.size()));
+                if (readU32(eocd64.data()) != Zip64EndOfCentralDirSignature)
+                {
+                    return NauMakeError("Invalid zip64 end of central directory");
+                }
+
+                entriesCount = readU64(eocd64.data() + 32);
+                centralDirSize = readU64(eocd64.data() + 40);
+                centralDirOffset = readU64(eocd64.data() + 48);
+            }
         }
 
-        FsPath getPath() const override
+        if (centralDirOffset + centralDirSize > m_archiveSize)
         {
-            return m_vfsPath;
+            return NauMakeError("Zip central directory is out of archive bounds");
         }
 
-        IStreamBase::Ptr createStream(std::optional<AccessModeFlag>) override
+        eastl::vector<std::byte> centralDir(static_cast<size_t>(centralDirSize));
+        NauCheckResult(reader.readAt(static_cast<size_t>(centralDirOffset), centralDir.data(), centralDir.size()));
+
+        m_files.reserve(static_cast<size_t>(entriesCount));
+        m_directories[eastl::string{}];
+
+        size_t pos = 0;
+        for (uint64_t i = 0; i < entriesCount; ++i)
         {
-            auto result = EXPR_Block->Result<std::tuple<const void*, size_t>>
+            if (pos + ZipCentralHeaderSize > centralDir.size() || readU32(centralDir.data() + pos) != ZipCentralHeaderSignature)
             {
-                lock_(m_archiveFileSystem->m_mutex);
-
-                if(m_uncompressedBuffer.empty())
-                {
-                    auto archive = m_archiveFileSystem->m_zipArchive;
+                return NauMakeError("Invalid zip central directory header");
+            }
 
-                    ::unzGoToFilePos64(archive, &m_fsEntry.zipPos);
-                    ::unzOpenCurrentFile(archive);
+            const std::byte* const header = centralDir.data() + pos;
+            const uint16_t flags = readU16(header + 8);
+            const uint16_t method = readU16(header + 10);
+            const uint16_t nameLen = readU16(header + 28);
+            const uint16_t extraLen = readU16(header + 30);
+            const uint16_t commentLen = readU16(header + 32);
 
-                    scope_on_leave
-                    {
-                        ::unzCloseCurrentFile(archive);
-                    };
+            const size_t headerSize = ZipCentralHeaderSize + nameLen + extraLen + commentLen;
+            if (pos + headerSize > centralDir.size())
+            {
+                return NauMakeError("Zip central directory header is truncated");
+            }
 
-                    m_uncompressedBuffer.resize(m_fsEntry.size);
-                    size_t readOffset = 0;
+            ZipEntry entry{
+                .localHeaderOffset = readU32(header + 42),
+                .compressedSize = readU32(header + 20),
+                .uncompressedSize = readU32(header + 24),
+                .compressionMethod = method,
+                .dosDateTime = readU32(header + 12)};
 
-                    constexpr size_t ZipReadMaxBytes = UINT16_MAX;
+            // zip64 extended information: 64-bit values are present only for the fields that are set to 0xFFFFFFFF
+            for (const std::byte *extra = header + ZipCentralHeaderSize + nameLen, *extraEnd = extra + extraLen; extra + 4 <= extraEnd;)
+            {
+                const uint16_t fieldId = readU16(extra);
+                const uint16_t fieldSize = readU16(extra + 2);
+                const std::byte* const fieldStart = extra + 4;
+                const std::byte* const fieldEnd = std::min(fieldStart + fieldSize, extraEnd);
 
-                    for(; readOffset < m_uncompressedBuffer.size();)
+                if (fieldId == Zip64ExtraFieldId)
+                {
+                    const std::byte* field = fieldStart;
+                    const auto readZip64Value = [&field, fieldEnd](size_t& value)
                     {
-                        void* const ptr = m_uncompressedBuffer.data() + readOffset;
-                        const size_t readCount = std::min(m_uncompressedBuffer.size() - readOffset, ZipReadMaxBytes);
-                        const int readResult = ::unzReadCurrentFile(archive, ptr, static_cast<uint32_t>(readCount));
-
-                        NAU_ASSERT(readResult >= 0);
-                        if(readResult < 0)
+                        if (value == UINT32_MAX && field + 8 <= fieldEnd)
                         {
-                            return NauMakeError("Read zip entry error");
+                            value = static_cast<size_t>(readU64(field));
+                            field += 8;
                         }
-                        if(readResult == 0)
-                        {
-                            break;
-                        }
-
-                        readOffset += static_cast<size_t>(readResult);
-                    }
+                    };
 
-                    if(readOffset < m_uncompressedBuffer.size())
-                    {
-                        m_uncompressedBuffer.resize(readOffset);
-                    }
+                    readZip64Value(entry.uncompressedSize);
+                    readZip64Value(entry.compressedSize);
+                    readZip64Value(entry.localHeaderOffset);
                 }
 
-                return {m_uncompressedBuffer.data(), m_uncompressedBuffer.size()};
-            };
+                extra = fieldStart + fieldSize;
+            }
+
+            const std::string_view entryName{reinterpret_cast<const char*>(header + ZipCentralHeaderSize), nameLen};
+            pos += headerSize;
 
-            if (!result)
+            if ((flags & ZipFlagEncrypted) != 0)
             {
-                return nullptr;
+                NAU_LOG_WARNING("Encrypted zip entry is not supported ({})", entryName);
+                continue;
             }
-            
-            const auto [ptr, size] = *result;
-    
-            return io::createReadOnlyMemoryStream(ptr, size, rtti::Acquire {as<IRefCounted*>()});
+
+            if (method != ZipMethodStored && method != ZipMethodDeflated)
+            {
+                NAU_LOG_WARNING("Zip compression method ({}) is not supported ({})", method, entryName);
+                continue;
+            }
+
+            addEntry(entryName, entry);
         }
 
-        uint64_t getSize() const override
+        for (auto& [key, children] : m_directories)
         {
-            return m_fsEntry.size;
+            eastl::sort(children.begin(), children.end());
+            children.erase(eastl::unique(children.begin(), children.end()), children.end());
         }
-  
-    private:
-        void setVfsPath(io::FsPath vfsPath) override
+
+        return ResultSuccess;
+    }
+
+    void ZipArchiveFileSystem::addEntry(std::string_view entryName, const ZipEntry& entry)
+    {
+        const bool isDirectory = entryName.ends_with('/') || entryName.ends_with('\\');
+        eastl::string key = makeEntryKey(entryName);
+        if (key.empty())
         {
-            m_vfsPath = std::move(vfsPath);
+            return;
         }
 
-        nau::Ptr<ZipArchiveFileSystem> m_archiveFileSystem;
-        const ZipArchiveFileSystem::ZipFsEntry& m_fsEntry;
-        std::vector<std::byte> m_uncompressedBuffer;
-        FsPath m_vfsPath;
-    };
+        if (isDirectory)
+        {
+            m_directories[key];
+        }
+        else
+        {
+            m_files.emplace(key, entry);
+        }
 
-    ZipArchiveFileSystem::~ZipArchiveFileSystem()
-    {
-        if(m_zipArchive)
+        // register the entry and all of its (possibly implicit) parent directories
+        for (eastl::string_view current = key; !current.empty();)
         {
-            ::unzClose(m_zipArchive);
+            const size_t separatorPos = current.rfind('/');
+            const eastl::string_view parent = separatorPos == eastl::string_view::npos ? eastl::string_view{} : current.substr(0, separatorPos);
+            const eastl::string_view name = separatorPos == eastl::string_view::npos ? current : current.substr(separatorPos + 1);
+
+            m_directories[eastl::string{parent}].emplace_back(name);
+            current = parent;
         }
     }
 
@@ -349,33 +860,27 @@ namespace nau::io
         return true;
     }
 
-    bool ZipArchiveFileSystem::exists(const FsPath& path, [[maybe_unused]] std::optional<FsEntryKind> kind)
+    bool ZipArchiveFileSystem::isImmutable() const
     {
-        struct OperatorLess
-        {
-            bool operator()(const FsEntry& fs, const FsPath& path) const
-            {
-                return fs.path < path;
-            }
+        return true;
+    }
 
-            bool operator()(const FsPath& path, const FsEntry& fs) const
-            {
-                return path < fs.path;
-            }
-        };
+    bool ZipArchiveFileSystem::exists(const FsPath& path, std::optional<FsEntryKind> kind)
+    {
+        const eastl::string key = makeEntryKey(path);
 
-        if (path.isEmpty())
-        { // root
+        if ((!kind || *kind == FsEntryKind::File) && m_files.find(key) != m_files.end())
+        {
             return true;
         }
 
-
-        return std::binary_search(m_index.begin(), m_index.end(), path, OperatorLess{});
+        return (!kind || *kind == FsEntryKind::Directory) && m_directories.find(key) != m_directories.end();
     }
 
-    size_t ZipArchiveFileSystem::getLastWriteTime(const FsPath&)
+    size_t ZipArchiveFileSystem::getLastWriteTime(const FsPath& path)
     {
-        return 0;
+        auto iter = m_files.find(makeEntryKey(path));
+        return iter != m_files.end() ? dosDateTimeToTime(iter->second.dosDateTime) : 0;
     }
 
     IFile::Ptr ZipArchiveFileSystem::openFile(const FsPath& path, AccessModeFlag accessMode, OpenFileMode openMode)
@@ -383,47 +888,57 @@ namespace nau::io
         NAU_ASSERT(openMode == OpenFileMode::OpenExisting);
         NAU_ASSERT(!(accessMode && AccessMode::Write));
 
-        // m_index is not mutable.
-        auto iter = std::find_if(m_index.begin(), m_index.end(), [&path](const ZipFsEntry& entry)
-                                 {
-                                     return entry.path == path;
-                                 });
-
-        if(iter == m_index.end())
+        auto iter = m_files.find(makeEntryKey(path));
+        if (iter == m_files.end())
         {
             return nullptr;
         }
 
-        return rtti::createInstance<ArchiveFile>(rtti::Acquire{this}, *iter);
+        return rtti::createInstance<ZipArchiveFile>(nau::Ptr<ZipArchiveFileSystem>{this}, iter->second);
     }
 
-    IFileSystem::OpenDirResult ZipArchiveFileSystem::openDirIterator(const FsPath& path)
+    FsEntry ZipArchiveFileSystem::makeFsEntry(const DirIteratorState& state) const
     {
-        std::vector<const ZipFsEntry*> entries;
-        for (const auto& entry : m_index)
+        if (state.currentIndex >= state.children.size())
         {
-            if (entry.path.getParentPath() == path)
-            {
-                entries.push_back(&entry);
-            }
+            return {};
         }
 
-        if (entries.empty())
+        const eastl::string& childName = state.children[state.currentIndex];
+        const eastl::string childKey = state.directoryKey.empty() ? childName : state.directoryKey + "/" + childName;
+
+        if (auto file = m_files.find(childKey); file != m_files.end())
         {
-            return {};
+            return FsEntry{
+                .path = state.path / std::string_view{childName.data(), childName.size()},
+                .kind = FsEntryKind::File,
+                .size = file->second.uncompressedSize,
+                .lastWriteTime = dosDateTimeToTime(file->second.dosDateTime)};
         }
 
-        auto* const state = new DirIteratorState {std::move(entries), path };
+        return FsEntry{
+            .path = state.path / std::string_view{childName.data(), childName.size()},
+            .kind = FsEntryKind::Directory};
+    }
 
-        return { state, state->getCurrentFsEntry() };
+    IFileSystem::OpenDirResult ZipArchiveFileSystem::openDirIterator(const FsPath& path)
+    {
+        eastl::string directoryKey = makeEntryKey(path);
+        auto iter = m_directories.find(directoryKey);
+        if (iter == m_directories.end() || iter->second.empty())
+        {
+            return {};
+        }
+
+        auto* const state = new DirIteratorState{iter->second, std::move(directoryKey), path};
+        return {state, makeFsEntry(*state)};
     }
 
     void ZipArchiveFileSystem::closeDirIterator(void* statePtr)
     {
         if (statePtr)
         {
-            auto* const state = reinterpret_cast<DirIteratorState*>(statePtr);
-            delete state;
+            delete reinterpret_cast<DirIteratorState*>(statePtr);
         }
     }
 
@@ -432,19 +947,25 @@ namespace nau::io
         NAU_ASSERT(statePtr);
         auto* const state = reinterpret_cast<DirIteratorState*>(statePtr);
 
-        if (++state->currentIndex >= state->entries.size())
+        ++state->currentIndex;
+        return makeFsEntry(*state);
+    }
+
+    IFileSystem::Ptr createZipArchiveFileSystem(IFile::Ptr archiveFile)
+    {
+        NAU_ASSERT(archiveFile && archiveFile->isOpened());
+        if (!archiveFile || !archiveFile->isOpened())
         {
-            return {};
+            return nullptr;
         }
 
-        return state->getCurrentFsEntry();
-    }
+        auto fileSystem = rtti::createInstance<ZipArchiveFileSystem>(std::move(archiveFile));
+        if (const auto readResult = fileSystem->readCentralDirectory(); !readResult)
+        {
+            NAU_LOG_ERROR("Fail to read zip archive: ({})", readResult.getError()->getMessage());
+            return nullptr;
+        }
 
-    IFileSystem::Ptr createZipArchiveFileSystem(IStreamReader::Ptr stream, [[maybe_unused]] std::string basePath)
-    {
-        NAU_ASSERT(basePath.empty(), "Archive base/inner path is not supported yet");
-        return rtti::createInstance<ZipArchiveFileSystem>(std::move(stream));
+        return fileSystem;
     }
 }  // namespace nau::io
-
-#endif
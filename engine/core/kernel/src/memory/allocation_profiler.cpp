@@ -0,0 +1,536 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/allocation_profiler.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <EASTL/unordered_map.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include "nau/core_defines.h"
+#include "nau/diag/assertion.h"
+#include "nau/serialization/json.h"
+
+#if NAU_PLATFORM_WIN32
+    #include <windows.h>
+#else
+    #include <execinfo.h>
+#endif
+
+namespace nau
+{
+    namespace
+    {
+        using SectionId = AllocationProfiler::SectionId;
+
+        constexpr SectionId MaxSections = AllocationProfiler::MaxSections;
+        constexpr size_t MaxStackFrames = AllocationProfiler::MaxStackFrames;
+
+        struct SectionCounters
+        {
+            std::atomic<uint64_t> allocations = 0;
+            std::atomic<uint64_t> deallocations = 0;
+            std::atomic<uint64_t> allocatedBytes = 0;
+            std::atomic<uint64_t> freedBytes = 0;
+        };
+
+        /**
+            Counters are written only by the owning thread, so there is no need in the atomic read-modify-write.
+         */
+        inline void addRelaxed(std::atomic<uint64_t>& counter, uint64_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        struct ThreadCounters
+        {
+            SectionCounters sections[MaxSections];
+        };
+
+        struct CallSiteKey
+        {
+            SectionId section = 0;
+            uint32_t framesCount = 0;
+            uintptr_t frames[MaxStackFrames] = {};
+
+            bool operator==(const CallSiteKey& other) const
+            {
+                return section == other.section && framesCount == other.framesCount &&
+                       memcmp(frames, other.frames, framesCount * sizeof(uintptr_t)) == 0;
+            }
+        };
+
+        struct CallSiteKeyHash
+        {
+            size_t operator()(const CallSiteKey& key) const
+            {
+                size_t hash = 14695981039346656037ull ^ key.section;
+                for (uint32_t i = 0; i < key.framesCount; ++i)
+                {
+                    hash = (hash ^ key.frames[i]) * 1099511628211ull;
+                }
+                return hash;
+            }
+        };
+
+        struct CallSiteCounters
+        {
+            uint64_t samples = 0;
+            uint64_t allocations = 0;
+            uint64_t bytes = 0;
+        };
+
+        uint32_t captureStack(uintptr_t* frames, size_t maxFrames, uint32_t skipFrames)
+        {
+            void* addresses[MaxStackFrames + 4];
+            const size_t captureCount = std::min(maxFrames + skipFrames, std::size(addresses));
+
+#if NAU_PLATFORM_WIN32
+            const uint32_t count = ::RtlCaptureStackBackTrace(0, static_cast<DWORD>(captureCount), addresses, nullptr);
+#else
+            const uint32_t count = static_cast<uint32_t>(::backtrace(addresses, static_cast<int>(captureCount)));
+#endif
+            if (count <= skipFrames)
+            {
+                return 0;
+            }
+
+            for (uint32_t i = skipFrames; i < count; ++i)
+            {
+                frames[i - skipFrames] = reinterpret_cast<uintptr_t>(addresses[i]);
+            }
+
+            return count - skipFrames;
+        }
+
+        class ProfilerState
+        {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            ProfilerState()
+            {
+                m_sections.emplace_back("Other");
+            }
+
+            SectionId registerSection(eastl::string_view kind)
+            {
+                const std::lock_guard lock{m_mutex};
+
+                auto section = eastl::find_if(m_sections.begin(), m_sections.end(), [kind](const eastl::string& section)
+                {
+                    return eastl::string_view{section} == kind;
+                });
+                if (section != m_sections.end())
+                {
+                    return static_cast<SectionId>(section - m_sections.begin());
+                }
+
+                if (m_sections.size() == MaxSections)
+                {
+                    NAU_ASSERT(false, "Too many allocation profiler sections, ({}) is counted as the other section", kind);
+                    return AllocationProfiler::OtherSection;
+                }
+
+                m_sections.emplace_back(kind);
+                return static_cast<SectionId>(m_sections.size() - 1);
+            }
+
+            ThreadCounters* attachThread()
+            {
+                auto* const counters = new ThreadCounters;
+
+                const std::lock_guard lock{m_mutex};
+                m_threads.push_back(counters);
+                return counters;
+            }
+
+            /**
+                The counters of the finished thread are kept in the retired counters, so the section totals never decrease.
+             */
+            void detachThread(ThreadCounters* counters)
+            {
+                {
+                    const std::lock_guard lock{m_mutex};
+
+                    for (SectionId id = 0; id < MaxSections; ++id)
+                    {
+                        const SectionCounters& threadCounters = counters->sections[id];
+                        SectionCounters& retired = m_retired.sections[id];
+
+                        addRelaxed(retired.allocations, threadCounters.allocations.load(std::memory_order_relaxed));
+                        addRelaxed(retired.deallocations, threadCounters.deallocations.load(std::memory_order_relaxed));
+                        addRelaxed(retired.allocatedBytes, threadCounters.allocatedBytes.load(std::memory_order_relaxed));
+                        addRelaxed(retired.freedBytes, threadCounters.freedBytes.load(std::memory_order_relaxed));
+                    }
+
+                    m_threads.erase(eastl::find(m_threads.begin(), m_threads.end(), counters));
+                }
+
+                delete counters;
+            }
+
+            void addSample(const CallSiteKey& key, size_t size, uint32_t weight)
+            {
+                const std::lock_guard lock{m_callSitesMutex};
+
+                CallSiteCounters& counters = m_callSites[key];
+                ++counters.samples;
+                counters.allocations += weight;
+                counters.bytes += static_cast<uint64_t>(size) * weight;
+            }
+
+            void resetCallSites()
+            {
+                const std::lock_guard lock{m_callSitesMutex};
+                m_callSites.clear();
+            }
+
+            AllocationProfiler::Snapshot makeSnapshot()
+            {
+                AllocationProfiler::Snapshot snapshot;
+                snapshot.timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_startTime).count();
+
+                {
+                    const std::lock_guard lock{m_mutex};
+
+                    snapshot.sections.resize(m_sections.size());
+                    for (SectionId id = 0; id < m_sections.size(); ++id)
+                    {
+                        AllocationProfiler::SectionStatistics& section = snapshot.sections[id];
+                        section.kind = m_sections[id];
+
+                        const auto accumulate = [&section, id](const ThreadCounters& counters)
+                        {
+                            const SectionCounters& sectionCounters = counters.sections[id];
+                            section.allocations += sectionCounters.allocations.load(std::memory_order_relaxed);
+                            section.deallocations += sectionCounters.deallocations.load(std::memory_order_relaxed);
+                            section.allocatedBytes += sectionCounters.allocatedBytes.load(std::memory_order_relaxed);
+                            section.freedBytes += sectionCounters.freedBytes.load(std::memory_order_relaxed);
+                        };
+
+                        accumulate(m_retired);
+                        for (const ThreadCounters* counters : m_threads)
+                        {
+                            accumulate(*counters);
+                        }
+                    }
+                }
+
+                const std::lock_guard lock{m_callSitesMutex};
+
+                snapshot.callSites.reserve(m_callSites.size());
+                for (const auto& [key, counters] : m_callSites)
+                {
+                    AllocationProfiler::CallSiteStatistics& callSite = snapshot.callSites.emplace_back();
+                    callSite.section = snapshot.sections[key.section].kind;
+                    callSite.frames.assign(key.frames, key.frames + key.framesCount);
+                    callSite.samples = counters.samples;
+                    callSite.allocations = counters.allocations;
+                    callSite.bytes = counters.bytes;
+                }
+
+                return snapshot;
+            }
+
+            std::atomic<bool> enabled = false;
+            std::atomic<uint32_t> samplingInterval = AllocationProfiler::DefaultSamplingInterval;
+
+        private:
+            const Clock::time_point m_startTime = Clock::now();
+
+            std::mutex m_mutex;
+            eastl::vector<eastl::string> m_sections;
+            eastl::vector<ThreadCounters*> m_threads;
+            ThreadCounters m_retired;
+
+            std::mutex m_callSitesMutex;
+            eastl::unordered_map<CallSiteKey, CallSiteCounters, CallSiteKeyHash> m_callSites;
+        };
+
+        ProfilerState& getProfilerState()
+        {
+            // never destroyed: the allocators can report from the other static objects destructors
+            static ProfilerState& state = *new ProfilerState;
+            return state;
+        }
+
+        struct ThreadState
+        {
+            ThreadCounters* counters = nullptr;
+            uint32_t sampleCountdown = 0;
+
+            // the profiler own allocations (counters, call sites) are not recorded
+            bool recording = false;
+            bool released = false;
+        };
+
+        thread_local constinit ThreadState t_threadState = {};
+
+        struct ThreadStateGuard
+        {
+            bool initialized = false;
+
+            ~ThreadStateGuard()
+            {
+                if (t_threadState.counters)
+                {
+                    getProfilerState().detachThread(t_threadState.counters);
+                    t_threadState.counters = nullptr;
+                }
+                t_threadState.released = true;
+            }
+        };
+
+        thread_local ThreadStateGuard t_threadStateGuard;
+
+        /**
+            @return The counters of the calling thread or nullptr if the thread is finishing.
+         */
+        inline ThreadCounters* getThreadCounters(ProfilerState& state)
+        {
+            ThreadState& thread = t_threadState;
+            if (thread.counters || thread.released)
+            {
+                return thread.counters;
+            }
+
+            // registers the guard destructor for the thread
+            t_threadStateGuard.initialized = true;
+            thread.counters = state.attachThread();
+            return thread.counters;
+        }
+
+        inline SectionId validateSection(SectionId section)
+        {
+            return section < MaxSections ? section : AllocationProfiler::OtherSection;
+        }
+    }  // namespace
+
+    AllocationProfiler::SectionId AllocationProfiler::registerSection(eastl::string_view kind)
+    {
+        return getProfilerState().registerSection(kind);
+    }
+
+    void AllocationProfiler::setEnabled(bool enabled)
+    {
+        getProfilerState().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool AllocationProfiler::isEnabled()
+    {
+        return getProfilerState().enabled.load(std::memory_order_relaxed);
+    }
+
+    void AllocationProfiler::setSamplingInterval(uint32_t interval)
+    {
+        getProfilerState().samplingInterval.store(interval, std::memory_order_relaxed);
+    }
+
+    uint32_t AllocationProfiler::getSamplingInterval()
+    {
+        return getProfilerState().samplingInterval.load(std::memory_order_relaxed);
+    }
+
+    void AllocationProfiler::recordAllocation(SectionId section, size_t size)
+    {
+        ProfilerState& state = getProfilerState();
+        ThreadState& thread = t_threadState;
+        if (!state.enabled.load(std::memory_order_relaxed) || thread.recording)
+        {
+            return;
+        }
+
+        thread.recording = true;
+        section = validateSection(section);
+
+        if (ThreadCounters* const counters = getThreadCounters(state))
+        {
+            SectionCounters& sectionCounters = counters->sections[section];
+            addRelaxed(sectionCounters.allocations, 1);
+            addRelaxed(sectionCounters.allocatedBytes, size);
+        }
+
+        if (const uint32_t interval = state.samplingInterval.load(std::memory_order_relaxed); interval != 0)
+        {
+            if (thread.sampleCountdown == 0 || thread.sampleCountdown > interval)
+            {
+                thread.sampleCountdown = interval;
+            }
+
+            if (--thread.sampleCountdown == 0)
+            {
+                CallSiteKey key;
+                key.section = section;
+                // skips captureStack and recordAllocation
+                key.framesCount = captureStack(key.frames, MaxStackFrames, 2);
+
+                state.addSample(key, size, interval);
+            }
+        }
+
+        thread.recording = false;
+    }
+
+    void AllocationProfiler::recordDeallocation(SectionId section, size_t size, size_t count)
+    {
+        ProfilerState& state = getProfilerState();
+        ThreadState& thread = t_threadState;
+        if (!state.enabled.load(std::memory_order_relaxed) || thread.recording)
+        {
+            return;
+        }
+
+        thread.recording = true;
+
+        if (ThreadCounters* const counters = getThreadCounters(state))
+        {
+            SectionCounters& sectionCounters = counters->sections[validateSection(section)];
+            addRelaxed(sectionCounters.deallocations, count);
+            addRelaxed(sectionCounters.freedBytes, size);
+        }
+
+        thread.recording = false;
+    }
+
+    AllocationProfiler::Snapshot AllocationProfiler::makeSnapshot()
+    {
+        ThreadState& thread = t_threadState;
+        const bool recording = std::exchange(thread.recording, true);
+
+        Snapshot snapshot = getProfilerState().makeSnapshot();
+
+        thread.recording = recording;
+        return snapshot;
+    }
+
+    void AllocationProfiler::resetCallSites()
+    {
+        getProfilerState().resetCallSites();
+    }
+
+    AllocationProfiler::Snapshot AllocationProfiler::Snapshot::diff(const Snapshot& base) const
+    {
+        Snapshot result;
+        result.timeNs = timeNs - base.timeNs;
+
+        for (const SectionStatistics& section : sections)
+        {
+            SectionStatistics delta = section;
+            if (const SectionStatistics* const baseSection = base.findSection(section.kind))
+            {
+                delta.allocations -= baseSection->allocations;
+                delta.deallocations -= baseSection->deallocations;
+                delta.allocatedBytes -= baseSection->allocatedBytes;
+                delta.freedBytes -= baseSection->freedBytes;
+            }
+
+            if (delta.allocations != 0 || delta.deallocations != 0)
+            {
+                result.sections.push_back(eastl::move(delta));
+            }
+        }
+
+        const auto makeCallSiteKey = [](const CallSiteStatistics& callSite)
+        {
+            eastl::string key = callSite.section;
+            key.push_back('\0');
+            key.append(reinterpret_cast<const char*>(callSite.frames.data()), callSite.frames.size() * sizeof(uintptr_t));
+            return key;
+        };
+
+        eastl::unordered_map<eastl::string, const CallSiteStatistics*> baseCallSites;
+        for (const CallSiteStatistics& callSite : base.callSites)
+        {
+            baseCallSites.emplace(makeCallSiteKey(callSite), &callSite);
+        }
+
+        for (const CallSiteStatistics& callSite : callSites)
+        {
+            CallSiteStatistics delta = callSite;
+            if (auto baseCallSite = baseCallSites.find(makeCallSiteKey(callSite)); baseCallSite != baseCallSites.end())
+            {
+                // call sites are reset by resetCallSites, so the base counters can be greater
+                delta.samples -= std::min(delta.samples, baseCallSite->second->samples);
+                delta.allocations -= std::min(delta.allocations, baseCallSite->second->allocations);
+                delta.bytes -= std::min(delta.bytes, baseCallSite->second->bytes);
+            }
+
+            if (delta.samples != 0)
+            {
+                result.callSites.push_back(eastl::move(delta));
+            }
+        }
+
+        return result;
+    }
+
+    const AllocationProfiler::SectionStatistics* AllocationProfiler::Snapshot::findSection(eastl::string_view kind) const
+    {
+        auto section = eastl::find_if(sections.begin(), sections.end(), [kind](const SectionStatistics& section)
+        {
+            return eastl::string_view{section.kind} == kind;
+        });
+
+        return section != sections.end() ? &*section : nullptr;
+    }
+
+    eastl::vector<AllocationProfiler::CallSiteStatistics> AllocationProfiler::Snapshot::getTopCallSites(size_t count) const
+    {
+        eastl::vector<CallSiteStatistics> result = callSites;
+        count = std::min(count, result.size());
+
+        eastl::partial_sort(result.begin(), result.begin() + count, result.end(), [](const CallSiteStatistics& left, const CallSiteStatistics& right)
+        {
+            return left.bytes > right.bytes;
+        });
+
+        result.resize(count);
+        return result;
+    }
+
+    Result<> AllocationProfiler::Snapshot::writeJson(io::IStreamWriter& stream) const
+    {
+        Json::Value root{Json::objectValue};
+        root["timeNs"] = Json::UInt64{timeNs};
+
+        Json::Value& sectionsValue = root["sections"] = Json::Value{Json::arrayValue};
+        for (const SectionStatistics& section : sections)
+        {
+            Json::Value& sectionValue = sectionsValue.append(Json::Value{Json::objectValue});
+            sectionValue["kind"] = section.kind.c_str();
+            sectionValue["allocations"] = Json::UInt64{section.allocations};
+            sectionValue["deallocations"] = Json::UInt64{section.deallocations};
+            sectionValue["allocatedBytes"] = Json::UInt64{section.allocatedBytes};
+            sectionValue["freedBytes"] = Json::UInt64{section.freedBytes};
+            sectionValue["liveBytes"] = Json::Int64{section.getLiveBytes()};
+        }
+
+        Json::Value& callSitesValue = root["callSites"] = Json::Value{Json::arrayValue};
+        for (const CallSiteStatistics& callSite : getTopCallSites(callSites.size()))
+        {
+            Json::Value& callSiteValue = callSitesValue.append(Json::Value{Json::objectValue});
+            callSiteValue["section"] = callSite.section.c_str();
+            callSiteValue["samples"] = Json::UInt64{callSite.samples};
+            callSiteValue["allocations"] = Json::UInt64{callSite.allocations};
+            callSiteValue["bytes"] = Json::UInt64{callSite.bytes};
+
+            Json::Value& framesValue = callSiteValue["frames"] = Json::Value{Json::arrayValue};
+            for (const uintptr_t frame : callSite.frames)
+            {
+                // hex strings: the addresses do not fit into the json number precision
+                framesValue.append(eastl::string{eastl::string::CtorSprintf{}, "0x%llx", static_cast<unsigned long long>(frame)}.c_str());
+            }
+        }
+
+        return serialization::jsonWrite(stream, root, {.pretty = true});
+    }
+
+}  // namespace nau
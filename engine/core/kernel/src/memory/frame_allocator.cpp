@@ -3,8 +3,12 @@
 
 
 #include <EASTL/unordered_map.h>
+
+#include <algorithm>
+
 #include "nau/memory/heap_allocator.h"
 #include "nau/memory/frame_allocator.h"
+#include "nau/memory/mem_section.h"
 
 namespace nau
 {
@@ -96,4 +100,184 @@ namespace nau
         return alloc;
     }
 
+    struct FrameArenaAllocator::ThreadArena
+    {
+        struct Slot
+        {
+            MemSection section;
+            std::atomic<uint64_t> frame = ~uint64_t(0);
+            std::atomic<size_t> usedBytes = 0;
+            size_t allocations = 0;
+        };
+
+        Slot slots[MaxFramesInFlight];
+        Slot* current = nullptr;
+        uint64_t currentFrame = ~uint64_t(0);
+    };
+
+    namespace
+    {
+        FrameArenaAllocator*& globalFrameArena()
+        {
+            static FrameArenaAllocator* allocator = nullptr;
+            return allocator;
+        }
+    }  // namespace
+
+    FrameArenaAllocator::FrameArenaAllocator(uint32_t framesInFlight, size_t pageSize) :
+        m_framesInFlight(framesInFlight),
+        m_pageSize(pageSize),
+        m_profilerSection(AllocationProfiler::registerSection("FrameArenaAllocator")),
+        m_arenas([this](eastl::unique_ptr<ThreadArena>& arena)
+        {
+            arena = eastl::make_unique<ThreadArena>();
+            for (auto& slot : arena->slots)
+            {
+                slot.section.setPageSize(m_pageSize);
+            }
+        })
+    {
+        NAU_ASSERT(framesInFlight > 0 && framesInFlight <= MaxFramesInFlight, "Invalid frames in flight count ({})", framesInFlight);
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        if (globalFrameArena() == this)
+        {
+            globalFrameArena() = nullptr;
+        }
+    }
+
+    bool FrameArenaAllocator::prepareFrame()
+    {
+        const uint64_t finishedFrame = m_frame.load(std::memory_order_relaxed);
+
+        size_t frameBytes = 0;
+        m_arenas.visitAll([finishedFrame, &frameBytes](const eastl::unique_ptr<ThreadArena>& arena)
+        {
+            if (!arena)
+            {
+                return;
+            }
+
+            for (const auto& slot : arena->slots)
+            {
+                if (slot.frame.load(std::memory_order_relaxed) == finishedFrame)
+                {
+                    frameBytes += slot.usedBytes.load(std::memory_order_relaxed);
+                }
+            }
+        });
+
+        m_lastFrameBytes = frameBytes;
+        m_peakFrameBytes = std::max(m_peakFrameBytes, frameBytes);
+
+        m_frame.store(finishedFrame + 1, std::memory_order_release);
+        return true;
+    }
+
+    FrameArenaAllocator::ThreadArena& FrameArenaAllocator::getThreadArena(uint64_t frame)
+    {
+        ThreadArena& arena = *m_arenas.value();
+        if (arena.currentFrame == frame)
+        {
+            return arena;
+        }
+
+        // The slot was used framesInFlight (or more) frames ago: its memory is not referenced anymore.
+        ThreadArena::Slot& slot = arena.slots[frame % m_framesInFlight];
+        if (const size_t usedBytes = slot.usedBytes.load(std::memory_order_relaxed); usedBytes > 0)
+        {
+            AllocationProfiler::recordDeallocation(m_profilerSection, usedBytes, slot.allocations);
+
+            slot.section.reset();
+            slot.usedBytes.store(0, std::memory_order_relaxed);
+            slot.allocations = 0;
+        }
+        slot.frame.store(frame, std::memory_order_relaxed);
+
+        arena.current = &slot;
+        arena.currentFrame = frame;
+
+        return arena;
+    }
+
+    void* FrameArenaAllocator::allocate(size_t size)
+    {
+        const size_t blockSize = alignedSize(std::max<size_t>(size, 1), BlockAlignment);
+
+        ThreadArena::Slot& slot = *getThreadArena(m_frame.load(std::memory_order_acquire)).current;
+        void* const ptr = slot.section.allocate(blockSize, BlockAlignment);
+        NAU_ASSERT(isAligned(ptr, BlockAlignment));
+
+        slot.usedBytes.store(slot.usedBytes.load(std::memory_order_relaxed) + blockSize, std::memory_order_relaxed);
+        ++slot.allocations;
+
+        AllocationProfiler::recordAllocation(m_profilerSection, blockSize);
+        return ptr;
+    }
+
+    void* FrameArenaAllocator::reallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return allocate(size);
+        }
+
+        NAU_FAILURE("FrameArenaAllocator does not support reallocation of the existing block");
+        return nullptr;
+    }
+
+    void FrameArenaAllocator::deallocate([[maybe_unused]] void* ptr)
+    {
+    }
+
+    size_t FrameArenaAllocator::getSize([[maybe_unused]] const void* ptr) const
+    {
+        NAU_FAILURE("FrameArenaAllocator blocks have no size");
+        return 0;
+    }
+
+    void* FrameArenaAllocator::allocateAligned(size_t size, size_t alignment)
+    {
+        NAU_ASSERT(isPowerOf2(alignment));
+        if (alignment <= BlockAlignment)
+        {
+            return allocate(size);
+        }
+
+        void* const ptr = allocate(size + alignment - BlockAlignment);
+        return reinterpret_cast<void*>(alignedSize(reinterpret_cast<uintptr_t>(ptr), alignment));
+    }
+
+    void* FrameArenaAllocator::reallocateAligned(void* ptr, size_t size, size_t alignment)
+    {
+        if (!ptr)
+        {
+            return allocateAligned(size, alignment);
+        }
+
+        NAU_FAILURE("FrameArenaAllocator does not support reallocation of the existing block");
+        return nullptr;
+    }
+
+    void FrameArenaAllocator::deallocateAligned([[maybe_unused]] void* ptr)
+    {
+    }
+
+    FrameArenaAllocator::Statistics FrameArenaAllocator::getStatistics() const
+    {
+        return {m_frame.load(std::memory_order_relaxed), m_lastFrameBytes, m_peakFrameBytes};
+    }
+
+    void FrameArenaAllocator::setFrameArena(FrameArenaAllocator* allocator)
+    {
+        globalFrameArena() = allocator;
+    }
+
+    FrameArenaAllocator* FrameArenaAllocator::getFrameArena()
+    {
+        return globalFrameArena();
+    }
+
 }
\ No newline at end of file
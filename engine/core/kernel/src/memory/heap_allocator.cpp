@@ -4,14 +4,14 @@
 
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/nau_allocator_wrapper.h"
-#include "nau/memory/general_allocator.h"
+#include "nau/memory/size_class_allocator.h"
 #include "nau/rtti/rtti_impl.h"
 
 namespace nau
 {
     const IMemAllocator::Ptr& getDefaultAllocator()
     {
-        static IMemAllocator::Ptr defaultAlloc = eastl::make_shared<GeneralAllocator>();
+        static IMemAllocator::Ptr defaultAlloc = eastl::make_shared<SizeClassAllocator>();
         return defaultAlloc;
     }
 
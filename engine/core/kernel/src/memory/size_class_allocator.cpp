@@ -0,0 +1,654 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/size_class_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include "nau/memory/allocation_profiler.h"
+#include "nau/memory/mem_page.h"
+#include "nau/memory/mem_section.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr size_t SpanSize = 64 * 1024;
+        constexpr size_t SegmentSize = 4 * 1024 * 1024;
+        constexpr size_t BlockAlignment = 16;
+
+        // 16 bytes step up to 128 bytes, then 4 classes per power of two up to MaxSmallSize.
+        constexpr size_t FineClassesCount = 8;
+        constexpr size_t FineClassesLimit = 128;
+        constexpr size_t SizeClassesCount = FineClassesCount + 4 * 5;
+
+        constexpr size_t getClassSize(size_t sizeClass)
+        {
+            if (sizeClass < FineClassesCount)
+            {
+                return (sizeClass + 1) * BlockAlignment;
+            }
+
+            const size_t group = (sizeClass - FineClassesCount) / 4;
+            const size_t step = (FineClassesLimit / 4) << group;
+            return (FineClassesLimit << group) + ((sizeClass - FineClassesCount) % 4 + 1) * step;
+        }
+
+        static_assert(getClassSize(SizeClassesCount - 1) == SizeClassAllocator::MaxSmallSize);
+
+        inline size_t getSizeClass(size_t size)
+        {
+            if (size <= FineClassesLimit)
+            {
+                return size == 0 ? 0 : (size - 1) / BlockAlignment;
+            }
+
+            const size_t group = std::bit_width(size - 1) - std::bit_width(FineClassesLimit);
+            const size_t step = (FineClassesLimit / 4) << group;
+            return FineClassesCount + group * 4 + (size - (FineClassesLimit << group) - 1) / step;
+        }
+
+        /**
+            Blocks that are moved between the thread cache and the central list at once.
+            Smaller classes use the larger batches: about 1/8 of the span, but no more than 64 blocks.
+         */
+        constexpr uint32_t getBatchSize(size_t sizeClass)
+        {
+            return static_cast<uint32_t>(std::clamp<size_t>(SpanSize / (getClassSize(sizeClass) * 8), 2, 64));
+        }
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        /**
+            Header at the start of each (SpanSize aligned) span: blocks of the span are found by masking the block address.
+            All the fields are guarded by the lock of the size class central list.
+         */
+        struct SpanHeader
+        {
+            uint32_t sizeClass = 0;
+            uint32_t usedBlocks = 0;
+            FreeBlock* freeList = nullptr;
+            std::byte* unused = nullptr;  // blocks that were never allocated: carved on demand
+            SpanHeader* prev = nullptr;
+            SpanHeader* next = nullptr;
+        };
+
+        constexpr size_t SpanHeaderSize = (sizeof(SpanHeader) + BlockAlignment - 1) & ~(BlockAlignment - 1);
+
+        inline SpanHeader* getSpan(const void* ptr)
+        {
+            return reinterpret_cast<SpanHeader*>(reinterpret_cast<uintptr_t>(ptr) & ~(SpanSize - 1));
+        }
+
+        inline bool hasFreeBlocks(const SpanHeader& span)
+        {
+            return span.freeList || span.unused + getClassSize(span.sizeClass) <= reinterpret_cast<std::byte*>(getSpan(&span)) + SpanSize;
+        }
+
+        /**
+            Header before the large block.
+         */
+        struct alignas(BlockAlignment) LargeHeader
+        {
+            MemPage* page;
+            size_t size;
+        };
+
+        /**
+            Two level bitmap of the SpanSize windows of the address space that belong to the page heap spans.
+            Spans are registered once (and never leave the page heap), lookups are lock free.
+         */
+        class SpanMap
+        {
+        public:
+            void add(const void* span)
+            {
+                const uintptr_t window = reinterpret_cast<uintptr_t>(span) / SpanSize;
+                const uintptr_t rootIndex = window >> LeafBits;
+                NAU_FATAL(rootIndex < RootSize, "Address is out of the supported range");
+
+                std::atomic<uint64_t>* leaf = m_root[rootIndex].load(std::memory_order_acquire);
+                if (!leaf)
+                {
+                    leaf = new std::atomic<uint64_t>[LeafWords];
+                    for (size_t i = 0; i < LeafWords; ++i)
+                    {
+                        leaf[i].store(0, std::memory_order_relaxed);
+                    }
+                    m_root[rootIndex].store(leaf, std::memory_order_release);
+                }
+
+                const uintptr_t bit = window & (LeafSize - 1);
+                leaf[bit / 64].fetch_or(uint64_t(1) << (bit % 64), std::memory_order_release);
+            }
+
+            bool contains(const void* ptr) const
+            {
+                const uintptr_t window = reinterpret_cast<uintptr_t>(ptr) / SpanSize;
+                const uintptr_t rootIndex = window >> LeafBits;
+                if (rootIndex >= RootSize)
+                {
+                    return false;
+                }
+
+                const std::atomic<uint64_t>* const leaf = m_root[rootIndex].load(std::memory_order_acquire);
+                if (!leaf)
+                {
+                    return false;
+                }
+
+                const uintptr_t bit = window & (LeafSize - 1);
+                return (leaf[bit / 64].load(std::memory_order_acquire) >> (bit % 64)) & 1;
+            }
+
+        private:
+            // 48-bit address space: 16 bits of the window in the leaf, 16 bits in the root.
+            static constexpr size_t LeafBits = 16;
+            static constexpr size_t LeafSize = size_t(1) << LeafBits;
+            static constexpr size_t LeafWords = LeafSize / 64;
+            static constexpr size_t RootSize = (size_t(1) << 48) / SpanSize / LeafSize;
+
+            std::atomic<std::atomic<uint64_t>*> m_root[RootSize] = {};
+        };
+
+        struct CentralList
+        {
+            std::mutex mutex;
+            SpanHeader* spans = nullptr;  // spans with free blocks
+            size_t spansCount = 0;
+            size_t usedBlocks = 0;
+        };
+
+        /**
+            Central heap: the page heap of spans and the per size class central lists.
+            Never destroyed: blocks can be freed by the static objects destructors.
+         */
+        class CentralHeap
+        {
+        public:
+            CentralHeap()
+            {
+                m_section.setPageSize(SegmentSize);
+            }
+
+            /**
+                Moves up to count blocks to the list.
+                @return Number of the moved blocks.
+             */
+            uint32_t fetchBlocks(size_t sizeClass, FreeBlock*& list, uint32_t count)
+            {
+                const size_t blockSize = getClassSize(sizeClass);
+                CentralList& central = m_central[sizeClass];
+                const std::lock_guard lock{central.mutex};
+
+                uint32_t fetched = 0;
+                while (fetched < count)
+                {
+                    SpanHeader* span = central.spans;
+                    if (!span)
+                    {
+                        span = allocateSpan(sizeClass);
+                        linkSpan(central, *span);
+                        ++central.spansCount;
+                    }
+
+                    while (fetched < count && hasFreeBlocks(*span))
+                    {
+                        FreeBlock* block = span->freeList;
+                        if (block)
+                        {
+                            span->freeList = block->next;
+                        }
+                        else
+                        {
+                            block = reinterpret_cast<FreeBlock*>(span->unused);
+                            span->unused += blockSize;
+                        }
+
+                        block->next = list;
+                        list = block;
+                        ++span->usedBlocks;
+                        ++fetched;
+                    }
+
+                    if (!hasFreeBlocks(*span))
+                    {
+                        unlinkSpan(central, *span);
+                    }
+                }
+
+                central.usedBlocks += fetched;
+                return fetched;
+            }
+
+            /**
+                Returns count blocks of the list (linked through FreeBlock::next) to their spans.
+             */
+            void releaseBlocks(size_t sizeClass, FreeBlock* list, uint32_t count)
+            {
+                CentralList& central = m_central[sizeClass];
+                const std::lock_guard lock{central.mutex};
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    NAU_ASSERT(list);
+                    FreeBlock* const block = list;
+                    list = list->next;
+
+                    SpanHeader& span = *getSpan(block);
+                    NAU_ASSERT(span.sizeClass == sizeClass && span.usedBlocks > 0);
+
+                    if (!hasFreeBlocks(span))
+                    {
+                        linkSpan(central, span);
+                    }
+
+                    block->next = span.freeList;
+                    span.freeList = block;
+
+                    // The last span of the class is kept to not return it on each alloc/free pair.
+                    if (--span.usedBlocks == 0 && central.spansCount > 1)
+                    {
+                        unlinkSpan(central, span);
+                        --central.spansCount;
+                        releaseSpan(span);
+                    }
+                }
+
+                central.usedBlocks -= count;
+            }
+
+            void* allocateLarge(size_t size)
+            {
+                MemPage* const page = MemPage::allocateMemPage(sizeof(LargeHeader) + size, BlockAlignment);
+                NAU_FATAL(page, "Out of memory");
+
+                auto* const header = static_cast<LargeHeader*>(page->getAddress());
+                header->page = page;
+                header->size = size;
+
+                m_largeBlocks.fetch_add(1, std::memory_order_relaxed);
+                m_largeBytes.fetch_add(size, std::memory_order_relaxed);
+
+                return header + 1;
+            }
+
+            void deallocateLarge(void* ptr)
+            {
+                const LargeHeader* const header = static_cast<LargeHeader*>(ptr) - 1;
+
+                m_largeBlocks.fetch_sub(1, std::memory_order_relaxed);
+                m_largeBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+                MemPage::freeMemPage(header->page);
+            }
+
+            bool isSmallBlock(const void* ptr) const
+            {
+                return m_spanMap.contains(ptr);
+            }
+
+            void addCounters(uint64_t allocations, uint64_t deallocations)
+            {
+                m_allocations.fetch_add(allocations, std::memory_order_relaxed);
+                m_deallocations.fetch_add(deallocations, std::memory_order_relaxed);
+            }
+
+            SizeClassAllocator::Statistics getStatistics()
+            {
+                SizeClassAllocator::Statistics statistics;
+                statistics.sizeClasses.resize(SizeClassesCount);
+
+                for (size_t sizeClass = 0; sizeClass < SizeClassesCount; ++sizeClass)
+                {
+                    CentralList& central = m_central[sizeClass];
+                    const std::lock_guard lock{central.mutex};
+
+                    auto& classStatistics = statistics.sizeClasses[sizeClass];
+                    classStatistics.blockSize = getClassSize(sizeClass);
+                    classStatistics.spansCount = central.spansCount;
+                    classStatistics.usedBlocks = central.usedBlocks;
+                }
+
+                {
+                    const std::lock_guard lock{m_pageHeapMutex};
+                    statistics.freeSpans = m_freeSpansCount;
+                    statistics.reservedBytes = m_spansCount * SpanSize;
+                }
+
+                statistics.largeBlocks = m_largeBlocks.load(std::memory_order_relaxed);
+                statistics.largeBytes = m_largeBytes.load(std::memory_order_relaxed);
+                statistics.reservedBytes += statistics.largeBytes;
+                statistics.allocations = m_allocations.load(std::memory_order_relaxed);
+                statistics.deallocations = m_deallocations.load(std::memory_order_relaxed);
+
+                return statistics;
+            }
+
+        private:
+            static void linkSpan(CentralList& central, SpanHeader& span)
+            {
+                span.prev = nullptr;
+                span.next = central.spans;
+                if (central.spans)
+                {
+                    central.spans->prev = &span;
+                }
+                central.spans = &span;
+            }
+
+            static void unlinkSpan(CentralList& central, SpanHeader& span)
+            {
+                (span.prev ? span.prev->next : central.spans) = span.next;
+                if (span.next)
+                {
+                    span.next->prev = span.prev;
+                }
+                span.prev = span.next = nullptr;
+            }
+
+            SpanHeader* allocateSpan(size_t sizeClass)
+            {
+                void* memory = nullptr;
+                {
+                    const std::lock_guard lock{m_pageHeapMutex};
+                    if (m_freeSpans)
+                    {
+                        memory = m_freeSpans;
+                        m_freeSpans = m_freeSpans->next;
+                        --m_freeSpansCount;
+                    }
+                    else
+                    {
+                        memory = m_section.allocate(SpanSize, SpanSize);
+                        NAU_FATAL(memory && getSpan(memory) == memory, "Page heap allocation failed");
+                        m_spanMap.add(memory);
+                        ++m_spansCount;
+                    }
+                }
+
+                auto* const span = new (memory) SpanHeader;
+                span->sizeClass = static_cast<uint32_t>(sizeClass);
+                span->unused = static_cast<std::byte*>(memory) + SpanHeaderSize;
+                return span;
+            }
+
+            void releaseSpan(SpanHeader& span)
+            {
+                const std::lock_guard lock{m_pageHeapMutex};
+                span.next = m_freeSpans;
+                m_freeSpans = &span;
+                ++m_freeSpansCount;
+            }
+
+            CentralList m_central[SizeClassesCount];
+
+            std::mutex m_pageHeapMutex;
+            MemSection m_section;
+            SpanHeader* m_freeSpans = nullptr;
+            size_t m_freeSpansCount = 0;
+            size_t m_spansCount = 0;
+            SpanMap m_spanMap;
+
+            std::atomic<size_t> m_largeBlocks = 0;
+            std::atomic<size_t> m_largeBytes = 0;
+            std::atomic<uint64_t> m_allocations = 0;
+            std::atomic<uint64_t> m_deallocations = 0;
+        };
+
+        CentralHeap& getCentralHeap()
+        {
+            static CentralHeap& heap = *new CentralHeap;
+            return heap;
+        }
+
+        /**
+            Per thread free lists. Trivially destructible: can be accessed (through the central heap) after the thread cache guard is destroyed.
+         */
+        struct ThreadCache
+        {
+            enum class State : uint8_t
+            {
+                NotInitialized,
+                Active,
+                Released
+            };
+
+            struct FreeList
+            {
+                FreeBlock* head;
+                uint32_t count;
+            };
+
+            FreeList lists[SizeClassesCount];
+            uint64_t allocations;
+            uint64_t deallocations;
+            State state;
+
+            void flush()
+            {
+                CentralHeap& heap = getCentralHeap();
+                for (size_t sizeClass = 0; sizeClass < SizeClassesCount; ++sizeClass)
+                {
+                    FreeList& list = lists[sizeClass];
+                    if (list.count > 0)
+                    {
+                        heap.releaseBlocks(sizeClass, list.head, list.count);
+                        list = FreeList{};
+                    }
+                }
+
+                flushCounters();
+            }
+
+            void flushCounters()
+            {
+                getCentralHeap().addCounters(allocations, deallocations);
+                allocations = deallocations = 0;
+            }
+        };
+
+        thread_local constinit ThreadCache t_threadCache = {};
+
+        struct ThreadCacheGuard
+        {
+            bool initialized = false;
+
+            ~ThreadCacheGuard()
+            {
+                t_threadCache.flush();
+                t_threadCache.state = ThreadCache::State::Released;
+            }
+        };
+
+        thread_local ThreadCacheGuard t_threadCacheGuard;
+
+        /**
+            @return The thread cache or nullptr if the thread is finishing (the cache is already released).
+         */
+        inline ThreadCache* getThreadCache()
+        {
+            ThreadCache& cache = t_threadCache;
+            if (cache.state == ThreadCache::State::Active) [[likely]]
+            {
+                return &cache;
+            }
+
+            if (cache.state == ThreadCache::State::Released)
+            {
+                return nullptr;
+            }
+
+            // registers the guard destructor for the thread
+            t_threadCacheGuard.initialized = true;
+            cache.state = ThreadCache::State::Active;
+            return &cache;
+        }
+
+        void* allocateSmall(size_t sizeClass)
+        {
+            ThreadCache* const cache = getThreadCache();
+            if (!cache) [[unlikely]]
+            {
+                FreeBlock* block = nullptr;
+                getCentralHeap().fetchBlocks(sizeClass, block, 1);
+                return block;
+            }
+
+            ThreadCache::FreeList& list = cache->lists[sizeClass];
+            if (list.count == 0) [[unlikely]]
+            {
+                list.count = getCentralHeap().fetchBlocks(sizeClass, list.head, getBatchSize(sizeClass));
+                cache->flushCounters();
+            }
+
+            FreeBlock* const block = list.head;
+            list.head = block->next;
+            --list.count;
+            ++cache->allocations;
+
+            return block;
+        }
+
+        void deallocateSmall(void* ptr)
+        {
+            const size_t sizeClass = getSpan(ptr)->sizeClass;
+            FreeBlock* const block = static_cast<FreeBlock*>(ptr);
+
+            ThreadCache* const cache = getThreadCache();
+            if (!cache) [[unlikely]]
+            {
+                block->next = nullptr;
+                getCentralHeap().releaseBlocks(sizeClass, block, 1);
+                return;
+            }
+
+            ThreadCache::FreeList& list = cache->lists[sizeClass];
+            block->next = list.head;
+            list.head = block;
+            ++list.count;
+            ++cache->deallocations;
+
+            // The blocks freed by this thread (including the blocks of the other threads) go back to the central list in a batch,
+            // the most recently freed (hot) blocks are kept.
+            const uint32_t batchSize = getBatchSize(sizeClass);
+            if (list.count > batchSize * 2) [[unlikely]]
+            {
+                FreeBlock* last = list.head;
+                for (uint32_t i = 1; i < batchSize; ++i)
+                {
+                    last = last->next;
+                }
+
+                FreeBlock* const released = last->next;
+                last->next = nullptr;
+                list.count = batchSize;
+
+                getCentralHeap().releaseBlocks(sizeClass, released, batchSize + 1);
+                cache->flushCounters();
+            }
+        }
+
+        AllocationProfiler::SectionId getProfilerSection()
+        {
+            static const AllocationProfiler::SectionId section = AllocationProfiler::registerSection("SizeClassAllocator");
+            return section;
+        }
+    }  // namespace
+
+    SizeClassAllocator::SizeClassAllocator()
+    {
+        m_name.value() = "SizeClassAllocator";
+    }
+
+    void* SizeClassAllocator::allocate(size_t size)
+    {
+        void* const ptr = size > MaxSmallSize ? getCentralHeap().allocateLarge(size) : allocateSmall(getSizeClass(size));
+        if (AllocationProfiler::isEnabled()) [[unlikely]]
+        {
+            AllocationProfiler::recordAllocation(getProfilerSection(), getSize(ptr));
+        }
+
+        return ptr;
+    }
+
+    void* SizeClassAllocator::reallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return allocate(size);
+        }
+
+        const size_t oldSize = getSize(ptr);
+        if (size <= oldSize && (size > MaxSmallSize || oldSize <= MaxSmallSize))
+        {
+            return ptr;
+        }
+
+        void* const newPtr = allocate(size);
+        memcpy(newPtr, ptr, std::min(size, oldSize));
+        deallocate(ptr);
+
+        return newPtr;
+    }
+
+    void SizeClassAllocator::deallocate(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        if (AllocationProfiler::isEnabled()) [[unlikely]]
+        {
+            AllocationProfiler::recordDeallocation(getProfilerSection(), getSize(ptr));
+        }
+
+        if (getCentralHeap().isSmallBlock(ptr))
+        {
+            deallocateSmall(ptr);
+        }
+        else
+        {
+            getCentralHeap().deallocateLarge(ptr);
+        }
+    }
+
+    size_t SizeClassAllocator::getSize(const void* ptr) const
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        if (getCentralHeap().isSmallBlock(ptr))
+        {
+            return getClassSize(getSpan(ptr)->sizeClass);
+        }
+
+        return (static_cast<const LargeHeader*>(ptr) - 1)->size;
+    }
+
+    void SizeClassAllocator::flushThreadCache()
+    {
+        if (ThreadCache* const cache = getThreadCache())
+        {
+            cache->flush();
+        }
+    }
+
+    SizeClassAllocator::Statistics SizeClassAllocator::getStatistics()
+    {
+        return getCentralHeap().getStatistics();
+    }
+
+}  // namespace nau
@@ -37,14 +37,26 @@ namespace nau
     }
 
     bool AsyncMessageSourceImpl::hasSubscribers(eastl::string_view streamName) const
+    {
+        // the name that was never interned can't have a stream
+        const NameId streamId = NameId::find(streamName);
+        return streamId && hasSubscribers(streamId);
+    }
+
+    bool AsyncMessageSourceImpl::hasSubscribers(NameId streamName) const
     {
         const std::shared_lock lock{m_mutex};
 
-        auto entry = m_subscribers.find(eastl::string{streamName});
+        auto entry = m_subscribers.find(streamName);
         return entry != m_subscribers.end() && entry->second.hasAnySubscription();
     }
 
     AsyncMessageStream AsyncMessageSourceImpl::getStream(eastl::string_view streamName)
+    {
+        return getStream(NameId{streamName});
+    }
+
+    AsyncMessageStream AsyncMessageSourceImpl::getStream(NameId streamName)
     {
         lock_(m_mutex);
 
@@ -56,13 +68,21 @@ namespace nau
         }
         else
         {
-            m_subscribers[eastl::string{streamName}].asyncStreams.push_back(stream);
+            m_subscribers[streamName].asyncStreams.push_back(stream);
         }
 
         return AsyncMessageStream{std::move(stream)};
     }
 
     void AsyncMessageSourceImpl::post(eastl::string_view streamName, RuntimeValue::Ptr message)
+    {
+        if (const NameId streamId = NameId::find(streamName))
+        {
+            post(streamId, std::move(message));
+        }
+    }
+
+    void AsyncMessageSourceImpl::post(NameId streamName, RuntimeValue::Ptr message)
     {
         eastl::vector<nau::Ptr<AsyncMessageStreamImpl>> receivers;
 
@@ -76,7 +96,7 @@ namespace nau
                 return;
             }
 
-            if(auto subscribers = m_subscribers.find(eastl::string{streamName}); subscribers != m_subscribers.end())
+            if(auto subscribers = m_subscribers.find(streamName); subscribers != m_subscribers.end())
             {
                 receivers.reserve(subscribers->second.asyncStreams.size());
                 for(nau::Ptr<AsyncMessageStreamImpl>& stream : subscribers->second.asyncStreams)
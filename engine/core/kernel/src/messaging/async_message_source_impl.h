@@ -34,12 +34,18 @@ namespace nau
 
         bool hasSubscribers(eastl::string_view streamName) const override;
 
+        bool hasSubscribers(NameId streamName) const override;
+
         AsyncMessageStream getStream(eastl::string_view streamName) override;
 
+        AsyncMessageStream getStream(NameId streamName) override;
+
         // virtual subscribeInplace(Functor<void (const MessageEnvelope&)) = 0;
 
         void post(eastl::string_view streamName, RuntimeValue::Ptr) override;
 
+        void post(NameId streamName, RuntimeValue::Ptr) override;
+
         void unregisterStream(AsyncMessageStreamImpl& stream);
 
     private:
@@ -55,7 +61,7 @@ namespace nau
 
         void cancelSubscriptions();
 
-        eastl::unordered_map<eastl::string, StreamSubscribers> m_subscribers;
+        eastl::unordered_map<NameId, StreamSubscribers> m_subscribers;
         mutable std::shared_mutex m_mutex;
         CancellationSubscription m_cancellationSubscription;
         RuntimeObjectRegistration m_disposeRegistration;
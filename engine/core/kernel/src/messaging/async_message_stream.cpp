@@ -53,7 +53,7 @@ namespace nau
     {
         NAU_ASSERT(m_stream);
 
-        return m_stream ? eastl::string_view{m_stream->getStreamName()} : eastl::string_view{};
+        return m_stream ? m_stream->getStreamName().getString() : eastl::string_view{};
     }
 
     async::Task<RuntimeValue::Ptr> AsyncMessageStream::getNextMessage()
@@ -9,7 +9,7 @@
 
 namespace nau
 {
-    AsyncMessageStreamImpl::AsyncMessageStreamImpl(AsyncMessageSourceImpl& source, eastl::string_view name) :
+    AsyncMessageStreamImpl::AsyncMessageStreamImpl(AsyncMessageSourceImpl& source, NameId name) :
         m_source(&source),
         m_streamName(name)
     {
@@ -68,7 +68,7 @@ namespace nau
         }
     }
 
-    const eastl::string& AsyncMessageStreamImpl::getStreamName() const
+    NameId AsyncMessageStreamImpl::getStreamName() const
     {
         return m_streamName;
     }
@@ -17,7 +17,7 @@ namespace nau
     {
         NAU_CLASS_(nau::AsyncMessageStreamImpl, IRefCounted)
     public:
-        AsyncMessageStreamImpl(AsyncMessageSourceImpl&, eastl::string_view name);
+        AsyncMessageStreamImpl(AsyncMessageSourceImpl&, NameId name);
 
         AsyncMessageStreamImpl(const AsyncMessageStreamImpl&) = delete;
 
@@ -29,7 +29,7 @@ namespace nau
 
         void push(RuntimeValue::Ptr);
 
-        const eastl::string& getStreamName() const;
+        NameId getStreamName() const;
 
         void cancelFromSource(Error::Ptr error);
 
@@ -46,7 +46,7 @@ namespace nau
         void cancel(Error::Ptr error, bool unregisterStream);
 
         AsyncMessageSourceImpl* m_source;
-        eastl::string m_streamName;
+        NameId m_streamName;
         std::mutex m_mutex;
 
         async::TaskSource<RuntimeValue::Ptr> m_awaiter = nullptr;
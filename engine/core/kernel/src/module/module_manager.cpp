@@ -8,6 +8,7 @@
 
 #include <filesystem>
 
+#include "nau/diag/startup_trace.h"
 #include "nau/io/file_system.h"
 #include "nau/memory/singleton_memop.h"
 #include "nau/module/internal/module_entry.h"
@@ -134,6 +135,9 @@ namespace nau
                 return ResultSuccess;
             }
 
+            const eastl::string moduleName = name.tostring();
+            const auto loadStartTime = diag::StartupTraceEntry::Clock::now();
+
             eastl::wstring dllWStringPath = strings::utf8ToWString(dllPath);
 
             HMODULE hmodule = GetModuleHandleW(dllWStringPath.c_str());
@@ -171,8 +175,12 @@ namespace nau
             entry.iModule = iModule;
             moduleRegistry[hName] = entry;
 
+            diag::recordStartupTrace(diag::StartupStage::ModuleLoad, moduleName, loadStartTime);
+
             if (m_needInitializeNewModules)
             {
+                diag::StartupTraceScope traceInit{diag::StartupStage::ModuleInit, moduleName};
+
                 moduleRegistry[hName].isModuleInitialized = true;
                 moduleRegistry[hName].iModule->initialize();
             }
@@ -196,6 +204,9 @@ namespace nau
                 if (!moduleEntry.isModuleInitialized)
                 {
                     NAU_ASSERT(moduleEntry.iModule, u8"Module wasn't created");
+
+                    const eastl::string moduleName = moduleEntry.name.tostring();
+                    diag::StartupTraceScope traceInit{diag::StartupStage::ModuleInit, moduleName};
                     moduleEntry.iModule->initialize();
                     moduleEntry.isModuleInitialized = true;
                 }
@@ -0,0 +1,24 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/diag/process_memory.h"
+
+#include <psapi.h>
+
+namespace nau::diag
+{
+    ProcessMemoryInfo getProcessMemoryInfo()
+    {
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return {};
+        }
+
+        return {
+            .residentBytes = counters.WorkingSetSize,
+            .peakResidentBytes = counters.PeakWorkingSetSize};
+    }
+
+}  // namespace nau::diag
@@ -6,6 +6,7 @@
 
 #include "./asset_pack_file_system.h"
 #include "nau/io/memory_stream.h"
+#include "nau/memory/eastl_aliases.h"
 
 namespace nau::io
 {
@@ -151,4 +152,55 @@ namespace nau::io
 
         return actualReadCount;
     }
+
+    Result<eastl::span<const std::byte>> AssetPackStream::readSpan(size_t count)
+    {
+        NAU_FATAL(m_selfPosition <= m_size);
+
+        const size_t actualReadCount = std::min(m_size - m_selfPosition, count);
+        if (actualReadCount == 0)
+        {
+            return eastl::span<const std::byte>{};
+        }
+
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_FATAL(fileSystem);
+
+        // the view is limited by the mapped pages boundary
+        const auto [ptr, availSize] = fileSystem->requestRead(m_selfPosition + m_offset, actualReadCount);
+        const size_t viewSize = std::min(availSize, actualReadCount);
+        m_selfPosition += viewSize;
+
+        return eastl::span<const std::byte>{reinterpret_cast<const std::byte*>(ptr), viewSize};
+    }
+
+    async::Task<size_t> AssetPackStream::readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        // the file system (and the pack file handle) is kept alive until the read is completed
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_FATAL(fileSystem);
+
+        // the buffers are trimmed by the end of the packed file: the pack continues with the other files data
+        size_t availableSize = offset < m_size ? m_size - static_cast<size_t>(offset) : 0;
+
+        Vector<eastl::span<std::byte>> fileBuffers;
+        for (const eastl::span<std::byte>& buffer : buffers)
+        {
+            if (availableSize == 0)
+            {
+                break;
+            }
+
+            const size_t bufferSize = std::min(buffer.size(), availableSize);
+            fileBuffers.emplace_back(buffer.data(), bufferSize);
+            availableSize -= bufferSize;
+        }
+
+        if (fileBuffers.empty())
+        {
+            co_return 0;
+        }
+
+        co_return co_await fileSystem->readAsync(m_offset + static_cast<size_t>(offset), fileBuffers, std::move(cancellation));
+    }
 }  // namespace nau::io
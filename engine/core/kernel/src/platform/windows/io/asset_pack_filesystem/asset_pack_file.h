@@ -46,10 +46,15 @@ namespace nau::io
     };
 
     /**
+        Reads from the mapped pages of the pack: the pages overlapping the live streams are kept mapped,
+        so the views returned by readSpan are valid while the stream is alive.
+        The async reads bypass the mapping and read the pack file through the shared IAsyncFileReader.
      */
-    class AssetPackStream : public IStreamReader
+    class AssetPackStream : public IStreamReader,
+                            public IStreamSpanReader,
+                            public IAsyncStreamReader
     {
-        NAU_CLASS_(AssetPackStream, IStreamReader)
+        NAU_CLASS_(AssetPackStream, IStreamReader, IStreamSpanReader, IAsyncStreamReader)
     public:
         AssetPackStream(const nau::Ptr<AssetPackFileSystemImpl>& fileSystem, size_t offset, size_t size);
         ~AssetPackStream();
@@ -60,6 +65,10 @@ namespace nau::io
 
         Result<size_t> read(std::byte* buffer, size_t size) override;
 
+        Result<eastl::span<const std::byte>> readSpan(size_t count) override;
+
+        async::Task<size_t> readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation) override;
+
     private:
         size_t m_offset = 0;
         size_t m_size = 0;
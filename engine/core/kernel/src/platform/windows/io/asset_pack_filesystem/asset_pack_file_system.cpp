@@ -7,6 +7,7 @@
 #include <EASTL/sort.h>
 
 #include "./asset_pack_file.h"
+#include "../../../../io/async_file_reader_backend.h"
 #include "nau/io/fs_path.h"
 #include "nau/io/nau_container.h"
 #include "nau/memory/eastl_aliases.h"
@@ -215,6 +216,11 @@ namespace nau::io
         return true;
     }
 
+    bool AssetPackFileSystemImpl::isImmutable() const
+    {
+        return true;
+    }
+
     bool AssetPackFileSystemImpl::exists(const FsPath& path, std::optional<FsEntryKind> kind)
     {
         const auto& [basePath, node] = findAssetPackNodeForPath(path);
@@ -288,6 +294,12 @@ namespace nau::io
         return assetPackNodeToFsEntry(data->basePath, data->current);
     }
 
+    async::Task<size_t> AssetPackFileSystemImpl::readAsync(size_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        // the pack handle is used only for the mapping: the positional reads moving its file pointer do not interfere
+        return io_detail::readNativeFileAsync(reinterpret_cast<intptr_t>(m_fileHandle), offset, buffers, std::move(cancellation));
+    }
+
     eastl::tuple<void*, size_t> AssetPackFileSystemImpl::requestRead(size_t offset, size_t size)
     {
         const size_t alignOffset = pageAlignedOffset(offset);
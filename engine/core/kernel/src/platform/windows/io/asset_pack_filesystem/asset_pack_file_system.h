@@ -142,6 +142,8 @@ namespace nau::io
 
         bool isReadOnly() const override;
 
+        bool isImmutable() const override;
+
         bool exists(const FsPath&, std::optional<FsEntryKind> kind) override;
 
         size_t getLastWriteTime(const FsPath&) override;
@@ -156,6 +158,11 @@ namespace nau::io
 
         eastl::tuple<void*, size_t> requestRead(size_t offset, size_t size);
 
+        /**
+            Reads the pack file data directly (not through the mapped pages).
+         */
+        async::Task<size_t> readAsync(size_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation);
+
         void notifyStreamCreated(size_t offset, size_t size);
 
         void notifyStreamRemoved(size_t offset, size_t size);
@@ -0,0 +1,117 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <EASTL/vector.h>
+
+#include <limits>
+
+#include "../../../io/async_file_reader_backend.h"
+#include "nau/platform/windows/diag/win_error.h"
+#include "nau/string/string_conv.h"
+
+namespace nau::io::io_detail
+{
+    Result<intptr_t> openNativeFileForAsyncRead(const char* path)
+    {
+        const eastl::wstring wPath = strings::utf8ToWString(eastl::string_view{path});
+        const HANDLE fileHandle = ::CreateFileW(wPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return NauMakeErrorT(diag::WinCodeError)(eastl::string{"Fail to open file: "} + path);
+        }
+
+        return reinterpret_cast<intptr_t>(fileHandle);
+    }
+
+    void closeNativeFileForAsyncRead(intptr_t nativeFile)
+    {
+        ::CloseHandle(reinterpret_cast<HANDLE>(nativeFile));
+    }
+
+    Result<uint64_t> getNativeFileSize(intptr_t nativeFile)
+    {
+        LARGE_INTEGER size;
+        if (!::GetFileSizeEx(reinterpret_cast<HANDLE>(nativeFile), &size))
+        {
+            return NauMakeErrorT(diag::WinCodeError)("Fail to get file size");
+        }
+
+        return static_cast<uint64_t>(size.QuadPart);
+    }
+
+    namespace
+    {
+        Result<size_t> readFileAt(HANDLE fileHandle, uint64_t fileOffset, std::byte* buffer, size_t size)
+        {
+            // Positional read with the synchronous handle: the file pointer is not shared between the readers.
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(fileOffset & 0xFFFFFFFFULL);
+            overlapped.OffsetHigh = static_cast<DWORD>(fileOffset >> 32);
+
+            DWORD actualReadCount = 0;
+            if (!::ReadFile(fileHandle, buffer, static_cast<DWORD>(std::min<size_t>(size, std::numeric_limits<DWORD>::max())), &actualReadCount, &overlapped))
+            {
+                const unsigned errorCode = diag::getAndResetLastErrorCode();
+                if (errorCode == ERROR_HANDLE_EOF)
+                {
+                    return 0;
+                }
+
+                return NauMakeErrorT(diag::WinCodeError)("Fail to read file", errorCode);
+            }
+
+            return static_cast<size_t>(actualReadCount);
+        }
+    }  // namespace
+
+    Result<size_t> readNativeFileAt(intptr_t nativeFile, const AsyncReadOperation& operation)
+    {
+        // Windows has no vectored read for buffered files (ReadFileScatter requires unbuffered page sized reads).
+        // The small merged runs are read with one call into the thread's bounce buffer and scattered into the chunks:
+        // the copy is cheaper than the call per chunk. The large chunks are read directly.
+        constexpr size_t MaxBounceReadSize = 256 * 1024;
+
+        const HANDLE fileHandle = reinterpret_cast<HANDLE>(nativeFile);
+        const uint64_t fileOffset = operation.offset + operation.bytesRead;
+        const size_t remainingSize = operation.size - operation.bytesRead;
+
+        size_t chunkOffset = operation.bytesRead;
+        auto chunk = operation.chunks.begin();
+        for (; chunk != operation.chunks.end() && chunkOffset >= chunk->size; ++chunk)
+        {
+            chunkOffset -= chunk->size;
+        }
+
+        if (chunk == operation.chunks.end())
+        {
+            return 0;
+        }
+
+        const bool isLastChunk = eastl::next(chunk) == operation.chunks.end();
+        if (isLastChunk || remainingSize > MaxBounceReadSize)
+        {
+            return readFileAt(fileHandle, fileOffset, chunk->buffer + chunkOffset, chunk->size - chunkOffset);
+        }
+
+        thread_local eastl::vector<std::byte> bounceBuffer;
+        bounceBuffer.resize(remainingSize);
+
+        const Result<size_t> readResult = readFileAt(fileHandle, fileOffset, bounceBuffer.data(), remainingSize);
+        NauCheckResult(readResult);
+
+        const std::byte* source = bounceBuffer.data();
+        size_t sourceSize = *readResult;
+        for (; chunk != operation.chunks.end() && sourceSize > 0; ++chunk)
+        {
+            const size_t count = std::min(chunk->size - chunkOffset, sourceSize);
+            memcpy(chunk->buffer + chunkOffset, source, count);
+
+            source += count;
+            sourceSize -= count;
+            chunkOffset = 0;
+        }
+
+        return *readResult;
+    }
+}  // namespace nau::io::io_detail
@@ -4,6 +4,7 @@
 
 #include "./win_file.h"
 
+#include "../../../io/async_file_reader_backend.h"
 #include "nau/platform/windows/diag/win_error.h"
 
 namespace nau::io
@@ -356,6 +357,24 @@ namespace nau::io
     {
     }
 
+    WinFileStreamReader::~WinFileStreamReader()
+    {
+        if (m_asyncReadHandle != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_asyncReadHandle);
+        }
+
+        if (m_mappedPtr)
+        {
+            ::UnmapViewOfFile(m_mappedPtr);
+        }
+
+        if (m_fileMappingHandle)
+        {
+            ::CloseHandle(m_fileMappingHandle);
+        }
+    }
+
     size_t WinFileStreamReader::getPosition() const
     {
         return getPositionInternal();
@@ -385,6 +404,73 @@ namespace nau::io
         return static_cast<size_t>(actualReadCount);
     }
 
+    Result<eastl::span<const std::byte>> WinFileStreamReader::readSpan(size_t count)
+    {
+        NAU_ASSERT(isOpened());
+        if (!isOpened())
+        {
+            return NauMakeError("File is not opened");
+        }
+
+        if (!m_mappedPtr)
+        {
+            LARGE_INTEGER size{};
+            if (::GetFileSizeEx(getFileHandle(), &size) != TRUE)
+            {
+                return NauMakeErrorT(diag::WinCodeError)("Fail to get file size");
+            }
+
+            if (size.QuadPart == 0)
+            {
+                return eastl::span<const std::byte>{};
+            }
+
+            m_fileMappingHandle = ::CreateFileMappingW(getFileHandle(), nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!m_fileMappingHandle)
+            {
+                return NauMakeErrorT(diag::WinCodeError)("Fail to create file mapping");
+            }
+
+            m_mappedPtr = reinterpret_cast<const std::byte*>(::MapViewOfFile(m_fileMappingHandle, FILE_MAP_READ, 0, 0, 0));
+            if (!m_mappedPtr)
+            {
+                // the error takes the last error code, so it is created before the handle is closed
+                auto error = NauMakeErrorT(diag::WinCodeError)("Fail to map file");
+                ::CloseHandle(m_fileMappingHandle);
+                m_fileMappingHandle = nullptr;
+                return error;
+            }
+
+            m_mappedSize = static_cast<size_t>(size.QuadPart);
+        }
+
+        const size_t position = std::min(getPositionInternal(), m_mappedSize);
+        const size_t actualReadCount = std::min(m_mappedSize - position, count);
+        setPositionInternal(OffsetOrigin::Begin, static_cast<int64_t>(position + actualReadCount));
+
+        return eastl::span<const std::byte>{m_mappedPtr + position, actualReadCount};
+    }
+
+    async::Task<size_t> WinFileStreamReader::readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation)
+    {
+        NAU_ASSERT(isOpened());
+        if (!isOpened())
+        {
+            return async::Task<size_t>::makeRejected(NauMakeError("File is not opened"));
+        }
+
+        if (m_asyncReadHandle == INVALID_HANDLE_VALUE)
+        {
+            m_asyncReadHandle = ::ReOpenFile(getFileHandle(), GENERIC_READ, FILE_SHARE_READ, FILE_FLAG_RANDOM_ACCESS);
+            if (m_asyncReadHandle == INVALID_HANDLE_VALUE)
+            {
+                return async::Task<size_t>::makeRejected(NauMakeErrorT(diag::WinCodeError)("Fail to reopen file for async read"));
+            }
+        }
+
+        return io_detail::readNativeFileAsync(reinterpret_cast<intptr_t>(m_asyncReadHandle), offset, buffers, std::move(cancellation));
+    }
+
     WinFileStreamWriter::WinFileStreamWriter(HANDLE fileHandle) :
         WinFileStreamBase(fileHandle)
     {
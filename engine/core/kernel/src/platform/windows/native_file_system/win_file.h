@@ -78,20 +78,36 @@ namespace nau::io
     };
 
 
-    class WinFileStreamReader final : public WinFileStreamBase, public virtual IStreamReader
+    /**
+        The first readSpan maps the whole file, the views are valid while the stream is alive.
+        The async reads go through the shared IAsyncFileReader with the reopened handle: positional reads with
+        the synchronous handle move its file pointer, so the stream's own handle can not be used.
+    */
+    class WinFileStreamReader final : public WinFileStreamBase, public virtual IStreamReader, public IStreamSpanReader, public IAsyncStreamReader
     {
-        NAU_CLASS_(nau::io::WinFileStreamReader,  IStreamReader)
+        NAU_CLASS_(nau::io::WinFileStreamReader,  IStreamReader, IStreamSpanReader, IAsyncStreamReader)
     public:
         using WinFileStreamBase::isOpened;
 
         WinFileStreamReader(HANDLE fileHandle);
         WinFileStreamReader(const wchar_t* path, AccessModeFlag accessMode, OpenFileMode openMode);
+        ~WinFileStreamReader();
 
         size_t getPosition() const override;
 
         size_t setPosition(OffsetOrigin, int64_t) override;
 
         Result<size_t> read(std::byte*, size_t count) override;
+
+        Result<eastl::span<const std::byte>> readSpan(size_t count) override;
+
+        async::Task<size_t> readAsync(uint64_t offset, eastl::span<const eastl::span<std::byte>> buffers, Cancellation cancellation) override;
+
+    private:
+        HANDLE m_asyncReadHandle = INVALID_HANDLE_VALUE;
+        HANDLE m_fileMappingHandle = nullptr;
+        const std::byte* m_mappedPtr = nullptr;
+        size_t m_mappedSize = 0;
     };
 
     class WinFileStreamWriter final : public WinFileStreamBase,
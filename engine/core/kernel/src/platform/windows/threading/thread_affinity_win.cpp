@@ -0,0 +1,34 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/threading/thread_affinity.h"
+
+#include "nau/diag/assertion.h"
+
+namespace nau::threading
+{
+    Result<> setThisThreadAffinity(eastl::span<const uint32_t> cpuIndices)
+    {
+        NAU_ASSERT(!cpuIndices.empty());
+
+        DWORD_PTR mask = 0;
+        for (const uint32_t cpu : cpuIndices)
+        {
+            if (cpu >= sizeof(DWORD_PTR) * 8)
+            {
+                return NauMakeError("Invalid cpu index ({})", cpu);
+            }
+
+            mask |= DWORD_PTR{1} << cpu;
+        }
+
+        if (::SetThreadAffinityMask(::GetCurrentThread(), mask) == 0)
+        {
+            return NauMakeError("Fail to set thread affinity, error ({})", ::GetLastError());
+        }
+
+        return ResultSuccess;
+    }
+
+}  // namespace nau::threading
@@ -26,28 +26,11 @@ namespace nau::serialization
 
     Result<RuntimeValue::Ptr> jsonParse(io::IStreamReader& reader, IMemAllocator::Ptr allocator)
     {
-        constexpr size_t BlockSize = 256;
-
         BytesBuffer buffer;
-        size_t totalRead = 0;
-
-        do
-        {
-            auto readResult = reader.read(buffer.append(BlockSize), BlockSize);
-            NauCheckResult(readResult);
-
-            const size_t actualRead = *readResult;
-            totalRead += actualRead;
-
-            if (actualRead < BlockSize)
-            {
-                buffer.resize(totalRead);
-                break;
-            }
-
-        } while (true);
+        const auto data = io::readStreamAsSpan(reader, std::numeric_limits<size_t>::max(), buffer);
+        NauCheckResult(data);
 
-        eastl::u8string_view str{reinterpret_cast<const char8_t*>(buffer.data()), buffer.size()};
+        eastl::u8string_view str{reinterpret_cast<const char8_t*>(data->data()), data->size()};
         return jsonParseString(str, std::move(allocator));
     }
 
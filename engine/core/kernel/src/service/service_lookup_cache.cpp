@@ -0,0 +1,96 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./service_lookup_cache.h"
+
+#include "nau/diag/assertion.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    eastl::optional<eastl::span<void* const>> ServiceLookupCache::find(const rtti::TypeInfo& type, uint64_t generation) const
+    {
+        const size_t hash = type.getHashCode();
+
+        for (size_t i = 0; i < SlotsCount; ++i)
+        {
+            const Entry* const entry = m_slots[(hash + i) & SlotsMask].load(std::memory_order_acquire);
+            if (!entry)
+            {
+                break;
+            }
+
+            if (entry->type == type)
+            {
+                if (entry->generation.load(std::memory_order_acquire) != generation)
+                {
+                    break;
+                }
+
+                return eastl::span<void* const>{entry->services.data(), entry->services.size()};
+            }
+        }
+
+        return eastl::nullopt;
+    }
+
+    eastl::span<void* const> ServiceLookupCache::store(const rtti::TypeInfo& type, uint64_t generation, eastl::vector<void*> services)
+    {
+        lock_(m_mutex);
+
+        const auto makeEntry = [&]() -> Entry*
+        {
+            return m_entries.emplace_back(eastl::make_unique<Entry>(type, generation, std::move(services))).get();
+        };
+
+        const auto toSpan = [](const Entry* entry)
+        {
+            return eastl::span<void* const>{entry->services.data(), entry->services.size()};
+        };
+
+        const size_t hash = type.getHashCode();
+        for (size_t i = 0; i < SlotsCount; ++i)
+        {
+            std::atomic<Entry*>& slot = m_slots[(hash + i) & SlotsMask];
+            Entry* const entry = slot.load(std::memory_order_relaxed);
+
+            if (!entry)
+            {
+                Entry* const newEntry = makeEntry();
+                slot.store(newEntry, std::memory_order_release);
+                return toSpan(newEntry);
+            }
+
+            if (entry->type != type)
+            {
+                continue;
+            }
+
+            // most registry changes do not affect the type: the entry is reused instead of being stored again
+            if (entry->services == services)
+            {
+                if (entry->generation.load(std::memory_order_relaxed) < generation)
+                {
+                    entry->generation.store(generation, std::memory_order_release);
+                }
+
+                return toSpan(entry);
+            }
+
+            Entry* const newEntry = makeEntry();
+
+            // concurrent lookups can build the entries of different generations: keep the latest one
+            if (entry->generation.load(std::memory_order_relaxed) <= generation)
+            {
+                slot.store(newEntry, std::memory_order_release);
+            }
+
+            return toSpan(newEntry);
+        }
+
+        // all slots are used: the result is still valid, but will not be found by the next lookups
+        NAU_FAILURE("Service lookup cache is full");
+        return toSpan(makeEntry());
+    }
+}  // namespace nau
@@ -0,0 +1,62 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/optional.h>
+#include <EASTL/span.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "nau/rtti/type_info.h"
+
+namespace nau
+{
+    /**
+        @brief Caches the service lookup results per api type. The lookup (find) takes no locks.
+
+        The cached services are immutable and are valid only for the registry generation they were built for:
+        any registry change makes all entries outdated (they are rebuilt by the next lookup).
+        The rebuilt entry with the same services is not stored again: the existing entry is moved to the new generation.
+        The entry with the changed services replaces the previous one, which is kept until the cache is destroyed,
+        so the spans given out earlier stay valid (the number of kept entries is bounded by the services changes, not by the registry changes).
+     */
+    class ServiceLookupCache
+    {
+    public:
+        ServiceLookupCache() = default;
+        ServiceLookupCache(const ServiceLookupCache&) = delete;
+        ServiceLookupCache& operator=(const ServiceLookupCache&) = delete;
+
+        /**
+            @brief The cached services for the type, or nullopt if the type is not cached or the entry is built for another generation.
+         */
+        eastl::optional<eastl::span<void* const>> find(const rtti::TypeInfo& type, uint64_t generation) const;
+
+        /**
+            @brief Caches the services for the type and returns the stored (immutable) copy.
+         */
+        eastl::span<void* const> store(const rtti::TypeInfo& type, uint64_t generation, eastl::vector<void*> services);
+
+    private:
+        static constexpr size_t SlotsCount = 1024;
+        static constexpr size_t SlotsMask = SlotsCount - 1;
+
+        struct Entry
+        {
+            const rtti::TypeInfo type;
+            std::atomic<uint64_t> generation;
+            const eastl::vector<void*> services;
+        };
+
+        // open addressing: the slot is never cleared (only replaced by the entry of the same type), so the empty slot ends the probing
+        eastl::array<std::atomic<Entry*>, SlotsCount> m_slots{};
+        std::mutex m_mutex;
+        eastl::vector<eastl::unique_ptr<Entry>> m_entries;
+    };
+}  // namespace nau
@@ -231,17 +231,17 @@ namespace nau
 
     void* ServiceProviderImpl::findInternal(const rtti::TypeInfo& type)
     {
+        const uint64_t generation = m_registryGeneration.load(std::memory_order_acquire);
+        if (const auto cached = m_findCache.find(type, generation))
+        {
+            return cached->empty() ? nullptr : cached->front();
+        }
+
         ServiceAccessor* accessor = nullptr;
 
         {
             shared_lock_(m_mutex);
 
-            auto iter = m_instances.find(type);
-            if (iter != m_instances.end())
-            {
-                return iter->second;
-            }
-
             auto accessorIter = std::find_if(m_accessors.begin(), m_accessors.end(), [&type](const ServiceAccessor::Ptr& accessor)
             {
                 return accessor->hasApi(type);
@@ -251,11 +251,9 @@ namespace nau
 
         // getApi can also access to the service provider (through lazy service creation and service impl constructor's invocation)
         void* const api = accessor ? accessor->getApi(type) : nullptr;
-        if (api)
-        {
-            lock_(m_mutex);
-            m_instances.emplace(type, ServiceInstanceEntry{api, accessor});
-        }
+
+        // the missing service is cached too: the next registration invalidates the cache
+        m_findCache.store(type, generation, api ? eastl::vector<void*>{api} : eastl::vector<void*>{});
 
         return api;
     }
@@ -293,6 +291,25 @@ namespace nau
         }
     }
 
+    eastl::span<void* const> ServiceProviderImpl::findAllCachedInternal(const rtti::TypeInfo& type)
+    {
+        const uint64_t generation = m_registryGeneration.load(std::memory_order_acquire);
+        if (const auto cached = m_findAllCache.find(type, generation))
+        {
+            return *cached;
+        }
+
+        // the services are collected without the cache lock: the lazy service creation can access the service provider.
+        // If the registry is changed meanwhile, the entry is stored with the outdated generation and will be rebuilt by the next lookup.
+        eastl::vector<void*> services;
+        findAllInternal(type, [](void* servicePtr, void* serviceCollection)
+        {
+            reinterpret_cast<eastl::vector<void*>*>(serviceCollection)->push_back(servicePtr);
+        }, &services, ServiceAccessor::GetApiMode::AllowLazyCreation);
+
+        return m_findAllCache.store(type, generation, std::move(services));
+    }
+
     void ServiceProviderImpl::addServiceAccessorInternal(ServiceAccessor::Ptr accessor, IClassDescriptor::Ptr classDescriptor)
     {
         NAU_ASSERT(accessor);
@@ -305,6 +322,7 @@ namespace nau
         NAU_ASSERT(!m_isDisposed);
 
         m_accessors.emplace_back(std::move(accessor));
+        m_registryGeneration.fetch_add(1, std::memory_order_acq_rel);
     }
 
     void ServiceProviderImpl::addClass(IClassDescriptor::Ptr&& descriptor)
@@ -412,60 +430,169 @@ namespace nau
     }
 
 
-    async::Task<> ServiceProviderImpl::initServicesInternal(async::Task<> (*getTaskCallback)(IServiceInitialization&))
+    async::Task<> ServiceProviderImpl::initServicesInternal(diag::StartupStage stage, async::Task<> (*getTaskCallback)(IServiceInitialization&))
     {
         using namespace nau::async;
+        using Clock = diag::StartupTraceEntry::Clock;
 
-        eastl::vector<IServiceInitialization*> services;
-        findAllInternal(rtti::getTypeInfo<IServiceInitialization>(), [](void* servicePtr, void* serviceCollection)
+        struct ServiceNode
         {
-            reinterpret_cast<decltype(services)*>(serviceCollection)->push_back(reinterpret_cast<IServiceInitialization*>(servicePtr));
-        }, &services, ServiceAccessor::GetApiMode::AllowLazyCreation);
+            IServiceInitialization* service;
+            std::string_view name;
+            eastl::vector<size_t> dependents;
+            size_t pendingDependencies = 0;
+            Clock::time_point startTime;
+        };
 
-        auto [independentServices, orderedDependentServices] = makeInitOrderedServiceList(services);
+        eastl::vector<ServiceNode> nodes;
 
         {
-            eastl::vector<Task<>> independentInitializationTasks;
-            for (const ServiceEntry& entry : independentServices)
+            eastl::vector<ServiceAccessor*> accessors;
             {
-                IServiceInitialization& serviceInstance = getInitializationInstance(entry.service);
-                if (auto task = getTaskCallback(serviceInstance); task && !task.isReady())
+                shared_lock_(m_mutex);
+                for (const ServiceAccessor::Ptr& accessor : m_accessors)
                 {
-                    independentInitializationTasks.emplace_back(std::move(task));
+                    if (accessor->hasApi(rtti::getTypeInfo<IServiceInitialization>()))
+                    {
+                        accessors.emplace_back(accessor.get());
+                    }
                 }
             }
 
-            co_await whenAll(independentInitializationTasks);
+            for (ServiceAccessor* const accessor : accessors)
+            {
+                if (void* const api = accessor->getApi(rtti::getTypeInfo<IServiceInitialization>(), ServiceAccessor::GetApiMode::AllowLazyCreation))
+                {
+                    nodes.push_back({reinterpret_cast<IServiceInitialization*>(api), accessor->getServiceTypeName()});
+                }
+            }
+        }
 
-#ifdef NAU_ASSERT_ENABLED
-            for (auto& task : independentInitializationTasks)
+        // The services are initialized as the dependency graph:
+        // the service starts right after all its direct dependencies are completed, the unrelated services (and dependency chains) do not wait each other.
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            const eastl::vector<const rtti::TypeInfo*> dependencies = nodes[i].service->getServiceDependencies();
+            if (dependencies.empty())
             {
-                if (task.isRejected())
+                continue;
+            }
+
+            for (size_t j = 0; j < nodes.size(); ++j)
+            {
+                IServiceInitialization* const otherService = nodes[j].service;
+                if (i == j || otherService == nodes[i].service)
                 {
-                    NAU_FAILURE(task.getError()->getDiagMessage().c_str());
+                    continue;
+                }
+
+                const bool isDependency = std::any_of(dependencies.begin(), dependencies.end(), [otherService](const rtti::TypeInfo* t)
+                {
+                    return otherService->is(*t);
+                });
+
+                if (isDependency)
+                {
+                    nodes[j].dependents.push_back(i);
+                    ++nodes[i].pendingDependencies;
                 }
             }
-#endif
         }
 
-        for (const ServiceEntry& serviceEntry : orderedDependentServices)
+        eastl::vector<size_t> readyNodes;
+        for (size_t i = 0; i < nodes.size(); ++i)
         {
-            IServiceInitialization& serviceInstance = getInitializationInstance(serviceEntry.service);
-            if (Task<> task = getTaskCallback(serviceInstance); task)
+            if (nodes[i].pendingDependencies == 0)
             {
-                co_await task;
+                readyNodes.push_back(i);
+            }
+        }
+
+        size_t completedCount = 0;
+        const auto completeNode = [&](size_t index)
+        {
+            const ServiceNode& node = nodes[index];
+            diag::recordStartupTrace(stage, eastl::string_view{node.name.data(), node.name.size()}, node.startTime);
+
+            ++completedCount;
+            for (const size_t dependentIndex : node.dependents)
+            {
+                NAU_FATAL(nodes[dependentIndex].pendingDependencies > 0);
+                if (--nodes[dependentIndex].pendingDependencies == 0)
+                {
+                    readyNodes.push_back(dependentIndex);
+                }
+            }
+        };
 
+        eastl::vector<Task<>> runningTasks;
+        eastl::vector<size_t> runningNodes;
+
+        while (completedCount < nodes.size())
+        {
+            // the services are started from the caller's executor (the service initialization can rely on the thread it is invoked from),
+            // the asynchronous part of the initialization runs concurrently with other services.
+            // readyNodes can grow within the loop: the service that completes synchronously makes its dependents ready.
+            for (size_t i = 0; i < readyNodes.size(); ++i)
+            {
+                const size_t index = readyNodes[i];
+                nodes[index].startTime = Clock::now();
+
+                Task<> task = getTaskCallback(getInitializationInstance(nodes[index].service));
+                if (task && !task.isReady())
+                {
+                    runningTasks.emplace_back(std::move(task));
+                    runningNodes.push_back(index);
+                    continue;
+                }
+
+                if (task && task.isRejected())
+                {
 #ifdef NAU_ASSERT_ENABLED
+                    NAU_FAILURE(task.getError()->getDiagMessage().c_str());
+#endif
+                    co_await task;
+                }
+
+                completeNode(index);
+            }
+
+            readyNodes.clear();
+
+            if (runningTasks.empty())
+            {
+                NAU_FATAL(completedCount == nodes.size(), "Service cyclic dependency");
+                break;
+            }
+
+            co_await whenAny(runningTasks);
+
+            for (size_t i = 0; i < runningTasks.size();)
+            {
+                if (!runningTasks[i].isReady())
+                {
+                    ++i;
+                    continue;
+                }
+
+                Task<> task = std::move(runningTasks[i]);
+                const size_t index = runningNodes[i];
+                runningTasks.erase(runningTasks.begin() + i);
+                runningNodes.erase(runningNodes.begin() + i);
+
                 if (task.isRejected())
                 {
+#ifdef NAU_ASSERT_ENABLED
                     NAU_FAILURE(task.getError()->getDiagMessage().c_str());
-                }
 #endif
+                    co_await task;
+                }
+
+                completeNode(index);
             }
         }
     }
 
-
     void ServiceProviderImpl::setInitializationProxy(const IServiceInitialization& source, IServiceInitialization* proxy)
     {
         lock_(m_mutex);
@@ -483,7 +610,7 @@ namespace nau
 
     async::Task<> ServiceProviderImpl::preInitServices()
     {
-        return initServicesInternal([](IServiceInitialization& serviceInit)
+        return initServicesInternal(diag::StartupStage::ServicePreInit, [](IServiceInitialization& serviceInit)
         {
             return serviceInit.preInitService();
         });
@@ -491,7 +618,7 @@ namespace nau
 
     async::Task<> ServiceProviderImpl::initServices()
     {
-        return initServicesInternal([](IServiceInitialization& serviceInit)
+        return initServicesInternal(diag::StartupStage::ServiceInit, [](IServiceInitialization& serviceInit)
         {
             return serviceInit.initService();
         });
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <atomic>
+
+#include "./service_lookup_cache.h"
+#include "nau/diag/startup_trace.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service.h"
@@ -22,27 +26,12 @@ namespace nau
         ~ServiceProviderImpl();
 
     private:
-        struct ServiceInstanceEntry
-        {
-            void* const serviceInstance;
-            ServiceAccessor* const accessor;
-
-            ServiceInstanceEntry(void* inServiceInstance, ServiceAccessor* inAccessor) :
-                serviceInstance(inServiceInstance),
-                accessor(inAccessor)
-            {
-            }
-
-            operator void*() const
-            {
-                return serviceInstance;
-            }
-        };
-
         void* findInternal(const rtti::TypeInfo&) override;
 
         void findAllInternal(const rtti::TypeInfo&, void (*)(void* instancePtr, void*), void*, ServiceAccessor::GetApiMode) override;
 
+        eastl::span<void* const> findAllCachedInternal(const rtti::TypeInfo&) override;
+
         void addServiceAccessorInternal(ServiceAccessor::Ptr, IClassDescriptor::Ptr) override;
 
         void addClass(IClassDescriptor::Ptr&& descriptor) override;
@@ -61,16 +50,20 @@ namespace nau
 
         async::Task<> shutdownServices() override;
 
-        async::Task<> initServicesInternal(async::Task<> (*)(IServiceInitialization&));
+        async::Task<> initServicesInternal(diag::StartupStage, async::Task<> (*)(IServiceInitialization&));
 
         template<typename T>
         T& getInitializationInstance(T* instance);
 
         eastl::list<ServiceAccessor::Ptr> m_accessors;
-        eastl::unordered_map<rtti::TypeIndex, ServiceInstanceEntry> m_instances;
         eastl::vector<IClassDescriptor::Ptr> m_classDescriptors;
         eastl::unordered_map<const IServiceInitialization*, IServiceInitialization*> m_initializationProxy;
         std::shared_mutex m_mutex;
+
+        // incremented on every registry change: invalidates the lookup caches
+        std::atomic<uint64_t> m_registryGeneration = 1;
+        ServiceLookupCache m_findCache;
+        ServiceLookupCache m_findAllCache;
         bool m_isDisposed = false;
     };
 }  // namespace nau
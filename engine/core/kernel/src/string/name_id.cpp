@@ -0,0 +1,238 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/string/name_id.h"
+
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+#include "nau/diag/assertion.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t PageBits = 12;
+        constexpr uint32_t PageSize = 1 << PageBits;
+        constexpr uint32_t MaxPages = 1024;
+        constexpr uint32_t InitialTableSize = 4096;
+        constexpr size_t StringBlockSize = 64 * 1024;
+
+        struct NameEntry
+        {
+            const char* str = "";
+            uint32_t length = 0;
+            uint32_t hash = 0;
+        };
+
+        /**
+            Open addressing table of ids (0 is an empty slot), at most half full.
+            Tables are never released: readers can still probe the previous table while the new one is published.
+         */
+        struct NameTable
+        {
+            explicit NameTable(uint32_t size) :
+                mask(size - 1),
+                slots(new std::atomic<uint32_t>[size])
+            {
+                for (uint32_t i = 0; i < size; ++i)
+                {
+                    slots[i].store(0, std::memory_order_relaxed);
+                }
+            }
+
+            const uint32_t mask;
+            eastl::unique_ptr<std::atomic<uint32_t>[]> slots;
+        };
+
+        /**
+            Entries and strings are never moved or released: the lookups and the id -> string access are lock free,
+            the mutex is taken only to add a new name.
+         */
+        class NameRegistry
+        {
+        public:
+            NameRegistry()
+            {
+                m_tables.push_back(eastl::make_unique<NameTable>(InitialTableSize));
+                m_table.store(m_tables.back().get(), std::memory_order_release);
+
+                // id 0 is the invalid (empty) name
+                addEntry(NameEntry{});
+            }
+
+            uint32_t find(const char* str, size_t length, uint32_t hash) const
+            {
+                return findInTable(*m_table.load(std::memory_order_acquire), str, length, hash);
+            }
+
+            uint32_t intern(const char* str, size_t length, uint32_t hash)
+            {
+                if (const uint32_t id = find(str, length, hash); id != 0)
+                {
+                    return id;
+                }
+
+                const std::lock_guard lock{m_mutex};
+                if (const uint32_t id = find(str, length, hash); id != 0)
+                {
+                    return id;
+                }
+
+                const uint32_t id = addEntry(NameEntry{copyString(str, length), static_cast<uint32_t>(length), hash});
+
+                NameTable* table = m_table.load(std::memory_order_relaxed);
+                if ((id + 1) * 2 > table->mask + 1)
+                {
+                    table = growTable(*table);
+                }
+
+                insertToTable(*table, id, hash);
+                return id;
+            }
+
+            const NameEntry& getEntry(uint32_t id) const
+            {
+                NAU_FATAL(id < m_count.load(std::memory_order_acquire), "Invalid name id ({})", id);
+                return m_pages[id >> PageBits].load(std::memory_order_acquire)[id & (PageSize - 1)];
+            }
+
+        private:
+            uint32_t findInTable(const NameTable& table, const char* str, size_t length, uint32_t hash) const
+            {
+                for (uint32_t slot = hash & table.mask;; slot = (slot + 1) & table.mask)
+                {
+                    const uint32_t id = table.slots[slot].load(std::memory_order_acquire);
+                    if (id == 0)
+                    {
+                        return 0;
+                    }
+
+                    const NameEntry& entry = getEntry(id);
+                    if (entry.hash == hash && entry.length == length && memcmp(entry.str, str, length) == 0)
+                    {
+                        return id;
+                    }
+                }
+            }
+
+            static void insertToTable(NameTable& table, uint32_t id, uint32_t hash)
+            {
+                uint32_t slot = hash & table.mask;
+                while (table.slots[slot].load(std::memory_order_relaxed) != 0)
+                {
+                    slot = (slot + 1) & table.mask;
+                }
+
+                table.slots[slot].store(id, std::memory_order_release);
+            }
+
+            NameTable* growTable(const NameTable& table)
+            {
+                auto newTable = eastl::make_unique<NameTable>((table.mask + 1) * 2);
+                for (uint32_t id = 1, count = m_count.load(std::memory_order_relaxed) - 1; id < count; ++id)
+                {
+                    insertToTable(*newTable, id, getEntry(id).hash);
+                }
+
+                m_tables.push_back(eastl::move(newTable));
+                m_table.store(m_tables.back().get(), std::memory_order_release);
+
+                return m_tables.back().get();
+            }
+
+            uint32_t addEntry(const NameEntry& entry)
+            {
+                const uint32_t id = m_count.load(std::memory_order_relaxed);
+                const uint32_t page = id >> PageBits;
+                NAU_FATAL(page < MaxPages, "Too many interned names");
+
+                NameEntry* entries = m_pages[page].load(std::memory_order_relaxed);
+                if (!entries)
+                {
+                    entries = new NameEntry[PageSize];
+                    m_pages[page].store(entries, std::memory_order_release);
+                }
+
+                entries[id & (PageSize - 1)] = entry;
+                m_count.store(id + 1, std::memory_order_release);
+
+                return id;
+            }
+
+            const char* copyString(const char* str, size_t length)
+            {
+                if (length + 1 > m_blockFree)
+                {
+                    const size_t blockSize = std::max(StringBlockSize, length + 1);
+                    m_blocks.push_back(eastl::make_unique<char[]>(blockSize));
+                    m_blockPos = m_blocks.back().get();
+                    m_blockFree = blockSize;
+                }
+
+                char* const result = m_blockPos;
+                memcpy(result, str, length);
+                result[length] = 0;
+
+                m_blockPos += length + 1;
+                m_blockFree -= length + 1;
+
+                return result;
+            }
+
+            std::atomic<NameEntry*> m_pages[MaxPages] = {};
+            std::atomic<uint32_t> m_count = 0;
+            std::atomic<NameTable*> m_table = nullptr;
+
+            std::mutex m_mutex;
+            eastl::vector<eastl::unique_ptr<NameTable>> m_tables;
+            eastl::vector<eastl::unique_ptr<char[]>> m_blocks;
+            char* m_blockPos = nullptr;
+            size_t m_blockFree = 0;
+        };
+
+        NameRegistry& getNameRegistry()
+        {
+            // never destroyed: names can be used by the other static objects destructors
+            static NameRegistry& registry = *new NameRegistry;
+            return registry;
+        }
+    }  // namespace
+
+    NameId NameId::find(eastl::string_view name)
+    {
+        return name.empty() ? NameId{} : NameId{getNameRegistry().find(name.data(), name.size(), constHash(name.data(), name.size()))};
+    }
+
+    NameId::NameId(eastl::string_view name) :
+        m_id(name.empty() ? 0 : getNameRegistry().intern(name.data(), name.size(), constHash(name.data(), name.size())))
+    {
+    }
+
+    NameId::NameId(const NameLiteral& literal) :
+        m_id(literal.length == 0 ? 0 : getNameRegistry().intern(literal.str, literal.length, literal.hash))
+    {
+    }
+
+    eastl::string_view NameId::getString() const
+    {
+        const NameEntry& entry = getNameRegistry().getEntry(m_id);
+        return {entry.str, entry.length};
+    }
+
+    const char* NameId::c_str() const
+    {
+        return getNameRegistry().getEntry(m_id).str;
+    }
+
+    uint32_t NameId::getHash() const
+    {
+        return getNameRegistry().getEntry(m_id).hash;
+    }
+}  // namespace nau
@@ -0,0 +1,144 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/threading/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "nau/async/executor.h"
+#include "nau/diag/cpu_profiler.h"
+#include "nau/diag/assertion.h"
+
+namespace nau::threading
+{
+    namespace
+    {
+        constexpr size_t MaxConcurrentLoops = 64;
+
+        /**
+            Jobs are never released: a helper invocation can be started after the loop is finished,
+            it checks the generation (before and after it is registered as active) and leaves without touching the loop data.
+         */
+        struct alignas(64) ParallelForJob
+        {
+            std::atomic<uintptr_t> generation = 0;
+            std::atomic<uint32_t> activeHelpers = 0;
+            std::atomic<bool> isBusy = false;
+
+            alignas(64) std::atomic<uint32_t> nextItem = 0;
+            std::atomic<uint32_t> nextWorkerIndex = 1;
+
+            ParallelForCallback callback = nullptr;
+            void* context = nullptr;
+            uint32_t count = 0;
+            uint32_t quant = 1;
+
+            void processRanges(uint32_t workerIndex)
+            {
+                for (uint32_t begin = nextItem.fetch_add(quant, std::memory_order_relaxed); begin < count;
+                     begin = nextItem.fetch_add(quant, std::memory_order_relaxed))
+                {
+                    callback(context, begin, std::min(begin + quant, count), workerIndex);
+                }
+            }
+        };
+
+        ParallelForJob g_jobs[MaxConcurrentLoops];
+
+        ParallelForJob* acquireJob()
+        {
+            for (ParallelForJob& job : g_jobs)
+            {
+                bool isBusy = false;
+                if (!job.isBusy.load(std::memory_order_relaxed) && job.isBusy.compare_exchange_strong(isBusy, true, std::memory_order_acquire))
+                {
+                    return &job;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void helperInvocation(void* jobPtr, void* generationValue) noexcept
+        {
+            ParallelForJob& job = *reinterpret_cast<ParallelForJob*>(jobPtr);
+            const uintptr_t generation = reinterpret_cast<uintptr_t>(generationValue);
+            if (job.generation.load(std::memory_order_acquire) != generation)
+            {
+                return;
+            }
+
+            // seq_cst pair with the caller: either the caller sees the active helper, or the helper sees the retired generation
+            job.activeHelpers.fetch_add(1);
+            if (job.generation.load() == generation)
+            {
+                const diag::CpuProfiler::Zone zone{"parallelFor helper"};
+                job.processRanges(job.nextWorkerIndex.fetch_add(1, std::memory_order_relaxed));
+            }
+
+            job.activeHelpers.fetch_sub(1, std::memory_order_release);
+        }
+    }  // namespace
+
+    uint32_t getParallelForWorkersCount()
+    {
+        const async::Executor::Ptr executor = async::Executor::getDefault();
+        return executor ? static_cast<uint32_t>(executor->getConcurrency()) : 0;
+    }
+
+    void parallelFor(uint32_t count, uint32_t quant, ParallelForCallback callback, void* context, uint32_t maxJobs)
+    {
+        NAU_ASSERT(callback);
+        if (count == 0)
+        {
+            return;
+        }
+
+        quant = std::max(quant, 1u);
+
+        const diag::CpuProfiler::Zone zone{"parallelFor"};
+
+        const uint32_t rangesCount = (count + quant - 1) / quant;
+        async::Executor::Ptr executor = rangesCount > 1 ? async::Executor::getDefault() : nullptr;
+        const uint32_t workersCount = executor ? static_cast<uint32_t>(executor->getConcurrency()) : 0;
+        const uint32_t jobsCount = std::min({maxJobs == 0 ? workersCount : maxJobs, workersCount, rangesCount - 1});
+
+        ParallelForJob* const job = jobsCount > 0 ? acquireJob() : nullptr;
+        if (!job)
+        {
+            for (uint32_t begin = 0; begin < count; begin += quant)
+            {
+                callback(context, begin, std::min(begin + quant, count), 0);
+            }
+            return;
+        }
+
+        job->callback = callback;
+        job->context = context;
+        job->count = count;
+        job->quant = quant;
+        job->nextItem.store(0, std::memory_order_relaxed);
+        job->nextWorkerIndex.store(1, std::memory_order_relaxed);
+        const uintptr_t generation = job->generation.fetch_add(1, std::memory_order_release) + 1;
+
+        for (uint32_t i = 0; i < jobsCount; ++i)
+        {
+            executor->execute(helperInvocation, job, reinterpret_cast<void*>(generation));
+        }
+
+        // help while waiting: the caller takes the ranges until all of them are taken
+        job->processRanges(0);
+
+        // retire generation: the helpers that are not started yet will not touch the job
+        job->generation.fetch_add(1);
+        while (job->activeHelpers.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+
+        job->isBusy.store(false, std::memory_order_release);
+    }
+}  // namespace nau::threading
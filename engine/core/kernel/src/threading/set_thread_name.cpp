@@ -3,11 +3,17 @@
 
 
 #include "nau/threading/set_thread_name.h"
+
+#include "nau/diag/cpu_profiler.h"
+
+#if NAU_PLATFORM_LINUX
+    #include <pthread.h>
+#endif
 // TODO Tracy #include "tracy/Tracy.hpp"
 
 namespace nau::threading
 {
-#if 1//NAU_PLATFORM_WINDOWS
+#if NAU_PLATFORM_WIN32
     namespace
     {
         constexpr DWORD MS_VC_EXCEPTION = 0x406D1388;
@@ -28,7 +34,7 @@ namespace nau::threading
 
     void setThisThreadName([[maybe_unused]] const std::string& name)
     {
-#if 1// NAU_PLATFORM_WINDOWS
+#if NAU_PLATFORM_WIN32
         // https://msdn.microsoft.com/en-us/library/xcb2z8hs.aspx
 
         THREADNAME_INFO info;
@@ -48,7 +54,13 @@ namespace nau::threading
     #pragma warning(pop)
 
 // TODO Tracy        tracy::SetThreadName(name.c_str());
-#endif // NAU_PLATFORM_WINDOWS
+#elif NAU_PLATFORM_LINUX
+        // the name is limited to 16 characters (including the terminating null)
+        const std::string shortName = name.substr(0, 15);
+        ::pthread_setname_np(::pthread_self(), shortName.c_str());
+#endif // NAU_PLATFORM_WIN32
+
+        diag::CpuProfiler::setThreadName(name.c_str());
     }
 
 }  // namespace nau::threading
@@ -0,0 +1,261 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/io/async_file_reader.h"
+#include "nau/io/file_system.h"
+#include "nau/io/special_paths.h"
+#include "nau/service/service_provider.h"
+#include "nau/utils/scope_guard.h"
+
+namespace nau::test
+{
+    class TestAsyncFileReader : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_filePath = io::getKnownFolderPath(io::KnownFolder::Temp) / "nau_test_async_file_reader.bin";
+
+            m_data.resize(256 * 1024);
+            for (size_t i = 0; i < m_data.size(); ++i)
+            {
+                m_data[i] = static_cast<uint8_t>((i * 13) % 251);
+            }
+
+            {
+                io::IStreamWriter::Ptr stream = io::createNativeFileStream(m_filePath.string().c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+                ASSERT_TRUE(stream);
+                stream->write(reinterpret_cast<const std::byte*>(m_data.data()), m_data.size()).ignore();
+            }
+
+            io::AsyncFileReaderSettings settings;
+            settings.queueDepth = 4;
+            m_reader = io::createAsyncFileReader(settings);
+
+            auto file = m_reader->openFile(m_filePath.string().c_str());
+            ASSERT_TRUE(file);
+            m_file = *file;
+        }
+
+        void TearDown() override
+        {
+            m_reader->closeFile(m_file);
+            m_reader.reset();
+            std::filesystem::remove(m_filePath);
+        }
+
+        bool isSameData(const std::vector<uint8_t>& buffer, size_t offset) const
+        {
+            return std::equal(buffer.begin(), buffer.end(), m_data.begin() + offset);
+        }
+
+        std::filesystem::path m_filePath;
+        std::vector<uint8_t> m_data;
+        io::IAsyncFileReader::Ptr m_reader;
+        io::AsyncFileHandle m_file = io::AsyncFileHandle::Invalid;
+    };
+
+    TEST_F(TestAsyncFileReader, FileSize)
+    {
+        ASSERT_EQ(*m_reader->getFileSize(m_file), m_data.size());
+    }
+
+    TEST_F(TestAsyncFileReader, ReadSingle)
+    {
+        constexpr size_t Offset = 1000;
+        std::vector<uint8_t> buffer(5000);
+
+        auto readResult = async::waitResult(m_reader->read({m_file, Offset, buffer.data(), buffer.size()}));
+        ASSERT_TRUE(readResult);
+        ASSERT_EQ(*readResult, buffer.size());
+        ASSERT_TRUE(isSameData(buffer, Offset));
+    }
+
+    TEST_F(TestAsyncFileReader, ReadPastEndOfFile)
+    {
+        std::vector<uint8_t> buffer(1000);
+        const size_t offset = m_data.size() - 100;
+
+        auto readResult = async::waitResult(m_reader->read({m_file, offset, buffer.data(), buffer.size()}));
+        ASSERT_TRUE(readResult);
+        ASSERT_EQ(*readResult, 100);
+
+        buffer.resize(100);
+        ASSERT_TRUE(isSameData(buffer, offset));
+    }
+
+    /**
+        Adjacent requests are merged: each task must still receive its own part of the data.
+     */
+    TEST_F(TestAsyncFileReader, ReadBatch)
+    {
+        constexpr size_t ChunkSize = 4096;
+        constexpr size_t ChunksCount = 32;
+
+        std::vector<std::vector<uint8_t>> buffers(ChunksCount, std::vector<uint8_t>(ChunkSize));
+        std::vector<io::AsyncReadRequest> requests;
+
+        // reverse order and mixed priorities
+        for (size_t i = ChunksCount; i > 0; --i)
+        {
+            const size_t index = i - 1;
+            const auto priority = index % 3 == 0 ? io::AsyncReadPriority::High : io::AsyncReadPriority::Normal;
+            requests.push_back({m_file, index * ChunkSize, buffers[index].data(), ChunkSize, priority});
+        }
+
+        auto tasks = m_reader->readBatch({requests.data(), requests.size()});
+        ASSERT_EQ(tasks.size(), requests.size());
+
+        async::waitResult(async::whenAll(tasks)).ignore();
+
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            ASSERT_TRUE(tasks[i].isReady());
+            ASSERT_FALSE(tasks[i].isRejected());
+            ASSERT_EQ(*tasks[i], ChunkSize);
+
+            const size_t index = ChunksCount - 1 - i;
+            ASSERT_TRUE(isSameData(buffers[index], index * ChunkSize));
+        }
+    }
+
+    /**
+        The merged run ends past the end of the file: the chunks before the end are filled completely,
+        the chunk at the end receives the rest of the file and the chunk after the end receives nothing.
+     */
+    TEST_F(TestAsyncFileReader, ReadBatchPastEndOfFile)
+    {
+        constexpr size_t ChunkSize = 1000;
+        const size_t offset = m_data.size() - ChunkSize * 2 - 100;
+
+        std::vector<std::vector<uint8_t>> buffers(4, std::vector<uint8_t>(ChunkSize));
+        std::vector<io::AsyncReadRequest> requests;
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            requests.push_back({m_file, offset + i * ChunkSize, buffers[i].data(), ChunkSize});
+        }
+
+        auto tasks = m_reader->readBatch({requests.data(), requests.size()});
+        async::waitResult(async::whenAll(tasks)).ignore();
+
+        const size_t expectedSizes[] = {ChunkSize, ChunkSize, 100, 0};
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            ASSERT_FALSE(tasks[i].isRejected());
+            ASSERT_EQ(*tasks[i], expectedSizes[i]);
+
+            buffers[i].resize(expectedSizes[i]);
+            ASSERT_TRUE(isSameData(buffers[i], requests[i].offset));
+        }
+    }
+
+    TEST_F(TestAsyncFileReader, ConcurrentBatches)
+    {
+        constexpr size_t ThreadsCount = 4;
+        constexpr size_t ReadSize = 1024;
+
+        std::vector<std::thread> threads;
+        std::atomic<size_t> successCount = 0;
+
+        for (size_t t = 0; t < ThreadsCount; ++t)
+        {
+            threads.emplace_back([this, t, &successCount]
+            {
+                std::vector<std::vector<uint8_t>> buffers(16, std::vector<uint8_t>(ReadSize));
+                std::vector<io::AsyncReadRequest> requests;
+                for (size_t i = 0; i < buffers.size(); ++i)
+                {
+                    requests.push_back({m_file, (t * buffers.size() + i) * ReadSize * 2, buffers[i].data(), ReadSize});
+                }
+
+                auto tasks = m_reader->readBatch({requests.data(), requests.size()});
+                async::waitResult(async::whenAll(tasks)).ignore();
+
+                for (size_t i = 0; i < buffers.size(); ++i)
+                {
+                    if (tasks[i].isRejected() || !isSameData(buffers[i], requests[i].offset))
+                    {
+                        return;
+                    }
+                }
+
+                ++successCount;
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(successCount, ThreadsCount);
+    }
+
+    /**
+        Test:
+            The native file stream reads through the reader registered as the service.
+            The scatter read fills the buffers one after another and does not move the stream position,
+            readStreamAsync reads from the current position and advances it.
+     */
+    TEST_F(TestAsyncFileReader, NativeStreamReadAsync)
+    {
+        setDefaultServiceProvider(createServiceProvider());
+        scope_on_leave
+        {
+            setDefaultServiceProvider(nullptr);
+        };
+        getServiceProvider().addService(m_reader);
+
+        io::IStreamReader::Ptr stream = io::createNativeFileStream(m_filePath.string().c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        ASSERT_TRUE(stream);
+
+        auto* const asyncReader = stream->as<io::IAsyncStreamReader*>();
+        ASSERT_TRUE(asyncReader);
+
+        constexpr size_t Offset = 100;
+        std::vector<uint8_t> head(3000);
+        std::vector<uint8_t> tail(5000);
+        const eastl::span<std::byte> buffers[] = {
+            {reinterpret_cast<std::byte*>(head.data()), head.size()},
+            {reinterpret_cast<std::byte*>(tail.data()), tail.size()}};
+
+        auto readResult = async::waitResult(asyncReader->readAsync(Offset, buffers));
+        ASSERT_TRUE(readResult);
+        ASSERT_EQ(*readResult, head.size() + tail.size());
+        ASSERT_TRUE(isSameData(head, Offset));
+        ASSERT_TRUE(isSameData(tail, Offset + head.size()));
+        ASSERT_EQ(stream->getPosition(), 0u);
+
+        constexpr size_t Position = 500;
+        std::vector<uint8_t> buffer(1000);
+        stream->setPosition(io::OffsetOrigin::Begin, Position);
+
+        auto streamReadResult = async::waitResult(io::readStreamAsync(stream, {reinterpret_cast<std::byte*>(buffer.data()), buffer.size()}));
+        ASSERT_TRUE(streamReadResult);
+        ASSERT_EQ(*streamReadResult, buffer.size());
+        ASSERT_TRUE(isSameData(buffer, Position));
+        ASSERT_EQ(stream->getPosition(), Position + buffer.size());
+    }
+
+    /**
+        Test:
+            The read with the already cancelled cancellation is rejected without touching the buffer.
+     */
+    TEST_F(TestAsyncFileReader, NativeStreamReadAsyncCancelled)
+    {
+        io::IStreamReader::Ptr stream = io::createNativeFileStream(m_filePath.string().c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        ASSERT_TRUE(stream);
+
+        CancellationSource cancellationSource;
+        cancellationSource.cancel();
+
+        std::vector<uint8_t> buffer(100, 0);
+        auto readResult = async::waitResult(io::readStreamAsync(stream, {reinterpret_cast<std::byte*>(buffer.data()), buffer.size()}, cancellationSource.getCancellation()));
+        ASSERT_FALSE(readResult);
+        ASSERT_TRUE(std::all_of(buffer.begin(), buffer.end(), [](uint8_t value)
+        {
+            return value == 0;
+        }));
+    }
+}  // namespace nau::test
@@ -0,0 +1,331 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <zlib.h>
+
+#include "nau/io/file_system.h"
+#include "nau/io/special_paths.h"
+#include "nau/io/stream.h"
+#include "nau/io/zip_archive_file_system.h"
+#include "nau/memory/bytes_buffer.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        struct ZipTestEntry
+        {
+            std::string name;
+            std::vector<uint8_t> data;
+            bool deflate = false;
+            bool zip64Sizes = false;  // the central directory keeps the sizes in the zip64 extra field
+            uint32_t dosDateTime = 0;
+        };
+
+        void writeU16(std::vector<uint8_t>& out, uint16_t value)
+        {
+            out.push_back(static_cast<uint8_t>(value & 0xFF));
+            out.push_back(static_cast<uint8_t>(value >> 8));
+        }
+
+        void writeU32(std::vector<uint8_t>& out, uint32_t value)
+        {
+            writeU16(out, static_cast<uint16_t>(value & 0xFFFF));
+            writeU16(out, static_cast<uint16_t>(value >> 16));
+        }
+
+        std::vector<uint8_t> deflateRaw(const std::vector<uint8_t>& data)
+        {
+            z_stream zstream{};
+            deflateInit2(&zstream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+            std::vector<uint8_t> result(deflateBound(&zstream, static_cast<uLong>(data.size())));
+            zstream.next_in = const_cast<Bytef*>(data.data());
+            zstream.avail_in = static_cast<uInt>(data.size());
+            zstream.next_out = result.data();
+            zstream.avail_out = static_cast<uInt>(result.size());
+
+            deflate(&zstream, Z_FINISH);
+            result.resize(zstream.total_out);
+            deflateEnd(&zstream);
+
+            return result;
+        }
+
+        /**
+            Builds minimal zip archive (CRC values are not filled, the file system does not verify them).
+         */
+        std::vector<uint8_t> buildZipArchive(const std::vector<ZipTestEntry>& entries)
+        {
+            std::vector<uint8_t> archive;
+            std::vector<uint8_t> centralDir;
+
+            for (const ZipTestEntry& entry : entries)
+            {
+                const std::vector<uint8_t> payload = entry.deflate ? deflateRaw(entry.data) : entry.data;
+                const uint16_t method = entry.deflate ? 8 : 0;
+                const uint32_t localHeaderOffset = static_cast<uint32_t>(archive.size());
+
+                writeU32(archive, 0x04034b50);
+                writeU16(archive, 20);
+                writeU16(archive, 0);
+                writeU16(archive, method);
+                writeU32(archive, 0);
+                writeU32(archive, 0);
+                writeU32(archive, static_cast<uint32_t>(payload.size()));
+                writeU32(archive, static_cast<uint32_t>(entry.data.size()));
+                writeU16(archive, static_cast<uint16_t>(entry.name.size()));
+                writeU16(archive, 0);
+                archive.insert(archive.end(), entry.name.begin(), entry.name.end());
+                archive.insert(archive.end(), payload.begin(), payload.end());
+
+                std::vector<uint8_t> extra;
+                if (entry.zip64Sizes)
+                {
+                    writeU16(extra, 0x0001);
+                    writeU16(extra, 16);
+                    writeU32(extra, static_cast<uint32_t>(entry.data.size()));
+                    writeU32(extra, 0);
+                    writeU32(extra, static_cast<uint32_t>(payload.size()));
+                    writeU32(extra, 0);
+
+                    // the field after the zip64 one (extended timestamp)
+                    writeU16(extra, 0x5455);
+                    writeU16(extra, 5);
+                    extra.insert(extra.end(), 5, 0);
+                }
+
+                writeU32(centralDir, 0x02014b50);
+                writeU16(centralDir, 20);
+                writeU16(centralDir, 20);
+                writeU16(centralDir, 0);
+                writeU16(centralDir, method);
+                writeU32(centralDir, entry.dosDateTime);
+                writeU32(centralDir, 0);
+                writeU32(centralDir, entry.zip64Sizes ? 0xFFFFFFFF : static_cast<uint32_t>(payload.size()));
+                writeU32(centralDir, entry.zip64Sizes ? 0xFFFFFFFF : static_cast<uint32_t>(entry.data.size()));
+                writeU16(centralDir, static_cast<uint16_t>(entry.name.size()));
+                writeU16(centralDir, static_cast<uint16_t>(extra.size()));
+                writeU16(centralDir, 0);
+                writeU16(centralDir, 0);
+                writeU16(centralDir, 0);
+                writeU32(centralDir, 0);
+                writeU32(centralDir, localHeaderOffset);
+                centralDir.insert(centralDir.end(), entry.name.begin(), entry.name.end());
+                centralDir.insert(centralDir.end(), extra.begin(), extra.end());
+            }
+
+            const uint32_t centralDirOffset = static_cast<uint32_t>(archive.size());
+            archive.insert(archive.end(), centralDir.begin(), centralDir.end());
+
+            writeU32(archive, 0x06054b50);
+            writeU16(archive, 0);
+            writeU16(archive, 0);
+            writeU16(archive, static_cast<uint16_t>(entries.size()));
+            writeU16(archive, static_cast<uint16_t>(entries.size()));
+            writeU32(archive, static_cast<uint32_t>(centralDir.size()));
+            writeU32(archive, centralDirOffset);
+            writeU16(archive, 0);
+
+            return archive;
+        }
+
+        std::vector<uint8_t> makeTestData(size_t size)
+        {
+            std::vector<uint8_t> data(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<uint8_t>((i * 7) % 251);
+            }
+
+            return data;
+        }
+
+        std::vector<uint8_t> readAll(io::IStreamReader& stream, size_t size)
+        {
+            std::vector<uint8_t> result(size);
+            const size_t readCount = *io::copyFromStream(result.data(), size, stream);
+            result.resize(readCount);
+            return result;
+        }
+    }  // namespace
+
+    class TestZipArchiveFileSystem : public testing::Test
+    {
+    protected:
+        // 2024-03-15 13:45:30 (local time)
+        static constexpr uint32_t DosDateTime = (((2024 - 1980) << 9 | 3 << 5 | 15) << 16) | (13 << 11 | 45 << 5 | 30 / 2);
+
+        void SetUp() override
+        {
+            const std::filesystem::path tempDir = io::getKnownFolderPath(io::KnownFolder::Temp);
+            m_archiveName = "nau_test_zip_archive.zip";
+
+            m_storedData = makeTestData(1000);
+            m_largeData = makeTestData(1024 * 1024);
+
+            const std::vector<uint8_t> archive = buildZipArchive({
+                {"content/stored.txt", m_storedData, false},
+                {"content/sub/", {}, false},
+                {"content/sub/large.bin", m_largeData, true},
+                {"small.bin", m_storedData, true},
+                {"zip64.bin", m_storedData, true, true, DosDateTime}
+            });
+
+            {
+                io::IStreamWriter::Ptr stream = io::createNativeFileStream((tempDir / m_archiveName).string().c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+                ASSERT_TRUE(stream);
+                stream->write(reinterpret_cast<const std::byte*>(archive.data()), archive.size()).ignore();
+            }
+
+            m_nativeFs = io::createNativeFileSystem(tempDir.string());
+            m_zipFs = io::createZipArchiveFileSystem(m_nativeFs->openFile(m_archiveName, io::AccessMode::Read, io::OpenFileMode::OpenExisting));
+            ASSERT_TRUE(m_zipFs);
+        }
+
+        void TearDown() override
+        {
+            m_zipFs.reset();
+            m_nativeFs.reset();
+            std::filesystem::remove(io::getKnownFolderPath(io::KnownFolder::Temp) / m_archiveName);
+        }
+
+        std::string m_archiveName;
+        std::vector<uint8_t> m_storedData;
+        std::vector<uint8_t> m_largeData;
+        io::IFileSystem::Ptr m_nativeFs;
+        io::IFileSystem::Ptr m_zipFs;
+    };
+
+    TEST_F(TestZipArchiveFileSystem, Exists)
+    {
+        ASSERT_TRUE(m_zipFs->exists("/content/stored.txt", io::FsEntryKind::File));
+        ASSERT_TRUE(m_zipFs->exists("/content/sub/large.bin"));
+        ASSERT_TRUE(m_zipFs->exists("/content", io::FsEntryKind::Directory));
+        ASSERT_TRUE(m_zipFs->exists("/content/sub", io::FsEntryKind::Directory));
+        ASSERT_FALSE(m_zipFs->exists("/content", io::FsEntryKind::File));
+        ASSERT_FALSE(m_zipFs->exists("/content/missing.txt"));
+    }
+
+    TEST_F(TestZipArchiveFileSystem, ReadStoredEntry)
+    {
+        auto file = m_zipFs->openFile("/content/stored.txt", io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        ASSERT_TRUE(file);
+        ASSERT_EQ(file->getSize(), m_storedData.size());
+
+        io::IStreamReader::Ptr stream = file->createStream();
+        ASSERT_EQ(readAll(*stream, m_storedData.size()), m_storedData);
+    }
+
+    /**
+        The stored entry of the mapped archive is read as the view of the archive data (without copying).
+     */
+    TEST_F(TestZipArchiveFileSystem, ReadStoredEntryAsSpan)
+    {
+        io::IStreamReader::Ptr stream = m_zipFs->openFile("/content/stored.txt", io::AccessMode::Read, io::OpenFileMode::OpenExisting)->createStream();
+        ASSERT_TRUE(stream->is<io::IStreamSpanReader>());
+
+        stream->setPosition(io::OffsetOrigin::Begin, 10);
+
+        BytesBuffer fallbackBuffer;
+        const auto data = io::readStreamAsSpan(*stream, std::numeric_limits<size_t>::max(), fallbackBuffer);
+        ASSERT_TRUE(data);
+        ASSERT_TRUE(fallbackBuffer.empty());
+        ASSERT_EQ(stream->getPosition(), m_storedData.size());
+
+        const std::vector<uint8_t> content(reinterpret_cast<const uint8_t*>(data->data()), reinterpret_cast<const uint8_t*>(data->data()) + data->size());
+        ASSERT_EQ(content, std::vector<uint8_t>(m_storedData.begin() + 10, m_storedData.end()));
+
+        const auto emptyData = stream->as<io::IStreamSpanReader*>()->readSpan(100);
+        ASSERT_TRUE(emptyData);
+        ASSERT_TRUE(emptyData->empty());
+    }
+
+    TEST_F(TestZipArchiveFileSystem, ReadDeflatedEntry)
+    {
+        io::IStreamReader::Ptr stream = m_zipFs->openFile("/small.bin", io::AccessMode::Read, io::OpenFileMode::OpenExisting)->createStream();
+        ASSERT_EQ(readAll(*stream, m_storedData.size()), m_storedData);
+    }
+
+    TEST_F(TestZipArchiveFileSystem, ReadLargeDeflatedEntryWithSeek)
+    {
+        io::IStreamReader::Ptr stream = m_zipFs->openFile("/content/sub/large.bin", io::AccessMode::Read, io::OpenFileMode::OpenExisting)->createStream();
+
+        ASSERT_EQ(stream->setPosition(io::OffsetOrigin::End, 0), m_largeData.size());
+
+        constexpr size_t Offset = 700000;
+        stream->setPosition(io::OffsetOrigin::Begin, Offset);
+        const std::vector<uint8_t> tail = readAll(*stream, m_largeData.size() - Offset);
+        ASSERT_TRUE(std::equal(tail.begin(), tail.end(), m_largeData.begin() + Offset, m_largeData.end()));
+
+        stream->setPosition(io::OffsetOrigin::Begin, 0);
+        ASSERT_EQ(readAll(*stream, m_largeData.size()), m_largeData);
+    }
+
+    /**
+        The sizes are read from the zip64 extra field, the extra field that follows it does not break the parsing.
+     */
+    TEST_F(TestZipArchiveFileSystem, ReadZip64Entry)
+    {
+        auto file = m_zipFs->openFile("/zip64.bin", io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        ASSERT_TRUE(file);
+        ASSERT_EQ(file->getSize(), m_storedData.size());
+        ASSERT_EQ(readAll(*file->createStream(), m_storedData.size()), m_storedData);
+    }
+
+    /**
+        The MS-DOS time of the entry is returned as the seconds since the epoch.
+     */
+    TEST_F(TestZipArchiveFileSystem, LastWriteTime)
+    {
+        std::tm expectedTime{};
+        expectedTime.tm_year = 2024 - 1900;
+        expectedTime.tm_mon = 2;
+        expectedTime.tm_mday = 15;
+        expectedTime.tm_hour = 13;
+        expectedTime.tm_min = 45;
+        expectedTime.tm_sec = 30;
+        expectedTime.tm_isdst = -1;
+
+        ASSERT_EQ(m_zipFs->getLastWriteTime("/zip64.bin"), static_cast<size_t>(std::mktime(&expectedTime)));
+        ASSERT_EQ(m_zipFs->getLastWriteTime("/small.bin"), 0);
+    }
+
+    TEST_F(TestZipArchiveFileSystem, ConcurrentReads)
+    {
+        std::vector<std::thread> threads;
+        std::atomic<size_t> successCount = 0;
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([this, &successCount]
+            {
+                io::IStreamReader::Ptr stream = m_zipFs->openFile("/content/sub/large.bin", io::AccessMode::Read, io::OpenFileMode::OpenExisting)->createStream();
+                if (readAll(*stream, m_largeData.size()) == m_largeData)
+                {
+                    ++successCount;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(successCount, threads.size());
+    }
+
+    TEST_F(TestZipArchiveFileSystem, DirectoryIterator)
+    {
+        std::vector<std::string> names;
+        io::DirectoryIterator dirIter{m_zipFs, "/content"};
+        for (const io::FsEntry& entry : dirIter)
+        {
+            names.emplace_back(entry.path.getName());
+        }
+
+        ASSERT_EQ(names, (std::vector<std::string>{"stored.txt", "sub"}));
+    }
+}  // namespace nau::test
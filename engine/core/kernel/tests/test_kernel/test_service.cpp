@@ -301,6 +301,67 @@ namespace nau::test
         ASSERT_THAT(services2.size(), Eq(1));
     }
 
+    /**
+        Test:
+            getAllCached returns the same snapshot while the registry is not changed.
+            The registration invalidates the snapshot, but the previously returned one remains valid.
+     */
+    TEST_F(TestService, GetAllCached)
+    {
+        m_serviceProvider->addService(std::make_unique<TestService1>());
+        m_serviceProvider->addService(std::make_unique<TestService12>());
+
+        const eastl::span<ITestInterface1* const> services1 = m_serviceProvider->getAllCached<ITestInterface1>();
+        ASSERT_THAT(services1.size(), Eq(2));
+        ASSERT_THAT(m_serviceProvider->getAllCached<ITestInterface1>().data(), Eq(services1.data()));
+
+        m_serviceProvider->addService(std::make_unique<TestService1>());
+
+        const eastl::span<ITestInterface1* const> services2 = m_serviceProvider->getAllCached<ITestInterface1>();
+        ASSERT_THAT(services2.size(), Eq(3));
+        ASSERT_THAT(m_serviceProvider->getAll<ITestInterface1>().size(), Eq(3));
+
+        ASSERT_THAT(services1.size(), Eq(2));
+        ASSERT_THAT(services1[0], Eq(services2[0]));
+        ASSERT_THAT(services1[1], Eq(services2[1]));
+    }
+
+    /**
+        Test:
+            the registration that does not provide the api does not store the new snapshot:
+            the cached one is reused, so the cache does not grow with the registry changes.
+     */
+    TEST_F(TestService, GetAllCachedReusedForUnrelatedRegistration)
+    {
+        m_serviceProvider->addService(std::make_unique<TestService1>());
+
+        const eastl::span<ITestInterface1* const> services1 = m_serviceProvider->getAllCached<ITestInterface1>();
+        ASSERT_THAT(services1.size(), Eq(1));
+
+        for (int i = 0; i < 10; ++i)
+        {
+            m_serviceProvider->addService(std::make_unique<TestService3>());
+            ASSERT_THAT(m_serviceProvider->getAllCached<ITestInterface1>().data(), Eq(services1.data()));
+        }
+
+        ASSERT_THAT(m_serviceProvider->getAllCached<ITestInterface3>().size(), Eq(10));
+    }
+
+    /**
+        Test:
+            the missing service lookup result is not kept after the service is registered.
+     */
+    TEST_F(TestService, FindAfterRegistration)
+    {
+        ASSERT_THAT(m_serviceProvider->find<ITestInterface3>(), IsNull());
+
+        m_serviceProvider->addService(std::make_unique<TestService3>());
+
+        ITestInterface3* const service = m_serviceProvider->find<ITestInterface3>();
+        ASSERT_THAT(service, NotNull());
+        ASSERT_THAT(m_serviceProvider->find<ITestInterface3>(), Eq(service));
+    }
+
     TEST_F(TestService, HasLazyApi)
     {
         bool fabricateAnyService = false;
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include "nau/diag/startup_trace.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_state.h"
 #include "nau/service/internal/service_provider_initialization.h"
@@ -177,6 +178,68 @@ namespace nau::test
         using Service2 = ServiceWithInit<ITestInterface2, ITestInterface1>;
         using Service3 = ServiceWithInit<ITestInterface3, ITestInterface2>;
         using Service4 = ServiceWithInit<ITestInterface4, ITestInterface1, ITestInterface3>;
+
+        struct AsyncServiceInitData : IServiceInitialization
+        {
+            NAU_INTERFACE(AsyncServiceInitData, IServiceInitialization)
+
+            async::TaskSource<> startedSignal;
+            async::Task<> startedTask = startedSignal.getTask();
+            async::TaskSource<> completeSignal;
+            std::atomic<bool> isPreInitialized = false;
+            std::atomic<bool> isStartedAfterDependencies = false;
+        };
+
+        /**
+            The service which pre-initialization is completed only when the test resolves completeSignal.
+         */
+        template <typename Itf, typename... Dependency>
+        class AsyncInitService : public Itf,
+                                 public AsyncServiceInitData
+        {
+            NAU_RTTI_CLASS(AsyncInitService<Itf>, Itf, AsyncServiceInitData)
+
+        public:
+            AsyncInitService(ServiceProvider& inServiceProvider) :
+                m_serviceProvider(inServiceProvider)
+            {
+            }
+
+            async::Task<> preInitService() override
+            {
+                this->isStartedAfterDependencies = (isDependencyPreInitialized<Dependency>() && ...);
+                this->startedSignal.resolve();
+
+                co_await this->completeSignal.getTask();
+                this->isPreInitialized = true;
+            }
+
+            async::Task<> initService() override
+            {
+                return async::makeResolvedTask();
+            }
+
+            eastl::vector<const rtti::TypeInfo*> getServiceDependencies() const override
+            {
+                return eastl::vector<const rtti::TypeInfo*>{
+                    &rtti::getTypeInfo<Dependency>()...};
+            }
+
+        private:
+            template <typename U>
+            bool isDependencyPreInitialized() const
+            {
+                return m_serviceProvider.get<U>().template as<AsyncServiceInitData&>().isPreInitialized;
+            }
+
+            ServiceProvider& m_serviceProvider;
+        };
+
+        // two independent dependency chains: 1 -> 2 and 3 -> 4
+        using AsyncService1 = AsyncInitService<ITestInterface1>;
+        using AsyncService2 = AsyncInitService<ITestInterface2, ITestInterface1>;
+        using AsyncService3 = AsyncInitService<ITestInterface3>;
+        using AsyncService4 = AsyncInitService<ITestInterface4, ITestInterface3>;
     }  // namespace
 
     /**
@@ -219,6 +282,66 @@ namespace nau::test
         ASSERT_TRUE(isInitializedOk(TypeList<ITestInterface4>{}));
     }
 
+    /**
+        Test:
+            the services are initialized as the dependency graph:
+            the service starts only after its dependencies are completed, but it does not wait for the unrelated services.
+            Every service initialization is recorded by the startup trace.
+     */
+    TEST_F(TestServiceDependencies, ConcurrentInitialization)
+    {
+        diag::resetStartupTrace();
+
+        m_serviceProvider->addService(eastl::make_unique<AsyncService2>(*m_serviceProvider));
+        m_serviceProvider->addService(eastl::make_unique<AsyncService4>(*m_serviceProvider));
+        m_serviceProvider->addService(eastl::make_unique<AsyncService1>(*m_serviceProvider));
+        m_serviceProvider->addService(eastl::make_unique<AsyncService3>(*m_serviceProvider));
+
+        const auto getInitData = [this]<typename T>(TypeList<T>) -> AsyncServiceInitData&
+        {
+            return m_serviceProvider->get<T>().template as<AsyncServiceInitData&>();
+        };
+
+        AsyncServiceInitData& service1 = getInitData(TypeList<ITestInterface1>{});
+        AsyncServiceInitData& service2 = getInitData(TypeList<ITestInterface2>{});
+        AsyncServiceInitData& service3 = getInitData(TypeList<ITestInterface3>{});
+        AsyncServiceInitData& service4 = getInitData(TypeList<ITestInterface4>{});
+
+        auto& serviceProviderInit = m_serviceProvider->as<core_detail::IServiceProviderInitialization&>();
+        async::Task<> preInitTask = serviceProviderInit.preInitServices();
+
+        // the services without dependencies are started at once
+        ASSERT_TRUE(service1.startedTask.isReady());
+        ASSERT_TRUE(service3.startedTask.isReady());
+        ASSERT_FALSE(service2.startedTask.isReady());
+        ASSERT_FALSE(service4.startedTask.isReady());
+
+        // the chain 3 -> 4 is completed while the service 1 is still in progress
+        service3.completeSignal.resolve();
+        ASSERT_TRUE(async::wait(service4.startedTask));
+        service4.completeSignal.resolve();
+
+        ASSERT_FALSE(service1.isPreInitialized);
+        ASSERT_FALSE(service2.startedTask.isReady());
+
+        service1.completeSignal.resolve();
+        ASSERT_TRUE(async::wait(service2.startedTask));
+        service2.completeSignal.resolve();
+
+        ASSERT_TRUE(async::waitResult(std::move(preInitTask)));
+
+        ASSERT_TRUE(service2.isStartedAfterDependencies);
+        ASSERT_TRUE(service4.isStartedAfterDependencies);
+
+        const auto trace = diag::getStartupTrace();
+        const auto preInitCount = std::count_if(trace.begin(), trace.end(), [](const diag::StartupTraceEntry& entry)
+        {
+            return entry.stage == diag::StartupStage::ServicePreInit;
+        });
+
+        ASSERT_EQ(preInitCount, 4);
+    }
+
     /**
         Test:
             the order of services shutdown takes into account the dependencies between them: it must be reverse of the initialization sequence
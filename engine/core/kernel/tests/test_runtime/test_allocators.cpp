@@ -4,18 +4,23 @@
 //
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/string_allocator.h"
+#include "nau/memory/allocation_profiler.h"
 #include "nau/memory/array_allocator.h"
 #include "nau/memory/frame_allocator.h"
 #include "nau/memory/stack_allocator.h"
 #include "nau/memory/general_allocator.h"
+#include "nau/memory/size_class_allocator.h"
 #include "nau/memory/eastl_aliases.h"
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/platform/aligned_allocator_windows.h"
+#include "nau/io/memory_stream.h"
+#include "nau/serialization/json.h"
 
 #include <limits>
 #include <unordered_set>
 #include <chrono>
 #include <mutex>
+#include <numeric>
 
 namespace nau::test
 {
@@ -411,6 +416,104 @@ namespace nau::test
         }
     }
 
+    TEST(TestAllocator, FrameArenaAllocator)
+    {
+        FrameArenaAllocator allocator{2};
+
+        auto* const frame0 = static_cast<int*>(allocator.allocate(sizeof(int) * 100));
+        for (int i = 0; i < 100; ++i)
+        {
+            frame0[i] = i;
+        }
+        EXPECT_TRUE(isAligned(frame0, FrameArenaAllocator::BlockAlignment));
+
+        // fire and forget: nothing is deallocated
+        EXPECT_TRUE(allocator.prepareFrame());
+        EXPECT_EQ(allocator.getStatistics().lastFrameBytes, alignedSize(sizeof(int) * 100, FrameArenaAllocator::BlockAlignment));
+
+        // memory of the previous frame is still valid (double buffering)
+        auto* const frame1 = static_cast<int*>(allocator.allocate(sizeof(int)));
+        EXPECT_NE(frame1, frame0);
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(frame0[i], i);
+        }
+
+        auto* const aligned = allocator.allocateAligned(16, 256);
+        EXPECT_TRUE(isAligned(aligned, 256));
+
+        EXPECT_TRUE(allocator.prepareFrame());
+
+        // memory of the frame 0 is reused
+        EXPECT_EQ(allocator.allocate(sizeof(int)), frame0);
+
+        const auto statistics = allocator.getStatistics();
+        EXPECT_EQ(statistics.frame, 2);
+        EXPECT_EQ(statistics.peakFrameBytes, alignedSize(sizeof(int) * 100, FrameArenaAllocator::BlockAlignment));
+    }
+
+    /**
+        Without the installed frame arena the frame arena containers use the default allocator.
+     */
+    TEST(TestAllocator, FrameArenaVectorWithoutArena)
+    {
+        ASSERT_EQ(FrameArenaAllocator::getFrameArena(), nullptr);
+
+        FrameArenaVector<int> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+
+        ASSERT_EQ(values.size(), 1000);
+        EXPECT_EQ(values.back(), 999);
+    }
+
+    TEST(TestAllocator, FrameArenaAllocatorMultiThread)
+    {
+        FrameArenaAllocator allocator{3};
+        FrameArenaAllocator::setFrameArena(&allocator);
+
+        constexpr int FramesCount = 10;
+        constexpr int ValuesCount = 1000;
+        const size_t threadsCount = std::max(2u, std::thread::hardware_concurrency());
+
+        for (int frame = 0; frame < FramesCount; ++frame)
+        {
+            std::vector<FrameArenaVector<int>*> results(threadsCount);
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < threadsCount; ++t)
+            {
+                threads.emplace_back([&results, t, frame]
+                {
+                    // the container is not destroyed: its memory is released with the frame
+                    auto* values = new (FrameArenaAllocator::getFrameArena()->allocate(sizeof(FrameArenaVector<int>))) FrameArenaVector<int>;
+                    for (int i = 0; i < ValuesCount; ++i)
+                    {
+                        values->push_back(frame + i);
+                    }
+                    results[t] = values;
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto* values : results)
+            {
+                ASSERT_EQ(values->size(), ValuesCount);
+                EXPECT_EQ(values->back(), frame + ValuesCount - 1);
+            }
+
+            EXPECT_TRUE(allocator.prepareFrame());
+            EXPECT_GE(allocator.getStatistics().lastFrameBytes, threadsCount * ValuesCount * sizeof(int));
+        }
+
+        FrameArenaAllocator::setFrameArena(nullptr);
+    }
+
     TEST(TestAllocator, MultiThread)
     {
         StackAllocatorUnnamed;
@@ -507,6 +610,284 @@ namespace nau::test
         Allocator::instance().deallocate(ptr);
     }
 
+    TEST(TestAllocator, SizeClassAllocator)
+    {
+        SizeClassAllocator allocator;
+
+        std::vector<std::pair<unsigned char*, size_t>> blocks;
+        for (size_t size = 0; size <= SizeClassAllocator::MaxSmallSize * 2; size += 7)
+        {
+            auto* ptr = static_cast<unsigned char*>(allocator.allocate(size));
+            ASSERT_TRUE(ptr);
+            EXPECT_TRUE(isAligned(ptr, 16));
+            EXPECT_GE(allocator.getSize(ptr), size);
+
+            memset(ptr, static_cast<int>(size & 0xff), size);
+            blocks.emplace_back(ptr, size);
+        }
+
+        for (auto& [ptr, size] : blocks)
+        {
+            const size_t newSize = size * 2 + 1;
+            ptr = static_cast<unsigned char*>(allocator.reallocate(ptr, newSize));
+            ASSERT_GE(allocator.getSize(ptr), newSize);
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(ptr[i], static_cast<unsigned char>(size & 0xff));
+            }
+        }
+
+        for (auto& [ptr, size] : blocks)
+        {
+            allocator.deallocate(ptr);
+        }
+    }
+
+    /**
+        Test:
+            Blocks are allocated by the one thread and freed by another one.
+            Blocks must not be corrupted and are returned to the allocating side through the central lists.
+     */
+    TEST(TestAllocator, SizeClassAllocatorCrossThreadFree)
+    {
+        constexpr size_t BlocksCount = 100'000;
+
+        SizeClassAllocator allocator;
+        const auto statisticsBefore = SizeClassAllocator::getStatistics();
+
+        std::vector<uint32_t*> blocks(BlocksCount);
+        std::thread producer([&]
+        {
+            for (size_t i = 0; i < BlocksCount; ++i)
+            {
+                blocks[i] = static_cast<uint32_t*>(allocator.allocate(sizeof(uint32_t) * (1 + i % 16)));
+                *blocks[i] = static_cast<uint32_t>(i);
+            }
+        });
+        producer.join();
+
+        std::thread consumer([&]
+        {
+            for (size_t i = 0; i < BlocksCount; ++i)
+            {
+                EXPECT_EQ(*blocks[i], static_cast<uint32_t>(i));
+                allocator.deallocate(blocks[i]);
+            }
+        });
+        consumer.join();
+
+        const auto statistics = SizeClassAllocator::getStatistics();
+        EXPECT_GE(statistics.allocations - statisticsBefore.allocations, BlocksCount);
+        EXPECT_GE(statistics.deallocations - statisticsBefore.deallocations, BlocksCount);
+    }
+
+    /**
+        Multithreaded alloc/free of the small mixed size blocks (with a part of the blocks freed by the other thread): SizeClassAllocator vs system allocator.
+        The timings, the allocation profiler counters of each memory section and the page heap usage are reported as the test properties.
+     */
+    TEST(TestAllocator, SizeClassAllocatorBenchmark)
+    {
+        constexpr size_t Iterations = 200'000;
+        constexpr size_t LiveBlocks = 256;
+        const size_t threadsCount = std::max(2u, std::thread::hardware_concurrency());
+
+        auto runBenchmark = [&](auto allocate, auto deallocate)
+        {
+            std::vector<std::vector<void*>> handOff(threadsCount);
+            std::vector<std::thread> threads;
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            for (size_t t = 0; t < threadsCount; ++t)
+            {
+                threads.emplace_back([&, t]
+                {
+                    std::vector<void*> live(LiveBlocks, nullptr);
+                    for (size_t i = 0; i < Iterations; ++i)
+                    {
+                        void*& slot = live[(i * 7) % LiveBlocks];
+                        if (slot)
+                        {
+                            deallocate(slot);
+                        }
+                        slot = allocate(16 + (i * 13) % 512);
+                    }
+
+                    // live blocks are freed by the neighbour thread
+                    handOff[t] = std::move(live);
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            threads.clear();
+
+            for (size_t t = 0; t < threadsCount; ++t)
+            {
+                threads.emplace_back([&, t]
+                {
+                    for (void* ptr : handOff[(t + 1) % threadsCount])
+                    {
+                        deallocate(ptr);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+        };
+
+        SizeClassAllocator allocator;
+        auto runSizeClassBenchmark = [&]
+        {
+            return runBenchmark([&](size_t size)
+            {
+                return allocator.allocate(size);
+            }, [&](void* ptr)
+            {
+                allocator.deallocate(ptr);
+            });
+        };
+
+        const auto sizeClassTime = runSizeClassBenchmark();
+
+        const auto systemTime = runBenchmark([](size_t size)
+        {
+            return ::malloc(size);
+        }, [](void* ptr)
+        {
+            ::free(ptr);
+        });
+
+        RecordProperty("threads", static_cast<int>(threadsCount));
+        RecordProperty("iterations", static_cast<int>(Iterations));
+        RecordProperty("size_class_allocator_us", static_cast<int>(sizeClassTime.count()));
+        RecordProperty("system_allocator_us", static_cast<int>(systemTime.count()));
+
+        // The section statistics are collected by the separate (not timed) run: the profiler slows down each allocation.
+        AllocationProfiler::setEnabled(true);
+        const auto before = AllocationProfiler::makeSnapshot();
+        runSizeClassBenchmark();
+        const auto diff = AllocationProfiler::makeSnapshot().diff(before);
+        AllocationProfiler::setEnabled(false);
+
+        for (const auto& section : diff.sections)
+        {
+            std::string name{section.kind.data(), section.kind.size()};
+            std::replace_if(name.begin(), name.end(), [](char c)
+            {
+                return !std::isalnum(static_cast<unsigned char>(c));
+            }, '_');
+
+            RecordProperty(name + "_allocations", static_cast<int>(section.allocations));
+            RecordProperty(name + "_deallocations", static_cast<int>(section.deallocations));
+            RecordProperty(name + "_allocated_kb", static_cast<int>(section.allocatedBytes / 1024));
+            RecordProperty(name + "_live_bytes", static_cast<int>(section.getLiveBytes()));
+        }
+
+        SizeClassAllocator::flushThreadCache();
+        const auto statistics = SizeClassAllocator::getStatistics();
+        const size_t spansCount = std::accumulate(statistics.sizeClasses.begin(), statistics.sizeClasses.end(), size_t{0}, [](size_t count, const auto& sizeClass)
+        {
+            return count + sizeClass.spansCount;
+        });
+
+        RecordProperty("size_class_spans", static_cast<int>(spansCount));
+        RecordProperty("size_class_free_spans", static_cast<int>(statistics.freeSpans));
+        RecordProperty("size_class_reserved_kb", static_cast<int>(statistics.reservedBytes / 1024));
+    }
+
+    /**
+        Test:
+            Section counters of the snapshot diff must match the allocations made between the snapshots.
+     */
+    TEST(TestAllocator, AllocationProfilerSections)
+    {
+        constexpr size_t BlockSize = 48;
+        auto& allocator = FixedBlocksAllocator<BlockSize>::instance();
+
+        AllocationProfiler::setEnabled(true);
+        const auto before = AllocationProfiler::makeSnapshot();
+
+        std::vector<void*> blocks;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            blocks.push_back(allocator.allocate(BlockSize));
+        }
+
+        for (size_t i = 0; i < 40; ++i)
+        {
+            allocator.deallocate(blocks[i]);
+        }
+
+        const auto diff = AllocationProfiler::makeSnapshot().diff(before);
+        AllocationProfiler::setEnabled(false);
+
+        for (size_t i = 40; i < blocks.size(); ++i)
+        {
+            allocator.deallocate(blocks[i]);
+        }
+
+        const auto* const section = diff.findSection("FixedBlocksAllocator<48>");
+        ASSERT_TRUE(section);
+        EXPECT_EQ(section->allocations, 100u);
+        EXPECT_EQ(section->deallocations, 40u);
+        EXPECT_EQ(section->getLiveBytes(), static_cast<int64_t>(60 * BlockSize));
+    }
+
+    /**
+        Test:
+            Each Nth allocation is sampled, the call site counters are weighted by the sampling interval.
+            The exported snapshot must be a valid json.
+     */
+    TEST(TestAllocator, AllocationProfilerSampling)
+    {
+        constexpr size_t AllocationsCount = 1000;
+        constexpr uint32_t SamplingInterval = 4;
+
+        SizeClassAllocator allocator;
+
+        AllocationProfiler::setSamplingInterval(SamplingInterval);
+        AllocationProfiler::setEnabled(true);
+        const auto before = AllocationProfiler::makeSnapshot();
+
+        for (size_t i = 0; i < AllocationsCount; ++i)
+        {
+            allocator.deallocate(allocator.allocate(64));
+        }
+
+        const auto diff = AllocationProfiler::makeSnapshot().diff(before);
+        AllocationProfiler::setEnabled(false);
+        AllocationProfiler::setSamplingInterval(AllocationProfiler::DefaultSamplingInterval);
+
+        const auto* const section = diff.findSection("SizeClassAllocator");
+        ASSERT_TRUE(section);
+        EXPECT_GE(section->allocations, AllocationsCount);
+        EXPECT_GE(section->deallocations, AllocationsCount);
+
+        const auto topCallSites = diff.getTopCallSites(1);
+        ASSERT_EQ(topCallSites.size(), 1u);
+        EXPECT_EQ(topCallSites.front().section, "SizeClassAllocator");
+        EXPECT_FALSE(topCallSites.front().frames.empty());
+        EXPECT_GE(topCallSites.front().samples, AllocationsCount / SamplingInterval);
+        EXPECT_EQ(topCallSites.front().allocations, topCallSites.front().samples * SamplingInterval);
+
+        auto stream = io::createMemoryStream();
+        ASSERT_TRUE(diff.writeJson(stream->as<io::IStreamWriter&>()));
+
+        const auto buffer = stream->getBufferAsSpan();
+        const auto json = serialization::jsonParseToValue(eastl::string_view{reinterpret_cast<const char*>(buffer.data()), buffer.size()});
+        ASSERT_TRUE(json);
+        EXPECT_TRUE((*json)["sections"].isArray());
+        EXPECT_TRUE((*json)["callSites"].isArray());
+    }
+
     TEST(TestEastlAleasesAllocator, Vector)
     {
         {
@@ -0,0 +1,154 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "helpers/runtime_guard.h"
+#include "nau/async/async_context.h"
+#include "nau/async/task.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        class TestAsyncContext final : public async::AsyncContext
+        {
+            NAU_CLASS_(nau::test::TestAsyncContext, async::AsyncContext)
+
+        public:
+            TestAsyncContext(int value_) :
+                value(value_),
+                m_parent(getCurrent())
+            {
+            }
+
+            AsyncContext* getParent() const override
+            {
+                return m_parent.get();
+            }
+
+            const int value;
+
+        private:
+            const AsyncContext::Ptr m_parent;
+        };
+
+        int getCurrentTestValue()
+        {
+            auto* const context = async::AsyncContext::find<TestAsyncContext>();
+            return context ? context->value : 0;
+        }
+    }  // namespace
+
+    /**
+        Test:
+            The coroutine keeps the context it was started with after it is resumed on the other thread,
+            the thread that resumed the coroutine gets its own context back.
+     */
+    TEST(TestAsyncContext, KeptAcrossAwait)
+    {
+        using namespace nau::async;
+
+        const auto runtimeGuard = RuntimeGuard::create();
+
+        TaskSource<> signal;
+        Task<int> task;
+        {
+            const AsyncContextScope contextScope{rtti::createInstance<TestAsyncContext>(1)};
+
+            task = [](Task<> signal) -> Task<int>
+            {
+                co_await signal;
+                const int valueAfterSignal = getCurrentTestValue();
+
+                co_await Executor::getDefault();
+                co_return valueAfterSignal == 1 ? getCurrentTestValue() : -1;
+            }(signal.getTask());
+        }
+
+        ASSERT_EQ(getCurrentTestValue(), 0);
+
+        {
+            const AsyncContextScope contextScope{rtti::createInstance<TestAsyncContext>(2)};
+            signal.resolve();
+            ASSERT_EQ(getCurrentTestValue(), 2);
+        }
+
+        ASSERT_EQ(*async::waitResult(std::move(task)), 1);
+        ASSERT_EQ(getCurrentTestValue(), 0);
+    }
+
+    /**
+        Test:
+            The scope that is opened within the coroutine is kept across co_await and does not leak to the thread that resumed the coroutine.
+     */
+    TEST(TestAsyncContext, ScopeSpansAwait)
+    {
+        using namespace nau::async;
+
+        const auto runtimeGuard = RuntimeGuard::create();
+
+        TaskSource<> signal;
+        Task<int> task = [](Task<> signal) -> Task<int>
+        {
+            int valueInScope = 0;
+            {
+                const AsyncContextScope contextScope{rtti::createInstance<TestAsyncContext>(1)};
+                co_await signal;
+                valueInScope = getCurrentTestValue();
+            }
+
+            co_return valueInScope == 1 ? getCurrentTestValue() : -1;
+        }(signal.getTask());
+
+        ASSERT_EQ(getCurrentTestValue(), 0);
+
+        signal.resolve();
+        ASSERT_EQ(getCurrentTestValue(), 0);
+        ASSERT_EQ(*async::waitResult(std::move(task)), 0);
+    }
+
+    /**
+        Test:
+            The coroutine that is destroyed while suspended (awaited task is rejected) closes its scope in its own context.
+     */
+    TEST(TestAsyncContext, ScopeOfDestroyedCoroutine)
+    {
+        using namespace nau::async;
+
+        const auto runtimeGuard = RuntimeGuard::create();
+
+        TaskSource<> signal;
+        Task<> task = [](Task<> signal) -> Task<>
+        {
+            const AsyncContextScope contextScope{rtti::createInstance<TestAsyncContext>(1)};
+            co_await signal;
+        }(signal.getTask());
+
+        signal.reject(NauMakeError("Test error"));
+        async::wait(task);
+
+        ASSERT_TRUE(task.isRejected());
+        ASSERT_EQ(getCurrentTestValue(), 0);
+    }
+
+    /**
+        Test:
+            The nested context keeps the outer one as the parent: find() returns the nearest context of the requested type.
+     */
+    TEST(TestAsyncContext, Nested)
+    {
+        using namespace nau::async;
+
+        const AsyncContextScope outerScope{rtti::createInstance<TestAsyncContext>(1)};
+        auto* const outerContext = AsyncContext::getCurrent();
+        {
+            const AsyncContextScope innerScope{rtti::createInstance<TestAsyncContext>(2)};
+            ASSERT_EQ(getCurrentTestValue(), 2);
+            ASSERT_EQ(AsyncContext::getCurrent()->getParent(), outerContext);
+        }
+
+        ASSERT_EQ(getCurrentTestValue(), 1);
+    }
+
+}  // namespace nau::test
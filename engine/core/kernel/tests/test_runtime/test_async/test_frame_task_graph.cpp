@@ -0,0 +1,154 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "helpers/runtime_guard.h"
+#include "nau/app/main_loop/frame_task_graph.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau::test
+{
+    using namespace nau::string_literals;
+    using namespace std::chrono_literals;
+
+    class TestFrameTaskGraph : public testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            m_runtimeGuard.reset();
+        }
+
+        RuntimeGuard::Ptr m_runtimeGuard = RuntimeGuard::create();
+    };
+
+    /**
+        Test:
+            Phases that write the same data run in the order they were added, the reader waits for the writer.
+     */
+    TEST_F(TestFrameTaskGraph, ConflictingPhasesOrder)
+    {
+        constexpr size_t FramesCount = 10;
+
+        std::mutex mutex;
+        std::vector<std::string> order;
+
+        const auto makePhase = [&](const char* name, eastl::vector<NameId> reads, eastl::vector<NameId> writes)
+        {
+            FramePhaseDesc phase;
+            phase.name = NameId{eastl::string_view{name}};
+            phase.reads = std::move(reads);
+            phase.writes = std::move(writes);
+            phase.callback = [&mutex, &order, name](float)
+            {
+                std::this_thread::sleep_for(1ms);
+                lock_(mutex);
+                order.push_back(name);
+            };
+
+            return phase;
+        };
+
+        FrameTaskGraph graph;
+        graph.addPhase(makePhase("write1", {}, {"data"_name}));
+        graph.addPhase(makePhase("read", {"data"_name}, {}));
+        graph.addPhase(makePhase("write2", {}, {"data"_name}));
+
+        for (size_t i = 0; i < FramesCount; ++i)
+        {
+            order.clear();
+            graph.run(0.f);
+            ASSERT_EQ(order, (std::vector<std::string>{"write1", "read", "write2"}));
+        }
+    }
+
+    /**
+        Test:
+            Independent phases run concurrently: the frame takes about the critical path (the longest phase), not the sum of the phases.
+     */
+    TEST_F(TestFrameTaskGraph, IndependentPhasesRunConcurrently)
+    {
+        constexpr size_t PhasesCount = 4;
+
+        std::atomic_uint32_t activePhases = 0;
+        std::atomic_uint32_t maxActivePhases = 0;
+
+        FrameTaskGraph graph;
+        for (size_t i = 0; i < PhasesCount; ++i)
+        {
+            FramePhaseDesc phase;
+            phase.name = NameId{eastl::string_view{::fmt::format("phase {}", i).c_str()}};
+            phase.writes = {phase.name};
+            phase.callback = [&](float)
+            {
+                const uint32_t active = activePhases.fetch_add(1) + 1;
+                for (uint32_t current = maxActivePhases.load(); current < active && !maxActivePhases.compare_exchange_weak(current, active);)
+                {
+                }
+
+                std::this_thread::sleep_for(20ms);
+                activePhases.fetch_sub(1);
+            };
+
+            graph.addPhase(std::move(phase));
+        }
+
+        graph.run(0.f);
+
+        const auto& statistics = graph.getLastFrameStatistics();
+        ASSERT_EQ(statistics.phases.size(), PhasesCount);
+        ASSERT_GT(maxActivePhases.load(), 1u);
+        ASSERT_LT(statistics.criticalPathNs, statistics.sumNs);
+        ASSERT_LT(statistics.wallNs, statistics.sumNs);
+    }
+
+    /**
+        Test:
+            Main thread phases run on the thread that calls run(), the exclusive phase waits for all previous phases.
+     */
+    TEST_F(TestFrameTaskGraph, MainThreadAndExclusivePhases)
+    {
+        const auto callerThreadId = std::this_thread::get_id();
+
+        std::atomic_uint32_t completedWorkerPhases = 0;
+        std::thread::id mainPhaseThreadId;
+        uint32_t completedBeforeExclusive = 0;
+
+        FrameTaskGraph graph;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            FramePhaseDesc phase;
+            phase.name = NameId{eastl::string_view{::fmt::format("worker {}", i).c_str()}};
+            phase.callback = [&](float)
+            {
+                std::this_thread::sleep_for(2ms);
+                completedWorkerPhases.fetch_add(1);
+            };
+
+            graph.addPhase(std::move(phase));
+        }
+
+        FramePhaseDesc mainPhase;
+        mainPhase.name = "main"_name;
+        mainPhase.mainThreadOnly = true;
+        mainPhase.callback = [&](float)
+        {
+            mainPhaseThreadId = std::this_thread::get_id();
+        };
+        graph.addPhase(std::move(mainPhase));
+
+        FramePhaseDesc exclusivePhase;
+        exclusivePhase.name = "exclusive"_name;
+        exclusivePhase.exclusive = true;
+        exclusivePhase.callback = [&](float)
+        {
+            completedBeforeExclusive = completedWorkerPhases.load();
+        };
+        graph.addPhase(std::move(exclusivePhase));
+
+        graph.run(0.f);
+
+        ASSERT_EQ(mainPhaseThreadId, callerThreadId);
+        ASSERT_EQ(completedBeforeExclusive, 3u);
+    }
+}  // namespace nau::test
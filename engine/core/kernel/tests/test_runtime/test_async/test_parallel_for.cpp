@@ -0,0 +1,77 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "helpers/runtime_guard.h"
+#include "nau/threading/parallel_for.h"
+
+namespace nau::test
+{
+    class TestParallelFor : public testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            m_runtimeGuard.reset();
+        }
+
+        RuntimeGuard::Ptr m_runtimeGuard = RuntimeGuard::create();
+    };
+
+    TEST_F(TestParallelFor, WorkersCountFromPool)
+    {
+        ASSERT_EQ(threading::getParallelForWorkersCount(), 4);
+    }
+
+    TEST_F(TestParallelFor, ProcessEachItemOnce)
+    {
+        constexpr uint32_t ItemsCount = 100'000;
+        constexpr uint32_t Quant = 64;
+
+        std::vector<std::atomic_uint32_t> visits(ItemsCount);
+        std::atomic_uint32_t maxWorkerIndex = 0;
+
+        threading::parallelFor(ItemsCount, Quant, [&](uint32_t begin, uint32_t end, uint32_t workerIndex)
+        {
+            ASSERT_LE(end - begin, Quant);
+
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                visits[i].fetch_add(1);
+            }
+
+            for (uint32_t current = maxWorkerIndex.load(); current < workerIndex && !maxWorkerIndex.compare_exchange_weak(current, workerIndex);)
+            {
+            }
+        }, 2);
+
+        for (const auto& counter : visits)
+        {
+            ASSERT_EQ(counter.load(), 1);
+        }
+
+        ASSERT_LE(maxWorkerIndex.load(), 2);
+    }
+
+    /**
+        Test:
+            Every range of the outer loop starts the inner loop from the pool thread.
+            The pool is too small to help all of them: nested loops must be completed by their callers.
+     */
+    TEST_F(TestParallelFor, NestedLoops)
+    {
+        constexpr uint32_t OuterCount = 16;
+        constexpr uint32_t InnerCount = 10'000;
+
+        std::atomic_uint32_t counter = 0;
+
+        threading::parallelFor(OuterCount, 1, [&counter](uint32_t, uint32_t, uint32_t)
+        {
+            threading::parallelFor(InnerCount, 100, [&counter](uint32_t begin, uint32_t end, uint32_t)
+            {
+                counter.fetch_add(end - begin);
+            });
+        });
+
+        ASSERT_EQ(counter.load(), OuterCount * InnerCount);
+    }
+}  // namespace nau::test
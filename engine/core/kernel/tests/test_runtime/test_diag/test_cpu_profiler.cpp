@@ -0,0 +1,160 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// test_cpu_profiler.cpp
+
+
+#include "nau/diag/cpu_profiler.h"
+#include "nau/io/memory_stream.h"
+#include "nau/serialization/json.h"
+#include "nau/utils/performance_profiling.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        class CpuProfilerScope
+        {
+        public:
+            CpuProfilerScope()
+            {
+                diag::CpuProfiler::reset();
+                diag::CpuProfiler::setEnabled(true);
+            }
+
+            ~CpuProfilerScope()
+            {
+                diag::CpuProfiler::setEnabled(false);
+                diag::CpuProfiler::reset();
+            }
+        };
+
+        const diag::CpuProfiler::ZoneStatistics* findZone(const eastl::vector<diag::CpuProfiler::ZoneStatistics>& zones, std::string_view name)
+        {
+            auto zone = eastl::find_if(zones.begin(), zones.end(), [name](const diag::CpuProfiler::ZoneStatistics& zone)
+            {
+                return name == zone.name;
+            });
+
+            return zone != zones.end() ? &*zone : nullptr;
+        }
+    }  // namespace
+
+    /**
+        Test:
+            Frames are measured between the frame markers, the zones of all threads are aggregated by name.
+     */
+    TEST(TestCpuProfiler, FramesAndZones)
+    {
+        using namespace std::chrono_literals;
+
+        constexpr size_t FramesCount = 4;
+        constexpr size_t ThreadsCount = 3;
+        constexpr size_t ZonesPerThread = 100;
+
+        const CpuProfilerScope profilerScope;
+
+        for (size_t frame = 0; frame < FramesCount; ++frame)
+        {
+            NAU_PROFILING_FRAME_END;
+            NAU_CPU_SCOPED_NAME("test frame");
+
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < ThreadsCount; ++i)
+            {
+                threads.emplace_back([]
+                {
+                    for (size_t j = 0; j < ZonesPerThread; ++j)
+                    {
+                        NAU_CPU_SCOPED_NAME("test job");
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::this_thread::sleep_for(2ms);
+        }
+        NAU_PROFILING_FRAME_END;
+
+        const auto frames = diag::CpuProfiler::getFrames();
+        ASSERT_EQ(frames.size(), FramesCount);
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            EXPECT_EQ(frames[i].index, i);
+            EXPECT_GE(frames[i].durationNs, 2'000'000u);
+        }
+
+        const auto zones = diag::CpuProfiler::getZoneStatistics();
+
+        const auto* const frameZone = findZone(zones, "test frame");
+        ASSERT_TRUE(frameZone);
+        EXPECT_EQ(frameZone->count, FramesCount);
+        EXPECT_GE(frameZone->maxNs, 2'000'000u);
+
+        const auto* const jobZone = findZone(zones, "test job");
+        ASSERT_TRUE(jobZone);
+        EXPECT_EQ(jobZone->count, FramesCount * ThreadsCount * ZonesPerThread);
+    }
+
+    /**
+        Test:
+            Zones are not recorded while the profiler is disabled.
+     */
+    TEST(TestCpuProfiler, Disabled)
+    {
+        diag::CpuProfiler::reset();
+        {
+            NAU_CPU_SCOPED_NAME("test disabled");
+            NAU_PROFILING_FRAME_END;
+        }
+
+        EXPECT_FALSE(findZone(diag::CpuProfiler::getZoneStatistics(), "test disabled"));
+        EXPECT_TRUE(diag::CpuProfiler::getFrames().empty());
+    }
+
+    /**
+        Test:
+            The trace must be a valid json with the recorded zones, counters and task events.
+     */
+    TEST(TestCpuProfiler, ChromeTrace)
+    {
+        const CpuProfilerScope profilerScope;
+
+        {
+            NAU_CPU_SCOPED_NAME("test trace zone");
+            diag::CpuProfiler::recordCounter("test counter", 42);
+
+            int task = 0;
+            diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::Begin, &task);
+            diag::CpuProfiler::recordTaskEvent(diag::CpuProfiler::TaskEvent::End, &task);
+        }
+
+        auto stream = io::createMemoryStream();
+        ASSERT_TRUE(diag::CpuProfiler::writeChromeTrace(stream->as<io::IStreamWriter&>()));
+
+        const auto buffer = stream->getBufferAsSpan();
+        const auto json = serialization::jsonParseToValue(eastl::string_view{reinterpret_cast<const char*>(buffer.data()), buffer.size()});
+        ASSERT_TRUE(json);
+
+        const Json::Value& events = (*json)["traceEvents"];
+        ASSERT_TRUE(events.isArray());
+
+        eastl::vector<std::string> phases;
+        for (const Json::Value& event : events)
+        {
+            const std::string name = event["name"].asString();
+            if (name == "test trace zone" || name == "test counter" || (name == "Task" && event["cat"].asString() == "task"))
+            {
+                phases.push_back(event["ph"].asString());
+            }
+        }
+
+        EXPECT_NE(eastl::find(phases.begin(), phases.end(), "X"), phases.end());
+        EXPECT_NE(eastl::find(phases.begin(), phases.end(), "C"), phases.end());
+        EXPECT_NE(eastl::find(phases.begin(), phases.end(), "b"), phases.end());
+        EXPECT_NE(eastl::find(phases.begin(), phases.end(), "e"), phases.end());
+    }
+}  // namespace nau::test
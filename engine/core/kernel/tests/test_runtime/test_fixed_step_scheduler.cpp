@@ -0,0 +1,126 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/app/main_loop/fixed_step_scheduler.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        constexpr std::chrono::nanoseconds Step60Hz{1'000'000'000 / 60};
+
+        /**
+            The virtual clock: the time is only advanced by the test.
+         */
+        struct VirtualClock
+        {
+            FixedStepScheduler::Clock::time_point now{};
+
+            FixedStepScheduler::Clock::time_point advance(std::chrono::nanoseconds dt)
+            {
+                now += std::chrono::duration_cast<FixedStepScheduler::Clock::duration>(dt);
+                return now;
+            }
+        };
+    }  // namespace
+
+    /**
+        Test:
+            The real time is consumed by the fixed steps without drift: the frame time that is not a multiple of the step
+            is accumulated, the steps count over the long run matches the elapsed time exactly.
+     */
+    TEST(TestFixedStepScheduler, NoDrift)
+    {
+        constexpr size_t FramesCount = 10'000;
+        constexpr std::chrono::nanoseconds FrameTime = 7'123'457ns;
+
+        VirtualClock clock;
+        FixedStepScheduler scheduler{{.step = Step60Hz}};
+        scheduler.reset(clock.now);
+
+        uint64_t stepsCount = 0;
+        for (size_t i = 0; i < FramesCount; ++i)
+        {
+            const uint32_t steps = scheduler.advance(clock.advance(FrameTime));
+            ASSERT_LE(steps, 1u);
+            stepsCount += steps;
+
+            const float alpha = scheduler.getInterpolationAlpha();
+            ASSERT_GE(alpha, 0.f);
+            ASSERT_LT(alpha, 1.f);
+        }
+
+        const std::chrono::nanoseconds totalTime = FrameTime * FramesCount;
+        ASSERT_EQ(stepsCount, static_cast<uint64_t>(totalTime / Step60Hz));
+        ASSERT_EQ(scheduler.getStepsCount(), stepsCount);
+        ASSERT_EQ(scheduler.getDroppedTime(), 0ns);
+    }
+
+    /**
+        Test:
+            The first advance only starts the accumulation, the interpolation alpha is the accumulated part of the step.
+     */
+    TEST(TestFixedStepScheduler, AccumulationAndAlpha)
+    {
+        VirtualClock clock;
+        FixedStepScheduler scheduler{{.step = 10ms}};
+
+        ASSERT_EQ(scheduler.advance(clock.now), 0u);
+        ASSERT_EQ(scheduler.advance(clock.advance(5ms)), 0u);
+        ASSERT_FLOAT_EQ(scheduler.getInterpolationAlpha(), 0.5f);
+        ASSERT_EQ(scheduler.getNextStepTime(), clock.now + 5ms);
+
+        ASSERT_EQ(scheduler.advance(clock.advance(7500us)), 1u);
+        ASSERT_FLOAT_EQ(scheduler.getInterpolationAlpha(), 0.25f);
+
+        ASSERT_EQ(scheduler.advance(clock.advance(20ms)), 2u);
+        ASSERT_FLOAT_EQ(scheduler.getInterpolationAlpha(), 0.25f);
+    }
+
+    /**
+        Test:
+            The simulation that can not keep up is limited by maxStepsPerAdvance, the rest of the time is dropped (not accumulated),
+            the long pause is clamped by maxElapsedTime.
+     */
+    TEST(TestFixedStepScheduler, CatchUpLimits)
+    {
+        VirtualClock clock;
+        FixedStepScheduler scheduler{{.step = 10ms, .maxStepsPerAdvance = 3, .maxElapsedTime = 100ms}};
+        scheduler.reset(clock.now);
+
+        ASSERT_EQ(scheduler.advance(clock.advance(55ms)), 3u);
+        ASSERT_FLOAT_EQ(scheduler.getInterpolationAlpha(), 0.5f);
+        ASSERT_EQ(scheduler.getDroppedTime(), 20ms);
+
+        ASSERT_EQ(scheduler.advance(clock.advance(5ms)), 1u);
+        ASSERT_EQ(scheduler.getInterpolationAlpha(), 0.f);
+
+        // one second pause: clamped to 100ms, then limited to 3 steps
+        ASSERT_EQ(scheduler.advance(clock.advance(1s)), 3u);
+        ASSERT_EQ(scheduler.getDroppedTime(), 20ms + 900ms + 70ms);
+        ASSERT_EQ(scheduler.getStepsCount(), 7u);
+    }
+
+    /**
+        Test:
+            waitForNextStep returns not earlier than the next step time (by the real clock).
+     */
+    TEST(TestFixedStepScheduler, WaitForNextStep)
+    {
+        for (const FixedStepPacing pacing : {FixedStepPacing::Sleep, FixedStepPacing::SpinThenSleep})
+        {
+            FixedStepScheduler scheduler{{.step = 5ms, .pacing = pacing, .spinThreshold = 1ms}};
+            scheduler.reset();
+
+            for (size_t i = 0; i < 5; ++i)
+            {
+                scheduler.waitForNextStep();
+                const auto now = FixedStepScheduler::Clock::now();
+                ASSERT_GE(now, scheduler.getNextStepTime());
+                ASSERT_GE(scheduler.advance(now), 1u);
+            }
+        }
+    }
+}  // namespace nau::test
@@ -0,0 +1,163 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// test_stream.cpp
+
+
+#include "nau/io/memory_stream.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            Reader without the span support, that returns at most 3 bytes per read.
+         */
+        class ChunkedStreamReader final : public io::IStreamReader
+        {
+            NAU_CLASS_(nau::test::ChunkedStreamReader, io::IStreamReader)
+
+        public:
+            ChunkedStreamReader(eastl::vector<std::byte> data) :
+                m_data(std::move(data))
+            {
+            }
+
+            size_t getPosition() const override
+            {
+                return m_position;
+            }
+
+            size_t setPosition(io::OffsetOrigin, int64_t) override
+            {
+                return m_position;
+            }
+
+            Result<size_t> read(std::byte* buffer, size_t count) override
+            {
+                const size_t readCount = std::min({count, m_data.size() - m_position, size_t{3}});
+                memcpy(buffer, m_data.data() + m_position, readCount);
+                m_position += readCount;
+                return readCount;
+            }
+
+        private:
+            const eastl::vector<std::byte> m_data;
+            size_t m_position = 0;
+        };
+
+        eastl::vector<std::byte> makeTestData(size_t size)
+        {
+            eastl::vector<std::byte> data(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<std::byte>(i % 251);
+            }
+
+            return data;
+        }
+    }  // namespace
+
+    /**
+        Test:
+            The memory stream hands out the views of its own buffer and advances the position.
+     */
+    TEST(TestStream, ReadSpanFromMemoryStream)
+    {
+        const auto data = makeTestData(100);
+        auto stream = io::createReadonlyMemoryStream({data.data(), data.size()});
+
+        BytesBuffer fallbackBuffer;
+        const auto head = io::readStreamAsSpan(stream->as<io::IStreamReader&>(), 40, fallbackBuffer);
+        ASSERT_TRUE(head);
+        ASSERT_EQ(head->size(), 40u);
+        ASSERT_EQ(head->data(), data.data());
+        ASSERT_EQ(stream->getPosition(), 40u);
+
+        const auto tail = io::readStreamAsSpan(stream->as<io::IStreamReader&>(), std::numeric_limits<size_t>::max(), fallbackBuffer);
+        ASSERT_TRUE(tail);
+        ASSERT_EQ(tail->size(), 60u);
+        ASSERT_EQ(tail->data(), data.data() + 40);
+        ASSERT_EQ(fallbackBuffer.size(), 0u);
+
+        ASSERT_TRUE(stream->readSpan(10)->empty());
+    }
+
+    /**
+        Test:
+            The reader without the span support is copied into the fallback buffer.
+     */
+    TEST(TestStream, ReadSpanFallback)
+    {
+        const auto data = makeTestData(10'000);
+
+        auto reader = rtti::createInstance<ChunkedStreamReader>(data);
+
+        BytesBuffer fallbackBuffer;
+        const auto head = io::readStreamAsSpan(*reader, 100, fallbackBuffer);
+        ASSERT_TRUE(head);
+        ASSERT_EQ(head->size(), 100u);
+        ASSERT_TRUE(memcmp(head->data(), data.data(), 100) == 0);
+
+        const auto tail = io::readStreamAsSpan(*reader, std::numeric_limits<size_t>::max(), fallbackBuffer);
+        ASSERT_TRUE(tail);
+        ASSERT_EQ(tail->size(), data.size() - 100);
+        ASSERT_EQ(tail->data(), fallbackBuffer.data());
+        ASSERT_TRUE(memcmp(tail->data(), data.data() + 100, tail->size()) == 0);
+    }
+
+    /**
+        Test:
+            copyStream writes the memory stream views without the intermediate buffer.
+     */
+    TEST(TestStream, CopyStreamFromMemoryStream)
+    {
+        const auto data = makeTestData(10'000);
+        auto source = io::createReadonlyMemoryStream({data.data(), data.size()});
+        auto target = io::createMemoryStream();
+
+        const auto copied = io::copyStream(target->as<io::IStreamWriter&>(), source->as<io::IStreamReader&>());
+        ASSERT_TRUE(copied);
+        ASSERT_EQ(*copied, data.size());
+
+        const auto targetData = target->getBufferAsSpan();
+        ASSERT_EQ(targetData.size(), data.size());
+        ASSERT_TRUE(memcmp(targetData.data(), data.data(), data.size()) == 0);
+    }
+
+    /**
+        Test:
+            The memory stream completes the scatter read immediately, the read is cut by the end of the stream.
+     */
+    TEST(TestStream, ReadAsyncFromMemoryStream)
+    {
+        const auto data = makeTestData(100);
+        auto stream = io::createReadonlyMemoryStream({data.data(), data.size()});
+
+        eastl::vector<std::byte> head(30);
+        eastl::vector<std::byte> tail(100);
+        const eastl::span<std::byte> buffers[] = {{head.data(), head.size()}, {tail.data(), tail.size()}};
+
+        auto readTask = stream->readAsync(10, buffers);
+        ASSERT_TRUE(readTask.isReady());
+        ASSERT_EQ(*readTask, 90u);
+        ASSERT_TRUE(memcmp(head.data(), data.data() + 10, head.size()) == 0);
+        ASSERT_TRUE(memcmp(tail.data(), data.data() + 40, 60) == 0);
+        ASSERT_EQ(stream->getPosition(), 0u);
+    }
+
+    /**
+        Test:
+            The reader without the async support is read synchronously: the whole stream is gathered into the buffer.
+     */
+    TEST(TestStream, ReadStreamToBufferFallback)
+    {
+        const auto data = makeTestData(1'000);
+        io::IStreamReader::Ptr reader = rtti::createInstance<ChunkedStreamReader>(data);
+
+        auto readResult = async::waitResult(io::readStreamToBufferAsync(reader));
+        ASSERT_TRUE(readResult);
+        ASSERT_EQ(readResult->size(), data.size());
+        ASSERT_TRUE(memcmp(readResult->data(), data.data(), data.size()) == 0);
+    }
+}  // namespace nau::test
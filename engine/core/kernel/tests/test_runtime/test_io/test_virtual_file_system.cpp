@@ -0,0 +1,236 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// test_virtual_file_system.cpp
+
+
+#include <EASTL/unordered_set.h>
+
+#include "nau/io/virtual_file_system.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            Read only file system that knows only the names of its files and counts the lookups.
+            Immutable by default (as a pack), otherwise its content can change behind the VFS back (as a read only native directory).
+         */
+        class TestFileSystem final : public io::IFileSystem
+        {
+            NAU_CLASS_(nau::test::TestFileSystem, io::IFileSystem)
+
+        public:
+            TestFileSystem(eastl::vector<io::FsPath> files, bool isImmutable = true) :
+                m_files(files.begin(), files.end()),
+                m_isImmutable(isImmutable)
+            {
+            }
+
+            bool isReadOnly() const override
+            {
+                return true;
+            }
+
+            bool isImmutable() const override
+            {
+                return m_isImmutable;
+            }
+
+            bool exists(const io::FsPath& path, std::optional<io::FsEntryKind> kind) override
+            {
+                m_lookupsCount.fetch_add(1, std::memory_order_relaxed);
+                return (!kind || *kind == io::FsEntryKind::File) && m_files.count(path) > 0;
+            }
+
+            size_t getLastWriteTime(const io::FsPath&) override
+            {
+                return 0;
+            }
+
+            io::IFile::Ptr openFile(const io::FsPath&, io::AccessModeFlag, io::OpenFileMode) override
+            {
+                m_lookupsCount.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            OpenDirResult openDirIterator(const io::FsPath&) override
+            {
+                return {};
+            }
+
+            void closeDirIterator(void*) override
+            {
+            }
+
+            io::FsEntry incrementDirIterator(void*) override
+            {
+                return {};
+            }
+
+            size_t getLookupsCount() const
+            {
+                return m_lookupsCount.load(std::memory_order_relaxed);
+            }
+
+            void addFile(io::FsPath path)
+            {
+                m_files.insert(std::move(path));
+            }
+
+        private:
+            eastl::unordered_set<io::FsPath> m_files;
+            const bool m_isImmutable;
+            std::atomic<size_t> m_lookupsCount = 0;
+        };
+
+        io::FsPath makeFileName(size_t index)
+        {
+            return io::FsPath{"data"} / std::format("file_{}.bin", index);
+        }
+    }  // namespace
+
+    /**
+        Test:
+            Repeated lookups (found and not found) must be served by the resolved path cache,
+            mount and unmount must invalidate it.
+     */
+    TEST(TestVirtualFileSystem, ResolvedPathCache)
+    {
+        auto vfs = io::createVirtualFileSystem();
+
+        auto contentFs = rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{makeFileName(0)});
+        ASSERT_TRUE(vfs->mount("/content", contentFs));
+
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+        ASSERT_FALSE(vfs->exists("/content/data/file_1.bin"));
+
+        const size_t lookupsCount = contentFs->getLookupsCount();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+            ASSERT_FALSE(vfs->exists("/content/data/file_1.bin"));
+        }
+        ASSERT_EQ(contentFs->getLookupsCount(), lookupsCount);
+
+        auto patchFs = rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{makeFileName(1)});
+        ASSERT_TRUE(vfs->mount("/content", patchFs, 2));
+        ASSERT_TRUE(vfs->exists("/content/data/file_1.bin"));
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+        ASSERT_TRUE(vfs->exists("/content"));
+        ASSERT_TRUE(vfs->exists("/content", io::FsEntryKind::Directory));
+
+        vfs->unmount(patchFs);
+        ASSERT_FALSE(vfs->exists("/content/data/file_1.bin"));
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+
+        ASSERT_FALSE(vfs->exists("/other/data/file_0.bin"));
+        ASSERT_TRUE(vfs->mount("/other", contentFs));
+        ASSERT_TRUE(vfs->exists("/other/data/file_0.bin"));
+    }
+
+    /**
+        Test:
+            The lookups within the mount point with the read only (but not immutable) file system are not cached:
+            the file added behind the VFS back is found, the repeated lookups reach the file system.
+     */
+    TEST(TestVirtualFileSystem, ReadOnlyFileSystemIsNotCached)
+    {
+        auto vfs = io::createVirtualFileSystem();
+
+        auto contentFs = rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{makeFileName(0)}, false);
+        ASSERT_TRUE(vfs->mount("/content", contentFs));
+
+        ASSERT_FALSE(vfs->exists("/content/data/file_1.bin"));
+        contentFs->addFile(makeFileName(1));
+        ASSERT_TRUE(vfs->exists("/content/data/file_1.bin"));
+
+        const size_t lookupsCount = contentFs->getLookupsCount();
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+        ASSERT_EQ(contentFs->getLookupsCount(), lookupsCount + 2);
+
+        // the immutable file system mounted to the same point does not make the lookups cacheable
+        ASSERT_TRUE(vfs->mount("/content", rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{}), 2));
+        ASSERT_FALSE(vfs->exists("/content/data/file_2.bin"));
+        contentFs->addFile(makeFileName(2));
+        ASSERT_TRUE(vfs->exists("/content/data/file_2.bin"));
+    }
+
+    /**
+        Test:
+            The file system with the higher priority is looked up first.
+     */
+    TEST(TestVirtualFileSystem, MountPriority)
+    {
+        auto vfs = io::createVirtualFileSystem();
+
+        auto lowPriorityFs = rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{makeFileName(0)});
+        auto highPriorityFs = rtti::createInstance<TestFileSystem>(eastl::vector<io::FsPath>{makeFileName(0)});
+        ASSERT_TRUE(vfs->mount("/content", lowPriorityFs, 1));
+        ASSERT_TRUE(vfs->mount("/content", highPriorityFs, 2));
+
+        ASSERT_TRUE(vfs->exists("/content/data/file_0.bin"));
+        ASSERT_EQ(highPriorityFs->getLookupsCount(), 1);
+        ASSERT_EQ(lowPriorityFs->getLookupsCount(), 0);
+    }
+
+    /**
+        Lookups of the files spread over 20 file systems mounted to the same point: the first (uncached) pass vs the repeated ones.
+        The timings are reported as the test properties.
+     */
+    TEST(TestVirtualFileSystem, LookupBenchmark)
+    {
+        constexpr size_t MountsCount = 20;
+        constexpr size_t FilesPerMount = 500;
+        constexpr size_t RepeatedPasses = 10;
+
+        auto vfs = io::createVirtualFileSystem();
+
+        for (size_t i = 0; i < MountsCount; ++i)
+        {
+            eastl::vector<io::FsPath> files;
+            for (size_t j = 0; j < FilesPerMount; ++j)
+            {
+                files.push_back(makeFileName(i * FilesPerMount + j));
+            }
+
+            ASSERT_TRUE(vfs->mount("/content", rtti::createInstance<TestFileSystem>(std::move(files)), static_cast<unsigned>(i)));
+        }
+
+        // every 8th path does not exist
+        eastl::vector<io::FsPath> paths;
+        for (size_t i = 0; i < MountsCount * FilesPerMount; ++i)
+        {
+            paths.push_back(io::FsPath{"/content"} / makeFileName(i % 8 == 0 ? MountsCount * FilesPerMount + i : i));
+        }
+
+        auto runPass = [&]
+        {
+            size_t foundCount = 0;
+            for (const auto& path : paths)
+            {
+                foundCount += vfs->exists(path, io::FsEntryKind::File) ? 1 : 0;
+            }
+
+            return foundCount;
+        };
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        const size_t foundCount = runPass();
+        const auto firstPassTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+        ASSERT_EQ(foundCount, paths.size() - paths.size() / 8);
+
+        for (size_t i = 0; i < RepeatedPasses; ++i)
+        {
+            ASSERT_EQ(runPass(), foundCount);
+        }
+        const auto repeatedPassTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start) - firstPassTime;
+
+        RecordProperty("mounts", static_cast<int>(MountsCount));
+        RecordProperty("lookups", static_cast<int>(paths.size()));
+        RecordProperty("first_pass_us", static_cast<int>(firstPassTime.count()));
+        RecordProperty("repeated_pass_us", static_cast<int>(repeatedPassTime.count() / RepeatedPasses));
+    }
+}  // namespace nau::test
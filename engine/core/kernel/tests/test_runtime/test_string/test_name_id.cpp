@@ -0,0 +1,148 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "EASTL/string.h"
+#include "EASTL/unordered_map.h"
+#include "EASTL/vector.h"
+#include "nau/string/name_id.h"
+
+using namespace nau::string_literals;
+
+namespace nau::test
+{
+    TEST(TestNameId, InternSameName)
+    {
+        const NameId name1{"test_name_id.same"};
+        const NameId name2{eastl::string{"test_name_id.same"}};
+        const NameId other{"test_name_id.other"};
+
+        ASSERT_TRUE(name1);
+        ASSERT_EQ(name1, name2);
+        ASSERT_NE(name1, other);
+
+        ASSERT_EQ(name1.getString(), "test_name_id.same");
+        ASSERT_STREQ(name1.c_str(), "test_name_id.same");
+        ASSERT_EQ(name1.getHash(), NameId::constHash("test_name_id.same", 17));
+    }
+
+    TEST(TestNameId, EmptyIsInvalid)
+    {
+        ASSERT_FALSE(NameId{});
+        ASSERT_FALSE(NameId{""});
+        ASSERT_EQ(NameId{}, NameId{""});
+        ASSERT_TRUE(NameId{}.getString().empty());
+        ASSERT_STREQ(NameId{}.c_str(), "");
+    }
+
+    TEST(TestNameId, FindDoesNotIntern)
+    {
+        ASSERT_FALSE(NameId::find("test_name_id.not_interned"));
+
+        const NameId name{"test_name_id.interned"};
+        ASSERT_EQ(NameId::find("test_name_id.interned"), name);
+    }
+
+    TEST(TestNameId, Literals)
+    {
+        constexpr NameLiteral literal = "test_name_id.literal"_name;
+        static_assert(literal.hash == NameId::constHash("test_name_id.literal", 20));
+
+        const NameId name = literal;
+        ASSERT_EQ(name, NameId{"test_name_id.literal"});
+        ASSERT_EQ(NAU_NAME("test_name_id.literal"), name);
+    }
+
+    /**
+        Test:
+            Threads intern the same names (more than the initial table can hold) in different order.
+            All threads must get the same ids.
+     */
+    TEST(TestNameId, ConcurrentIntern)
+    {
+        constexpr size_t ThreadsCount = 4;
+        constexpr size_t NamesCount = 10'000;
+
+        eastl::vector<eastl::string> names;
+        for (size_t i = 0; i < NamesCount; ++i)
+        {
+            names.emplace_back(eastl::string::CtorSprintf{}, "test_name_id.concurrent_%d", static_cast<int>(i));
+        }
+
+        std::vector<eastl::vector<NameId>> ids(ThreadsCount);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < ThreadsCount; ++t)
+        {
+            threads.emplace_back([&names, &result = ids[t], t]
+            {
+                result.resize(names.size());
+                for (size_t i = 0; i < names.size(); ++i)
+                {
+                    const size_t index = (t % 2 == 0) ? i : names.size() - i - 1;
+                    result[index] = NameId{names[index]};
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < NamesCount; ++i)
+        {
+            ASSERT_EQ(ids[0][i].getString(), names[i]);
+            for (size_t t = 1; t < ThreadsCount; ++t)
+            {
+                ASSERT_EQ(ids[t][i], ids[0][i]);
+            }
+        }
+    }
+
+    /**
+        Test:
+            Per frame lookup by the string key (hashing and the key copy on each lookup) vs lookup by the pre-resolved NameId.
+            The timings are reported as the test properties.
+     */
+    TEST(TestNameId, LookupCost)
+    {
+        constexpr size_t KeysCount = 64;
+        constexpr size_t LookupsCount = 200'000;
+
+        eastl::vector<eastl::string> keys;
+        eastl::vector<NameId> ids;
+        eastl::unordered_map<eastl::string, int> stringMap;
+        eastl::unordered_map<NameId, int> idMap;
+        for (size_t i = 0; i < KeysCount; ++i)
+        {
+            keys.emplace_back(eastl::string::CtorSprintf{}, "test_name_id.stream_name_%d", static_cast<int>(i));
+            ids.push_back(NameId{keys.back()});
+            stringMap[keys.back()] = static_cast<int>(i);
+            idMap[ids.back()] = static_cast<int>(i);
+        }
+
+        using Clock = std::chrono::high_resolution_clock;
+
+        int64_t stringSum = 0;
+        const auto stringStart = Clock::now();
+        for (size_t i = 0; i < LookupsCount; ++i)
+        {
+            const eastl::string_view key = keys[i % KeysCount];
+            stringSum += stringMap.find(eastl::string{key})->second;
+        }
+        const auto stringTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - stringStart);
+
+        int64_t idSum = 0;
+        const auto idStart = Clock::now();
+        for (size_t i = 0; i < LookupsCount; ++i)
+        {
+            idSum += idMap.find(ids[i % KeysCount])->second;
+        }
+        const auto idTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - idStart);
+
+        ASSERT_EQ(stringSum, idSum);
+        RecordProperty("lookups", static_cast<int>(LookupsCount));
+        RecordProperty("lookup_by_string_us", static_cast<int>(stringTime.count()));
+        RecordProperty("lookup_by_name_id_us", static_cast<int>(idTime.count()));
+    }
+}  // namespace nau::test
@@ -0,0 +1,91 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <array>
+
+#include "nau/threading/snapshot_buffer.h"
+
+namespace nau::test
+{
+    /**
+        Test:
+            The consumer gets only the latest published snapshot and only once.
+     */
+    TEST(TestSnapshotBuffer, AcquireLatest)
+    {
+        threading::SnapshotBuffer<int> buffer;
+        ASSERT_EQ(buffer.acquire(), nullptr);
+
+        buffer.getWriteSnapshot().value = 1;
+        buffer.publish(1);
+
+        buffer.getWriteSnapshot().value = 2;
+        buffer.publish(2);
+
+        auto* const snapshot = buffer.acquire();
+        ASSERT_TRUE(snapshot);
+        ASSERT_EQ(snapshot->value, 2);
+        ASSERT_EQ(snapshot->frameIndex, 2u);
+        ASSERT_EQ(buffer.getAcquiredFrame(), 2u);
+        ASSERT_EQ(buffer.getPublishedFrame(), 2u);
+
+        ASSERT_EQ(buffer.acquire(), nullptr);
+
+        // the acquired snapshot is not touched by the producer
+        buffer.getWriteSnapshot().value = 3;
+        buffer.publish(3);
+        buffer.getWriteSnapshot().value = 4;
+        buffer.publish(4);
+        ASSERT_EQ(snapshot->value, 2);
+
+        ASSERT_EQ(buffer.acquire()->value, 4);
+    }
+
+    /**
+        Test:
+            The producer and the consumer work concurrently: every acquired snapshot is consistent (written completely)
+            and the acquired frames only increase.
+     */
+    TEST(TestSnapshotBuffer, ConcurrentProducerAndConsumer)
+    {
+        constexpr uint64_t FramesCount = 100'000;
+        constexpr size_t ValuesCount = 16;
+
+        threading::SnapshotBuffer<std::array<uint64_t, ValuesCount>> buffer;
+
+        std::thread producer([&buffer]
+        {
+            for (uint64_t frame = 1; frame <= FramesCount; ++frame)
+            {
+                auto& snapshot = buffer.getWriteSnapshot();
+                snapshot.value.fill(frame);
+                buffer.publish(frame);
+            }
+        });
+
+        uint64_t lastFrame = 0;
+        size_t acquiredCount = 0;
+        while (lastFrame < FramesCount)
+        {
+            auto* const snapshot = buffer.acquire();
+            if (!snapshot)
+            {
+                continue;
+            }
+
+            ++acquiredCount;
+            ASSERT_GT(snapshot->frameIndex, lastFrame);
+            for (const uint64_t value : snapshot->value)
+            {
+                ASSERT_EQ(value, snapshot->frameIndex);
+            }
+
+            lastFrame = snapshot->frameIndex;
+        }
+
+        producer.join();
+
+        ASSERT_GT(acquiredCount, 0u);
+        ASSERT_EQ(buffer.getAcquiredFrame(), FramesCount);
+    }
+}  // namespace nau::test
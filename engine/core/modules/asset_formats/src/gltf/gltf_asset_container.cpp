@@ -16,6 +16,7 @@
 #include "nau/animation/controller/animation_controller_blend.h"
 #include "nau/animation/assets/animation_asset.h"
 #include "nau/assets/asset_descriptor_factory.h"
+#include "nau/io/memory_stream.h"
 #include "nau/scene/components/camera_component.h"
 #include "nau/scene/components/static_mesh_component.h"
 #include "nau/scene/components/skinned_mesh_component.h"
@@ -171,9 +172,12 @@ namespace nau
         NAU_ASSERT(stream);
         ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault())
 
+        // the pool thread is released while the content is read, only the parsing occupies it
+        io::IStreamReader::Ptr contentStream = co_await io::readStreamToMemoryAsync(std::move(stream));
+
         GltfFile gltfFile;
 
-        co_await GltfFile::loadFromJsonStream(stream, gltfFile);
+        co_await GltfFile::loadFromJsonStream(contentStream, gltfFile);
         co_return rtti::createInstance<GltfAssetContainer>(std::move(gltfFile), info.path);
     }
 
@@ -8,6 +8,23 @@ namespace nau
 {
     namespace
     {
+        /**
+            Converts the elements of the (not necessarily aligned) stream data.
+         */
+        template <typename SourceType, typename TargetType>
+        void convertElements(eastl::span<const std::byte> source, TargetType* target, size_t elementCount)
+        {
+            NAU_ASSERT(source.size() >= elementCount * sizeof(SourceType));
+            elementCount = std::min(elementCount, source.size() / sizeof(SourceType));
+
+            for (size_t i = 0; i < elementCount; ++i)
+            {
+                SourceType value;
+                memcpy(&value, source.data() + i * sizeof(SourceType), sizeof(SourceType));
+                target[i] = static_cast<TargetType>(value);
+            }
+        }
+
         inline nau::ElementFormat gltf2ElementFormat(unsigned gltfDataType)
         {
             // constexpr unsigned Signed8 = 5120;
@@ -223,31 +240,19 @@ namespace nau
                 const size_t elementCount = binAccessor->size / formatByteSize(binAccessor->attrib->elementFormat);
                 NAU_ASSERT(outputDesc.outputBufferSize == elementCount * 4);
 
+                BytesBuffer fallbackBuffer;
+                const auto data = io::readStreamAsSpan(*reader, binAccessor->size, fallbackBuffer);
+                NauCheckResult(data);
+
                 if (binAccessor->attrib->elementFormat == ElementFormat::Uint8)
                 {
-                    std::vector<uint8_t> tmpU8;
-                    tmpU8.resize(elementCount);
-
-                    io::copyFromStream(tmpU8.data(), binAccessor->size, *reader).ignore();
-
-                    for (size_t i = 0; i < elementCount; ++i)
-                    {
-                        buf[i] = static_cast<uint32_t>(tmpU8[i]);
-                    }
+                    convertElements<uint8_t>(*data, buf, elementCount);
                 }
                 else if (binAccessor->attrib->elementFormat == ElementFormat::Uint16)
                 {
                     NAU_ASSERT(outputDesc.outputBufferSize == binAccessor->size * 2);
 
-                    std::vector<uint16_t> tmpU16;
-                    tmpU16.resize(elementCount);
-
-                    io::copyFromStream(tmpU16.data(), binAccessor->size, *reader).ignore();
-
-                    for (size_t i = 0; i < elementCount; ++i)
-                    {
-                        buf[i] = static_cast<uint32_t>(tmpU16[i]);
-                    }
+                    convertElements<uint16_t>(*data, buf, elementCount);
                 }
             }
         }
@@ -280,16 +285,14 @@ namespace nau
         }
         else if (m_meshDescription.indexFormat == ElementFormat::Uint32)
         {
-            std::vector<uint32_t> tmpU32;
-            tmpU32.resize(binaryAccessor.size);
+            const size_t elementCount = binaryAccessor.size / sizeof(uint32_t);
+            NAU_ASSERT(outputBufferSize >= elementCount * sizeof(uint16_t));
 
-            io::copyFromStream(tmpU32.data(), binaryAccessor.size, *reader).ignore();
+            BytesBuffer fallbackBuffer;
+            const auto data = io::readStreamAsSpan(*reader, binaryAccessor.size, fallbackBuffer);
+            NauCheckResult(data);
 
-            uint16_t* buf = reinterpret_cast<uint16_t*>(outputBuffer);
-            for (size_t i = 0; i < tmpU32.size(); ++i)
-            {
-                buf[i] = static_cast<uint16_t>(tmpU32[i]);
-            }
+            convertElements<uint32_t>(*data, reinterpret_cast<uint16_t*>(outputBuffer), std::min(elementCount, outputBufferSize / sizeof(uint16_t)));
         }
         else
         {
@@ -4,6 +4,7 @@
 
 #include "texture_asset_container.h"
 
+#include "nau/io/memory_stream.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
 
@@ -52,12 +53,15 @@ namespace nau
         NAU_ASSERT(stream);
         ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault())
 
+        // the pool thread is released while the content is read, only the decoding occupies it
+        io::IStreamReader::Ptr contentStream = co_await io::readStreamToMemoryAsync(std::move(stream));
+
         TinyImageFormat forceFormat = TinyImageFormat_UNDEFINED;
         if (info.kind == "hdr")
         {
             forceFormat = TinyImageFormat_R32G32B32A32_SFLOAT;
         }
-        auto textureData = TextureSourceData::loadFromStream(stream, info.importSettings ? info.importSettings->as<RuntimeReadonlyDictionary *>() : getDefaultImportSettings(), forceFormat);
+        auto textureData = TextureSourceData::loadFromStream(contentStream, info.importSettings ? info.importSettings->as<RuntimeReadonlyDictionary *>() : getDefaultImportSettings(), forceFormat);
         if(!textureData)
         {
             co_return textureData.getError();
@@ -4,6 +4,11 @@
 
 #include "texture_compressor.h"
 
+#include <EASTL/vector.h>
+
+#include <algorithm>
+#include <thread>
+
 // TODO: replace malloc/realloc/free with our allocator
 #define STBI_MALLOC(sz) malloc(sz)
 #define STBI_REALLOC(p, newsz) realloc(p, newsz)
@@ -11,6 +16,7 @@
 
 // ISPC texcomp
 #include "ispc_texcomp.h"
+#include "nau/async/executor.h"
 #include "nau/diag/assertion.h"
 
 namespace nau
@@ -91,9 +97,76 @@ namespace nau
 
             return outFormat;
         }
+
+        /**
+            Minimal count of 4x4 block rows that is worth to be compressed by the separate job.
+         */
+        constexpr unsigned MinBlockRowsPerBand = 8;
+
+        unsigned getBandsCount(unsigned blockRows, bool parallel)
+        {
+            if (!parallel || !async::Executor::getDefault())
+            {
+                return 1;
+            }
+
+            const unsigned maxBands = std::max(1u, std::thread::hardware_concurrency());
+            return std::clamp(blockRows / MinBlockRowsPerBand, 1u, maxBands);
+        }
+
+        /**
+            Waiting for the compression jobs is only allowed outside of the default executor's threads,
+            otherwise all pool workers can be blocked waiting for the jobs queued behind them.
+         */
+        bool canWaitForCompressionJobs()
+        {
+            auto defaultExecutor = async::Executor::getDefault();
+            return defaultExecutor && async::Executor::getInvoked().get() != defaultExecutor.get();
+        }
+
+        /**
+            ISPC writes the output blocks row by row with (width / 4) blocks per row,
+            so the surface can be split into independent bands of whole block rows.
+         */
+        template <typename CompressFunc>
+        async::Task<> compressBlockRows(rgba_surface surface, uint8_t* dst, uint32_t bytesPerBlock, bool parallel, CompressFunc compressFunc)
+        {
+            const unsigned blockRows = std::max(1u, (static_cast<unsigned>(surface.height) + 3u) / 4u);
+            const unsigned bandsCount = getBandsCount(blockRows, parallel);
+            if (bandsCount == 1)
+            {
+                compressFunc(&surface, dst);
+                co_return;
+            }
+
+            const size_t dstBlockRowPitch = static_cast<size_t>(surface.width / 4) * bytesPerBlock;
+            const unsigned blockRowsPerBand = (blockRows + bandsCount - 1) / bandsCount;
+
+            eastl::vector<async::Task<>> bandTasks;
+            bandTasks.reserve(bandsCount);
+
+            for (unsigned firstBlockRow = 0; firstBlockRow < blockRows; firstBlockRow += blockRowsPerBand)
+            {
+                const unsigned bandBlockRows = std::min(blockRowsPerBand, blockRows - firstBlockRow);
+                const int firstPixelRow = static_cast<int>(firstBlockRow * 4u);
+
+                rgba_surface band = surface;
+                band.ptr = surface.ptr + static_cast<size_t>(firstPixelRow) * surface.stride;
+                band.height = std::min(static_cast<int>(bandBlockRows * 4u), surface.height - firstPixelRow);
+
+                uint8_t* const bandDst = dst + firstBlockRow * dstBlockRowPitch;
+
+                bandTasks.emplace_back(async::run([band, bandDst, compressFunc]
+                {
+                    compressFunc(&band, bandDst);
+                }, async::Executor::getDefault()));
+            }
+
+            co_await async::whenAll(bandTasks);
+        }
     }  // namespace
 
-    unsigned char* ASTCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height)
+    async::Task<unsigned char*> ASTCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height, bool parallel)
     {
         NAU_ASSERT(data);
         NAU_ASSERT(width && height);  // widht/height cannot be 0
@@ -106,7 +179,7 @@ namespace nau
         if (TinyImageFormat_BitSizeOfBlock(format) != 32)
         {
             NAU_ASSERT("Fast ISPC Texture Compressor only supports 32bits per pixel for ASTC");
-            return nullptr;
+            co_return nullptr;
         }
 
         // Get astc encoder settings
@@ -126,10 +199,16 @@ namespace nau
         input.stride = width * channels;
         input.ptr = data;
         unsigned char* result = (unsigned char*)STBI_MALLOC(width * height * channels);
-        CompressBlocksASTC(&input, result, &astcEncSettings);
-
         NAU_ASSERT(result);
-        return result;
+
+        constexpr uint32_t AstcBytesPerBlock = 16;
+        co_await compressBlockRows(input, result, AstcBytesPerBlock, parallel, [astcEncSettings](const rgba_surface* src, uint8_t* dst)
+        {
+            astc_enc_settings settings = astcEncSettings;
+            CompressBlocksASTC(src, dst, &settings);
+        });
+
+        co_return result;
     }
 
     typedef void (*BCCompressionFunc)(const rgba_surface* src, uint8_t* dst);
@@ -167,7 +246,7 @@ namespace nau
     DECLARE_COMPRESS_FUNCTION_BC7(alpha_basic);
     DECLARE_COMPRESS_FUNCTION_BC7(alpha_slow);
 
-    unsigned char* BCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height)
+    async::Task<unsigned char*> BCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height, bool parallel)
     {
         NAU_ASSERT(data);
         NAU_ASSERT(width && height);  // width/height cannot be 0
@@ -209,7 +288,7 @@ namespace nau
                 if (bitsPerPixel != 64 || !TinyImageFormat_IsFloat(format))
                 {
                     NAU_ASSERT("Unsupported format for BC6 compression");
-                    return nullptr;
+                    co_return nullptr;
                 }
                 break;
             case DXT_BC7:
@@ -237,8 +316,8 @@ namespace nau
         };
         NAU_FATAL(resultStorage);
 
-        bcCompress(&input, resultStorage);
-        return resultStorage;
+        co_await compressBlockRows(input, resultStorage, bytesPerBlock, parallel, bcCompress);
+        co_return resultStorage;
     }
 
     TextureCompressor::TextureCompressor(TinyImageFormat format, CompressionType compressionType) :
@@ -253,9 +332,9 @@ namespace nau
         switch (m_compressionType)
         {
             case COMPRESSION_ASTC:
-                return ASTCCompression(data, m_sourceFormat, width, height);
+                return *async::waitResult(compressAsync(data, width, height));
             case COMPRESSION_BC:
-                return BCCompression(data, m_sourceFormat, width, height);
+                return *async::waitResult(compressAsync(data, width, height));
             default:
                 NAU_ASSERT("Unknown compression type");
                 return nullptr;
@@ -264,6 +343,21 @@ namespace nau
         return nullptr;
     }
 
+    async::Task<unsigned char*> TextureCompressor::compressAsync(unsigned char* data, unsigned width, unsigned height)
+    {
+        NAU_ASSERT(data);
+        switch (m_compressionType)
+        {
+            case COMPRESSION_ASTC:
+                return ASTCCompression(data, m_sourceFormat, width, height, canWaitForCompressionJobs());
+            case COMPRESSION_BC:
+                return BCCompression(data, m_sourceFormat, width, height, canWaitForCompressionJobs());
+            default:
+                NAU_ASSERT("Unknown compression type");
+                return async::Task<unsigned char*>::makeResolved(nullptr);
+        }
+    }
+
     TinyImageFormat TextureCompressor::getOutputTextureFormat(TinyImageFormat format, nau::TextureCompressor::CompressionType compressionType)
     {
         TinyImageFormat outFormat = TinyImageFormat_UNDEFINED;
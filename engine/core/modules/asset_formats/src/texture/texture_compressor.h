@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "nau/async/task.h"
 #include "tinyimageformat.h"
 
 namespace nau
@@ -24,6 +25,14 @@ namespace nau
             ~TextureCompressor() = default;
             unsigned char* compress(unsigned char* data, unsigned width, unsigned height);
 
+            /**
+                Compresses the image on the default executor: the surface is split into bands of 4x4 block rows
+                and each band is compressed by a separate job.
+                When called from the default executor's thread the image is compressed inline (the task is already completed on return).
+                Source data must stay alive until the returned task is completed.
+            */
+            async::Task<unsigned char*> compressAsync(unsigned char* data, unsigned width, unsigned height);
+
             static TinyImageFormat getOutputTextureFormat(TinyImageFormat format, CompressionType compressionType = CompressionType::COMPRESSION_BC);
 
         private:
@@ -278,64 +278,95 @@ namespace nau
             unsigned width;
             unsigned height;
             unsigned char* data;
+            async::Task<unsigned char*> compressTask;
         };
 
         NAU_ASSERT(mipLevelsCount >= 0);
         NAU_ASSERT(mipLevelsCount <= m_numMipmaps);
 
-        std::optional<Mip> prevMip;
-
+        const bool isCompressed = m_compressedFormat != TinyImageFormat_UNDEFINED;
         const uint32_t channels = TinyImageFormat_ChannelCount(getFormat());
+        TextureCompressor compressor{m_format};
+
+        // Mips are generated one by one (each level is downscaled from the previous one),
+        // while compression of the already generated levels is running on the worker threads.
+        eastl::vector<Mip> mips;
+        mips.reserve(mipLevelsCount);
+
+        // The level is released as soon as it is copied into the destination and the next level is generated from it,
+        // so only the levels that are still being compressed are kept in memory.
+        const auto releaseMip = [this, &destination](Mip& mip, size_t index)
+        {
+            if(mip.compressTask)
+            {
+                unsigned char* const compressedData = *async::waitResult(std::move(mip.compressTask));
+                NAU_ASSERT(compressedData);
+                TextureUtils::copyImageData(destination[index], mip.width, mip.height, getFormat(), reinterpret_cast<std::byte*>(compressedData));
+                STBI_FREE(compressedData);
+            }
+
+            // NOTE: do not delete original (mip0) data
+            if(mip.data != m_data)
+            {
+                STBI_FREE(mip.data);
+            }
+
+            mip.data = nullptr;
+        };
+
+        Mip prevMip{m_width, m_height, reinterpret_cast<unsigned char*>(m_data)};
+
         for(uint32_t i = 0; i < mipLevelsCount; ++i)
         {
             const auto mipLevelIndex = mipLevelStart + i;
 
-            Mip mip;
+            Mip& mip = mips.emplace_back();
 
             if(mipLevelIndex == 0)
             {
-                NAU_ASSERT(!prevMip);
                 mip.width = m_width;
                 mip.height = m_height;
                 mip.data = reinterpret_cast<unsigned char*>(m_data);
             }
             else
             {
-                if(!prevMip)
-                {
-                    prevMip = Mip{m_width, m_height, reinterpret_cast<unsigned char*>(m_data)};
-                }
-
                 std::tie(mip.width, mip.height) = TextureUtils::getMipSize(getWidth(), getHeight(), mipLevelIndex);
                 mip.data = reinterpret_cast<unsigned char*>(STBI_MALLOC(mip.width * mip.height * channels));
 
                 [[maybe_unused]] unsigned char* const mipTexureData = stbir_resize_uint8_linear(
-                    prevMip->data, static_cast<int>(prevMip->width), static_cast<int>(prevMip->height), static_cast<int>(channels * prevMip->width),
+                    prevMip.data, static_cast<int>(prevMip.width), static_cast<int>(prevMip.height), static_cast<int>(channels * prevMip.width),
                     mip.data, static_cast<int>(mip.width), static_cast<int>(mip.height), static_cast<int>(channels * mip.width), stbir_pixel_layout(channels));
 
                 NAU_ASSERT(mipTexureData == mip.data);
             }
 
-            if(m_compressedFormat != TinyImageFormat_UNDEFINED)
+            if(isCompressed)
             {
-                TextureCompressor compressor{m_format};
-                unsigned char* compressed_data = compressor.compress(mip.data, mip.width, mip.height);
-                NAU_ASSERT(compressed_data);
-                TextureUtils::copyImageData(destination[i], mip.width, mip.height, getFormat(), reinterpret_cast<std::byte*>(compressed_data));
-                STBI_FREE(compressed_data);
+                mip.compressTask = compressor.compressAsync(mip.data, mip.width, mip.height);
             }
             else
             {
                 TextureUtils::copyImageData(destination[i], mip.width, mip.height, getFormat(), reinterpret_cast<std::byte*>(mip.data));
             }
 
-            // NOTE: do not delete original (mip0) data
-            if(prevMip && (prevMip->width != m_width && prevMip->height != m_height))
+            prevMip = Mip{mip.width, mip.height, mip.data};
+
+            // the previous levels are not needed for the downscaling any more: release the ones that are already compressed
+            for(uint32_t j = 0; j < i; ++j)
             {
-                STBI_FREE(prevMip->data);
+                if(mips[j].data && (!mips[j].compressTask || mips[j].compressTask.isReady()))
+                {
+                    releaseMip(mips[j], j);
+                }
             }
+        }
 
-            prevMip = mip;
+        for(uint32_t i = 0; i < mips.size(); ++i)
+        {
+            if(mips[i].data)
+            {
+                releaseMip(mips[i], i);
+            }
         }
     }
 
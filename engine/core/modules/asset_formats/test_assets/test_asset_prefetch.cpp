@@ -0,0 +1,292 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "helpers/my_asset_view.h"
+#include "nau/assets/asset_container.h"
+#include "nau/assets/asset_content_provider.h"
+#include "nau/assets/asset_manager.h"
+#include "nau/assets/asset_prefetcher.h"
+#include "nau/io/special_paths.h"
+#include "nau/test/helpers/app_guard.h"
+#include "nau/utils/scope_guard.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+         */
+        class PrefetchTestContainer final : public IAssetContainer
+        {
+            NAU_CLASS_(nau::test::PrefetchTestContainer, IAssetContainer)
+
+            nau::Ptr<> getAsset(eastl::string_view path) override
+            {
+                return rtti::createInstance<MyAssetView>(eastl::string(path));
+            }
+
+            eastl::vector<eastl::string> getContent() const override
+            {
+                return {};
+            }
+        };
+
+        /**
+            Provides containers for the 't_prefetch' scheme.
+            The container 'root_<name>' requests the container 'dep_<name>' while it is loading.
+         */
+        class PrefetchTestContentProvider : public IAssetContentProvider
+        {
+            NAU_TYPEID(nau::test::PrefetchTestContentProvider)
+            NAU_CLASS_BASE(IAssetContentProvider)
+
+            static constexpr eastl::string_view Scheme{"t_prefetch"};
+            static constexpr eastl::string_view RootPrefix{"root_"};
+
+            Result<AssetContent> openStreamOrContainer(const AssetPath& assetPath) override
+            {
+                const eastl::string_view containerPath = assetPath.getContainerPath();
+                if (containerPath.starts_with(RootPrefix))
+                {
+                    const eastl::string dependencyPath = eastl::string{"t_prefetch:dep_"} + eastl::string{containerPath.substr(RootPrefix.size())};
+                    IAssetDescriptor::Ptr dependency = getServiceProvider().get<IAssetManager>().openAsset(AssetPath{dependencyPath});
+                    NAU_FATAL(dependency);
+                    dependency->getRawAsset().detach();
+                }
+
+                return AssetContent{rtti::createInstance<PrefetchTestContainer>(), AssetContentInfo{.kind = "test"}};
+            }
+
+            eastl::vector<eastl::string_view> getSupportedSchemes() const override
+            {
+                return {Scheme};
+            }
+        };
+    }  // namespace
+
+    /**
+     */
+    class TestAssetPrefetch : public testing::Test
+    {
+        void SetUp() final
+        {
+            m_app.start();
+        }
+
+        void TearDown() final
+        {
+            m_app.stop();
+        }
+
+    protected:
+        /**
+         */
+        class MyTestApp final : public AppGuard
+        {
+            void setupTestServices() override
+            {
+                registerServices<PrefetchTestContentProvider>();
+            }
+        };
+
+        static IAssetManager& getAssetManager()
+        {
+            return getServiceProvider().get<IAssetManager>();
+        }
+
+        static IAssetPrefetcher& getPrefetcher()
+        {
+            return getServiceProvider().get<IAssetPrefetcher>();
+        }
+
+        /**
+            Requests the container on behalf of the recording.
+         */
+        static void loadAsset(eastl::string_view path, AssetDependencyRecordingId recordingId)
+        {
+            IAssetDescriptor::Ptr asset = getAssetManager().openAsset(AssetPath{path});
+            ASSERT_TRUE(asset);
+
+            async::Task<nau::Ptr<>> loadTask;
+            {
+                AssetDependencyRecordingScope recordingScope{getPrefetcher(), recordingId};
+                loadTask = asset->getRawAsset();
+            }
+
+            ASSERT_TRUE(async::wait(loadTask));
+        }
+
+        static eastl::vector<eastl::string> endRecording(AssetDependencyRecordingId recordingId)
+        {
+            Result<AssetPrefetchManifest> manifest = async::waitResult(getPrefetcher().endDependencyRecording(recordingId));
+            NAU_FATAL(manifest);
+
+            eastl::vector<eastl::string> dependencies = std::move(manifest->dependencies);
+            eastl::sort(dependencies.begin(), dependencies.end());
+            return dependencies;
+        }
+
+        MyTestApp m_app;
+    };
+
+    /**
+        Test: the loads are attributed to the root they are requested by, the loads requested by anyone else are not recorded.
+     */
+    TEST_F(TestAssetPrefetch, RecordingAttributesLoadsToRequestingRoot)
+    {
+        const AssetDependencyRecordingId recordingA = getPrefetcher().beginDependencyRecording(AssetPath{"t_prefetch:scene_a"});
+        const AssetDependencyRecordingId recordingB = getPrefetcher().beginDependencyRecording(AssetPath{"t_prefetch:scene_b"});
+        ASSERT_NE(recordingA, recordingB);
+
+        loadAsset("t_prefetch:root_a", recordingA);
+        loadAsset("t_prefetch:root_b", recordingB);
+        loadAsset("t_prefetch:root_c", AssetDependencyRecordingId::None);
+
+        const eastl::vector<eastl::string> expectedA = {"t_prefetch:dep_a", "t_prefetch:root_a"};
+        const eastl::vector<eastl::string> expectedB = {"t_prefetch:dep_b", "t_prefetch:root_b"};
+
+        ASSERT_EQ(endRecording(recordingA), expectedA);
+        ASSERT_EQ(endRecording(recordingB), expectedB);
+        ASSERT_TRUE(getPrefetcher().findPrefetchManifest(AssetPath{"t_prefetch:scene_a"}));
+    }
+
+    /**
+        Test: the same root can be recorded several times at once.
+        The second recording requests the container that is already loaded: its dependencies are still recorded.
+     */
+    TEST_F(TestAssetPrefetch, RepeatedRecordingOfSameRoot)
+    {
+        const AssetPath scenePath{"t_prefetch:scene_a"};
+        const AssetDependencyRecordingId recording1 = getPrefetcher().beginDependencyRecording(scenePath);
+        const AssetDependencyRecordingId recording2 = getPrefetcher().beginDependencyRecording(scenePath);
+
+        loadAsset("t_prefetch:root_a", recording1);
+        loadAsset("t_prefetch:root_a", recording2);
+
+        const eastl::vector<eastl::string> expected = {"t_prefetch:dep_a", "t_prefetch:root_a"};
+        ASSERT_EQ(endRecording(recording2), expected);
+        ASSERT_EQ(endRecording(recording1), expected);
+    }
+
+    /**
+        Test: the recording scope spans co_await, the loads requested after the coroutine is resumed on the other thread are attributed to the recording.
+     */
+    TEST_F(TestAssetPrefetch, RecordingKeptAcrossAwait)
+    {
+        const AssetDependencyRecordingId recordingId = getPrefetcher().beginDependencyRecording(AssetPath{"t_prefetch:scene_a"});
+
+        async::Task<> loadTask = [](AssetDependencyRecordingId recordingId) -> async::Task<>
+        {
+            AssetDependencyRecordingScope recordingScope{getPrefetcher(), recordingId};
+            co_await async::Executor::getDefault();
+
+            IAssetDescriptor::Ptr asset = getAssetManager().openAsset(AssetPath{"t_prefetch:root_a"});
+            co_await asset->getRawAsset();
+        }(recordingId);
+
+        ASSERT_TRUE(async::wait(loadTask));
+        loadAsset("t_prefetch:root_c", AssetDependencyRecordingId::None);
+
+        const eastl::vector<eastl::string> expected = {"t_prefetch:dep_a", "t_prefetch:root_a"};
+        ASSERT_EQ(endRecording(recordingId), expected);
+    }
+
+    /**
+        Test: prefetchDependencies loads all containers listed in the manifest (bounded by the concurrent loads limit),
+        and does nothing for the root without the manifest.
+     */
+    TEST_F(TestAssetPrefetch, PrefetchDependencies)
+    {
+        const AssetPath scenePath{"t_prefetch:scene_a"};
+        const eastl::vector<eastl::string> dependencies = {"t_prefetch:item_1", "t_prefetch:item_2", "t_prefetch:item_3", "t_prefetch:root_a"};
+
+        AssetPrefetchManifest manifest;
+        manifest.dependencies = dependencies;
+        getPrefetcher().setPrefetchManifest(scenePath, std::move(manifest));
+        getPrefetcher().setMaxConcurrentLoads(2);
+
+        async::Task<> prefetchTask = getPrefetcher().prefetchDependencies(scenePath);
+        ASSERT_TRUE(async::wait(prefetchTask));
+        ASSERT_FALSE(prefetchTask.isRejected());
+
+        for (const eastl::string& dependencyPath : dependencies)
+        {
+            IAssetDescriptor::Ptr asset = getAssetManager().findAsset(AssetPath{dependencyPath});
+            ASSERT_TRUE(asset);
+            ASSERT_EQ(asset->getLoadState(), IAssetDescriptor::LoadState::Ready);
+        }
+
+        ASSERT_TRUE(getPrefetcher().prefetchDependencies(AssetPath{"t_prefetch:scene_b"}).isReady());
+    }
+
+    /**
+        Test: the recorded manifests are saved to the manifests file and loaded back from it.
+     */
+    TEST_F(TestAssetPrefetch, PersistManifests)
+    {
+        const std::filesystem::path tempDir = io::getKnownFolderPath(io::KnownFolder::Temp) / "nau_test_asset_prefetch";
+        const std::filesystem::path manifestsPath = tempDir / "prefetch_manifests.json";
+        std::filesystem::remove_all(tempDir);
+        scope_on_leave
+        {
+            std::filesystem::remove_all(tempDir);
+        };
+
+        ASSERT_TRUE(getPrefetcher().addPrefetchManifestsStorage({}, manifestsPath));
+
+        const AssetPath scenePath{"t_prefetch:scene_a"};
+        const AssetDependencyRecordingId recordingId = getPrefetcher().beginDependencyRecording(scenePath);
+        loadAsset("t_prefetch:root_a", recordingId);
+        const eastl::vector<eastl::string> recordedDependencies = endRecording(recordingId);
+        ASSERT_TRUE(std::filesystem::exists(manifestsPath));
+
+        getPrefetcher().setPrefetchManifest(scenePath, {});
+        ASSERT_TRUE(getPrefetcher().addPrefetchManifestsStorage({}, manifestsPath));
+
+        eastl::optional<AssetPrefetchManifest> manifest = getPrefetcher().findPrefetchManifest(scenePath);
+        ASSERT_TRUE(manifest);
+        ASSERT_EQ(manifest->dependencies, recordedDependencies);
+    }
+
+    /**
+        Test: the manifest is saved only to the storage its root is located under,
+        the manifest that is out of date is replaced by the next recording and saved again.
+     */
+    TEST_F(TestAssetPrefetch, RefreshManifestInItsStorage)
+    {
+        const std::filesystem::path tempDir = io::getKnownFolderPath(io::KnownFolder::Temp) / "nau_test_asset_prefetch_storages";
+        const std::filesystem::path otherManifestsPath = tempDir / "other_db.json";
+        const std::filesystem::path manifestsPath = tempDir / "prefetch_manifests.json";
+        std::filesystem::remove_all(tempDir);
+        scope_on_leave
+        {
+            std::filesystem::remove_all(tempDir);
+        };
+
+        ASSERT_TRUE(getPrefetcher().addPrefetchManifestsStorage("/other_db", otherManifestsPath));
+        ASSERT_TRUE(getPrefetcher().addPrefetchManifestsStorage({}, manifestsPath));
+
+        const AssetPath scenePath{"t_prefetch:scene_a"};
+        AssetDependencyRecordingId recordingId = getPrefetcher().beginDependencyRecording(scenePath);
+        loadAsset("t_prefetch:root_a", recordingId);
+        endRecording(recordingId);
+
+        ASSERT_TRUE(std::filesystem::exists(manifestsPath));
+        ASSERT_FALSE(std::filesystem::exists(otherManifestsPath));
+
+        // the scene content is changed: it requests the other containers
+        recordingId = getPrefetcher().beginDependencyRecording(scenePath);
+        loadAsset("t_prefetch:root_b", recordingId);
+        const eastl::vector<eastl::string> refreshedDependencies = endRecording(recordingId);
+
+        const eastl::vector<eastl::string> expected = {"t_prefetch:dep_b", "t_prefetch:root_b"};
+        ASSERT_EQ(refreshedDependencies, expected);
+
+        getPrefetcher().setPrefetchManifest(scenePath, {});
+        ASSERT_TRUE(getPrefetcher().addPrefetchManifestsStorage({}, manifestsPath));
+
+        eastl::optional<AssetPrefetchManifest> manifest = getPrefetcher().findPrefetchManifest(scenePath);
+        ASSERT_TRUE(manifest);
+        ASSERT_EQ(manifest->dependencies, expected);
+    }
+}  // namespace nau::test
@@ -0,0 +1,130 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/vector.h>
+
+#include <filesystem>
+
+#include "nau/assets/asset_path.h"
+#include "nau/async/async_context.h"
+#include "nau/async/task_base.h"
+#include "nau/io/fs_path.h"
+#include "nau/meta/class_info.h"
+#include "nau/rtti/type_info.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+        @brief List of the asset containers that are (transitively) required by the root asset (i.e. scene).
+     */
+    struct AssetPrefetchManifest
+    {
+        eastl::vector<eastl::string> dependencies;
+
+#pragma region Class Info
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(dependencies))
+#pragma endregion
+    };
+
+    /**
+        @brief Identifies the single dependency recording (see IAssetPrefetcher::beginDependencyRecording).
+     */
+    enum class AssetDependencyRecordingId : uint64_t
+    {
+        None = 0
+    };
+
+    /**
+        @brief API to start all container loads of the asset up front instead of discovering them one by one.
+
+        Manifest can be recorded at runtime: the container loads that are requested on behalf of the recording (see AssetDependencyRecordingScope)
+        are attributed to its root asset. The attribution is carried by the async context (see async::AsyncContext) through the whole task chain:
+        the loads requested after co_await and the containers requested while the recorded container is loading are attributed to the same recording.
+        Loads requested by anyone else (i.e. by the other scene that is loading at the same time) are not recorded.
+        The next time prefetchDependencies starts all of them in parallel (bounded by the concurrent loads limit).
+
+        Each asset database keeps its own manifests (see addPrefetchManifestsStorage). The root can be recorded again while its manifest is prefetched:
+        the manifest that is out of date is replaced and saved.
+     */
+    struct NAU_ABSTRACT_TYPE IAssetPrefetcher
+    {
+        NAU_TYPEID(nau::IAssetPrefetcher)
+
+        virtual ~IAssetPrefetcher() = default;
+
+        /**
+            @brief Starts recording of the container loads on behalf of the root asset.
+            The same root can be recorded several times at once (i.e. the scene is opened twice): the recordings are independent.
+         */
+        virtual AssetDependencyRecordingId beginDependencyRecording(const AssetPath& rootAssetPath) = 0;
+
+        /**
+            @brief Stops recording once all recorded loads (and the loads started by them) are completed.
+            The result replaces the root asset's manifest and is returned. When the manifest is changed it is saved to the root's manifests storage (if any).
+         */
+        virtual async::Task<AssetPrefetchManifest> endDependencyRecording(AssetDependencyRecordingId recordingId) = 0;
+
+        /**
+            @brief Creates the async context that attributes the container loads to the recording (None stops the attribution).
+            Prefer AssetDependencyRecordingScope.
+         */
+        virtual async::AsyncContext::Ptr createDependencyRecordingContext(AssetDependencyRecordingId recordingId) = 0;
+
+        /**
+            @brief Sets manifest explicitly (i.e. manifest that is stored with the game content).
+         */
+        virtual void setPrefetchManifest(const AssetPath& rootAssetPath, AssetPrefetchManifest manifest) = 0;
+
+        virtual eastl::optional<AssetPrefetchManifest> findPrefetchManifest(const AssetPath& rootAssetPath) = 0;
+
+        /**
+            @brief Adds the storage of the manifests of the root assets that are located under the contentRoot (i.e. the asset database directory).
+            The storage with the empty contentRoot keeps the manifests of the roots that are not located under the other storages.
+
+            The manifests are loaded from the manifestsPath, or if it does not exist yet, from the initialManifestsPath
+            (the manifests that are shipped with the content: the virtual file system path, it can be inside the read-only pack).
+            The manifests of the storage's roots that are recorded after the call are saved to the manifestsPath: the native path at the writable location.
+            The storage without the manifestsPath is not saved.
+            Adding the storage for the same contentRoot again replaces its paths and reloads the manifests.
+         */
+        virtual Result<> addPrefetchManifestsStorage(const io::FsPath& contentRoot, const std::filesystem::path& manifestsPath, const io::FsPath& initialManifestsPath = {}) = 0;
+
+        /**
+            @brief Saves the manifests of all storages that have the manifestsPath.
+         */
+        virtual Result<> savePrefetchManifests() = 0;
+
+        /**
+            @brief Starts loading of all containers listed in the root asset's manifest.
+            Task is completed when all the loads are completed. Does nothing if there is no manifest for the asset.
+         */
+        virtual async::Task<> prefetchDependencies(const AssetPath& rootAssetPath) = 0;
+
+        /**
+            @brief Sets the maximum number of the container loads that prefetchDependencies keeps in flight.
+         */
+        virtual void setMaxConcurrentLoads(size_t maxConcurrentLoads) = 0;
+    };
+
+    /**
+        @brief Attributes the container loads requested within the scope to the recording.
+        The tasks started within the scope keep the attribution after co_await, the scope itself can span co_await within the Task<> coroutine.
+     */
+    class AssetDependencyRecordingScope
+    {
+    public:
+        AssetDependencyRecordingScope(IAssetPrefetcher& prefetcher, AssetDependencyRecordingId recordingId) :
+            m_contextScope(prefetcher.createDependencyRecordingContext(recordingId))
+        {
+        }
+
+    private:
+        const async::AsyncContextScope m_contextScope;
+    };
+}  // namespace nau
@@ -6,6 +6,7 @@
 #include <EASTL/vector.h>
 
 #include "nau/assets/asset_accessor.h"
+#include "nau/assets/asset_path.h"
 #include "nau/assets/asset_view.h"
 #include "nau/async/task.h"
 #include "nau/rtti/type_info.h"
@@ -37,5 +38,20 @@ namespace nau
          * @return              Task object providing the operation status as well as access to the created asset view.
          */
         virtual async::Task<IAssetView::Ptr> createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType) = 0;
+
+        /**
+         * @brief Schedules asset view creation operation for the asset with known path.
+         *
+         * Factories can use the path to identify the asset (i.e. to prioritize its loading). By default the path is ignored.
+         *
+         * @param [in] accessor  A pointer to the object (depending on the asset type) containing the asset data.
+         * @param [in] viewType  Type of the asset to create the view of.
+         * @param [in] assetPath Full path of the asset.
+         * @return               Task object providing the operation status as well as access to the created asset view.
+         */
+        virtual async::Task<IAssetView::Ptr> createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType, [[maybe_unused]] const AssetPath& assetPath)
+        {
+            return createAssetView(std::move(accessor), viewType);
+        }
     };
 }  // namespace nau
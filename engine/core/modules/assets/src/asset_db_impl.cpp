@@ -6,9 +6,11 @@
 
 #include <format>
 
+#include "nau/assets/asset_prefetcher.h"
 #include "nau/diag/logging.h"
 #include "nau/io/file_system.h"
 #include "nau/io/fs_path.h"
+#include "nau/io/special_paths.h"
 #include "nau/serialization/json.h"
 #include "nau/serialization/runtime_value_builder.h"
 #include "nau/service/service_provider.h"
@@ -17,6 +19,8 @@ namespace nau
 {
     namespace
     {
+        constexpr eastl::string_view PrefetchManifestsFileName = "prefetch_manifests.json";
+
         io::FsPath stripRootPath(const AssetPath& path)
         {
             const auto filePath = io::FsPath(path.getContainerPath());
@@ -265,6 +269,22 @@ namespace nau
             it.dbPath = (entry.rootPath / it.dbPath).getCStr();
             m_allAssets.emplace(it.uid, it);
         }
+
+        // Prefetch manifests of the database's scenes: the manifests shipped next to the database (can be inside the read-only pack) are the initial ones,
+        // the recorded manifests are kept at the writable location. The database without its own uid has no stable location: its manifests are not saved.
+        if (IAssetPrefetcher* const prefetcher = getServiceProvider().find<IAssetPrefetcher>())
+        {
+            std::filesystem::path manifestsPath;
+            if (assetDb.uid)
+            {
+                manifestsPath = io::getKnownFolderPath(io::KnownFolder::LocalAppData) / "nau" / "prefetch_manifests" / (toString(assetDb.uid) + ".json");
+            }
+
+            if (const Result<> loadResult = prefetcher->addPrefetchManifestsStorage(entry.rootPath, manifestsPath, entry.rootPath / PrefetchManifestsFileName); !loadResult)
+            {
+                NAU_LOG_WARNING("Fail to load prefetch manifests: ({})", loadResult.getError()->getMessage());
+            }
+        }
     }
 
     void AssetDBImpl::reloadAssetDBInternal(io::FsPath dbPath)
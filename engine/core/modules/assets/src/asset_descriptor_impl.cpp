@@ -4,11 +4,31 @@
 
 #include "./asset_descriptor_impl.h"
 
+#include "./asset_loading_context.h"
 #include "./asset_manager_impl.h"
 #include "nau/assets/asset_messages.h"
 
 namespace nau
 {
+    namespace
+    {
+        /**
+            Makes the asset the loading one: the containers requested by its loader (or view factory) are its dependencies,
+            they are attributed to the asset, not to the dependency recording.
+         */
+        class AssetLoadingScope
+        {
+        public:
+            AssetLoadingScope(AssetDescriptorImpl& asset) :
+                m_contextScope(rtti::createInstance<AssetLoadingContext>(AssetDependencyRecordingId::None, &asset))
+            {
+            }
+
+        private:
+            const async::AsyncContextScope m_contextScope;
+        };
+    }  // namespace
+
     /**
      */
     class InnerAssetDescriptor : public IAssetDescriptor,
@@ -91,9 +111,10 @@ namespace nau
         const AssetPath m_assetFullPath;
     };
 
-    AssetDescriptorImpl::AssetViewEntry::AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType) :
+    AssetDescriptorImpl::AssetViewEntry::AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType, AssetPath assetPath) :
         m_assetInnerPath(std::move(assetInnerPath)),
-        m_viewType(viewType)
+        m_viewType(viewType),
+        m_assetPath(std::move(assetPath))
     {
     }
 
@@ -153,7 +174,7 @@ namespace nau
             NAU_ASSERT(viewFactory, "Don't known how to create requested asset view: ({})", m_viewType->getTypeName());
             if (viewFactory)
             {
-                assetView = co_await viewFactory->createAssetView(asset, *m_viewType);
+                assetView = co_await viewFactory->createAssetView(asset, *m_viewType, m_assetPath);
             }
         }
 
@@ -302,6 +323,19 @@ namespace nau
     {
         using namespace nau::async;
 
+        if (const AssetLoadingContext* const loadingContext = AssetLoadingContext::findCurrent())
+        {
+            if (loadingContext->loadingAsset && loadingContext->loadingAsset.get() != this)
+            {
+                loadingContext->loadingAsset->addRequestedDependency(*this);
+            }
+
+            if (loadingContext->recordingId != AssetDependencyRecordingId::None)
+            {
+                AssetManagerImpl::getInstance().onContainerRequested(loadingContext->recordingId, *this);
+            }
+        }
+
         bool needToLoadContainer = false;
 
         {
@@ -323,7 +357,13 @@ namespace nau
         {  // load container and return it as result
             NAU_FATAL(m_containerLoader);
 
-            Result<IAssetContainer::Ptr> loadContainerResult = co_await m_containerLoader().doTry();
+            Task<IAssetContainer::Ptr> loaderTask;
+            {
+                AssetLoadingScope loadingScope{*this};
+                loaderTask = m_containerLoader();
+            }
+
+            Result<IAssetContainer::Ptr> loadContainerResult = co_await loaderTask.doTry();
             NAU_ASSERT(!m_container);
 
             if (!loadContainerResult)
@@ -338,11 +378,14 @@ namespace nau
             if (!m_assetViews.empty())
             {
                 eastl::vector<Task<>> updateTasks;
-                for (AssetViewEntry& viewEntry : m_assetViews)
                 {
-                    if (auto task = viewEntry.updateAssetView(m_assetId, *m_container); task && !task.isReady())
+                    AssetLoadingScope loadingScope{*this};
+                    for (AssetViewEntry& viewEntry : m_assetViews)
                     {
-                        updateTasks.emplace_back(std::move(task));
+                        if (auto task = viewEntry.updateAssetView(m_assetId, *m_container); task && !task.isReady())
+                        {
+                            updateTasks.emplace_back(std::move(task));
+                        }
                     }
                 }
 
@@ -359,6 +402,29 @@ namespace nau
         co_return container;
     }
 
+    void AssetDescriptorImpl::addRequestedDependency(const AssetDescriptorImpl& dependency)
+    {
+        AssetPath dependencyPath = dependency.getAssetPath();
+
+        lock_(m_mutex);
+        if (std::find(m_requestedDependencies.begin(), m_requestedDependencies.end(), dependencyPath) == m_requestedDependencies.end())
+        {
+            m_requestedDependencies.emplace_back(std::move(dependencyPath));
+        }
+    }
+
+    eastl::vector<AssetPath> AssetDescriptorImpl::getRequestedDependencies() const
+    {
+        lock_(m_mutex);
+        return m_requestedDependencies;
+    }
+
+    async::Task<bool> AssetDescriptorImpl::loadContainer()
+    {
+        IAssetContainer::Ptr container = co_await getContainer();
+        co_return static_cast<bool>(container);
+    }
+
     async::Task<IAssetView::Ptr> AssetDescriptorImpl::getInnerAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType)
     {
         auto container = co_await getContainer();
@@ -379,14 +445,26 @@ namespace nau
 
             if (viewEntryIter == m_assetViews.end())
             {
-                m_assetViews.emplace_back(eastl::string{innerPath}, viewType);
+                AssetPath viewAssetPath = m_assetPath;
+                if (!innerPath.empty())
+                {
+                    viewAssetPath.setAssetInnerPath(innerPath);
+                }
+
+                m_assetViews.emplace_back(eastl::string{innerPath}, viewType, std::move(viewAssetPath));
                 return m_assetViews.back();
             }
 
             return *viewEntryIter;
         };
 
-        IAssetView::Ptr assetView = co_await viewEntry.getAssetView(*container);
+        async::Task<IAssetView::Ptr> viewTask;
+        {
+            AssetLoadingScope loadingScope{*this};
+            viewTask = viewEntry.getAssetView(*container);
+        }
+
+        IAssetView::Ptr assetView = co_await viewTask;
 
         co_return assetView;
     }
@@ -411,14 +489,26 @@ namespace nau
 
             if (viewEntryIter == m_assetViews.end())
             {
-                m_assetViews.emplace_back(eastl::string{innerPath}, viewType);
+                AssetPath viewAssetPath = m_assetPath;
+                if (!innerPath.empty())
+                {
+                    viewAssetPath.setAssetInnerPath(innerPath);
+                }
+
+                m_assetViews.emplace_back(eastl::string{innerPath}, viewType, std::move(viewAssetPath));
                 return m_assetViews.back();
             }
 
             return *viewEntryIter;
         };
 
-        ReloadableAssetView::Ptr assetView = co_await viewEntry.getReloadableAssetView(*container);
+        async::Task<ReloadableAssetView::Ptr> viewTask;
+        {
+            AssetLoadingScope loadingScope{*this};
+            viewTask = viewEntry.getReloadableAssetView(*container);
+        }
+
+        ReloadableAssetView::Ptr assetView = co_await viewTask;
 
         co_return assetView;
     }
@@ -40,6 +40,16 @@ namespace nau
 
         IAssetContainer* getLoadedContainer();
 
+        /**
+            Starts loading the container (if it is not loaded yet). The task is completed with false if the container can not be loaded.
+         */
+        async::Task<bool> loadContainer();
+
+        /**
+            Paths of the containers that were requested while this container (or its views) was loading.
+         */
+        eastl::vector<AssetPath> getRequestedDependencies() const;
+
         AssetId getAssetId() const final;
 
         AssetPath getAssetPath() const override;
@@ -61,7 +71,7 @@ namespace nau
         {
         public:
             AssetViewEntry() = delete;
-            AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType);
+            AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType, AssetPath assetPath);
             AssetViewEntry(const AssetViewEntry&) = delete;
             ~AssetViewEntry();
 
@@ -84,6 +94,7 @@ namespace nau
 
             const eastl::string m_assetInnerPath;
             const rtti::TypeInfo* const m_viewType = nullptr;
+            const AssetPath m_assetPath;
 
             nau::WeakPtr<IAssetView> m_assetViewRef;
             nau::WeakPtr<ReloadableAssetView> m_reloadableAssetViewRef;
@@ -93,6 +104,8 @@ namespace nau
 
         async::Task<IAssetContainer::Ptr> getContainer();
 
+        void addRequestedDependency(const AssetDescriptorImpl& dependency);
+
         async::Task<IAssetView::Ptr> getInnerAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType);
         async::Task<ReloadableAssetView::Ptr> getInnerReloadableAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType);
 
@@ -109,6 +122,7 @@ namespace nau
         IAssetContainer::Ptr m_container;
         async::MultiTaskSource<IAssetContainer::Ptr> m_containerLoadingState = nullptr;
         eastl::list<AssetViewEntry, EastlBlockAllocator<alignedSize(sizeof(AssetViewEntry), 64)>> m_assetViews;
+        eastl::vector<AssetPath> m_requestedDependencies;
         mutable std::mutex m_mutex;
 
         friend class InnerAssetDescriptor;
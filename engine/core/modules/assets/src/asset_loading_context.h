@@ -0,0 +1,47 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "./asset_descriptor_impl.h"
+#include "nau/assets/asset_prefetcher.h"
+#include "nau/async/async_context.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau
+{
+    /**
+        The async context of the container loads: it is passed with the load requests through the task chain (including the suspension points).
+        The container loads requested within the context are attributed to the recording, or if the context belongs to the asset
+        whose container (or view) is loading, to this asset: they are the asset's dependencies.
+     */
+    class AssetLoadingContext final : public async::AsyncContext
+    {
+        NAU_CLASS_(nau::AssetLoadingContext, async::AsyncContext)
+
+    public:
+        static AssetLoadingContext* findCurrent()
+        {
+            return async::AsyncContext::find<AssetLoadingContext>();
+        }
+
+        AssetLoadingContext(AssetDependencyRecordingId recordingId_, nau::Ptr<AssetDescriptorImpl> loadingAsset_) :
+            recordingId(recordingId_),
+            loadingAsset(std::move(loadingAsset_)),
+            m_parent(async::AsyncContext::getCurrent())
+        {
+        }
+
+        async::AsyncContext* getParent() const override
+        {
+            return m_parent.get();
+        }
+
+        const AssetDependencyRecordingId recordingId;
+        const nau::Ptr<AssetDescriptorImpl> loadingAsset;
+
+    private:
+        const async::AsyncContext::Ptr m_parent;
+    };
+}  // namespace nau
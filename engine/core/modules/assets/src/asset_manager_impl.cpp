@@ -4,10 +4,18 @@
 
 #include "./asset_manager_impl.h"
 
+#include <EASTL/sort.h>
+#include <EASTL/unordered_set.h>
+
+#include "./asset_loading_context.h"
+
 #include "nau/assets/import_settings_provider.h"
 #include "nau/async/multi_task_source.h"
 #include "nau/diag/error.h"
+#include "nau/io/file_system.h"
 #include "nau/memory/mem_allocator.h"
+#include "nau/serialization/json.h"
+#include "nau/serialization/runtime_value_builder.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
 
@@ -305,13 +313,398 @@ namespace nau
         m_assets.erase(iter);
     }
 
+    AssetDependencyRecordingId AssetManagerImpl::beginDependencyRecording(const AssetPath& rootAssetPath)
+    {
+        const auto recordingId = static_cast<AssetDependencyRecordingId>(m_nextDependencyRecordingId.fetch_add(1));
+
+        lock_(m_prefetchMutex);
+        m_dependencyRecordings.emplace_back(DependencyRecording{recordingId, rootAssetPath.toString(), {}});
+
+        return recordingId;
+    }
+
+    async::Task<AssetPrefetchManifest> AssetManagerImpl::endDependencyRecording(AssetDependencyRecordingId recordingId)
+    {
+        const auto findRecording = [this, recordingId]
+        {
+            return std::find_if(m_dependencyRecordings.begin(), m_dependencyRecordings.end(), [recordingId](const DependencyRecording& recording)
+            {
+                return recording.id == recordingId;
+            });
+        };
+
+        // Recorded containers can request other containers while they are loading, those are recorded too (see AssetDescriptorImpl::getRequestedDependencies).
+        // So recording is finished only when all recorded loads are completed and there are no new ones.
+        for (size_t i = 0;; ++i)
+        {
+            nau::Ptr<AssetDescriptorImpl> asset;
+            {
+                lock_(m_prefetchMutex);
+
+                auto recording = findRecording();
+                NAU_ASSERT(recording != m_dependencyRecordings.end(), "Dependency recording ({}) is not active", static_cast<uint64_t>(recordingId));
+                if (recording == m_dependencyRecordings.end())
+                {
+                    co_return AssetPrefetchManifest{};
+                }
+
+                if (i < recording->assets.size())
+                {
+                    asset = recording->assets[i];
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            co_await asset->loadContainer();
+
+            // the container can be loaded earlier on behalf of another root: its dependencies are known by the container itself
+            eastl::vector<nau::Ptr<AssetDescriptorImpl>> dependencies;
+            for (const AssetPath& dependencyPath : asset->getRequestedDependencies())
+            {
+                IAssetDescriptor::Ptr dependency = openAsset(dependencyPath);
+                if (AssetDescriptorImpl* const dependencyImpl = dependency ? dependency->as<AssetDescriptorImpl*>() : nullptr)
+                {
+                    dependencies.emplace_back(dependencyImpl);
+                }
+            }
+
+            lock_(m_prefetchMutex);
+            if (auto recording = findRecording(); recording != m_dependencyRecordings.end())
+            {
+                for (const nau::Ptr<AssetDescriptorImpl>& dependency : dependencies)
+                {
+                    recording->addAsset(*dependency);
+                }
+            }
+        }
+
+        eastl::string rootAssetPath;
+        {
+            lock_(m_prefetchMutex);
+
+            auto recording = findRecording();
+            NAU_FATAL(recording != m_dependencyRecordings.end());
+            rootAssetPath = recording->rootAssetPath;
+        }
+
+        // the storage is found before the lock: the root asset path is resolved under m_mutex
+        const eastl::optional<eastl::string> storageRoot = findPrefetchManifestsStorage(AssetPath{rootAssetPath});
+
+        AssetPrefetchManifest manifest;
+        bool needSave = false;
+        {
+            lock_(m_prefetchMutex);
+
+            auto recording = findRecording();
+            NAU_FATAL(recording != m_dependencyRecordings.end());
+
+            eastl::unordered_set<eastl::string> uniquePaths;
+            for (const nau::Ptr<AssetDescriptorImpl>& recordedAsset : recording->assets)
+            {
+                eastl::string assetPath = recordedAsset->getAssetPath().toString();
+                if (uniquePaths.emplace(assetPath).second)
+                {
+                    manifest.dependencies.emplace_back(std::move(assetPath));
+                }
+            }
+
+            // the loads are completed in any order: sorted dependencies make the manifests comparable
+            eastl::sort(manifest.dependencies.begin(), manifest.dependencies.end());
+
+            PrefetchManifestEntry& entry = m_prefetchManifests[rootAssetPath];
+            if (entry.manifest.dependencies != manifest.dependencies || entry.storageRoot != storageRoot)
+            {
+                entry.manifest = manifest;
+                entry.storageRoot = storageRoot;
+                needSave = storageRoot.has_value();
+            }
+
+            m_dependencyRecordings.erase(recording);
+        }
+
+        if (needSave)
+        {
+            if (const Result<> saveResult = savePrefetchManifests(*storageRoot); !saveResult)
+            {
+                NAU_LOG_WARNING("Fail to save prefetch manifests: ({})", saveResult.getError()->getMessage());
+            }
+        }
+
+        co_return manifest;
+    }
+
+    async::AsyncContext::Ptr AssetManagerImpl::createDependencyRecordingContext(AssetDependencyRecordingId recordingId)
+    {
+        const AssetLoadingContext* const currentContext = AssetLoadingContext::findCurrent();
+        return rtti::createInstance<AssetLoadingContext>(recordingId, currentContext ? currentContext->loadingAsset : nullptr);
+    }
+
+    void AssetManagerImpl::setPrefetchManifest(const AssetPath& rootAssetPath, AssetPrefetchManifest manifest)
+    {
+        eastl::optional<eastl::string> storageRoot = findPrefetchManifestsStorage(rootAssetPath);
+
+        lock_(m_prefetchMutex);
+        m_prefetchManifests[rootAssetPath.toString()] = PrefetchManifestEntry{std::move(manifest), std::move(storageRoot)};
+    }
+
+    eastl::optional<AssetPrefetchManifest> AssetManagerImpl::findPrefetchManifest(const AssetPath& rootAssetPath)
+    {
+        lock_(m_prefetchMutex);
+
+        auto iter = m_prefetchManifests.find(rootAssetPath.toString());
+        if (iter == m_prefetchManifests.end())
+        {
+            return eastl::nullopt;
+        }
+
+        return iter->second.manifest;
+    }
+
+    Result<> AssetManagerImpl::addPrefetchManifestsStorage(const io::FsPath& contentRoot, const std::filesystem::path& manifestsPath, const io::FsPath& initialManifestsPath)
+    {
+        PrefetchManifestsData data;
+        if (!manifestsPath.empty() && std::filesystem::exists(manifestsPath))
+        {
+            io::IStreamBase::Ptr stream = io::createNativeFileStream(manifestsPath.string().c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+            if (!stream)
+            {
+                return NauMakeError("Fail to open prefetch manifests ({})", manifestsPath.string());
+            }
+
+            auto parseResult = serialization::jsonParse(*stream->as<io::IStreamReader*>());
+            NauCheckResult(parseResult);
+            NauCheckResult(runtimeValueApply(data, *parseResult));
+        }
+        else if (!initialManifestsPath.isEmpty())
+        {
+            auto& fileSystem = getServiceProvider().get<io::IFileSystem>();
+            if (fileSystem.exists(initialManifestsPath, io::FsEntryKind::File))
+            {
+                auto file = fileSystem.openFile(initialManifestsPath, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+                if (!file)
+                {
+                    return NauMakeError("Fail to open prefetch manifests ({})", initialManifestsPath.getCStr());
+                }
+
+                auto parseResult = serialization::jsonParse(*file->createStream()->as<io::IStreamReader*>());
+                NauCheckResult(parseResult);
+                NauCheckResult(runtimeValueApply(data, *parseResult));
+            }
+        }
+
+        eastl::string storageRoot;
+        if (!contentRoot.isEmpty())
+        {
+            const std::string absoluteContentRoot = io::FsPath{contentRoot}.makeAbsolute().getString();
+            storageRoot.assign(absoluteContentRoot.data(), absoluteContentRoot.size());
+        }
+
+        lock_(m_prefetchMutex);
+
+        auto storage = eastl::find_if(m_prefetchManifestsStorages.begin(), m_prefetchManifestsStorages.end(), [&storageRoot](const PrefetchManifestsStorage& storage)
+        {
+            return storage.contentRoot == storageRoot;
+        });
+
+        if (storage == m_prefetchManifestsStorages.end())
+        {
+            m_prefetchManifestsStorages.emplace_back(PrefetchManifestsStorage{storageRoot, manifestsPath});
+        }
+        else
+        {
+            storage->manifestsPath = manifestsPath;
+        }
+
+        for (auto& [rootAssetPath, manifest] : data.manifests)
+        {
+            m_prefetchManifests[rootAssetPath] = PrefetchManifestEntry{std::move(manifest), storageRoot};
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> AssetManagerImpl::savePrefetchManifests()
+    {
+        eastl::vector<eastl::string> storageRoots;
+        {
+            lock_(m_prefetchMutex);
+            for (const PrefetchManifestsStorage& storage : m_prefetchManifestsStorages)
+            {
+                if (!storage.manifestsPath.empty())
+                {
+                    storageRoots.emplace_back(storage.contentRoot);
+                }
+            }
+        }
+
+        if (storageRoots.empty())
+        {
+            return NauMakeError("Prefetch manifests storage is not set");
+        }
+
+        for (const eastl::string& storageRoot : storageRoots)
+        {
+            NauCheckResult(savePrefetchManifests(storageRoot));
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> AssetManagerImpl::savePrefetchManifests(const eastl::string& storageRoot)
+    {
+        PrefetchManifestsData data;
+        std::filesystem::path path;
+        {
+            lock_(m_prefetchMutex);
+
+            auto storage = eastl::find_if(m_prefetchManifestsStorages.begin(), m_prefetchManifestsStorages.end(), [&storageRoot](const PrefetchManifestsStorage& storage)
+            {
+                return storage.contentRoot == storageRoot;
+            });
+
+            if (storage == m_prefetchManifestsStorages.end() || storage->manifestsPath.empty())
+            {
+                return ResultSuccess;
+            }
+
+            path = storage->manifestsPath;
+            for (const auto& [rootAssetPath, entry] : m_prefetchManifests)
+            {
+                if (entry.storageRoot && *entry.storageRoot == storageRoot)
+                {
+                    data.manifests[rootAssetPath] = entry.manifest;
+                }
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+
+        io::IStreamBase::Ptr stream = io::createNativeFileStream(path.string().c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        if (!stream)
+        {
+            return NauMakeError("Fail to open prefetch manifests for writing ({})", path.string());
+        }
+
+        return serialization::jsonWrite(*stream->as<io::IStreamWriter*>(), makeValueRef(data, getDefaultAllocator()), serialization::JsonSettings{.pretty = true});
+    }
+
+    eastl::optional<eastl::string> AssetManagerImpl::findPrefetchManifestsStorage(const AssetPath& rootAssetPath)
+    {
+        // the container registered through addAssetContainer can not be resolved: its own path is used
+        AssetPath resolvedRootAssetPath = rootAssetPath;
+        {
+            lock_(m_mutex);
+            if (m_assets.find_as(rootAssetPath.getSchemeAndContainerPath()) == m_assets.end())
+            {
+                if (ResolvedContentData resolvedContent = resolveAssetContent(rootAssetPath))
+                {
+                    resolvedRootAssetPath = std::move(resolvedContent.assetPath);
+                }
+            }
+        }
+
+        const eastl::string_view containerPath = resolvedRootAssetPath.getContainerPath();
+
+        lock_(m_prefetchMutex);
+
+        const PrefetchManifestsStorage* result = nullptr;
+        for (const PrefetchManifestsStorage& storage : m_prefetchManifestsStorages)
+        {
+            const eastl::string_view contentRoot = storage.contentRoot;
+            const bool isUnderContentRoot = contentRoot.empty() ||
+                                            (containerPath.starts_with(contentRoot) && (containerPath.size() == contentRoot.size() || containerPath[contentRoot.size()] == '/'));
+
+            if (isUnderContentRoot && (!result || result->contentRoot.size() < contentRoot.size()))
+            {
+                result = &storage;
+            }
+        }
+
+        if (!result)
+        {
+            return eastl::nullopt;
+        }
+
+        return result->contentRoot;
+    }
+
+    async::Task<> AssetManagerImpl::prefetchDependencies(const AssetPath& rootAssetPath)
+    {
+        using namespace nau::async;
+
+        const eastl::optional<AssetPrefetchManifest> manifest = findPrefetchManifest(rootAssetPath);
+        if (!manifest || manifest->dependencies.empty())
+        {
+            co_return;
+        }
+
+        const size_t maxConcurrentLoads = std::max<size_t>(m_maxConcurrentLoads.load(std::memory_order_relaxed), 1);
+        Vector<Task<bool>> activeLoads;
+
+        for (const eastl::string& dependencyPath : manifest->dependencies)
+        {
+            IAssetDescriptor::Ptr descriptor = openAsset(AssetPath{dependencyPath});
+            AssetDescriptorImpl* const asset = descriptor ? descriptor->as<AssetDescriptorImpl*>() : nullptr;
+            if (!asset)
+            {
+                NAU_LOG_WARNING("Can not prefetch asset ({})", dependencyPath);
+                continue;
+            }
+
+            if (Task<bool> loadTask = asset->loadContainer(); !loadTask.isReady())
+            {
+                activeLoads.emplace_back(std::move(loadTask));
+            }
+
+            while (activeLoads.size() >= maxConcurrentLoads)
+            {
+                co_await whenAny(activeLoads);
+
+                activeLoads.erase(std::remove_if(activeLoads.begin(), activeLoads.end(), [](const Task<bool>& task)
+                {
+                    return task.isReady();
+                }), activeLoads.end());
+            }
+        }
+
+        co_await whenAll(activeLoads);
+    }
+
+    void AssetManagerImpl::setMaxConcurrentLoads(size_t maxConcurrentLoads)
+    {
+        NAU_ASSERT(maxConcurrentLoads > 0);
+        m_maxConcurrentLoads.store(maxConcurrentLoads, std::memory_order_relaxed);
+    }
+
+    void AssetManagerImpl::onContainerRequested(AssetDependencyRecordingId recordingId, AssetDescriptorImpl& asset)
+    {
+        NAU_ASSERT(recordingId != AssetDependencyRecordingId::None);
+
+        lock_(m_prefetchMutex);
+
+        auto recording = std::find_if(m_dependencyRecordings.begin(), m_dependencyRecordings.end(), [recordingId](const DependencyRecording& recording)
+        {
+            return recording.id == recordingId;
+        });
+
+        // the recording can be already finished: the load is requested by the container that is still loading.
+        if (recording != m_dependencyRecordings.end())
+        {
+            recording->addAsset(asset);
+        }
+    }
+
     IAssetContainerLoader* AssetManagerImpl::findContainerLoader(const eastl::string& kind)
     {
         // BE AWARE: findFileContainerLoader requires that m_mutex is locked
         // prior findFileContainerLoader is called
         if (m_containerLoaders.empty())
         {
-            for (IAssetContainerLoader* const loader : getServiceProvider().getAll<IAssetContainerLoader>())
+            for (IAssetContainerLoader* const loader : getServiceProvider().getAllCached<IAssetContainerLoader>())
             {
                 eastl::vector<eastl::string_view> supportedAssetKinds = loader->getSupportedAssetKind();
                 for (auto assetKind : supportedAssetKinds)
@@ -344,7 +737,7 @@ namespace nau
 
         if (m_schemeHandlers.empty())
         {
-            for (IAssetContentProvider* const contentProvider : getServiceProvider().getAll<IAssetContentProvider>())
+            for (IAssetContentProvider* const contentProvider : getServiceProvider().getAllCached<IAssetContentProvider>())
             {
                 eastl::vector<eastl::string_view> supportedAssetSchemes = contentProvider->getSupportedSchemes();
                 for (auto assetScheme : supportedAssetSchemes)
@@ -354,7 +747,7 @@ namespace nau
                 }
             }
 
-            for (IAssetPathResolver* const pathResolver : getServiceProvider().getAll<IAssetPathResolver>())
+            for (IAssetPathResolver* const pathResolver : getServiceProvider().getAllCached<IAssetPathResolver>())
             {
                 eastl::vector<eastl::string_view> supportedAssetSchemes = pathResolver->getSupportedSchemes();
                 for (auto assetScheme : supportedAssetSchemes)
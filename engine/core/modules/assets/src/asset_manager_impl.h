@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/unordered_set.h>
+
 #include "./asset_descriptor_impl.h"
 #include "nau/assets/asset_container.h"
 #include "nau/assets/asset_descriptor_factory.h"
@@ -11,6 +13,7 @@
 #include "nau/assets/asset_manager.h"
 #include "nau/assets/asset_path.h"
 #include "nau/assets/asset_path_resolver.h"
+#include "nau/assets/asset_prefetcher.h"
 #include "nau/assets/asset_view_factory.h"
 #include "nau/async/multi_task_source.h"
 #include "nau/rtti/rtti_impl.h"
@@ -23,9 +26,10 @@ namespace nau
     /**
      */
     class AssetManagerImpl final : public IAssetManager,
-                                   public IAssetDescriptorFactory
+                                   public IAssetDescriptorFactory,
+                                   public IAssetPrefetcher
     {
-        NAU_INTERFACE(nau::AssetManagerImpl, IAssetManager, IAssetDescriptorFactory)
+        NAU_INTERFACE(nau::AssetManagerImpl, IAssetManager, IAssetDescriptorFactory, IAssetPrefetcher)
 
     public:
         static AssetManagerImpl& getInstance();
@@ -45,6 +49,21 @@ namespace nau
         void addAssetContainer(const AssetPath& assetPath, IAssetContainer::Ptr) override;
         void removeAssetContainer(const AssetPath& assetPath) override;
 
+        AssetDependencyRecordingId beginDependencyRecording(const AssetPath& rootAssetPath) override;
+        async::Task<AssetPrefetchManifest> endDependencyRecording(AssetDependencyRecordingId recordingId) override;
+        async::AsyncContext::Ptr createDependencyRecordingContext(AssetDependencyRecordingId recordingId) override;
+        void setPrefetchManifest(const AssetPath& rootAssetPath, AssetPrefetchManifest manifest) override;
+        eastl::optional<AssetPrefetchManifest> findPrefetchManifest(const AssetPath& rootAssetPath) override;
+        Result<> addPrefetchManifestsStorage(const io::FsPath& contentRoot, const std::filesystem::path& manifestsPath, const io::FsPath& initialManifestsPath) override;
+        Result<> savePrefetchManifests() override;
+        async::Task<> prefetchDependencies(const AssetPath& rootAssetPath) override;
+        void setMaxConcurrentLoads(size_t maxConcurrentLoads) override;
+
+        /**
+            @brief Is called by the asset descriptor when its container is requested on behalf of the recording.
+         */
+        void onContainerRequested(AssetDependencyRecordingId recordingId, AssetDescriptorImpl& asset);
+
         IAssetViewFactory* findAssetViewFactory(const rtti::TypeInfo& viewType);
 
         IAssetDescriptor::AssetId getNextAssetId();
@@ -77,6 +96,59 @@ namespace nau
         ResolvedContentData resolveAssetContent(const AssetPath& path);
         const eastl::vector<IAssetListener*>& getAssetListeners();
 
+        struct DependencyRecording
+        {
+            AssetDependencyRecordingId id;
+            eastl::string rootAssetPath;
+            eastl::vector<nau::Ptr<AssetDescriptorImpl>> assets;
+            eastl::unordered_set<const AssetDescriptorImpl*> uniqueAssets;
+
+            void addAsset(AssetDescriptorImpl& asset)
+            {
+                if (uniqueAssets.emplace(&asset).second)
+                {
+                    assets.emplace_back(&asset);
+                }
+            }
+        };
+
+        /**
+            The manifests of the root assets located under the content root (see addPrefetchManifestsStorage).
+         */
+        struct PrefetchManifestsStorage
+        {
+            eastl::string contentRoot;
+            std::filesystem::path manifestsPath;
+        };
+
+        struct PrefetchManifestEntry
+        {
+            AssetPrefetchManifest manifest;
+            eastl::optional<eastl::string> storageRoot;
+        };
+
+        /**
+            @brief Returns the content root of the storage that keeps the root asset's manifest:
+            the storage with the longest content root the resolved root asset path is located under.
+            Must be called without m_mutex and m_prefetchMutex locked.
+         */
+        eastl::optional<eastl::string> findPrefetchManifestsStorage(const AssetPath& rootAssetPath);
+
+        Result<> savePrefetchManifests(const eastl::string& storageRoot);
+
+        /**
+            Content of the manifests file.
+         */
+        struct PrefetchManifestsData
+        {
+            eastl::unordered_map<eastl::string, AssetPrefetchManifest> manifests;
+
+#pragma region Class Info
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(manifests))
+#pragma endregion
+        };
+
         eastl::unordered_map<AssetPath, nau::Ptr<AssetDescriptorImpl>> m_assets;
         eastl::unordered_map<eastl::string, IAssetContainerLoader*> m_containerLoaders;
         eastl::unordered_map<eastl::string_view, SchemeHandler> m_schemeHandlers;
@@ -85,5 +157,12 @@ namespace nau
 
         std::atomic<IAssetDescriptor::AssetId> m_nextAssetId{1ui64};
         mutable std::shared_mutex m_mutex;
+
+        eastl::unordered_map<eastl::string, PrefetchManifestEntry> m_prefetchManifests;
+        eastl::vector<PrefetchManifestsStorage> m_prefetchManifestsStorages;
+        eastl::vector<DependencyRecording> m_dependencyRecordings;
+        std::atomic<uint64_t> m_nextDependencyRecordingId{1};
+        std::atomic<size_t> m_maxConcurrentLoads{8};
+        std::mutex m_prefetchMutex;
     };
 }  // namespace nau
@@ -42,6 +42,8 @@ struct Query;
 struct UpdateStageInfo;
 struct EntitySystemDesc;
 struct ComponentsIterator;
+class SerializerCb;
+class DeserializerCb;
 struct NestedQueryRestorer;
 
 typedef eastl::function<void(EntityId /*created_entity*/)> create_entity_async_cb_t;
@@ -243,6 +245,19 @@ public:
   // Remove all entities and all entity systems
   void clear();
 
+  // World snapshot: binary image of all entities, written per archetype close to the chunks layout.
+  // Entity ids and template names are stored with it, POD components are written as raw chunk columns,
+  // other components are written with their (component or type) serializers, components without ones are not saved.
+  // Loading keeps saved entity ids (so EntityId components stay valid), entities are created through the regular creation path
+  // from their templates, and saved component values are copied over the created ones (bulk memcpy for POD columns).
+  // Saved entities which ids are occupied in this manager or which templates are missing are skipped.
+  // Components which are missing in this manager or have other type are skipped (they keep template values).
+  // If the snapshot is truncated or corrupted, loadSnapshot returns false and the world is left as it was before the call:
+  // entities already created by it are destroyed (with the usual destruction events).
+  // Both can't be called within queries/ES or in constrained MT mode. Pending creations are flushed first.
+  bool saveSnapshot(SerializerCb &cb);
+  bool loadSnapshot(const DeserializerCb &cb);
+
   // Get entity components iterator (with or without template ones)
   // Warning: DO NOT recreateEntity from within this iterator - it might get invalidated!
   ComponentsIterator getComponentsIterator(EntityId eid, bool including_templates = true) const;
@@ -329,8 +344,17 @@ public:
   void destroyQuery(QueryId);
   const component_index_t *queryComponents(QueryId) const; // invalid index means unresolved
 
-  void setMaxUpdateJobs(uint32_t max_num_jobs); // TODO Uncomment or delete
-  //uint32_t getMaxWorkerId() const; // this is inclusive! i.e. it can return setMaxUpdateJobs()/MAX_POSSIBLE_WORKERS_COUNT + 1!
+  // Max number of helper jobs of multithreaded queries (ES with update quant), capped by MAX_ES_JOBS.
+  // Applied on the next tick, limited by the number of nau::threading::parallelFor workers. 0 disables multithreaded queries.
+  void setMaxUpdateJobs(uint32_t max_num_jobs);
+  // Run ES of the same update stage concurrently if they don't conflict, i.e. none of them writes a component that other reads or
+  // writes, and there is no explicit before/after order between them. ES with quant, empty ES and ES without RW/RO components are
+  // always run alone. Waves of concurrent ES are run in Constrained MT mode, so ES must not access components that are not declared.
+  void setParallelEsUpdate(bool on) { parallelEsUpdate = on; }
+  bool isParallelEsUpdate() const { return parallelEsUpdate; }
+  // Worker id passed to the queries is in [0, getMaxWorkerId()] - inclusive! 0 is the calling thread, so per worker data needs
+  // getMaxWorkerId() + 1 slots.
+  uint32_t getMaxWorkerId() const;
   void setQueryUpdateQuant(const char *es, uint16_t min_quant);
 
   EntityManager();
@@ -522,6 +546,8 @@ public:
 
   EntityId allocateOneEid();
   EntityId allocateOneEidDelayed(bool delayed);
+  void claimSnapshotEids(eastl::vector<EntityId> &eids); // invalidates eids which can't be allocated
+  bool loadSnapshotComponents(const DeserializerCb &cb, const eastl::vector<EntityId> &eids, const eastl::vector<uint32_t> &blockStarts);
 
   void removeDataFromArchetype(const uint32_t archetype, const chunk_type_t chunkId, const uint32_t idInChunk);  // remove data, without
                                                                                                                  // calling to destructors
@@ -903,6 +929,15 @@ public:
   typedef EsIndexFixedSet es_index_set;
   eastl::vector<es_index_set> esUpdates;  // sorted by update priority ES functions (for each update stage)
 
+  // ES of update stage grouped to waves, ES within one wave can be run concurrently. Waves are run in order.
+  struct EsUpdateSchedule
+  {
+      eastl::vector<es_index_type> systems;  // sorted by wave, then by update priority
+      eastl::vector<uint16_t> waveStarts;    // i-th wave is [waveStarts[i], waveStarts[i + 1]) range of systems, {0} if stage has no ES
+  };
+  eastl::vector<EsUpdateSchedule> esUpdateSchedules;  // parallel to esUpdates
+  bool parallelEsUpdate = false;
+
   // probably use ska::flat_hash_map<event_type_t, event_index_t> esEventsMap; eastl::vector<eastl::vector_set<es_index_type>>
   // esEventsList; check performance
   ska::flat_hash_map<event_type_t, es_index_set, ska::power_of_two_std_hash<event_type_t>> esEvents;
@@ -957,6 +992,12 @@ public:
   const EntitySystemDesc& getESDescForEvent(es_index_type esIndex, const Event& evt) const;
   void registerEsEvents();
   void registerEsStage(int esId);
+  // es_ordered(from, to) returns true if ES 'from' has to be finished before ES 'to' is started (explicit before/after order)
+  void buildEsUpdateSchedules(const eastl::function<bool(es_index_type, es_index_type)>& es_ordered);
+  bool isEsUpdateConflicting(es_index_type a, es_index_type b) const;
+  bool isEsUpdateBarrier(es_index_type esIndex) const;
+  void performEsUpdate(es_index_type esIndex, const UpdateStageInfo& info);
+  void performEsUpdateWave(const es_index_type* systems, uint32_t count, const UpdateStageInfo& info);
   void registerEsEvent(int esId);
   void registerEs(int esId);
   void validateEventRegistrationInternal(const Event& evt, const char* name);
@@ -1219,7 +1260,7 @@ public:
   }
 
   uint32_t maxNumJobs = 0, maxNumJobsSet = 0;
-  void updateCurrentUpdateMaxJobs();// TODO Uncomment or delete
+  void updateCurrentUpdateMaxJobs(); // maxNumJobs = min(maxNumJobsSet, parallelFor workers count)
 
   void destroyEntityImmediate(EntityId e);
 
@@ -2429,10 +2470,10 @@ namespace ecs
                 ++currentAttr;
     }
 
-    //inline uint32_t EntityManager::getMaxWorkerId() const TODO Uncomment or delete
-    //{
-    //    return maxNumJobs;
-    //}
+    inline uint32_t EntityManager::getMaxWorkerId() const
+    {
+        return maxNumJobs;
+    }
 
     template <typename Fn>
     bool EntityManager::performEidQuery(ecs::EntityId eid, QueryId h, Fn&& fun, void* user_data)
@@ -4,6 +4,7 @@
 #pragma once
 #include "nau/diag/assertion.h"
 #include "nau/diag/logging.h"
+#include "nau/utils/performance_profiling.h"
 
 #define logerr(...) NAU_LOG_ERROR({ "ecs" }, ##__VA_ARGS__)
 #define logwarn(...) NAU_LOG_WARNING({"ecs"}, ##__VA_ARGS__)
@@ -11,7 +12,7 @@
 #define ECS_VERBOSE_LOG(...) NAU_LOG_VERBOSE({"ecs"}, ##__VA_ARGS__)
 #define ECS_LOG(...) NAU_LOG_INFO({"ecs"}, ##__VA_ARGS__)
 #define DA_PROFILE_TAG(...)
-#define TIME_PROFILE(...)
+#define TIME_PROFILE(Name) NAU_CPU_SCOPED_NAME(#Name)
 #define FRAMEMEM_REGION
 #define TIME_PROFILE_DEV(...)
 #define TIME_PROFILE_WAIT_DEV(...)
@@ -1218,6 +1218,7 @@ void EntityManager::clear()
   clearQueries(); // as long as we clear archetypes
   queryToEsMap.clear();
   esUpdates.clear();
+  esUpdateSchedules.clear();
   eidTrackingQueue.clear();
   archetypeTrackingQueue.clear();
   trackQueryIndices.clear();
@@ -1,12 +1,12 @@
 // Copyright 2024 N-GINN LLC. All rights reserved.
 
 // Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+#include <EASTL/algorithm.h>
 #include <EASTL/utility.h>
 #include <daECS/core/entityManager.h>
 #include <daECS/core/componentTypes.h>
 #include <daECS/core/ecsQuery.h>
-#include <nau/async/thread_pool_executor.h>
-#include "nau/async/task.h"
+#include <nau/threading/parallel_for.h>
 #include "nau/string/string.h"
 #include <daECS/core/internal/trackComponentAccess.h>
 #include "ecsPerformQueryInline.h"
@@ -25,175 +25,65 @@ thread_local MTLinkedList<QueryStackData>::Node *MTLinkedList<QueryStackData>::t
 static_assert(sizeof(ArchetypesQuery) <= 64);
 static constexpr int MAX_ES_JOBS = MAX_POSSIBLE_WORKERS_COUNT;
 
-// all JobInfo fits in one cache line, if there is only one chunk
 struct JobInfo //-V730
 {
-  std::atomic<int> work_started = {0};
-  uint32_t totalSize = 0;
   EntityManager &mgr;
   const Query &__restrict query;
   const query_cb_t &__restrict fun;
   void *__restrict userData;
-  int quant;
-  eastl::fixed_vector<uint32_t, 32, true, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> starts;
-  JobInfo(EntityManager &mgr, const Query &__restrict query, const query_cb_t &__restrict fun, void *__restrict userData, int quant) :
-    mgr(mgr), query(query), fun(fun), userData(userData), quant(quant)
+  eastl::fixed_vector<uint32_t, 32, true, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> starts; // first entity of each
+                                                                                                              // chunk, plus total size
+  JobInfo(EntityManager &mgr, const Query &__restrict query, const query_cb_t &__restrict fun, void *__restrict userData) :
+    mgr(mgr), query(query), fun(fun), userData(userData)
   {}
 };
 
-#if defined(__ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__) && __ENVIRONMENT_MAC_OS_X_VERSION_MIN_REQUIRED__ < 101400
-class ESJob final : public cpujobs::IJob // workaround for 'error: aligned deallocation function of type 'void (void *,
-                                         // std::align_val_t) noexcept' is only available on macOS 10.14 or newer'
-#else
-class alignas(128) ESJob                 // align on 2 cache lines to avoid false sharing on setting 'done' within
-                                                      // threadpool
-#endif
+// range of the query entities can span several chunks
+static void perform_range(const JobInfo &__restrict info, uint32_t begin, uint32_t end, uint32_t worker_id)
 {
-  JobInfo *__restrict parent = 0; // same lifetime as thread
-  uint32_t workerId = 0;
-
-public:
-  ESJob(JobInfo *parent_, uint32_t id) : parent(parent_), workerId(id) {}
-
-  static inline void perform_fun( // ESJob *job,
-    JobInfo *__restrict info, const uint32_t *__restrict startsPtr, uint32_t worker_id)
+  TIME_PROFILE_DEV(perform_fun);
+  const Query &__restrict query = info.query;
+  const uint32_t *__restrict starts = info.starts.data();
+  uint32_t chunk = eastl::upper_bound(info.starts.begin(), info.starts.end(), begin) - info.starts.begin() - 1;
+  QueryView jobView = query.getView(info.mgr, info.userData, 0, 0, 0, worker_id);
+  while (begin < end)
   {
-    // NAU_CORE_DEBUG_LF("start job {} us", get_time_usec(baset));
-    const uint32_t totalSize = info->totalSize;
-    if (info->work_started.load(std::memory_order_relaxed) >= totalSize)
-      return;
-    TIME_PROFILE_DEV(perform_fun);
-    // QueryView jobView = query.getView(user_data, chunk);//still can happen that query is already dead, if all work is done!!
-
-    int currentChunk = 0;
-    for (;;)
-    {
-      const int minQuant = info->quant;
-      int totalStart = info->work_started.fetch_add(minQuant);
-      int totalCount = std::min<int>(totalSize - totalStart, minQuant);
-      // we can use query Only after this line, so we won't start working on already dead pointer.
-      //  if info->work_finished became zero, work is finished, and job won't be 'waited' upon, code will leave, &query will become
-      //  dead, but thread can just 'sleep' that can happen only before this line (or after info->work_finished.fetch_sub)
-      // thread will be 'finalized' sometime.
-      //'info', unlike 'query', have SAME lifetime as thread
-      if (totalCount <= 0)
-        return;
-      // if we are here, query is valid pointer
-      // NAU_CORE_DEBUG_LF("{}:we start at {} do {} out of {}",threadId, totalStart, totalCount, query.totalSize);
-      const uint32_t *__restrict starts = startsPtr + currentChunk;
-      for (; totalStart >= starts[1]; currentChunk++, starts++) // we first need to find chunk where unfinished work starts
-        ;
-      // NAU_CORE_DEBUG_LF("{}:current chunk is {}, which starts at {} has size of {}",threadId, currentChunk, *starts, starts[1]-starts[0]);
-
-      const Query &__restrict query = info->query;
-      NAU_FAST_ASSERT(currentChunk < query.chunksCount());
-      QueryView jobView = query.getView(info->mgr, info->userData, 0, 0, 0, worker_id);
-      jobView.componentData = query.getChunkData(currentChunk);
-      for (int workLeft = totalCount; workLeft > 0;)
-      {
-        const int chunkStartsAt = *starts;
-        const int chunkStart = totalStart - chunkStartsAt;
-        const int chunkWork = std::min((int)(starts[1]) - totalStart, workLeft);
-        // NAU_CORE_DEBUG_LF("{}:perform on chunk {} c_i {} c_size {}",threadId, currentChunk, chunkStart, chunkWork);
-
-        NAU_FAST_ASSERT(currentChunk < query.chunksCount() &&
-                      uint32_t(chunkStart) + uint32_t(chunkWork) <= info->query.chunkEntitiesCnt[currentChunk]);
-        jobView.chunkEntitiesStart = chunkStart;
-        jobView.chunkEntitiesEnd = chunkStart + chunkWork;
-        info->fun(jobView);
-        if (chunkWork != workLeft) // work goes to next chunk, overlap
-        {
-          ++starts;
-          ++currentChunk; // will be done anyway on next loop, only needed for NAU_FAST_ASSERT to be correct
-          jobView.componentData = info->query.getChunkData(currentChunk);
-        }
-        workLeft -= chunkWork;
-        totalStart += chunkWork;
-      }
-    }
+    NAU_FAST_ASSERT(chunk < query.chunksCount());
+    const uint32_t chunkEnd = eastl::min(end, starts[chunk + 1]);
+    jobView.componentData = query.getChunkData(chunk);
+    jobView.chunkEntitiesStart = begin - starts[chunk];
+    jobView.chunkEntitiesEnd = chunkEnd - starts[chunk];
+    info.fun(jobView);
+    begin = chunkEnd;
+    ++chunk;
   }
-  static uint32_t getChunkSize(const Query &q, int ci) { return q.chunkEntitiesCnt[ci]; }
-
-  void doJob() { perform_fun(parent, parent->starts.data(), workerId); }
-};
-
-static constexpr int num_jobs_to_wake_up_all = 2; // it is faster to wake up 2 thread workers one-by-one, than wake up all
+}
 
-static __forceinline void parallel_for(int num_jobs, EntityManager &mgr, const query_cb_t &fun, const Query &pQuery, void *user_data, int min_quant /*, threadpool::JobPriority tpprio */)
+static __forceinline void parallel_for(int num_jobs, EntityManager &mgr, const query_cb_t &fun, const Query &pQuery, void *user_data, int min_quant)
 {
-  // NAU_CORE_DEBUG_LF("start working on {:p}[{}] == {}({})", &pQuery, chunk, cnt);
-  alignas(ESJob) char jobStorage[MAX_ES_JOBS * sizeof(ESJob)];
-  ESJob *jobs = (ESJob *)jobStorage;
-  JobInfo info(mgr, pQuery, fun, user_data, min_quant);
   TIME_PROFILE(ecs_parallel_for_query);
+  JobInfo info(mgr, pQuery, fun, user_data);
   const uint32_t chunksCount = pQuery.chunksCount();
   info.starts.resize(chunksCount + 1);
   uint32_t querySize = 0;
   for (uint32_t ci = 0; ci < chunksCount; ++ci)
   {
     info.starts[ci] = querySize;
-    querySize += ESJob::getChunkSize(pQuery, ci);
+    querySize += pQuery.chunkEntitiesCnt[ci];
   }
-  info.starts[chunksCount] = info.totalSize = querySize; // we have to copy querySize to info.totalSize. &query will die before thread
-                                                         // exits
-
-  num_jobs = std::min(num_jobs, (int)MAX_ES_JOBS);
-  // NAU_CORE_DEBUG_LF("num_jobs = {}", num_jobs);
-  uint32_t queue_pos = 0;
-
-  auto jobFactory = [&](ESJob* j) -> nau::async::Task<>
-  {
-      co_await nau::async::Executor::getDefault();
-      j->doJob();
-  };
-
-  eastl::vector<nau::async::Task<>> tasks;
-
- // auto wakeOnAdd = num_jobs <= num_jobs_to_wake_up_all ? threadpool::AddFlags::WakeOnAdd : threadpool::AddFlags::None;
-  {
-    // TIME_PROFILE(add);
-    for (int i = 0; i < num_jobs; ++i)
-    {
-      ESJob *j = new (jobs + i/*, _NEW_INPLACE*/) ESJob(&info, i + 1);
-      tasks.push_back(jobFactory(j));
-      //threadpool::add(j, tpprio, queue_pos, wakeOnAdd | threadpool::AddFlags::IgnoreNotDone); // job->done == 1 for sure
-    }
-  }
-  //if (wakeOnAdd == threadpool::AddFlags::None)
-  //{
-  //  // TIME_PROFILE(wake);
-  //  threadpool::wake_up_all();
-  //}
-  // NAU_CORE_DEBUG_LF("jobs added start is {} ({})",
-  //   info.work_started.load(std::memory_order_acquire), cnt);
-  {
-    // TIME_PROFILE(active_wait);
-    ESJob::perform_fun(&info, info.starts.data(), 0);
-  }
-  // todo: we can use just active wait, instead of barrier active wait, if we are running from non main thread
-  // it reflects the following assumption, when we run from main thread our primary goal is to reduce latency, if we run from other
-  // threads - our goal is to increase occupancy
-  //threadpool::barrier_active_wait_for_job(&jobs[num_jobs - 1], tpprio, queue_pos); // make sure we have captured all jobs
-  // NAU_CORE_DEBUG_LF("all work scheduled {} done = ({})",
-  //   info.work_started.load(std::memory_order_acquire), cnt);
-  TIME_PROFILE_WAIT_DEV("ecs_pfor_wait");
-
- // for (int i = 0; i < num_jobs; ++i) // ensure all other jobs are also finished
- //   threadpool::wait(&jobs[i]);
-  auto awaiter = [&tasks]() -> nau::async::Task<>
-  {
-      co_await nau::async::Executor::getDefault();
-      co_await nau::async::whenAll(tasks, nau::Expiration::never());
-  }();
+  info.starts[chunksCount] = querySize;
 
-  nau::async::wait(awaiter);
+  // fork-join: caller thread processes ranges as well, and returns when all of them are done
+  nau::threading::parallelFor(querySize, min_quant,
+    [&info](uint32_t begin, uint32_t end, uint32_t worker_id) { perform_range(info, begin, end, worker_id); },
+    std::min(num_jobs, (int)MAX_ES_JOBS));
 }
 
 void EntityManager::setMaxUpdateJobs(uint32_t num_jobs) { maxNumJobsSet = std::min(num_jobs, (uint32_t)MAX_ES_JOBS); }
 
 void EntityManager::updateCurrentUpdateMaxJobs()
 {
-    maxNumJobs = std::min((uint32_t)std::max(int(/*threadpool::get_num_workers()) TODO Uncomment or delete */ 100), int(0)), maxNumJobsSet);
+    maxNumJobs = std::min(nau::threading::getParallelForWorkersCount(), maxNumJobsSet);
 }
 
 bool EntityManager::performMTQuery(const Query &pQuery, const query_cb_t &fun, void *user_data, int min_quant)
@@ -210,10 +100,7 @@ bool EntityManager::performMTQuery(const Query &pQuery, const query_cb_t &fun, v
     return false;
   setConstrainedMTMode(true);
   ECS_LOG("start for {} jobs {} quant do: {}", numJobs, min_quant, pQuery.totalSize);
-  //threadpool::JobPriority tpprio = isMainThread ? threadpool::PRIO_HIGH : threadpool::PRIO_NORMAL; // Note: this probably need to be
-  //                                                                                                 // configured per ES
-  // TODO Uncomment or delete
-  parallel_for(numJobs, *this, fun, pQuery, user_data, min_quant /*, tpprio*/);
+  parallel_for(numJobs, *this, fun, pQuery, user_data, min_quant);
   // NAU_CORE_DEBUG_LF("done");
   setConstrainedMTMode(false);
   return true;
@@ -0,0 +1,476 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <daECS/core/entityManager.h>
+#include <daECS/core/baseIo.h>
+#include <daECS/core/componentTypes.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/numeric_limits.h>
+#include "ecsQueryInternal.h"
+
+// Snapshot layout (all counts are write_compressed):
+//  header: magic, version
+//  templates: count, names
+//  entities: blocks count, for each block (archetype) - entities count, raw eids, template index per entity
+//  components: for each block - columns count, columns descs, then columns data in block entities order
+//    raw column - values of all block entities as-is (memcpy of chunk lines)
+//    serialized column - size of the column data in bits (uint64), then values written one by one with component serializer
+namespace ecs
+{
+
+static constexpr uint32_t SNAPSHOT_MAGIC = 0x53534345; // 'ECSS'
+static constexpr uint32_t SNAPSHOT_VERSION = 2;
+static constexpr uint32_t SNAPSHOT_MAX_TEMPLATE_NAME = 1024;
+
+enum class SnapshotColumn : uint8_t
+{
+  Raw,
+  Serialized
+};
+
+struct SnapshotColumnDesc
+{
+  component_t name;
+  component_type_t type;
+  uint16_t size;
+  SnapshotColumn mode;
+};
+
+// continuous range of block entities, which are placed continuously in one chunk
+struct SnapshotRun
+{
+  archetype_t archetype; // INVALID_ARCHETYPE for skipped entities
+  chunk_type_t chunkId;
+  uint32_t idInChunk;
+  uint32_t count;
+};
+
+template <typename T>
+static inline void write_value(SerializerCb &cb, const T &v)
+{
+  cb.write(&v, sizeof(T) * CHAR_BIT, 0);
+}
+
+template <typename T>
+static inline bool read_value(const DeserializerCb &cb, T &v)
+{
+  return cb.read(&v, sizeof(T) * CHAR_BIT, 0);
+}
+
+static inline bool write_count(SerializerCb &cb, size_t count)
+{
+  NAU_ASSERT_RETURN(count <= eastl::numeric_limits<uint32_t>::max(), false, "snapshot count {} doesn't fit into 32 bits", count);
+  write_compressed(cb, uint32_t(count));
+  return true;
+}
+
+static bool skip_bits(const DeserializerCb &cb, uint64_t bits)
+{
+  uint8_t scratch[4096];
+  for (uint64_t len; bits; bits -= len)
+  {
+    len = eastl::min(bits, uint64_t(sizeof(scratch) * CHAR_BIT));
+    if (!cb.read(scratch, len, 0))
+      return false;
+  }
+  return true;
+}
+
+// counts written bits only, used to prefix serialized columns with their size
+struct SnapshotBitsCounter final : public SerializerCb
+{
+  uint64_t bits = 0;
+  void write(const void *, size_t sz_in_bits, component_type_t) override { bits += sz_in_bits; }
+};
+
+bool EntityManager::saveSnapshot(SerializerCb &cb)
+{
+  NAU_ASSERT_RETURN(!isConstrainedMTMode() && nestedQuery == 0, false, "snapshot can't be saved within queries or in MT mode");
+  TIME_PROFILE(ecs_save_snapshot);
+  performDelayedCreation(true);
+
+  eastl::vector<uint32_t> savedArchetypes;
+  eastl::vector<uint32_t> templateIndices(templates.size(), ~0u);
+  eastl::vector<template_t> savedTemplates;
+  for (uint32_t archetype = 0, archetypesCount = archetypes.size(); archetype < archetypesCount; ++archetype)
+  {
+    bool hasEntities = false;
+    for (const auto &chunk : archetypes.getArchetype(archetype).manager.getChunksConst())
+    {
+      const EntityId *eids = (const EntityId *)chunk.getData();
+      for (const EntityId *eid = eids, *eidE = eids + chunk.getUsed(); eid != eidE; ++eid)
+      {
+        const template_t templId = entDescs[eid->index()].template_id;
+        if (templateIndices[templId] == ~0u)
+        {
+          templateIndices[templId] = savedTemplates.size();
+          savedTemplates.push_back(templId);
+        }
+      }
+      hasEntities |= chunk.getUsed() != 0;
+    }
+    if (hasEntities)
+      savedArchetypes.push_back(archetype);
+  }
+
+  write_value(cb, SNAPSHOT_MAGIC);
+  write_value(cb, SNAPSHOT_VERSION);
+
+  if (!write_count(cb, savedTemplates.size()))
+    return false;
+  for (template_t templId : savedTemplates)
+    write_string(cb, getTemplateName(templId), SNAPSHOT_MAX_TEMPLATE_NAME);
+
+  if (!write_count(cb, savedArchetypes.size()))
+    return false;
+  for (uint32_t archetype : savedArchetypes)
+  {
+    const auto &manager = archetypes.getArchetype(archetype).manager;
+    uint32_t entitiesCount = 0;
+    for (const auto &chunk : manager.getChunksConst())
+      entitiesCount += chunk.getUsed();
+    write_compressed(cb, entitiesCount);
+    for (const auto &chunk : manager.getChunksConst())
+      if (chunk.getUsed())
+        cb.write(chunk.getData(), chunk.getUsed() * sizeof(EntityId) * CHAR_BIT, 0);
+    for (const auto &chunk : manager.getChunksConst())
+    {
+      const EntityId *eids = (const EntityId *)chunk.getData();
+      for (const EntityId *eid = eids, *eidE = eids + chunk.getUsed(); eid != eidE; ++eid)
+        write_compressed(cb, templateIndices[entDescs[eid->index()].template_id]);
+    }
+  }
+
+  eastl::vector<SnapshotColumnDesc> columns;
+  eastl::vector<uint32_t> columnIds;
+  eastl::vector<ComponentSerializer *> columnIO;
+  for (uint32_t archetype : savedArchetypes)
+  {
+    columns.clear();
+    columnIds.clear();
+    columnIO.clear();
+    const component_index_t *componentIndices = archetypes.componentIndices(archetype);
+    for (uint32_t i = 1, componentsCount = archetypes.getComponentsCount(archetype); i < componentsCount; ++i) // 0 is eid
+    {
+      const component_index_t cidx = componentIndices[i];
+      const DataComponent dc = dataComponents.getComponentById(cidx);
+      const ComponentType typeInfo = componentTypes.getTypeInfo(dc.componentType);
+      ComponentSerializer *io = nullptr;
+      SnapshotColumn mode = SnapshotColumn::Raw;
+      if (!is_pod(typeInfo.flags) || (typeInfo.flags & COMPONENT_TYPE_BOXED))
+      {
+        io = dataComponents.getComponentIO(cidx);
+        if (!io && has_io(typeInfo.flags))
+          io = componentTypes.getTypeIO(dc.componentType);
+        if (!io) // can't be saved, will be created from template on load
+          continue;
+        mode = SnapshotColumn::Serialized;
+      }
+      columns.push_back(SnapshotColumnDesc{dataComponents.getComponentTpById(cidx), dc.componentTypeName, typeInfo.size, mode});
+      columnIds.push_back(i);
+      columnIO.push_back(io);
+    }
+
+    if (!write_count(cb, columns.size()))
+      return false;
+    for (const SnapshotColumnDesc &column : columns)
+    {
+      write_value(cb, column.name);
+      write_value(cb, column.type);
+      write_value(cb, column.size);
+      write_value(cb, column.mode);
+    }
+
+    const auto &manager = archetypes.getArchetype(archetype).manager;
+    const uint16_t *offsets = archetypes.componentDataOffsets(archetype);
+    for (uint32_t c = 0; c < columns.size(); ++c)
+    {
+      const SnapshotColumnDesc &column = columns[c];
+      const type_index_t typeId = dataComponents.getComponentById(componentIndices[columnIds[c]]).componentType;
+      const bool isBoxed = componentTypes.getTypeInfo(typeId).flags & COMPONENT_TYPE_BOXED;
+      if (column.mode == SnapshotColumn::Raw)
+      {
+        for (const auto &chunk : manager.getChunksConst())
+          if (chunk.getUsed() && column.size)
+            cb.write(chunk.getCompDataUnsafe(offsets[columnIds[c]]), chunk.getUsed() * column.size * CHAR_BIT, column.type);
+        continue;
+      }
+      auto serializeColumn = [&](SerializerCb &to) {
+        for (const auto &chunk : manager.getChunksConst())
+        {
+          const uint8_t *data = chunk.getCompDataUnsafe(offsets[columnIds[c]]);
+          for (const uint8_t *value = data, *valueE = data + chunk.getUsed() * column.size; value != valueE; value += column.size)
+            columnIO[c]->serialize(to, isBoxed ? *(void *const *)value : value, column.size, column.type);
+        }
+      };
+      // size prefix lets the loader skip the column, when the component is missing or has other type
+      SnapshotBitsCounter counter;
+      serializeColumn(counter);
+      write_value(cb, counter.bits);
+      serializeColumn(cb);
+    }
+  }
+  return true;
+}
+
+void EntityManager::claimSnapshotEids(eastl::vector<EntityId> &eids)
+{
+  uint32_t maxIndex = 0;
+  for (EntityId eid : eids)
+    maxIndex = eastl::max(maxIndex, eid.index());
+
+  eastl::bitvector<> freeSlots(maxIndex + 1, false);
+  for (entity_id_t eid : freeIndices)
+    if ((eid & ENTITY_INDEX_MASK) <= maxIndex)
+      freeSlots.set(eid & ENTITY_INDEX_MASK, true);
+  for (entity_id_t eid : freeIndicesReserved)
+    if ((eid & ENTITY_INDEX_MASK) <= maxIndex)
+      freeSlots.set(eid & ENTITY_INDEX_MASK, true);
+  for (uint32_t idx = nextResevedEidIndex; idx <= eastl::min(maxIndex, MAX_RESERVED_EID_IDX_CONST); ++idx)
+    freeSlots.set(idx, true);
+  for (uint32_t idx = eastl::max(entDescs.size(), MAX_RESERVED_EID_IDX_CONST + 1); idx <= maxIndex; ++idx)
+    freeSlots.set(idx, true);
+
+  eastl::bitvector<> claimed(maxIndex + 1, false);
+  uint32_t skipped = 0;
+  uint32_t maxClaimed = 0, maxClaimedReserved = 0;
+  for (EntityId &eid : eids)
+  {
+    const uint32_t idx = eid.index();
+    if (idx == 0 || !freeSlots[idx] || claimed[idx])
+    {
+      skipped += eid != INVALID_ENTITY_ID;
+      eid = INVALID_ENTITY_ID;
+      continue;
+    }
+    claimed.set(idx, true);
+    if (idx <= MAX_RESERVED_EID_IDX_CONST)
+      maxClaimedReserved = eastl::max(maxClaimedReserved, idx);
+    else
+      maxClaimed = eastl::max(maxClaimed, idx);
+  }
+  if (skipped)
+    logerr("{} snapshot entities are skipped, as their ids are already used", skipped);
+
+  // allocate slots up to claimed ones, the rest becomes free
+  for (; nextResevedEidIndex <= maxClaimedReserved; ++nextResevedEidIndex)
+  {
+    entDescs[nextResevedEidIndex].generation = entDescs.globalGen;
+    if (!claimed[nextResevedEidIndex])
+      freeIndicesReserved.push_back(make_eid(nextResevedEidIndex, entDescs.globalGen));
+  }
+  while (entDescs.size() <= maxClaimed)
+  {
+    const uint32_t idx = entDescs.push_back();
+    entDescs[idx].generation = entDescs.globalGen;
+    if (!claimed[idx])
+      freeIndices.push_back(make_eid(idx, entDescs.globalGen));
+  }
+  auto isClaimed = [&claimed](entity_id_t eid) {
+    const uint32_t idx = eid & ENTITY_INDEX_MASK;
+    return idx < claimed.size() && claimed[idx];
+  };
+  freeIndices.erase(eastl::remove_if(freeIndices.begin(), freeIndices.end(), isClaimed), freeIndices.end());
+  freeIndicesReserved.erase(eastl::remove_if(freeIndicesReserved.begin(), freeIndicesReserved.end(), isClaimed),
+    freeIndicesReserved.end());
+
+  for (EntityId eid : eids)
+    if (eid != INVALID_ENTITY_ID)
+      entDescs[eid.index()].generation = eid.generation();
+}
+
+bool EntityManager::loadSnapshot(const DeserializerCb &cb)
+{
+  NAU_ASSERT_RETURN(!isConstrainedMTMode() && nestedQuery == 0, false, "snapshot can't be loaded within queries or in MT mode");
+  TIME_PROFILE(ecs_load_snapshot);
+  performDelayedCreation(true);
+
+  uint32_t magic = 0, version = 0;
+  if (!read_value(cb, magic) || !read_value(cb, version) || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION)
+  {
+    logerr("invalid snapshot header (magic 0x{:x}, version {}), expected version {}", magic, version, SNAPSHOT_VERSION);
+    return false;
+  }
+
+  uint32_t templatesCount = 0;
+  if (!read_compressed(cb, templatesCount))
+    return false;
+  eastl::vector<template_t> snapshotTemplates(templatesCount, INVALID_TEMPLATE_INDEX);
+  for (template_t &templId : snapshotTemplates)
+  {
+    char name[SNAPSHOT_MAX_TEMPLATE_NAME];
+    if (read_string(cb, name, sizeof(name)) < 0)
+      return false;
+    templId = templateByName(name);
+  }
+
+  uint32_t blocksCount = 0;
+  if (!read_compressed(cb, blocksCount))
+    return false;
+  eastl::vector<uint32_t> blockStarts(blocksCount + 1, 0);
+  eastl::vector<EntityId> eids;
+  eastl::vector<template_t> eidTemplates;
+  for (uint32_t block = 0; block < blocksCount; ++block)
+  {
+    uint32_t entitiesCount = 0;
+    if (!read_compressed(cb, entitiesCount) || entitiesCount > eastl::numeric_limits<uint32_t>::max() - eids.size())
+      return false;
+    const uint32_t first = uint32_t(eids.size());
+    blockStarts[block + 1] = first + entitiesCount;
+    eids.resize(first + entitiesCount);
+    eidTemplates.resize(first + entitiesCount);
+    if (entitiesCount && !cb.read(eids.data() + first, entitiesCount * sizeof(EntityId) * CHAR_BIT, 0))
+      return false;
+    for (uint32_t i = first; i < first + entitiesCount; ++i)
+    {
+      uint32_t templIndex = 0;
+      if (!read_compressed(cb, templIndex) || templIndex >= templatesCount)
+        return false;
+      eidTemplates[i] = snapshotTemplates[templIndex];
+      if (eidTemplates[i] == INVALID_TEMPLATE_INDEX) // error is already logged by templateByName
+        eids[i] = INVALID_ENTITY_ID;
+    }
+  }
+
+  claimSnapshotEids(eids);
+
+  {
+    TIME_PROFILE(ecs_load_snapshot_create);
+    ComponentsInitializer noInitializer;
+    for (uint32_t i = 0; i < eids.size(); ++i)
+    {
+      const EntityId eid = eids[i];
+      if (eid == INVALID_ENTITY_ID)
+        continue;
+      if (requestResources(eid, INVALID_ARCHETYPE, eidTemplates[i], noInitializer, RequestResourcesType::SYNC) ==
+          RequestResources::Error)
+      {
+        logerr("snapshot creation of entity {} eid ({}) failed, as some resources are missing", eid, getTemplateName(eidTemplates[i]));
+        destroyEntityImmediate(eid);
+        eids[i] = INVALID_ENTITY_ID;
+        continue;
+      }
+      createEntityInternal(eid, eidTemplates[i], ComponentsInitializer(), ComponentsMap(), create_entity_async_cb_t());
+    }
+  }
+
+  if (!loadSnapshotComponents(cb, eids, blockStarts))
+  {
+    // roll back, so the world doesn't keep half-restored entities: created ones are destroyed and their ids become free again
+    for (EntityId eid : eids)
+      if (eid != INVALID_ENTITY_ID && doesEntityExist(eid))
+        destroyEntityImmediate(eid);
+    return false;
+  }
+  return true;
+}
+
+bool EntityManager::loadSnapshotComponents(const DeserializerCb &cb, const eastl::vector<EntityId> &eids,
+  const eastl::vector<uint32_t> &blockStarts)
+{
+  const uint32_t blocksCount = uint32_t(blockStarts.size() - 1);
+  eastl::vector<SnapshotColumnDesc> columns;
+  eastl::vector<SnapshotRun> runs;
+  for (uint32_t block = 0; block < blocksCount; ++block)
+  {
+    uint32_t columnsCount = 0;
+    if (!read_compressed(cb, columnsCount))
+      return false;
+    columns.resize(columnsCount);
+    for (SnapshotColumnDesc &column : columns)
+      if (!read_value(cb, column.name) || !read_value(cb, column.type) || !read_value(cb, column.size) || !read_value(cb, column.mode))
+        return false;
+
+    // entities could be created in other order or moved by creation events, so find where they are now
+    runs.clear();
+    for (uint32_t i = blockStarts[block]; i < blockStarts[block + 1]; ++i)
+    {
+      SnapshotRun run{INVALID_ARCHETYPE, 0, 0, 1};
+      if (eids[i] != INVALID_ENTITY_ID && doesEntityExist(eids[i]) && entDescs[eids[i].index()].archetype != INVALID_ARCHETYPE)
+      {
+        const EntityDesc &desc = entDescs[eids[i].index()];
+        run = SnapshotRun{desc.archetype, desc.chunkId, desc.idInChunk, 1};
+      }
+      SnapshotRun *last = runs.empty() ? nullptr : &runs.back();
+      if (last && last->archetype == run.archetype &&
+          (run.archetype == INVALID_ARCHETYPE || (last->chunkId == run.chunkId && last->idInChunk + last->count == run.idInChunk)))
+        last->count++;
+      else
+        runs.push_back(run);
+    }
+
+    for (const SnapshotColumnDesc &column : columns)
+    {
+      uint64_t serializedBits = 0;
+      if (column.mode == SnapshotColumn::Serialized && !read_value(cb, serializedBits))
+        return false;
+
+      component_index_t cidx = dataComponents.findComponentId(column.name);
+      ComponentSerializer *io = nullptr;
+      bool isBoxed = false;
+      if (cidx != INVALID_COMPONENT_INDEX)
+      {
+        const DataComponent dc = dataComponents.getComponentById(cidx);
+        const ComponentType typeInfo = componentTypes.getTypeInfo(dc.componentType);
+        if (dc.componentTypeName != column.type || typeInfo.size != column.size)
+        {
+          logwarn("snapshot component <{}> has different type, it is not restored", dataComponents.getComponentNameById(cidx));
+          cidx = INVALID_COMPONENT_INDEX;
+        }
+        else if (column.mode == SnapshotColumn::Serialized)
+        {
+          io = dataComponents.getComponentIO(cidx);
+          if (!io && has_io(typeInfo.flags))
+            io = componentTypes.getTypeIO(dc.componentType);
+          isBoxed = typeInfo.flags & COMPONENT_TYPE_BOXED;
+          if (!io)
+            cidx = INVALID_COMPONENT_INDEX;
+        }
+      }
+
+      if (column.mode == SnapshotColumn::Serialized && cidx == INVALID_COMPONENT_INDEX)
+      {
+        if (!skip_bits(cb, serializedBits))
+        {
+          logerr("snapshot is truncated or corrupted, component 0x{:x} can't be read", column.name);
+          return false;
+        }
+        continue;
+      }
+
+      for (const SnapshotRun &run : runs)
+      {
+        uint8_t *data = nullptr;
+        if (run.archetype != INVALID_ARCHETYPE && cidx != INVALID_COMPONENT_INDEX)
+        {
+          const archetype_component_id componentId = archetypes.getArchetypeComponentIdUnsafe(run.archetype, cidx);
+          if (componentId != INVALID_ARCHETYPE_COMPONENT_ID)
+            data = archetypes.getArchetype(run.archetype)
+                     .manager.getChunk(run.chunkId)
+                     .getCompDataUnsafe(archetypes.componentDataOffsets(run.archetype)[componentId]) +
+                   run.idInChunk * column.size;
+        }
+
+        bool ok = true;
+        if (column.mode == SnapshotColumn::Raw)
+          ok = data ? cb.read(data, run.count * column.size * CHAR_BIT, column.type)
+                    : skip_bits(cb, uint64_t(run.count) * column.size * CHAR_BIT);
+        else if (data)
+          for (uint8_t *value = data, *valueE = data + run.count * column.size; ok && value != valueE; value += column.size)
+            ok = io->deserialize(cb, isBoxed ? *(void **)value : value, column.size, column.type);
+        else
+          for (uint32_t i = 0; ok && i < run.count; ++i)
+            ok = bool(deserialize_init_component_typeless(column.type, cidx, cb)); // read and drop (entity is skipped)
+        if (!ok)
+        {
+          logerr("snapshot is truncated or corrupted, component 0x{:x} can't be read", column.name);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace ecs
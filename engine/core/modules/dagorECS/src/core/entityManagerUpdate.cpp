@@ -6,6 +6,7 @@
 #include <daECS/core/entitySystem.h>
 #include "entityManagerEvent.h"
 #include "ecsPerformQueryInline.h"
+#include "nau/threading/parallel_for.h"
 
 
 #if defined(__cplusplus) && !defined(__GNUC__)
@@ -42,6 +43,30 @@ void init_profiler_tokens()
 #endif
 }
 
+__forceinline void EntityManager::performEsUpdate(es_index_type esIndex, const UpdateStageInfo &info)
+{
+  const EntitySystemDesc &es = *esList[esIndex];
+#if TIME_PROFILER_ENABLED && DAGOR_DBGLEVEL > 0
+  DA_PROFILE_EVENT_DESC(es.dapToken);
+#else
+  NAU_CPU_SCOPED_DYNAMIC_NAME(es.name);
+#endif
+  performQueryEmptyAllowed(esListQueries[esIndex], (ESFuncType)es.ops.onUpdate, (const ESPayLoad &)info, es.userData, es.quant);
+}
+
+void EntityManager::performEsUpdateWave(const es_index_type *systems, uint32_t count, const UpdateStageInfo &info)
+{
+  TIME_PROFILE(ecs_parallel_es_wave);
+  // current thread takes its share of systems as well
+  nau::threading::parallelFor(
+    count, 1,
+    [&](uint32_t begin, uint32_t end, uint32_t) {
+      for (uint32_t i = begin; i < end; ++i)
+        performEsUpdate(systems[i], info);
+    },
+    MAX_POSSIBLE_WORKERS_COUNT);
+}
+
 void EntityManager::update(const ecs::UpdateStageInfo &info)
 {
   NAU_ASSERT(lastEsGen == EntitySystemDesc::generation, "setEsOrder was not called");
@@ -55,20 +80,43 @@ void EntityManager::update(const ecs::UpdateStageInfo &info)
   DA_PROFILE_EVENT_DESC(dap_stage_tokens[eastl::min(info.stage, (int)US_COUNT)]);
 #endif
   createQueuedEntities(); // if entities were scheduled for creation outside ES
-  for (auto esIndex : esUpdates[info.stage])
-  {
-    const EntitySystemDesc &es = *esList[esIndex];
-    {
-#if TIME_PROFILER_ENABLED && DAGOR_DBGLEVEL > 0
-      DA_PROFILE_EVENT_DESC(es.dapToken);
-#endif
-      performQueryEmptyAllowed(esListQueries[esIndex], (ESFuncType)es.ops.onUpdate, (const ESPayLoad &)info, es.userData, es.quant);
-    }
+  auto sendEventsBetweenES = [this]() {
     if (!isConstrainedMTMode())
     {
       if (current_tick_events < average_tick_events_uint) // let's try to send events as early, as possible
         sendQueuedEvents(average_tick_events_uint - current_tick_events);
     }
+  };
+  if (parallelEsUpdate && !isConstrainedMTMode())
+  {
+    const EsUpdateSchedule &schedule = esUpdateSchedules[info.stage];
+    const es_index_set &registeredSystems = esUpdates[info.stage];
+    eastl::fixed_vector<es_index_type, 64, true> waveSystems;
+    for (uint32_t wave = 0; wave + 1 < schedule.waveStarts.size(); ++wave)
+    {
+      waveSystems.clear();
+      for (uint32_t i = schedule.waveStarts[wave], ie = schedule.waveStarts[wave + 1]; i < ie; ++i)
+        if (registeredSystems.count(schedule.systems[i]))
+          waveSystems.push_back(schedule.systems[i]);
+      if (waveSystems.empty())
+        continue;
+      if (waveSystems.size() == 1)
+        performEsUpdate(waveSystems[0], info);
+      else
+      {
+        ScopeSetMtConstrained mtConstrained(*this);
+        performEsUpdateWave(waveSystems.data(), waveSystems.size(), info);
+      }
+      sendEventsBetweenES();
+    }
+  }
+  else
+  {
+    for (auto esIndex : esUpdates[info.stage])
+    {
+      performEsUpdate(esIndex, info);
+      sendEventsBetweenES();
+    }
   }
   if (hasQueuedEntitiesCreation())
     performDelayedCreation(false); // we try to destroy queued entities after each query, asap
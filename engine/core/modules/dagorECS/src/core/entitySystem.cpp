@@ -428,6 +428,40 @@ void EntityManager::resetEsOrder()
       esListQueries[j] = esList[j]->emptyES ? QueryId() : createUnresolvedQuery(*esList[j]);
 
     registerEsEvents();
+
+    // explicit order between ES is a path between them in the graph (directly or via sync points)
+    eastl::vector<int, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> esGraphNodes;
+    esGraphNodes.resize(esList.size(), -1);
+    for (int i = 0; i < prio.size(); ++i)
+      if (prio[i].id < esToGraphNodeMap.size())
+        esGraphNodes[i] = esToGraphNodeMap[prio[i].id];
+    eastl::vector<eastl::bitvector<>> reachableNodes(esList.size()); // calculated on demand, only for ES with stages
+    eastl::vector<int, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> nodesStack;
+    auto esOrdered = [&](es_index_type from, es_index_type to) {
+      const int fromNode = esGraphNodes[from], toNode = esGraphNodes[to];
+      if (fromNode < 0 || toNode < 0)
+        return false;
+      eastl::bitvector<> &reachable = reachableNodes[from];
+      if (reachable.empty())
+      {
+        reachable.resize(graphNodesCount, false);
+        nodesStack.push_back(fromNode);
+        while (!nodesStack.empty())
+        {
+          const int node = nodesStack.back();
+          nodesStack.pop_back();
+          if (node < edgesFrom.size())
+            for (auto child : edgesFrom[node])
+              if (!reachable[child])
+              {
+                reachable.set(child, true);
+                nodesStack.push_back(child);
+              }
+        }
+      }
+      return bool(reachable[toNode]);
+    };
+    buildEsUpdateSchedules(esOrdered);
     // todo: change esUpdates based on current entities
     // todo: validate hash collision in es (i.e. component_t collides with hash in componentDesc)
     /*
@@ -458,6 +492,98 @@ void EntityManager::enableES(const char *es_name, bool on)
     resetEsOrder();
   }
 }
+static bool has_common_components(nau::ConstSpan<ComponentDesc> a, nau::ConstSpan<ComponentDesc> b)
+{
+  for (const ComponentDesc &ca : a)
+    for (const ComponentDesc &cb : b)
+      if (ca.name == cb.name)
+        return true;
+  return false;
+}
+
+bool EntityManager::isEsUpdateConflicting(es_index_type a, es_index_type b) const
+{
+  const EntitySystemDesc &esA = *esList[a], &esB = *esList[b];
+  return has_common_components(esA.componentsRW, esB.componentsRW) || has_common_components(esA.componentsRW, esB.componentsRO) ||
+         has_common_components(esA.componentsRO, esB.componentsRW);
+}
+
+bool EntityManager::isEsUpdateBarrier(es_index_type esIndex) const
+{
+  // empty ES can access anything, ES with quant is already run in parallel on its own
+  const EntitySystemDesc &es = *esList[esIndex];
+  return es.emptyES || es.quant != 0 || (es.componentsRW.empty() && es.componentsRO.empty());
+}
+
+void EntityManager::buildEsUpdateSchedules(const eastl::function<bool(es_index_type, es_index_type)> &es_ordered)
+{
+  esUpdateSchedules.clear();
+  esUpdateSchedules.resize(esUpdates.size());
+  eastl::vector<es_index_type, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> stageSystems;
+  eastl::vector<int, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> waves;
+  for (uint32_t stage = 0; stage < esUpdateSchedules.size(); ++stage)
+  {
+    // all ES of the stage, not only registered ones: ES is registered in esUpdates once its query matches any archetype
+    stageSystems.clear();
+    for (int j = 0, ej = esList.size(); j < ej; ++j)
+      if ((esList[j]->stageMask & (1 << stage)) && !esForAllEntities[j])
+        stageSystems.push_back(es_index_type(j));
+    EsUpdateSchedule &schedule = esUpdateSchedules[stage];
+    schedule.waveStarts.assign(1, 0); // stage without ES has no waves
+    if (stageSystems.empty())
+      continue;
+
+    // each ES goes to the first wave after all preceding (by priority) ES it conflicts with
+    waves.resize(stageSystems.size());
+    int wavesCount = 0, barrierWave = -1, barrierIndex = -1;
+    for (int i = 0, ei = stageSystems.size(); i < ei; ++i)
+    {
+      const es_index_type esIndex = stageSystems[i];
+      const bool isBarrier = isEsUpdateBarrier(esIndex);
+      int wave = isBarrier ? wavesCount : barrierWave + 1;
+      if (!isBarrier)
+        for (int k = barrierIndex + 1; k < i; ++k)
+          if (waves[k] >= wave && (isEsUpdateConflicting(stageSystems[k], esIndex) || es_ordered(stageSystems[k], esIndex)))
+            wave = waves[k] + 1;
+      waves[i] = wave;
+      wavesCount = eastl::max(wavesCount, wave + 1);
+      if (isBarrier)
+      {
+        barrierWave = wave;
+        barrierIndex = i;
+      }
+    }
+
+    schedule.waveStarts.assign(wavesCount + 1, 0);
+    for (int wave : waves)
+      ++schedule.waveStarts[wave + 1];
+    for (int w = 0; w < wavesCount; ++w)
+      schedule.waveStarts[w + 1] += schedule.waveStarts[w];
+    schedule.systems.resize(stageSystems.size());
+    eastl::vector<uint16_t, /* framemem_allocator TODO Allocators.*/ EASTLAllocatorType> waveEnds(schedule.waveStarts.begin(),
+      schedule.waveStarts.end() - 1);
+    for (int i = 0, ei = stageSystems.size(); i < ei; ++i) // stable, so priority order is kept within the wave
+      schedule.systems[waveEnds[waves[i]]++] = stageSystems[i];
+
+    ECS_LOG("stage <{}>: {} ES in {} waves", stage, stageSystems.size(), wavesCount);
+
+#if NAU_DEBUG
+    // validate that ES of the same wave are independent, and conflicting ES are run in order of priority
+    for (int i = 0, ei = stageSystems.size(); i < ei; ++i)
+      for (int k = i + 1; k < ei; ++k)
+      {
+        const es_index_type a = stageSystems[i], b = stageSystems[k];
+        const bool isDependent = isEsUpdateBarrier(a) || isEsUpdateBarrier(b) || isEsUpdateConflicting(a, b) || es_ordered(a, b);
+        if (isDependent && waves[i] >= waves[k])
+        {
+          logerr("data race: ES <{}> and <{}> of stage {} are dependent, but are scheduled to waves {} and {}", esList[a]->name,
+            esList[b]->name, stage, waves[i], waves[k]);
+        }
+      }
+#endif
+  }
+}
+
 void EntityManager::setEsOrder(nau::ConstSpan<const char *> es_order, nau::ConstSpan<const char *> es_skip)
 {
   esOrder.clear();
@@ -0,0 +1,206 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <math.h>
+
+#include "daECS/core/entityManager.h"
+#include "daECS/core/entitySystem.h"
+#include "daECS/core/updateStage.h"
+#include "dag_perfTimer.h"
+#include "nau/utils/span.h"
+#include "test_ecs_common.h"
+
+// 50 systems over 10 value components: systems that write the same value are chained, the rest can run concurrently
+static constexpr ecs::ComponentDesc parallel_es_comps[] = {
+    {ECS_HASH("par_es_input"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value0"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value1"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value2"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value3"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value4"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value5"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value6"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value7"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value8"), ecs::ComponentTypeInfo<float>()},
+    {ECS_HASH("par_es_value9"), ecs::ComponentTypeInfo<float>()}
+};
+static constexpr const char* parallel_es_value_names[] = {"par_es_value0", "par_es_value1", "par_es_value2", "par_es_value3",
+                                                          "par_es_value4", "par_es_value5", "par_es_value6", "par_es_value7",
+                                                          "par_es_value8", "par_es_value9"};
+static constexpr int PARALLEL_ES_VALUES = eastl::size(parallel_es_value_names);
+static constexpr int PARALLEL_ES_COUNT = 50;
+static constexpr int PARALLEL_ES_ENTITIES = 100000;
+static constexpr int PARALLEL_ES_RUNS = 3;
+
+static void parallel_es_all(const ecs::UpdateStageInfo& info, const ecs::QueryView& components)
+{
+    const float dt = static_cast<const ecs::UpdateStageInfoAct&>(info).dt;
+    auto* __restrict value = components.getComponentRawRW<float>(0);
+    auto* __restrict valueE = value + components.end();
+    value += components.begin();
+    auto* __restrict input = components.getComponentRawRO<float>(1) + components.begin();
+    do
+    {
+        float v = ecs::getRef(value);
+        for (int i = 0; i < 8; ++i)
+        {
+            v = v * 0.5f + sinf(ecs::getRef(input) + v * dt);
+        }
+        ecs::getRef(value) = v;
+        value++;
+        input++;
+    } while (value < valueE);
+}
+
+static std::atomic<int> single_stage_es_entities = 0;
+
+static void single_stage_es_all(const ecs::UpdateStageInfo&, const ecs::QueryView& components)
+{
+    single_stage_es_entities += components.end() - components.begin();
+}
+
+namespace nau::test
+{
+    TEST_F(TestDagorECS, ParallelSystemsStage)
+    {
+        {
+            ecs::ComponentsMap map;
+            map[ECS_HASH("par_es_input")] = 0.f;
+            for (const char* name : parallel_es_value_names)
+            {
+                map[ECS_HASH_SLOW(name)] = 0.f;
+            }
+            create_template(eastl::move(map), {}, "parallelEsTemplate");
+        }
+
+        eastl::vector<ecs::EntityId> eids;
+        eids.reserve(PARALLEL_ES_ENTITIES);
+        for (int i = 0; i < PARALLEL_ES_ENTITIES; ++i)
+        {
+            ecs::ComponentsInitializer attrs;
+            ECS_INIT(attrs, "par_es_input", float(i % 1000) * 0.001f);
+            eids.push_back(g_entity_mgr->createEntitySync("parallelEsTemplate", eastl::move(attrs)));
+        }
+
+        eastl::vector<eastl::string> esNames;
+        eastl::vector<ecs::EntitySystemDesc*> systems;
+        esNames.reserve(PARALLEL_ES_COUNT);
+        for (int i = 0; i < PARALLEL_ES_COUNT; ++i)
+        {
+            const eastl::string& name = esNames.emplace_back(eastl::string::CtorSprintf(), "parallel_es_%d", i);
+            systems.push_back(new ecs::EntitySystemDesc(
+                name.c_str(),
+                ecs::EntitySystemOps(parallel_es_all),
+                make_span(parallel_es_comps + 1 + i % PARALLEL_ES_VALUES, 1) /*rw*/,
+                make_span(parallel_es_comps + 0, 1) /*ro*/,
+                empty_span(),
+                empty_span(),
+                ecs::EventSetBuilder<>::build(),
+                (1 << ecs::UpdateStageInfoAct::STAGE),
+                nullptr, nullptr, nullptr, nullptr, nullptr, 0, true));
+        }
+        g_entity_mgr->setEsOrder({}, {});
+
+        auto resetValues = [&eids]
+        {
+            for (ecs::EntityId eid : eids)
+            {
+                for (const char* name : parallel_es_value_names)
+                {
+                    g_entity_mgr->set(eid, ECS_HASH_SLOW(name), 0.f);
+                }
+            }
+        };
+        auto getChecksum = [&eids]
+        {
+            double checksum = 0;
+            for (ecs::EntityId eid : eids)
+            {
+                for (const char* name : parallel_es_value_names)
+                {
+                    checksum += g_entity_mgr->get<float>(eid, ECS_HASH_SLOW(name));
+                }
+            }
+            return checksum;
+        };
+        auto runStage = [](bool parallel)
+        {
+            g_entity_mgr->setParallelEsUpdate(parallel);
+            const int64_t reft = profile_ref_ticks();
+            for (int i = 0; i < PARALLEL_ES_RUNS; ++i)
+            {
+                g_entity_mgr->update(ecs::UpdateStageInfoAct(0.1f, 0.f));
+            }
+            return profile_time_usec(reft) / PARALLEL_ES_RUNS;
+        };
+
+        const int serialUsec = runStage(false);
+        const double serialChecksum = getChecksum();
+
+        resetValues();
+        const int parallelUsec = runStage(true);
+        const double parallelChecksum = getChecksum();
+        g_entity_mgr->setParallelEsUpdate(false);
+
+        // systems that write the same component are run in the same order in both modes
+        EXPECT_EQ(serialChecksum, parallelChecksum);
+        ECS_LOG("{} systems over {} entities: serial stage {} us, parallel stage {} us, speed-up {:.2f}", PARALLEL_ES_COUNT,
+                PARALLEL_ES_ENTITIES, serialUsec, parallelUsec, double(serialUsec) / eastl::max(parallelUsec, 1));
+
+        for (ecs::EntitySystemDesc* system : systems)
+        {
+            ecs::remove_system_from_list(system);
+            system->freeIfDynamic();
+        }
+        g_entity_mgr->setEsOrder({}, {});
+    }
+
+    /**
+        Test: parallel update of the stage that has no ES (but is followed by the stage that has) does nothing,
+        the stage with the single ES runs it once for all entities.
+     */
+    TEST_F(TestDagorECS, ParallelUpdateOfEmptyAndSingleEsStages)
+    {
+        // the systems of this test use the stage after all others, so the preceding stages have no ES
+        constexpr int SingleEsStage = ecs::US_USER;
+        static_assert(ecs::US_RENDER_TRANS < SingleEsStage);
+        constexpr int EntitiesCount = 100;
+
+        {
+            ecs::ComponentsMap map;
+            map[ECS_HASH("par_es_input")] = 0.f;
+            map[ECS_HASH("par_es_value0")] = 0.f;
+            create_template(eastl::move(map), {}, "singleStageEsTemplate");
+        }
+
+        for (int i = 0; i < EntitiesCount; ++i)
+        {
+            g_entity_mgr->createEntitySync("singleStageEsTemplate");
+        }
+
+        auto* system = new ecs::EntitySystemDesc(
+            "single_stage_es",
+            ecs::EntitySystemOps(single_stage_es_all),
+            make_span(parallel_es_comps + 1, 1) /*rw*/,
+            make_span(parallel_es_comps + 0, 1) /*ro*/,
+            empty_span(),
+            empty_span(),
+            ecs::EventSetBuilder<>::build(),
+            (1 << SingleEsStage),
+            nullptr, nullptr, nullptr, nullptr, nullptr, 0, true);
+        g_entity_mgr->setEsOrder({}, {});
+        g_entity_mgr->setParallelEsUpdate(true);
+
+        single_stage_es_entities = 0;
+        g_entity_mgr->update(ecs::UpdateStageInfoRenderTrans());
+        EXPECT_EQ(single_stage_es_entities, 0);
+
+        g_entity_mgr->update(ecs::UpdateStageInfo(SingleEsStage));
+        EXPECT_EQ(single_stage_es_entities, EntitiesCount);
+
+        g_entity_mgr->setParallelEsUpdate(false);
+        ecs::remove_system_from_list(system);
+        system->freeIfDynamic();
+        g_entity_mgr->setEsOrder({}, {});
+    }
+}  // namespace nau::test
@@ -0,0 +1,141 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "daECS/core/baseIo.h"
+#include "daECS/core/entityManager.h"
+#include "dag_perfTimer.h"
+#include "test_ecs_common.h"
+
+static constexpr int SNAPSHOT_ENTITIES = 1000000;
+static constexpr int SNAPSHOT_NAMED_ENTITIES = 1000;
+
+struct SnapshotWriter final : public ecs::SerializerCb
+{
+    eastl::vector<uint8_t> data;
+    void write(const void* from, size_t sz_in_bits, ecs::component_type_t) override
+    {
+        NAU_ASSERT(sz_in_bits % CHAR_BIT == 0);
+        data.insert(data.end(), (const uint8_t*)from, (const uint8_t*)from + sz_in_bits / CHAR_BIT);
+    }
+};
+
+struct SnapshotReader final : public ecs::DeserializerCb
+{
+    const eastl::vector<uint8_t>& data;
+    mutable size_t pos = 0;
+    SnapshotReader(const eastl::vector<uint8_t>& data_) :
+        data(data_)
+    {
+    }
+    bool read(void* to, size_t sz_in_bits, ecs::component_type_t) const override
+    {
+        const size_t size = sz_in_bits / CHAR_BIT;
+        if (pos + size > data.size())
+        {
+            return false;
+        }
+        memcpy(to, data.data() + pos, size);
+        pos += size;
+        return true;
+    }
+};
+
+namespace nau::test
+{
+    TEST_F(TestDagorECS, WorldSnapshot)
+    {
+        {
+            ecs::ComponentsMap map;
+            map[ECS_HASH("snap_value")] = 0.f;
+            map[ECS_HASH("snap_counter")] = 0;
+            map[ECS_HASH("snap_link")] = ecs::EntityId();
+            create_template(eastl::move(map), {}, "snapshotTemplate");
+        }
+        {
+            ecs::ComponentsMap map;
+            map[ECS_HASH("snap_value")] = 0.f;
+            map[ECS_HASH("snap_name")] = ecs::string();
+            create_template(eastl::move(map), {}, "snapshotNamedTemplate");
+        }
+
+        eastl::vector<ecs::EntityId> eids;
+        eids.reserve(SNAPSHOT_ENTITIES + SNAPSHOT_NAMED_ENTITIES);
+        for (int i = 0; i < SNAPSHOT_ENTITIES; ++i)
+        {
+            ecs::ComponentsInitializer attrs;
+            ECS_INIT(attrs, "snap_value", float(i) * 0.5f);
+            ECS_INIT(attrs, "snap_counter", i);
+            ECS_INIT(attrs, "snap_link", eids.empty() ? ecs::EntityId() : eids.back());
+            eids.push_back(g_entity_mgr->createEntitySync("snapshotTemplate", eastl::move(attrs)));
+        }
+        for (int i = 0; i < SNAPSHOT_NAMED_ENTITIES; ++i)
+        {
+            ecs::ComponentsInitializer attrs;
+            ECS_INIT(attrs, "snap_value", float(i));
+            ECS_INIT(attrs, "snap_name", ecs::string(eastl::string::CtorSprintf(), "named_%d", i));
+            eids.push_back(g_entity_mgr->createEntitySync("snapshotNamedTemplate", eastl::move(attrs)));
+        }
+
+        auto getChecksum = [&eids]
+        {
+            double checksum = 0;
+            for (ecs::EntityId eid : eids)
+            {
+                checksum += g_entity_mgr->get<float>(eid, ECS_HASH("snap_value"));
+                checksum += g_entity_mgr->getOr(eid, ECS_HASH("snap_counter"), 0);
+                checksum += ecs::entity_id_t(g_entity_mgr->getOr(eid, ECS_HASH("snap_link"), ecs::EntityId()));
+                checksum += strlen(g_entity_mgr->getOr(eid, ECS_HASH("snap_name"), ""));
+            }
+            return checksum;
+        };
+        const double savedChecksum = getChecksum();
+
+        SnapshotWriter writer;
+        const int64_t saveRef = profile_ref_ticks();
+        ASSERT_TRUE(g_entity_mgr->saveSnapshot(writer));
+        const int saveUsec = profile_time_usec(saveRef);
+
+        for (ecs::EntityId eid : eids)
+        {
+            g_entity_mgr->destroyEntityAsync(eid);
+        }
+        g_entity_mgr->tick(true);
+        ASSERT_FALSE(g_entity_mgr->doesEntityExist(eids.front()));
+
+        SnapshotReader reader(writer.data);
+        const int64_t loadRef = profile_ref_ticks();
+        ASSERT_TRUE(g_entity_mgr->loadSnapshot(reader));
+        const int loadUsec = profile_time_usec(loadRef);
+        EXPECT_EQ(reader.pos, writer.data.size());
+
+        for (ecs::EntityId eid : eids)
+        {
+            ASSERT_TRUE(g_entity_mgr->doesEntityExist(eid));
+        }
+        EXPECT_EQ(g_entity_mgr->get<ecs::EntityId>(eids[1], ECS_HASH("snap_link")), eids[0]);
+        EXPECT_STREQ(g_entity_mgr->get<ecs::string>(eids.back(), ECS_HASH("snap_name")).c_str(), "named_999");
+        EXPECT_EQ(savedChecksum, getChecksum());
+
+        // truncated snapshot: the load fails on the last component column and the created entities are destroyed
+        for (ecs::EntityId eid : eids)
+        {
+            g_entity_mgr->destroyEntityAsync(eid);
+        }
+        g_entity_mgr->tick(true);
+
+        const eastl::vector<uint8_t> truncatedData(writer.data.begin(), writer.data.end() - 1);
+        SnapshotReader truncatedReader(truncatedData);
+        ASSERT_FALSE(g_entity_mgr->loadSnapshot(truncatedReader));
+        EXPECT_FALSE(g_entity_mgr->doesEntityExist(eids.front()));
+        EXPECT_FALSE(g_entity_mgr->doesEntityExist(eids.back()));
+
+        // ids of the rolled back entities are free again
+        SnapshotReader retryReader(writer.data);
+        ASSERT_TRUE(g_entity_mgr->loadSnapshot(retryReader));
+        EXPECT_EQ(savedChecksum, getChecksum());
+
+        const double sizeMb = double(writer.data.size()) / (1 << 20);
+        ECS_LOG("snapshot of {} entities ({:.1f} MB): save {} us ({:.0f} MB/s), load {} us ({:.0f} entities/s)", eids.size(), sizeMb,
+                saveUsec, sizeMb * 1e6 / eastl::max(saveUsec, 1), loadUsec, double(eids.size()) * 1e6 / eastl::max(loadUsec, 1));
+    }
+}  // namespace nau::test
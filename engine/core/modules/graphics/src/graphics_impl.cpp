@@ -9,9 +9,11 @@
 #include "nau/input.h"
 #include "nau/scene/scene_manager.h"
 
+#include "graphics_assets/gpu_upload_queue.h"
 #include "graphics_assets/shader_asset.h"
 #include "graphics_assets/texture_asset.h"
 #include "nau/app/core_window_manager.h"
+#include "nau/app/global_properties.h"
 #include "nau/app/platform_window.h"
 #include "nau/app/window_manager.h"
 #include "nau/assets/asset_manager.h"
@@ -28,6 +30,7 @@
 #include "nau/shaders/shader_defines.h"
 #include "nau/service/service_provider.h"
 #include "nau/shaders/shader_globals.h"
+#include "nau/threading/lock_guard.h"
 #include "nau/ui.h"
 #include "nau/utils/performance_profiling.h"
 #include "render/daBfg/bfg.h"
@@ -109,6 +112,22 @@ public:
 static Driver3dInitCB cb;
 namespace nau
 {
+    namespace
+    {
+        /**
+            "/graphics/gpuUpload" section of the global properties.
+         */
+        struct GpuUploadConfig
+        {
+            float frameBudgetMs = 2.f;
+            size_t frameBudgetBytes = 32 * 1024 * 1024;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(frameBudgetMs),
+                CLASS_FIELD(frameBudgetBytes))
+        };
+    }  // namespace
+
     GraphicsImpl::GraphicsImpl() = default;
 
     GraphicsImpl::~GraphicsImpl() = default;
@@ -181,6 +200,11 @@ namespace nau
 
     async::Task<> GraphicsImpl::initService()
     {
+        if (eastl::optional<GpuUploadConfig> config = getServiceProvider().get<GlobalProperties>().getValue<GpuUploadConfig>("/graphics/gpuUpload"))
+        {
+            getServiceProvider().get<GpuUploadQueue>().setFrameBudget(config->frameBudgetMs, config->frameBudgetBytes);
+        }
+
         return async::makeResolvedTask();
     }
 
@@ -297,6 +321,9 @@ namespace nau
 
         for (auto& [world, scene] : m_worldToGraphicScene)
         {
+            // pipelined sync: the latest state published by the host thread, while it simulates the next frame
+            scene->applyPublishedSceneState();
+
             auto task = scene->update();
             task.detach();
         }
@@ -305,6 +332,8 @@ namespace nau
 
         co_await executeRenderJobs();
 
+        uploadGpuResources();
+
         d3d::finish_render_commands();
 
         renderMainScene();
@@ -312,14 +341,14 @@ namespace nau
         co_return true;
     }
 
-    async::Task<bool> GraphicsImpl::update([[maybe_unused]] std::chrono::milliseconds dt)
+    async::Task<bool> GraphicsImpl::update([[maybe_unused]] std::chrono::nanoseconds dt)
     {
         return renderFrame();
     }
 
     void GraphicsImpl::renderMainScene()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
 
 #if VIEWPORT_AUTO_RESIZE
         IWindowManager& wndManager = getServiceProvider().get<IWindowManager>();
@@ -407,12 +436,15 @@ namespace nau
     {
         imgui_shutdown();
 
-        for (auto& [world, scene] : m_worldToGraphicScene)
         {
-            scene.reset();
+            lock_(m_worldToGraphicSceneMutex);
+            for (auto& [world, scene] : m_worldToGraphicScene)
+            {
+                scene.reset();
+            }
+
+            m_worldToGraphicScene.clear();
         }
-       
-        m_worldToGraphicScene.clear();
         m_renderWindows.clear();
         m_defaultRenderWindow.reset();
 
@@ -439,7 +471,10 @@ namespace nau
         if (worldEntry == m_worldToGraphicScene.end())
         {
             [[maybe_unused]] bool emplaceOk;
-            eastl::tie(worldEntry, emplaceOk) = m_worldToGraphicScene.emplace(worldUid, eastl::make_unique<GraphicsScene>(worldUid));
+            {
+                lock_(m_worldToGraphicSceneMutex);
+                eastl::tie(worldEntry, emplaceOk) = m_worldToGraphicScene.emplace(worldUid, eastl::make_unique<GraphicsScene>(worldUid));
+            }
             co_await worldEntry->second->initialize();
         }
 
@@ -464,6 +499,22 @@ namespace nau
         imgui_copy_render_data();
     }
 
+    void GraphicsImpl::publishSceneState(uint64_t frameIndex)
+    {
+        {
+            lock_(m_worldToGraphicSceneMutex);
+            for (auto& [world, scene] : m_worldToGraphicScene)
+            {
+                if (scene)
+                {
+                    scene->publishSceneState(frameIndex);
+                }
+            }
+        }
+
+        imgui_copy_render_data();
+    }
+
     async::Executor::Ptr GraphicsImpl::getPreRenderExecutor()
     {
         return m_preRenderWorkQueue;
@@ -508,6 +559,20 @@ namespace nau
         co_await whenAll(tasks, Expiration::never());
     }
 
+    void GraphicsImpl::uploadGpuResources()
+    {
+        auto& uploadQueue = getServiceProvider().get<GpuUploadQueue>();
+
+        if (auto scene = m_worldToGraphicScene.find(m_defaultWorld); scene != m_worldToGraphicScene.end() && scene->second->hasMainCamera())
+        {
+            uploadQueue.setViewerPosition(scene->second->getMainCamera().worldPosition);
+        }
+
+        d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+        uploadQueue.drain();
+        d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
+    }
+
     WeakPtr<render::IRenderWindow> GraphicsImpl::getDefaultRenderWindow()
     {
         return WeakPtr<render::IRenderWindow>(m_defaultRenderWindow);
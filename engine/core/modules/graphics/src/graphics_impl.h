@@ -24,6 +24,7 @@ namespace nau
      */
     class GraphicsImpl final : public ICoreGraphics,
                                public IGameSceneUpdate,
+                               public IGameScenePipelinedSync,
                                public scene::IComponentsAsyncActivator,
                                public IServiceInitialization,
                                public IServiceShutdown
@@ -31,6 +32,7 @@ namespace nau
         NAU_RTTI_CLASS(GraphicsImpl,
                        ICoreGraphics,
                        IGameSceneUpdate,
+                       IGameScenePipelinedSync,
                        scene::IComponentsAsyncActivator,
                        IServiceInitialization,
                        IServiceShutdown)
@@ -51,15 +53,17 @@ namespace nau
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
         async::Task<> deactivateComponentsAsync(Uid worldUid, eastl::span<const scene::DeactivatedComponentData> components) override;
 
-        async::Task<bool> update(std::chrono::milliseconds dt) override;
+        async::Task<bool> update(std::chrono::nanoseconds dt) override;
 
-        eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() override
+        eastl::optional<std::chrono::nanoseconds> getFixedUpdateTimeStep() override
         {
             return eastl::nullopt;
         }
 
         void syncSceneState() override;
 
+        void publishSceneState(uint64_t frameIndex) override;
+
         async::Task<> preInitService() override;
         async::Task<> initService() override;
         async::Task<> shutdownService() override;
@@ -93,6 +97,11 @@ namespace nau
 
         async::Task<> executeRenderJobs();
 
+        /**
+            Drains the GPU upload queue within the frame budget. Uploads closer to the main camera are made first.
+         */
+        void uploadGpuResources();
+
         void stopGraphics();
 
         BaseTexture* m_defaultTex;
@@ -101,6 +110,8 @@ namespace nau
 
         nau::Uid m_defaultWorld = nau::NullUid;
         eastl::map<nau::Uid, eastl::shared_ptr<GraphicsScene>> m_worldToGraphicScene;
+        // the scenes are added/removed on the render thread, the mutex guards them from publishSceneState on the host thread
+        std::mutex m_worldToGraphicSceneMutex;
         Ptr<nau::render::RenderWindowImpl> m_defaultRenderWindow;
         eastl::map<SWAPID, Ptr<nau::render::RenderWindowImpl>> m_renderWindows;
         uint32_t m_renderWindowsIds = 0;
@@ -22,66 +22,92 @@ namespace nau
 {
     namespace Debug
     {
-        void drawBonesRecursive(const eastl::vector<SkeletonJoint>& joints, const nau::math::Matrix4* jointsTransforms, size_t rootJointIndex)
+        void drawBonesRecursive(const SkeletonDebugData& skeletonData, size_t rootJointIndex)
         {
+            const auto& jointsTransforms = skeletonData.jointsTransforms;
+
             getDebugRenderer().drawSphere(0.05f, nau::math::Color4(0.0f, 0.0f, 1.0f, 1.0f), jointsTransforms[rootJointIndex], 8, 0.12f);
-            for (size_t i = 0; i < joints.size(); ++i)
+            for (size_t i = 0; i < skeletonData.jointsParents.size(); ++i)
             {
-                if (joints[i].parentIndex == rootJointIndex)
+                if (skeletonData.jointsParents[i] == rootJointIndex)
                 {
                     const nau::math::Vector3& p1 = jointsTransforms[rootJointIndex].getTranslation();
                     const nau::math::Vector3& p2 = jointsTransforms[i].getTranslation();
                     getDebugRenderer().drawLine(nau::math::Point3(p1), nau::math::Point3(p2), nau::math::Color4(1.0f, 0.0f, 0.0f, 1.0f), 0.2f);
 
-                    drawBonesRecursive(joints, jointsTransforms, i);
+                    drawBonesRecursive(skeletonData, i);
                 }
             }
         }
 
-        void debugDrawSkeleton(const SkeletonComponent& skeletonComponent)
+        SkeletonDebugData captureSkeletonDebugData(const SkeletonComponent& skeletonComponent)
         {
-            const unsigned bonesCount = skeletonComponent.getBonesCount();
+            SkeletonDebugData skeletonData;
 
-            if (bonesCount == 0)
+            const eastl::vector<SkeletonJoint>& joints = skeletonComponent.getJoints();
+            const size_t jointsCount = eastl::min<size_t>(skeletonComponent.getBonesCount(), joints.size());
+            if (jointsCount == 0)
             {
-                return;
+                return skeletonData;
             }
-            nau::math::Matrix4 debugBonesTransforms[NAU_MAX_SKINNING_BONES_COUNT];
+
             const auto& modelSpaceJointMatrices = skeletonComponent.getModelSpaceJointMatrices();
+            const auto modelTr = skeletonComponent.getWorldTransform().getMatrix();
 
-            std::memcpy(&debugBonesTransforms[0], &modelSpaceJointMatrices[0], bonesCount * 64);  // 64 == 16 elements * 4 (sizeof(float))
+            skeletonData.jointsParents.reserve(jointsCount);
+            skeletonData.jointsTransforms.reserve(jointsCount);
+            for (size_t i = 0; i < jointsCount; ++i)
+            {
+                nau::math::Matrix4 jointTransform;
+                std::memcpy(&jointTransform, &modelSpaceJointMatrices[i], 64);  // 64 == 16 elements * 4 (sizeof(float))
+
+                skeletonData.jointsParents.push_back(joints[i].parentIndex);
+                skeletonData.jointsTransforms.push_back(modelTr * jointTransform);
+            }
 
-            auto modelTr = skeletonComponent.getWorldTransform().getMatrix();
-            for (auto& tr : debugBonesTransforms)
+            Vector<scene::SceneObject*> children = skeletonComponent.getParentObject().getDirectChildObjects();
+            for (scene::SceneObject* child : children)
             {
-                tr = modelTr * tr;
+                if (child->findFirstComponent<SkeletonSocketComponent>())
+                {
+                    skeletonData.socketsTransforms.push_back(child->getWorldTransform().getMatrix());
+                }
             }
-            const eastl::vector<SkeletonJoint>& joints = skeletonComponent.getJoints();
-            auto rootNodeIt = eastl::find_if(joints.begin(), joints.end(), [](const SkeletonJoint& joint)
+
+            return skeletonData;
+        }
+
+        void debugDrawSkeleton(const SkeletonDebugData& skeletonData)
+        {
+            if (skeletonData.jointsTransforms.empty())
             {
-                return joint.parentIndex == -1;
+                return;
+            }
+
+            const auto& parents = skeletonData.jointsParents;
+            auto rootNodeIt = eastl::find_if(parents.begin(), parents.end(), [](unsigned parentIndex)
+            {
+                return parentIndex == -1;
             });
-            if (rootNodeIt != joints.end())
+            if (rootNodeIt != parents.end())
             {
-                const size_t rootNodeIndex = eastl::distance(joints.begin(), rootNodeIt);
-                Debug::drawBonesRecursive(joints, &debugBonesTransforms[0], rootNodeIndex);
+                Debug::drawBonesRecursive(skeletonData, eastl::distance(parents.begin(), rootNodeIt));
             }
             else
             {
                 NAU_ASSERT(false);
             }
 
-            Vector<scene::SceneObject*> children = skeletonComponent.getParentObject().getDirectChildObjects();
-            for (scene::SceneObject* child : children)
+            for (const nau::math::Matrix4& tr : skeletonData.socketsTransforms)
             {
-                SkeletonSocketComponent* socketComponent = child->findFirstComponent<SkeletonSocketComponent>();
-                if (socketComponent)
-                {
-                    const auto& tr = child->getWorldTransform();
-                    getDebugRenderer().drawSphere(0.03f, nau::math::Color4(0.0f, 1.0f, 0.0f, 1.0f), tr.getMatrix(), 8, 0.12f);
-                }
+                getDebugRenderer().drawSphere(0.03f, nau::math::Color4(0.0f, 1.0f, 0.0f, 1.0f), tr, 8, 0.12f);
             }
         }
+
+        void debugDrawSkeleton(const SkeletonComponent& skeletonComponent)
+        {
+            debugDrawSkeleton(captureSkeletonDebugData(skeletonComponent));
+        }
     }  // namespace Debug
 
     async::Task<StaticMeshNode> makeStaticMeshNode(nau::Ptr<nau::RenderScene> renderScene, const scene::StaticMeshComponent& meshComponent, MaterialAssetRef overrideMaterial)
@@ -221,20 +247,12 @@ namespace nau
         }
     }
 
-    const scene::ICameraProperties& CameraNode::getProperties() const
-    {
-        NAU_FATAL(cameraProperties);
-        return *cameraProperties;
-    }
-
-    void CameraNode::updateFromCamera()
+    void CameraNode::updateFromCamera(const math::Transform& cameraWorldTransform)
     {
         using namespace ::DirectX;
 
-        NAU_FATAL(cameraProperties);
-
-        worldPosition = cameraProperties->getWorldTransform().getTranslation();
-        viewTransform = nau::math::inverse(cameraProperties->getWorldTransform().getMatrix());
+        worldPosition = cameraWorldTransform.getTranslation();
+        viewTransform = nau::math::inverse(cameraWorldTransform.getMatrix());
     }
 
     nau::math::Matrix4 CameraNode::getViewMatrix() const
@@ -257,9 +275,9 @@ namespace nau
             aspectRatioRec = static_cast<float>(height) / static_cast<float>(width);
         }
         
-        return nau::math::Matrix4::perspectiveRH(nau::math::degToRad(cameraProperties->getFov()),
+        return nau::math::Matrix4::perspectiveRH(nau::math::degToRad(fov),
             aspectRatioRec,
-            cameraProperties->getClipNearPlane(), cameraProperties->getClipFarPlane());
+            clipNearPlane, clipFarPlane);
     }
 
     nau::math::Matrix4 CameraNode::getProjMatrixReverseZ() const
@@ -275,9 +293,9 @@ namespace nau
             aspectRatioRec = static_cast<float>(height) / static_cast<float>(width);
         }
 
-        return nau::math::Matrix4::perspectiveRH_ReverseZ(nau::math::degToRad(cameraProperties->getFov()),
+        return nau::math::Matrix4::perspectiveRH_ReverseZ(nau::math::degToRad(fov),
             aspectRatioRec,
-            cameraProperties->getClipNearPlane(), cameraProperties->getClipFarPlane());
+            clipNearPlane, clipFarPlane);
     }
 
     nau::math::Matrix4 CameraNode::getViewProjectionMatrix() const
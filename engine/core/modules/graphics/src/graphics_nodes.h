@@ -49,18 +49,23 @@ namespace nau
         }
     };
 
+    /**
+        The render thread copy of the camera properties: the camera objects are synchronized only on the host thread.
+     */
     struct CameraNode
     {
-        nau::Ptr<scene::ICameraProperties> cameraProperties;
+        Uid cameraUid;
+        float fov = 90.f;
+        float clipNearPlane = 0.1f;
+        float clipFarPlane = 1000.f;
         nau::math::Matrix4 viewTransform;
         nau::math::Vector3 worldPosition;
 
-        void updateFromCamera();
+        void updateFromCamera(const math::Transform& cameraWorldTransform);
         nau::math::Matrix4 getViewMatrix() const;
         nau::math::Matrix4 getProjMatrix() const;
         nau::math::Matrix4 getProjMatrixReverseZ() const;
         nau::math::Matrix4 getViewProjectionMatrix() const;
-        const scene::ICameraProperties& getProperties() const;
     };
 
     struct DirectionalLightNode
@@ -121,6 +126,25 @@ namespace nau
         }
     };
 
+    namespace Debug
+    {
+        /**
+            The skeleton debug geometry: read from the components on the host thread, drawn on the render thread.
+         */
+        struct SkeletonDebugData
+        {
+            eastl::vector<unsigned> jointsParents;
+            eastl::vector<math::Matrix4> jointsTransforms;
+            eastl::vector<math::Matrix4> socketsTransforms;
+        };
+
+        SkeletonDebugData captureSkeletonDebugData(const SkeletonComponent& skeletonComponent);
+
+        void debugDrawSkeleton(const SkeletonDebugData& skeletonData);
+
+        void debugDrawSkeleton(const SkeletonComponent& skeletonComponent);
+    }
+
     async::Task<StaticMeshNode> makeStaticMeshNode(
         nau::Ptr<nau::RenderScene> renderScene,
         const nau::scene::StaticMeshComponent& meshComponent,
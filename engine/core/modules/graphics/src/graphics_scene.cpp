@@ -20,6 +20,7 @@
 #include "nau/scene/scene_object.h"
 #include "nau/shaders/dag_renderStateId.h"
 #include "nau/shaders/shader_globals.h"
+#include "nau/threading/lock_guard.h"
 #include "nau/utils/performance_profiling.h"
 #include "nau/vfx_manager.h"
 
@@ -171,6 +172,9 @@ namespace nau
         auto& graphics = getServiceProvider().get<GraphicsImpl>();
         co_await graphics.getPreRenderExecutor();
 
+        // the host thread can capture the scene state (pipelined sync) concurrently
+        lock_(m_nodesMutex);
+
         if (!staticMeshes.empty())
         {
             m_staticMeshes.reserve(m_staticMeshes.size() + staticMeshes.size());
@@ -255,6 +259,8 @@ namespace nau
         auto& graphics = getServiceProvider().get<GraphicsImpl>();
         co_await graphics.getPreRenderExecutor();
 
+        lock_(m_nodesMutex);
+
         const auto componentRemoved = [&components](Uid uid)
         {
             return eastl::any_of(components.begin(), components.end(), [&uid](const DeactivatedComponentData& c)
@@ -435,11 +441,11 @@ namespace nau
         auto& activeCamera = getMainCamera();
 
         m_lights.cullFrustumLights(
-            math::Point3(activeCamera.cameraProperties->getTransform().getTranslation()),
+            math::Point3(activeCamera.worldPosition),
             activeCamera.getViewProjectionMatrix(),
             activeCamera.getViewMatrix(),
             activeCamera.getProjMatrix(),
-            activeCamera.getProperties().getClipNearPlane());
+            activeCamera.clipNearPlane);
 
         if (!m_lights.hasDeferredLights())
         {
@@ -448,7 +454,7 @@ namespace nau
 
         auto mvp = activeCamera.getViewProjectionMatrix();
         shader_globals::setVariable("mvp", &mvp);
-        auto world_view_pos = math::Vector4(activeCamera.getProperties().getTranslation());
+        auto world_view_pos = math::Vector4(activeCamera.worldPosition);
         shader_globals::setVariable("world_view_pos", &world_view_pos);
 
         m_lights.renderOtherLights();
@@ -472,7 +478,7 @@ namespace nau
 
         auto mvp = activeCamera.getViewProjectionMatrix();
         shader_globals::setVariable("mvp", &mvp);
-        auto world_view_pos = math::Vector4(activeCamera.getProperties().getTranslation());
+        auto world_view_pos = math::Vector4(activeCamera.worldPosition);
         shader_globals::setVariable("world_view_pos", &world_view_pos);
 
         m_lights.renderDebugLights();
@@ -506,34 +512,161 @@ namespace nau
         m_renderScene->renderBillboards(viewProjectionMatrix);
     }
 
+    namespace
+    {
+        /**
+            The nodes are only appended and removed (keeping the order), so the snapshot entries go in the same order as the nodes:
+            the node is searched from the position next to the previous found node.
+         */
+        template <typename Node>
+        Node* findNextNode(eastl::vector<Node>& nodes, size_t& cursor, Uid uid)
+        {
+            for (size_t i = cursor; i < nodes.size(); ++i)
+            {
+                if (nodes[i].componentUid == uid)
+                {
+                    cursor = i + 1;
+                    return &nodes[i];
+                }
+            }
+
+            return nullptr;
+        }
+    }  // namespace
+
     void GraphicsScene::syncSceneState()
+    {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+
+        lock_(m_nodesMutex);
+
+        ++m_syncFrame;
+        captureSceneState(m_syncState, m_syncFrame, m_syncFrame - 1);
+        applySceneState(m_syncState);
+    }
+
+    void GraphicsScene::publishSceneState(uint64_t frameIndex)
+    {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+
+        auto& snapshot = m_publishedState.getWriteSnapshot();
+        {
+            lock_(m_nodesMutex);
+            captureSceneState(snapshot.value, frameIndex, m_publishedState.getAcquiredFrame());
+        }
+
+        m_publishedState.publish(frameIndex);
+    }
+
+    void GraphicsScene::applyPublishedSceneState()
+    {
+        auto* const snapshot = m_publishedState.acquire();
+        if (!snapshot)
+        {
+            return;
+        }
+
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+
+        lock_(m_nodesMutex);
+        applySceneState(snapshot->value);
+    }
+
+    void GraphicsScene::keepUntilConsumed(Uid uid, uint64_t frameIndex, uint32_t* dirtyFlags, eastl::optional<MaterialAssetRef>* material, eastl::optional<TextureAssetRef>* texture)
+    {
+        auto iter = m_pendingChanges.find(uid);
+        if (iter == m_pendingChanges.end())
+        {
+            const bool hasChanges = (dirtyFlags && *dirtyFlags != 0) || (material && *material) || (texture && *texture);
+            if (!hasChanges)
+            {
+                return;
+            }
+
+            iter = m_pendingChanges.emplace(uid, PendingSceneChanges{}).first;
+        }
+
+        PendingSceneChanges& pending = iter->second;
+        pending.frameIndex = frameIndex;
+
+        if (dirtyFlags)
+        {
+            pending.dirtyFlags |= *dirtyFlags;
+            *dirtyFlags = pending.dirtyFlags;
+        }
+
+        const auto keepLatest = []<typename T>(eastl::optional<T>& pendingValue, eastl::optional<T>& value)
+        {
+            if (value)
+            {
+                pendingValue = value;
+            }
+            else
+            {
+                value = pendingValue;
+            }
+        };
+
+        if (material)
+        {
+            keepLatest(pending.material, *material);
+        }
+
+        if (texture)
+        {
+            keepLatest(pending.texture, *texture);
+        }
+    }
+
+    void GraphicsScene::captureSceneState(SceneStateSnapshot& snapshot, uint64_t frameIndex, uint64_t acquiredFrame)
     {
         using namespace nau::scene;
 
-        // TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+        snapshot.staticMeshes.clear();
+        snapshot.skinnedMeshes.clear();
+        snapshot.billboards.clear();
+        snapshot.directionalLights.clear();
+        snapshot.lights.clear();
+        snapshot.environment.reset();
+
+        captureSceneCameras(snapshot);
+
+        eastl::erase_if(m_pendingChanges, [acquiredFrame](const auto& entry)
+        {
+            return entry.second.frameIndex <= acquiredFrame;
+        });
+
         if (!getServiceProvider().has<ISceneManagerInternal>())
         {
             return;
         }
         auto& sceneManager = getServiceProvider().get<ISceneManagerInternal>();
 
-        for (auto& m : m_staticMeshes)
+        snapshot.staticMeshes.reserve(m_staticMeshes.size());
+        for (const auto& m : m_staticMeshes)
         {
             if (Component* const component = sceneManager.findComponent(m.componentUid))
             {
-                // StaticMeshNode::updateFromScene(m, component->as<const SceneComponent&>());
-
                 StaticMeshComponent& staticMeshComponent = component->as<StaticMeshComponent&>();
-                if ((staticMeshComponent.getDirtyFlags() & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
+
+                auto& entry = snapshot.staticMeshes.emplace_back();
+                entry.componentUid = m.componentUid;
+                entry.dirtyFlags = staticMeshComponent.getDirtyFlags();
+                entry.worldTransform = staticMeshComponent.getWorldTransform();
+                entry.isVisible = staticMeshComponent.getVisibility();
+                entry.castShadow = staticMeshComponent.getCastShadow();
+                if ((entry.dirtyFlags & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
                 {
-                    m.materialOverride = staticMeshComponent.getMaterial();
+                    entry.materialOverride = staticMeshComponent.getMaterial();
                 }
-                m.handle->syncState(staticMeshComponent);
 
                 staticMeshComponent.resetDirtyFlags();
+                keepUntilConsumed(entry.componentUid, frameIndex, &entry.dirtyFlags, &entry.materialOverride, nullptr);
             }
         }
-        for (auto& m : m_skinnedMeshes)
+
+        snapshot.skinnedMeshes.reserve(m_skinnedMeshes.size());
+        for (const auto& m : m_skinnedMeshes)
         {
             Component* const skMeshComponent = sceneManager.findComponent(m.componentUid);
 
@@ -542,6 +675,9 @@ namespace nau
                 continue;
             }
 
+            auto& entry = snapshot.skinnedMeshes.emplace_back();
+            entry.componentUid = m.componentUid;
+
             Component* skeletonComponent = nullptr;
             if (m.skeletonComponentUid != NullUid)
             {
@@ -550,83 +686,114 @@ namespace nau
             if (!skeletonComponent)
             {
                 SceneObject& parentObj = skMeshComponent->getParentObject();
-                if (skeletonComponent = parentObj.findFirstComponent<SkeletonComponent>())
-                {
-                    m.skeletonComponentUid = skeletonComponent->getUid();
-                }
+                skeletonComponent = parentObj.findFirstComponent<SkeletonComponent>();
             }
 
             SkinnedMeshComponent& skinnedMeshComponent = skMeshComponent->as<SkinnedMeshComponent&>();
 
             if (skinnedMeshComponent.isMaterialDirty() && skinnedMeshComponent.getMaterial())
             {
-                m.materialOverride = skinnedMeshComponent.getMaterial();
+                entry.materialOverride = skinnedMeshComponent.getMaterial();
                 skinnedMeshComponent.resetIsMaterialDirty();
             }
+            keepUntilConsumed(entry.componentUid, frameIndex, nullptr, &entry.materialOverride, nullptr);
+
+            if (!skeletonComponent)
+            {
+                continue;
+            }
+
+            const SkeletonComponent& skeleton = skeletonComponent->as<const SkeletonComponent&>();
+            entry.skeletonComponentUid = skeleton.getUid();
+            entry.worldTransform = skMeshComponent->as<const SceneComponent&>().getWorldTransform().getMatrix();
+
+            const unsigned bonesCount = skeleton.getBonesCount();
+            NAU_ASSERT(bonesCount <= NAU_MAX_SKINNING_BONES_COUNT);
+
+            const auto& modelSpaceJointMatrices = skeleton.getModelSpaceJointMatrices();
+            const auto& inverseBindTransforms = skeleton.getInverseBindTransforms();
+
+            entry.bonesTransforms.resize(bonesCount);
+            if (bonesCount > 0)
+            {
+                std::memcpy(entry.bonesTransforms.data(), &modelSpaceJointMatrices[0], bonesCount * 64);  // 64 == 16 elements * 4 (sizeof(float))
+            }
+
+            for (size_t i = 0; i < bonesCount; ++i)
+            {
+                entry.bonesTransforms[i] = entry.worldTransform * entry.bonesTransforms[i] * inverseBindTransforms.at(i);
+            }
 
-            if (skeletonComponent)
+            // the debug renderer is used on the render thread: the skeleton is drawn when the state is applied
+            if (SkeletonComponent::drawDebugSkeletons)
             {
-                SkinnedMeshNode::updateFromScene(m, skMeshComponent->as<const SceneComponent&>(), skeletonComponent->as<const SkeletonComponent&>());
+                entry.debugSkeleton = Debug::captureSkeletonDebugData(skeleton);
             }
         }
 
-        for (auto& bill : m_billboards)
+        snapshot.billboards.reserve(m_billboards.size());
+        for (const auto& bill : m_billboards)
         {
             if (Component* const component = sceneManager.findComponent(bill.componentUid))
             {
-                GraphicsSceneNode::updateFromScene(bill, component->as<const SceneComponent&>());
                 BillboardComponent& billComponent = component->as<BillboardComponent&>();
-                bill.billboardHandle->setScreenPercentageSize(billComponent.getScreenPercentageSize());
-                bill.billboardHandle->setWorldPos(billComponent.getWorldTransform().getTranslation());
-                bill.billboardHandle->setVisibility(billComponent.getVisibility());
+
+                auto& entry = snapshot.billboards.emplace_back();
+                entry.componentUid = bill.componentUid;
+                entry.worldTransform = billComponent.getWorldTransform().getMatrix();
+                entry.screenPercentageSize = billComponent.getScreenPercentageSize();
+                entry.isVisible = billComponent.getVisibility();
                 if (billComponent.isTextureDirty())
                 {
-                    bill.overrideTexture = billComponent.getTextureRef();
+                    entry.overrideTexture = billComponent.getTextureRef();
                     billComponent.resetIsTextureDirty();
                 }
+                keepUntilConsumed(entry.componentUid, frameIndex, nullptr, nullptr, &entry.overrideTexture);
             }
         }
 
-        for (auto& directionalLight : m_directionalLights)
+        for (const auto& directionalLight : m_directionalLights)
         {
             if (Component* const component = sceneManager.findComponent(directionalLight.componentUid))
             {
-                DirectionalLightComponent& directionalLightComponent = component->as<DirectionalLightComponent&>();
-                directionalLight = makeDirectionalLightNode(directionalLightComponent);
+                snapshot.directionalLights.emplace_back(makeDirectionalLightNode(component->as<DirectionalLightComponent&>()));
             }
         }
-        for (auto& light : m_lightNodes)
+
+        snapshot.lights.reserve(m_lightNodes.size());
+        for (const auto& light : m_lightNodes)
         {
             if (Component* const component = sceneManager.findComponent(light.componentUid))
             {
+                auto& entry = snapshot.lights.emplace_back();
+                entry.componentUid = light.componentUid;
+                entry.worldTransform = component->as<const SceneComponent&>().getWorldTransform().getMatrix();
+
                 if (component->is<OmnilightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
                     OmnilightComponent& omnilightComponent = component->as<OmnilightComponent&>();
-                    m_lights.setLight(light.lightId, render::ClusteredLights::OmniLight{
-                                                         math::float3((omnilightComponent.getWorldTransform().getTranslation()) + omnilightComponent.getShift()),
-                                                         omnilightComponent.getColor(),
-                                                         omnilightComponent.getRadius(),
-                                                         omnilightComponent.getAttenuation(),
-                                                         omnilightComponent.getIntensity(),
-                                                         omnilightComponent.getDebugDraw()});
+                    entry.omniLight = render::ClusteredLights::OmniLight{
+                        math::float3((omnilightComponent.getWorldTransform().getTranslation()) + omnilightComponent.getShift()),
+                        omnilightComponent.getColor(),
+                        omnilightComponent.getRadius(),
+                        omnilightComponent.getAttenuation(),
+                        omnilightComponent.getIntensity(),
+                        omnilightComponent.getDebugDraw()};
                 }
                 if (component->is<SpotlightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
                     SpotlightComponent& spotlightComponent = component->as<SpotlightComponent&>();
-                    m_lights.setLight(light.lightId, render::ClusteredLights::SpotLight{
-                                                         math::float3((spotlightComponent.getWorldTransform().getTranslation()) + spotlightComponent.getShift()),
-                                                         spotlightComponent.getColor(),
-                                                         spotlightComponent.getRadius(),
-                                                         spotlightComponent.getIntensity(),
-                                                         spotlightComponent.getAttenuation(),
-                                                         math::float3(spotlightComponent.getWorldTransform().transformVector(spotlightComponent.getDirection())),
-                                                         spotlightComponent.getAngle(),
-                                                         false,
-                                                         spotlightComponent.getDebugDraw()});
+                    entry.spotLight = render::ClusteredLights::SpotLight{
+                        math::float3((spotlightComponent.getWorldTransform().getTranslation()) + spotlightComponent.getShift()),
+                        spotlightComponent.getColor(),
+                        spotlightComponent.getRadius(),
+                        spotlightComponent.getIntensity(),
+                        spotlightComponent.getAttenuation(),
+                        math::float3(spotlightComponent.getWorldTransform().transformVector(spotlightComponent.getDirection())),
+                        spotlightComponent.getAngle(),
+                        false,
+                        spotlightComponent.getDebugDraw()};
                 }
-                // TODO: SpotlightComponent
             }
         }
 
@@ -635,50 +802,197 @@ namespace nau
             if (Component* const component = sceneManager.findComponent(m_envNodes[0].componentUid))
             {
                 EnvironmentComponent& envComponent = component->as<EnvironmentComponent&>();
-                m_envNodes[0].envIntensity = envComponent.getIntensity();
+
+                auto& entry = snapshot.environment.emplace();
+                entry.componentUid = m_envNodes[0].componentUid;
+                entry.intensity = envComponent.getIntensity();
                 if (envComponent.isTextureDirty())
                 {
                     envComponent.resetIsTextureDirty();
-                    m_envNodes[0].newTextureRef = envComponent.getTextureAsset();
+                    entry.newTextureRef = envComponent.getTextureAsset();
                 }
+                keepUntilConsumed(entry.componentUid, frameIndex, nullptr, nullptr, &entry.newTextureRef);
             }
         }
+    }
+
+    void GraphicsScene::applySceneState(const SceneStateSnapshot& snapshot)
+    {
+        size_t cursor = 0;
+        for (const auto& entry : snapshot.staticMeshes)
+        {
+            if (StaticMeshNode* const m = findNextNode(m_staticMeshes, cursor, entry.componentUid))
+            {
+                if (entry.materialOverride)
+                {
+                    m->materialOverride = entry.materialOverride;
+                }
+                m->handle->syncState(entry.dirtyFlags, entry.worldTransform, entry.isVisible, entry.castShadow);
+            }
+        }
+
+        cursor = 0;
+        for (const auto& entry : snapshot.skinnedMeshes)
+        {
+            SkinnedMeshNode* const m = findNextNode(m_skinnedMeshes, cursor, entry.componentUid);
+            if (!m)
+            {
+                continue;
+            }
 
-        syncSceneCameras();
+            if (entry.materialOverride)
+            {
+                m->materialOverride = entry.materialOverride;
+            }
+
+            if (entry.skeletonComponentUid == NullUid)
+            {
+                continue;
+            }
+
+            m->skeletonComponentUid = entry.skeletonComponentUid;
+            m->worldTransform = entry.worldTransform;
+            if (entry.debugSkeleton)
+            {
+                Debug::debugDrawSkeleton(*entry.debugSkeleton);
+            }
+
+            if (entry.bonesTransforms.empty())
+            {
+                continue;
+            }
+
+            for (size_t i = 0; i < entry.bonesTransforms.size(); ++i)
+            {
+                m->instance->bonesTransforms[i] = entry.bonesTransforms[i];
+                m->instance->bonesNormalTransforms[i] = math::transpose(math::inverse(entry.bonesTransforms[i]));
+            }
+            m->instance->setWorldPos(m->worldTransform);
+        }
+
+        cursor = 0;
+        for (const auto& entry : snapshot.billboards)
+        {
+            if (BillboardNode* const bill = findNextNode(m_billboards, cursor, entry.componentUid))
+            {
+                bill->worldTransform = entry.worldTransform;
+                bill->billboardHandle->setScreenPercentageSize(entry.screenPercentageSize);
+                bill->billboardHandle->setWorldPos(entry.worldTransform.getTranslation());
+                bill->billboardHandle->setVisibility(entry.isVisible);
+                if (entry.overrideTexture)
+                {
+                    bill->overrideTexture = entry.overrideTexture;
+                }
+            }
+        }
+
+        cursor = 0;
+        for (const auto& entry : snapshot.directionalLights)
+        {
+            if (DirectionalLightNode* const directionalLight = findNextNode(m_directionalLights, cursor, entry.componentUid))
+            {
+                *directionalLight = entry;
+            }
+        }
+
+        cursor = 0;
+        for (const auto& entry : snapshot.lights)
+        {
+            if (LightNode* const light = findNextNode(m_lightNodes, cursor, entry.componentUid))
+            {
+                light->worldTransform = entry.worldTransform;
+                if (entry.omniLight)
+                {
+                    m_lights.setLight(light->lightId, *entry.omniLight);
+                }
+                if (entry.spotLight)
+                {
+                    m_lights.setLight(light->lightId, *entry.spotLight);
+                }
+            }
+        }
+
+        if (snapshot.environment && !m_envNodes.empty() && m_envNodes[0].componentUid == snapshot.environment->componentUid)
+        {
+            m_envNodes[0].envIntensity = snapshot.environment->intensity;
+            if (snapshot.environment->newTextureRef)
+            {
+                m_envNodes[0].newTextureRef = snapshot.environment->newTextureRef;
+            }
+        }
+
+        applySceneCameras(snapshot);
     }
 
-    void GraphicsScene::syncSceneCameras()
+    void GraphicsScene::captureSceneCameras(SceneStateSnapshot& snapshot)
     {
         using namespace nau::scene;
 
+        snapshot.cameras.clear();
+        snapshot.mainCameraUid = NullUid;
+
         auto onCameraAdded = [&](ICameraProperties& cam)
         {
             NAU_LOG_VERBOSE("Found new camera:({}), uid:({}) from world:({})", cam.getCameraName(), toString(cam.getCameraUid()), toString(cam.getWorldUid()));
 
-            [[maybe_unused]] auto [iter, emplaceCameraOk] = m_cameras.emplace(cam.getCameraUid(), CameraNode{.cameraProperties = Ptr{&cam}});
+            [[maybe_unused]] auto [iter, emplaceCameraOk] = m_hostCamerasByUid.emplace(cam.getCameraUid(), Ptr{&cam});
             NAU_ASSERT(emplaceCameraOk);
         };
 
         auto onCameraRemoved = [&](const ICameraProperties& cam)
         {
-            m_cameras.erase(cam.getCameraUid());
+            m_hostCamerasByUid.erase(cam.getCameraUid());
         };
 
-        getServiceProvider().get<ICameraManager>().syncCameras(m_allInGameCameras, onCameraAdded, onCameraRemoved);
-        for (auto& [uid, camera]: m_cameras)
+        getServiceProvider().get<ICameraManager>().syncCameras(m_hostCameras, onCameraAdded, onCameraRemoved);
+
+        snapshot.cameras.reserve(m_hostCamerasByUid.size());
+        for (const auto& [uid, cameraProperties] : m_hostCamerasByUid)
+        {
+            auto& entry = snapshot.cameras.emplace_back();
+            entry.cameraUid = uid;
+            entry.worldTransform = cameraProperties->getWorldTransform();
+            entry.fov = cameraProperties->getFov();
+            entry.clipNearPlane = cameraProperties->getClipNearPlane();
+            entry.clipFarPlane = cameraProperties->getClipFarPlane();
+        }
+
+        if (Ptr<ICameraProperties> mainCamera = m_hostCameras.getWorldMainCamera(m_worldUid))
+        {
+            snapshot.mainCameraUid = mainCamera->getCameraUid();
+        }
+    }
+
+    void GraphicsScene::applySceneCameras(const SceneStateSnapshot& snapshot)
+    {
+        eastl::erase_if(m_cameras, [&snapshot](const auto& entry)
+        {
+            return eastl::none_of(snapshot.cameras.begin(), snapshot.cameras.end(), [uid = entry.first](const SceneStateSnapshot::Camera& camera)
+            {
+                return camera.cameraUid == uid;
+            });
+        });
+
+        for (const auto& entry : snapshot.cameras)
         {
-            camera.updateFromCamera();
+            CameraNode& camera = m_cameras[entry.cameraUid];
+            camera.cameraUid = entry.cameraUid;
+            camera.fov = entry.fov;
+            camera.clipNearPlane = entry.clipNearPlane;
+            camera.clipFarPlane = entry.clipFarPlane;
+            camera.updateFromCamera(entry.worldTransform);
         }
+
+        m_mainCameraUid = snapshot.mainCameraUid;
     }
 
     CameraNode& GraphicsScene::getMainCamera()
     {
         NAU_ASSERT(!m_cameras.empty());
 
-        Ptr<scene::ICameraProperties> cameraProps = m_allInGameCameras.getWorldMainCamera(m_worldUid);
-        if (cameraProps)
+        if (m_mainCameraUid != NullUid)
         {
-            auto camIter = m_cameras.find(cameraProps->getCameraUid());
+            auto camIter = m_cameras.find(m_mainCameraUid);
             if (camIter != m_cameras.end())
             {
                 return (camIter->second);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <shared_mutex>
 
 #include "nau/animation/components/skeleton_component.h"
@@ -12,6 +13,7 @@
 #include "nau/scene/components/scene_component.h"
 #include "nau/scene/scene_processor.h"
 #include "nau/shaders/shader_defines.h"
+#include "nau/threading/snapshot_buffer.h"
 
 #include "graphics_assets/material_asset.h"
 #include "graphics_assets/static_mesh_asset.h"
@@ -32,6 +34,75 @@ namespace nau::scene
 
 namespace nau
 {
+    /**
+        The scene state read from the components (on the host thread) to be applied to the render nodes (on the render thread).
+        The entries are captured in the order of the nodes.
+     */
+    struct SceneStateSnapshot
+    {
+        struct StaticMesh
+        {
+            Uid componentUid;
+            uint32_t dirtyFlags = 0;
+            math::Transform worldTransform;
+            bool isVisible = true;
+            bool castShadow = true;
+            eastl::optional<MaterialAssetRef> materialOverride;
+        };
+
+        struct SkinnedMesh
+        {
+            Uid componentUid;
+            Uid skeletonComponentUid;
+            math::Matrix4 worldTransform;
+            eastl::vector<math::Matrix4> bonesTransforms;
+            eastl::optional<MaterialAssetRef> materialOverride;
+            eastl::optional<Debug::SkeletonDebugData> debugSkeleton;
+        };
+
+        struct Billboard
+        {
+            Uid componentUid;
+            math::Matrix4 worldTransform;
+            float screenPercentageSize = 0.f;
+            bool isVisible = true;
+            eastl::optional<TextureAssetRef> overrideTexture;
+        };
+
+        struct Light
+        {
+            Uid componentUid;
+            math::Matrix4 worldTransform;
+            eastl::optional<render::ClusteredLights::OmniLight> omniLight;
+            eastl::optional<render::ClusteredLights::SpotLight> spotLight;
+        };
+
+        struct Environment
+        {
+            Uid componentUid;
+            float intensity = 1.f;
+            eastl::optional<TextureAssetRef> newTextureRef;
+        };
+
+        struct Camera
+        {
+            Uid cameraUid;
+            math::Transform worldTransform;
+            float fov = 90.f;
+            float clipNearPlane = 0.1f;
+            float clipFarPlane = 1000.f;
+        };
+
+        eastl::vector<StaticMesh> staticMeshes;
+        eastl::vector<SkinnedMesh> skinnedMeshes;
+        eastl::vector<Billboard> billboards;
+        eastl::vector<DirectionalLightNode> directionalLights;
+        eastl::vector<Light> lights;
+        eastl::optional<Environment> environment;
+        eastl::vector<Camera> cameras;
+        Uid mainCameraUid = NullUid;
+    };
+
     class GraphicsScene
     {
     public:
@@ -55,8 +126,21 @@ namespace nau
         void renderSceneDebug();
         void renderBillboards();
 
+        /**
+            Reads the scene state and applies it to the nodes at once: the host and the render threads must be synchronized.
+         */
         void syncSceneState();
 
+        /**
+            Host thread (pipelined sync): reads the scene state into the next snapshot, the render thread is not blocked.
+         */
+        void publishSceneState(uint64_t frameIndex);
+
+        /**
+            Render thread (pipelined sync): applies the latest published snapshot (if there is a new one).
+         */
+        void applyPublishedSceneState();
+
         CameraNode& getMainCamera();
         bool hasCamera();
         bool hasMainCamera() const;
@@ -72,7 +156,24 @@ namespace nau
         nau::RenderScene* getRenderScene();
 
     private:
-        void syncSceneCameras();
+        /**
+            The changes that are not the part of the complete state (dirty flags, new assets) are kept
+            until the render thread acquires the snapshot with them: the intermediate snapshots can be skipped.
+         */
+        struct PendingSceneChanges
+        {
+            uint32_t dirtyFlags = 0;
+            eastl::optional<MaterialAssetRef> material;
+            eastl::optional<TextureAssetRef> texture;
+            uint64_t frameIndex = 0;
+        };
+
+        void captureSceneState(SceneStateSnapshot& snapshot, uint64_t frameIndex, uint64_t acquiredFrame);
+        void applySceneState(const SceneStateSnapshot& snapshot);
+        void keepUntilConsumed(Uid uid, uint64_t frameIndex, uint32_t* dirtyFlags, eastl::optional<MaterialAssetRef>* material, eastl::optional<TextureAssetRef>* texture);
+
+        void captureSceneCameras(SceneStateSnapshot& snapshot);
+        void applySceneCameras(const SceneStateSnapshot& snapshot);
 
         const Uid m_worldUid;
 
@@ -83,12 +184,23 @@ namespace nau
         eastl::vector<EnvironmentNode> m_envNodes;
         eastl::vector<LightNode> m_lightNodes;
         eastl::unordered_map<Uid, CameraNode> m_cameras;
+        Uid m_mainCameraUid = NullUid;
 
         render::ClusteredLights m_lights;
         
         nau::Ptr<nau::RenderScene> m_renderScene;
 
         shaders::RenderStateId fakeId;
-        scene::ICameraManager::CamerasSnapshot m_allInGameCameras;
+
+        // host thread only: the camera manager syncs the cameras only on the main thread, the render thread gets the copies through the snapshot
+        scene::ICameraManager::CamerasSnapshot m_hostCameras;
+        eastl::unordered_map<Uid, Ptr<scene::ICameraProperties>> m_hostCamerasByUid;
+
+        // the nodes are added/removed only on the render thread, the mutex guards them from the capture on the host thread
+        std::mutex m_nodesMutex;
+        threading::SnapshotBuffer<SceneStateSnapshot> m_publishedState;
+        SceneStateSnapshot m_syncState;
+        uint64_t m_syncFrame = 0;
+        eastl::unordered_map<Uid, PendingSceneChanges> m_pendingChanges;
     };
 }  // namespace nau
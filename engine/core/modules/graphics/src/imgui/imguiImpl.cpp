@@ -9,6 +9,7 @@
 #include <implot.h>
 #include <EASTL/unique_ptr.h>
 #include <EASTL/vector.h>
+#include <mutex>
 #include "nau/3d/dag_drv3d.h"
 #include "nau/3d/dag_drv3dReset.h"
 #include "nau/perfMon/dag_cpuFreq.h"
@@ -44,6 +45,8 @@ static bool imguiSubmenuEnabled = true;
 
 ImDrawData* cachedDrawData = nullptr;
 ImDrawData* copiedDrawData = nullptr;
+// the copied data is rendered on the render thread, the pipelined scene sync copies it from the host thread
+static std::mutex copiedDrawDataMutex;
 
 //void imgui_set_override_blk(const nau::DataBlock &imgui_blk_)
 //{
@@ -328,6 +331,7 @@ void imgui_copy_render_data()
         return;
     }
 
+    std::lock_guard lock(copiedDrawDataMutex);
     if(copiedDrawData)
     {
         deleteDrawData(copiedDrawData);
@@ -341,6 +345,7 @@ void imgui_copy_render_data()
 
 void imgui_render_copied_data()
 {
+    std::lock_guard lock(copiedDrawDataMutex);
     if(copiedDrawData)
     {
         renderer->render(copiedDrawData);
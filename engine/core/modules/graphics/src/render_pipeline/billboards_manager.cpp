@@ -18,6 +18,8 @@ namespace nau
     BillboardsManager::BillboardsManager(nau::Ptr<nau::MaterialAssetView> material)
     {
         m_billboardMaterial = material;
+        m_textureProperty = m_billboardMaterial->findTexture("default", "tex");
+        m_vpVariable = nau::shader_globals::addVariable("vp", sizeof(nau::math::Matrix4));
         dataBuffer = d3d::create_cb(sizeof(BillboardData), SBCF_DYNAMIC, u8"billboard buffer");
     }
 
@@ -60,7 +62,10 @@ namespace nau
 
         NAU_ASSERT(m_billboardMaterial);
 
-        nau::shader_globals::setVariable("vp", &viewProj);
+        NAU_ASSERT(m_textureProperty);
+
+        nau::shader_globals::setVariable(m_vpVariable, &viewProj);
+        m_billboardMaterial->setCBuffer("default", "SB_BillboardBuffer", dataBuffer);
 
         d3d::setvsrc(0, nullptr, 0);
         d3d::setind(nullptr);
@@ -96,8 +101,7 @@ namespace nau
 
                 dataBuffer->updateDataWithLock(0, sizeof(BillboardData), &data, VBLOCK_DISCARD);
 
-                m_billboardMaterial->setCBuffer("default", "SB_BillboardBuffer", dataBuffer);
-                m_billboardMaterial->setTexture("default", "tex", textureView->getTexture());
+                m_billboardMaterial->setTexture(m_textureProperty, textureView->getTexture());
 
                 m_billboardMaterial->bind();
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "nau/shaders/shader_globals.h"
 #include "render_pipeline/render_manager.h"
 
 
@@ -45,6 +46,8 @@ namespace nau
         eastl::vector<eastl::weak_ptr<BillboardInfo>> m_billboards;
 
         nau::Ptr<nau::MaterialAssetView> m_billboardMaterial;
+        nau::MaterialAssetView::TextureHandle m_textureProperty;
+        shader_globals::VariableId m_vpVariable = shader_globals::VariableId::Invalid;
         bool m_isBillboardsDirty = false;
 
         Sbuffer* dataBuffer = nullptr;
@@ -6,23 +6,65 @@
 
 #include "nau/shaders/shader_globals.h"
 
-void nau::RenderEntity::render(nau::math::Matrix4 viewProj) const
+namespace
 {
-    const nau::math::Matrix4 mvpMatrix = viewProj * worldTransform;
-    const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(worldTransform));
+    /**
+        Handles of the per draw globals: are resolved once, the draw code does not do any name lookups.
+     */
+    struct DrawGlobals
+    {
+        nau::shader_globals::VariableId vp = nau::shader_globals::addVariable("vp", sizeof(nau::math::Matrix4));
+        nau::shader_globals::VariableId mvp = nau::shader_globals::addVariable("mvp", sizeof(nau::math::Matrix4));
+        nau::shader_globals::VariableId worldMatrix = nau::shader_globals::addVariable("worldMatrix", sizeof(nau::math::Matrix4));
+        nau::shader_globals::VariableId normalMatrix = nau::shader_globals::addVariable("normalMatrix", sizeof(nau::math::Matrix4));
+        nau::shader_globals::VariableId instanceBaseID = nau::shader_globals::addVariable("instanceBaseID", sizeof(nau::math::Vector4));
+    };
+
+    const DrawGlobals& getDrawGlobals()
+    {
+        static const DrawGlobals globals;
+        return globals;
+    }
 
-    nau::shader_globals::setVariable("vp", &viewProj);
-    nau::shader_globals::setVariable("mvp", &mvpMatrix);
-    nau::shader_globals::setVariable("worldMatrix", &worldTransform);
-    nau::shader_globals::setVariable("normalMatrix", &normalMatrix);
+    void setDrawGlobals(const nau::math::Matrix4& viewProj, const nau::math::Matrix4& worldTransform)
+    {
+        const DrawGlobals& globals = getDrawGlobals();
+
+        const nau::math::Matrix4 mvpMatrix = viewProj * worldTransform;
+        const nau::math::Matrix4 normalMatrix = nau::math::transpose(nau::math::inverse(worldTransform));
 
-    for (const auto& cbStruct : cbStructsData)
+        nau::shader_globals::setVariable(globals.vp, &viewProj);
+        nau::shader_globals::setVariable(globals.mvp, &mvpMatrix);
+        nau::shader_globals::setVariable(globals.worldMatrix, &worldTransform);
+        nau::shader_globals::setVariable(globals.normalMatrix, &normalMatrix);
+    }
+}  // namespace
+
+void nau::RenderEntity::resolveConstBufferStructs()
+{
+    for (auto& [name, cbStruct] : cbStructsData)
     {
-        nau::shader_globals::setVariable(cbStruct.first, cbStruct.second.dataPtr);
+        if (cbStruct.variableId == shader_globals::VariableId::Invalid)
+        {
+            cbStruct.variableId = shader_globals::findVariable(name);
+        }
+    }
+}
+
+void nau::RenderEntity::render(nau::math::Matrix4 viewProj) const
+{
+    setDrawGlobals(viewProj, worldTransform);
+
+    for (const auto& [name, cbStruct] : cbStructsData)
+    {
+        if (cbStruct.variableId != shader_globals::VariableId::Invalid)
+        {
+            nau::shader_globals::setVariable(cbStruct.variableId, cbStruct.dataPtr);
+        }
     }
 
     NAU_ASSERT(material);
-    material->bindPipeline("default");
+    material->bindPipeline(NAU_NAME("default"));
 
     d3d::set_buffer(STAGE_VS, 0, nullptr);
 
@@ -50,8 +92,16 @@ void nau::RenderEntity::renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* in
     NAU_ASSERT(material);
     d3d::set_buffer(STAGE_VS, 0, instanceData);
 
-    material->setProperty("instanced", "instanceBaseID", nau::math::Vector4(startInstance));
-    material->bindPipeline("instanced");
+    const auto instanceBaseId = nau::math::Vector4(startInstance);
+    if (instanceBaseIdProperty)
+    {
+        material->setProperty(instanceBaseIdProperty, instanceBaseId);
+    }
+    else
+    {
+        material->setProperty("instanced", "instanceBaseID", instanceBaseId);
+    }
+    material->bindPipeline(NAU_NAME("instanced"));
 
     d3d::setvsrc(0, positionBuffer, sizeof(nau::math::float3));
     d3d::setvsrc(1, normalsBuffer, sizeof(nau::math::float3));
@@ -69,22 +119,22 @@ void nau::RenderEntity::renderZPrepass(const math::Matrix4& viewProj, MaterialAs
 
     if (skinned)
     {
-        static constexpr auto bonesTransforms = "BonesTransforms";
-
-        auto& [size, ptr] = cbStructsData.at(bonesTransforms);
-
-        nau::shader_globals::setVariable(bonesTransforms, ptr);
-
-        prepareZPrepass("skinned", viewProj, zPrepassMat);
+        const ConstBufferStructData& bonesTransforms = cbStructsData.at(NAU_NAME("BonesTransforms"));
+        if (bonesTransforms.variableId != shader_globals::VariableId::Invalid)
+        {
+            nau::shader_globals::setVariable(bonesTransforms.variableId, bonesTransforms.dataPtr);
+        }
+
+        setDrawGlobals(viewProj, worldTransform);
+        prepareZPrepass(NAU_NAME("skinned"), zPrepassMat);
         d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
         d3d::setvsrc(1, boneWeightsBuffer, sizeof(nau::math::float4));
         d3d::setvsrc(2, boneIndicesBuffer, sizeof(nau::math::float4));
     }
     else
     {
-        auto mvp = viewProj * worldTransform;
-        shader_globals::setVariable("vp", &mvp);
-        prepareZPrepass("default", viewProj, zPrepassMat);
+        setDrawGlobals(viewProj, worldTransform);
+        prepareZPrepass(NAU_NAME("default"), zPrepassMat);
         d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
     }
 
@@ -94,27 +144,21 @@ void nau::RenderEntity::renderZPrepass(const math::Matrix4& viewProj, MaterialAs
 
 void nau::RenderEntity::renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const
 {
-    shader_globals::setVariable("vp", &viewProj);
-    prepareZPrepass("default", viewProj, zPrepassMat);
+    // per instance data is taken from the instance buffer
+    shader_globals::setVariable(getDrawGlobals().vp, &viewProj);
+    prepareZPrepass(NAU_NAME("default"), zPrepassMat);
 
     d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
     d3d::setind(indexBuffer);
     d3d::drawind_instanced(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, 0, instancesCount, 0);
 }
 
-void nau::RenderEntity::prepareZPrepass(eastl::string_view pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const
+void nau::RenderEntity::prepareZPrepass(NameId pipeline, MaterialAssetView* zPrepassMat) const
 {
     NAU_ASSERT(zPrepassMat);
 
-    const nau::math::Matrix4 mvpMatrix = viewProj * worldTransform;
-    const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(worldTransform));
-
-    nau::shader_globals::setVariable("vp", &viewProj);
-    nau::shader_globals::setVariable("mvp", &mvpMatrix);
-    nau::shader_globals::setVariable("worldMatrix", &worldTransform);
-    nau::shader_globals::setVariable("normalMatrix", &normalMatrix);
-    auto instanceId = math::Vector4(startInstance);
-    nau::shader_globals::setVariable("instanceBaseID", &instanceId);
+    const auto instanceId = math::Vector4(startInstance);
+    nau::shader_globals::setVariable(getDrawGlobals().instanceBaseID, &instanceId);
 
     zPrepassMat->bindPipeline(pipeline);
 }
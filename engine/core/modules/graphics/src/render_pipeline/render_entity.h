@@ -8,6 +8,7 @@
 
 #include "graphics_assets/material_asset.h"
 #include "nau/3d/dag_drv3d.h"
+#include "nau/shaders/shader_globals.h"
 #include "nau/platform/windows/utils/uid.h"
 
 
@@ -30,6 +31,7 @@ namespace nau
         {
             uint32_t size;
             void* dataPtr;
+            shader_globals::VariableId variableId = shader_globals::VariableId::Invalid;
         };
 
         Sbuffer* positionBuffer = nullptr;
@@ -49,6 +51,7 @@ namespace nau
         eastl::vector<InstanceData> instanceData;
 
         nau::Ptr<nau::MaterialAssetView> material;
+        nau::MaterialAssetView::PropertyHandle instanceBaseIdProperty; ///< "instanceBaseID" of the material's "instanced" pipeline, if any.
 
         uint32_t startIndex;
         uint32_t endIndex;
@@ -56,7 +59,12 @@ namespace nau
         RenderTags tags;
 
         nau::math::Matrix4 worldTransform;
-        eastl::map<eastl::string_view, ConstBufferStructData> cbStructsData;
+        eastl::map<NameId, ConstBufferStructData> cbStructsData;
+
+        /**
+            Resolves the handles of the cbStructsData globals. Entries of the not registered (not used by any loaded shader) globals are skipped on render.
+         */
+        void resolveConstBufferStructs();
 
         void render(nau::math::Matrix4 viewProj) const;
         void renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* instanceData) const;
@@ -64,7 +72,7 @@ namespace nau
         void renderZPrepass(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
         void renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
     private:
-        void prepareZPrepass(eastl::string_view pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
+        void prepareZPrepass(NameId pipeline, MaterialAssetView* zPrepassMat) const;
     };
 
 } // namespace nau
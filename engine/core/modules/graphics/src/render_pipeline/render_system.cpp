@@ -200,7 +200,7 @@ namespace nau
         co_return true;
     }
 
-    async::Task<bool> RenderSystem::update([[maybe_unused]] std::chrono::milliseconds dt)
+    async::Task<bool> RenderSystem::update([[maybe_unused]] std::chrono::nanoseconds dt)
     {
         co_return renderFrame();
     }
@@ -208,7 +208,7 @@ namespace nau
 
     void RenderSystem::renderMainScene()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
 
     }
 
@@ -49,9 +49,9 @@ namespace nau
 
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
 
-        async::Task<bool> update(std::chrono::milliseconds dt) override;
+        async::Task<bool> update(std::chrono::nanoseconds dt) override;
 
-        eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() override
+        eastl::optional<std::chrono::nanoseconds> getFixedUpdateTimeStep() override
         {
             return eastl::nullopt;
         }
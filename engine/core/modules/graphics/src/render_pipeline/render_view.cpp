@@ -12,22 +12,10 @@
 nau::RenderView::RenderView(eastl::string_view viewName) :
     m_viewName(viewName)
 {
-    if (!nau::shader_globals::containsName("mvp"))
-    {
-        nau::shader_globals::addVariable("mvp", sizeof(math::Matrix4));
-    }
-    if (!nau::shader_globals::containsName("vp"))
-    {
-        nau::shader_globals::addVariable("vp", sizeof(math::Matrix4));
-    }
-    if (!nau::shader_globals::containsName("normalMatrix"))
-    {
-        nau::shader_globals::addVariable("normalMatrix", sizeof(math::Matrix4));
-    }
-    if (!nau::shader_globals::containsName("worldMatrix"))
-    {
-        nau::shader_globals::addVariable("worldMatrix", sizeof(math::Matrix4));
-    }
+    m_vpVariable = nau::shader_globals::addVariable("vp", sizeof(math::Matrix4));
+    nau::shader_globals::addVariable("mvp", sizeof(math::Matrix4));
+    nau::shader_globals::addVariable("normalMatrix", sizeof(math::Matrix4));
+    nau::shader_globals::addVariable("worldMatrix", sizeof(math::Matrix4));
     if (!nau::shader_globals::containsName("uid"))
     {
         const auto uid = math::IVector4{};
@@ -86,13 +74,14 @@ void nau::RenderView::renderInstanced(const nau::math::Matrix4& vp) const
         return;
     }
 
-    nau::shader_globals::setVariable("vp", &vp);
+    nau::shader_globals::setVariable(m_vpVariable, &vp);
 
     for (auto& list : m_lists)
     {
         for (auto& ent : list->getEntities())
         {
-            if (!ent.instancingSupported || ent.instancesCount == 1)
+            // single instances are drawn with the instanced pipeline too: per draw data is taken from the instance buffer
+            if (!ent.instancingSupported)
             {
                 ent.render(vp);
             }
@@ -119,7 +108,7 @@ void nau::RenderView::renderZPrepass(const nau::math::Matrix4& vp, nau::Material
     {
         for (auto& ent : list->getEntities())
         {
-            if (!ent.instancingSupported || ent.instancesCount == 1)
+            if (!ent.instancingSupported)
             {
                 ent.renderZPrepass(vp, zPrepassMat);
             }
@@ -154,7 +143,7 @@ void nau::RenderView::renderOutlineMask(const nau::math::Matrix4& vp, nau::Mater
             {
                 continue;
             }
-            if (!ent.instancingSupported || ent.instancesCount == 1)
+            if (!ent.instancingSupported)
             {
                 ent.renderZPrepass(vp, zPrepassMat);
             }
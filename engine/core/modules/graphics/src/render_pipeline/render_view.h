@@ -8,6 +8,7 @@
 
 #include "nau/3d/dag_drv3d.h"
 #include "nau/math/dag_frustum.h"
+#include "nau/shaders/shader_globals.h"
 #include "graphics_assets/material_asset.h"
 #include "render_list.h"
 #include "instance_group.h"
@@ -57,6 +58,7 @@ namespace nau
         nau::math::NauFrustum m_frustum;
         Sbuffer* m_instanceData = nullptr;
         uint32_t m_maxInstancesCount = 0;
+        shader_globals::VariableId m_vpVariable = shader_globals::VariableId::Invalid;
         eastl::vector<RenderList::Ptr> m_lists = {};
 
         eastl::function<bool(const InstanceInfo&)> m_instanceFilter;
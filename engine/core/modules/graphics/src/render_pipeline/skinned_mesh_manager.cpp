@@ -81,8 +81,9 @@ namespace nau
 
             ent.instancingSupported = false;
             ent.worldTransform = skinnedMeshInstance->worldMatrix;
-            ent.cbStructsData["BonesTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesTransforms), skinnedMeshInstance->bonesTransforms};
-            ent.cbStructsData["BonesNormalTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesNormalTransforms), skinnedMeshInstance->bonesNormalTransforms};
+            ent.cbStructsData[NAU_NAME("BonesTransforms")] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesTransforms), skinnedMeshInstance->bonesTransforms};
+            ent.cbStructsData[NAU_NAME("BonesNormalTransforms")] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesNormalTransforms), skinnedMeshInstance->bonesNormalTransforms};
+            ent.resolveConstBufferStructs();
 
             ent.instanceData.emplace_back(skinnedMeshInstance->worldMatrix, skinnedMeshInstance->worldMatrix, skinnedMeshInstance->getUid(), skinnedMeshInstance->isHighlighted());
         }
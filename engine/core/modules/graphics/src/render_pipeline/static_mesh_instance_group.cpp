@@ -140,6 +140,7 @@ namespace nau
                     ent.startIndex = slot.m_startIndex;
                     ent.endIndex = slot.m_endIndex;
                     ent.material = material;
+                    ent.instanceBaseIdProperty = material->findProperty("instanced", "instanceBaseID");
                 }
 
                 uint32_t entInd = mats[matNameHash];
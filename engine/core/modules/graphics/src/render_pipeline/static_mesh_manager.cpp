@@ -3,6 +3,7 @@
 
 
 #include "render_pipeline/static_mesh_manager.h"
+#include "graphics_assets/gpu_upload_queue.h"
 #include "nau/math/dag_lsbVisitor.h"
 #include <graphics_impl.h>
 #include <EASTL/algorithm.h>
@@ -43,6 +44,12 @@ namespace nau
 
     async::Task<eastl::unique_ptr<nau::MeshHandle>> StaticMeshManager::addStaticMesh(StaticMeshAssetRef ref, const nau::math::Matrix4& matrix)
     {
+        // Mesh (if it is not loaded yet) is uploaded to the GPU with the priority of the instance closest to the camera.
+        if (IAssetDescriptor::Ptr meshDescriptor = ref.getAssetDiscriptor())
+        {
+            getServiceProvider().get<GpuUploadQueue>().addPriorityHint(meshDescriptor->getAssetPath().toString(), matrix.getTranslation());
+        }
+
         eastl::shared_ptr<StaticMeshInstanceGroup> group = co_await findOrCreateGroup(ref);
 
         auto& graphics = getServiceProvider().get<nau::GraphicsImpl>();
@@ -201,6 +208,11 @@ namespace nau
 
 
     void MeshHandle::syncState(nau::scene::StaticMeshComponent& component)
+    {
+        syncState(component.getDirtyFlags(), component.getWorldTransform(), component.getVisibility(), component.getCastShadow());
+    }
+
+    void MeshHandle::syncState(uint32_t dirtyFlags, const nau::math::Transform& worldTransform, bool isVisible, bool castShadow)
     {
         NAU_ASSERT(m_group);
         using DirtyFlags = nau::scene::StaticMeshComponent::DirtyFlags;
@@ -215,13 +227,12 @@ namespace nau
             isMaterialDirty = false;
         }
 
-        uint32_t flags = component.getDirtyFlags();
-        for (auto flag : nau::math::LsbVisitor{ flags })
+        for (auto flag : nau::math::LsbVisitor{ dirtyFlags })
         {
             switch (1 << flag)
             {
             case static_cast<uint32_t>(DirtyFlags::WorldPos):
-                setWorldTransform(component.getWorldTransform());
+                setWorldTransform(worldTransform);
                 info.worldMatrix = m_instInfo.worldMatrix;
                 info.worldSphere = m_instInfo.worldSphere;
                 break;
@@ -229,11 +240,11 @@ namespace nau
             //    info.overrideInfo = m_instInfo.overrideInfo;
             //    break;
             case static_cast<uint32_t>(DirtyFlags::Visibility):
-                setVisibility(component.getVisibility());
+                setVisibility(isVisible);
                 info.isVisible = m_instInfo.isVisible;
                 break;
             case static_cast<uint32_t>(DirtyFlags::CastShadow):
-                setCastShadow(component.getCastShadow());
+                setCastShadow(castShadow);
                 info.isCastShadow = m_instInfo.isCastShadow;
                 break;
             }
@@ -68,6 +68,11 @@ namespace nau
 
         void syncState(nau::scene::StaticMeshComponent& component);
 
+        /**
+            Applies the state captured from the component (StaticMeshComponent::DirtyFlags): can be called without the access to the scene.
+         */
+        void syncState(uint32_t dirtyFlags, const nau::math::Transform& worldTransform, bool isVisible, bool castShadow);
+
         void overrideMaterial(uint32_t lodIndex, uint32_t slotIndex, ReloadableAssetView::Ptr material);
 
         ~MeshHandle();
@@ -59,7 +59,7 @@ namespace nau::render
                 m_gBuffer->setRt();
                 d3d::clearview(CLEAR_TARGET | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0), 0, 0);
                 
-                const auto worldViewPos = math::Vector4(m_graphicsScene->getMainCamera().getProperties().getTranslation());
+                const auto worldViewPos = math::Vector4(m_graphicsScene->getMainCamera().worldPosition);
                 shader_globals::setVariable("worldViewPos", &worldViewPos);
 
                 m_graphicsScene->renderFrame(true);
@@ -83,8 +83,8 @@ namespace nau::render
                 nau::CameraNode& camera = m_graphicsScene->getMainCamera();
                 nau::csm::CascadeShadows::ModeSettings mode;
                 mode.powWeight = 0.985;
-                mode.maxDist = camera.cameraProperties->getClipFarPlane();
-                mode.shadowStart = camera.cameraProperties->getClipNearPlane();
+                mode.maxDist = camera.clipFarPlane;
+                mode.shadowStart = camera.clipNearPlane;
                 mode.numCascades = 4;
 
                 nau::math::Vector3 lightDir = nau::math::Vector3(1,1,1);
@@ -118,8 +118,8 @@ namespace nau::render
                 nau::math::Matrix4 proj = camera.getProjMatrix();
                 nau::math::Matrix4 globtm = proj * view;
 
-                auto nearZ = camera.cameraProperties->getClipNearPlane();
-                auto farZ  = camera.cameraProperties->getClipFarPlane();
+                auto nearZ = camera.clipNearPlane;
+                auto farZ  = camera.clipFarPlane;
                 nau::math::NauFrustum frustum;
                 frustum.construct(globtm);
 
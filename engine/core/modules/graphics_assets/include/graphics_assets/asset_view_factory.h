@@ -19,5 +19,7 @@ namespace nau
         eastl::vector<const rtti::TypeInfo*> getAssetViewTypes() const override;
 
         async::Task<IAssetView::Ptr> createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType) override;
+
+        async::Task<IAssetView::Ptr> createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType, const AssetPath& assetPath) override;
     };
 }  // namespace nau
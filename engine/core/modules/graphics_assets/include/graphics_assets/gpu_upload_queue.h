@@ -0,0 +1,143 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/fixed_vector.h>
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "nau/async/task.h"
+#include "nau/math/math.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/threading/lock_guard.h"
+#include "nau/utils/functor.h"
+
+namespace nau
+{
+    /**
+        @brief Upload queue counters. "Last frame" values are related to the last drain() call.
+     */
+    struct GpuUploadQueueStats
+    {
+        size_t queueDepth = 0;
+        size_t pendingBytes = 0;
+        size_t priorityHintsCount = 0;
+
+        float lastFrameUploadMs = 0.f;
+        size_t lastFrameUploadBytes = 0;
+        size_t lastFrameUploadCount = 0;
+
+        float maxFrameUploadMs = 0.f;
+        uint64_t totalUploadBytes = 0;
+        uint64_t totalUploadCount = 0;
+    };
+
+    /**
+        @brief Defers GPU resource creation and data uploads to the render thread and spreads them over the frames.
+
+        Asset views prepare their data on the worker threads and enqueue only the driver work (resource creation, lock/copy/unlock).
+        The queue is drained once per frame until the time or the byte budget is exhausted (at least one upload is made per frame).
+        Requests are ordered by the distance between the viewer and the closest priority hint of the request's key (usually the asset path),
+        requests without hints are made after them in the order they were enqueued.
+
+        Until the first drain() call (i.e. while the graphics is initializing) uploads are made immediately on the caller thread.
+     */
+    class NAU_GRAPHICSASSETS_EXPORT GpuUploadQueue final : public IRttiObject
+    {
+        NAU_RTTI_CLASS(nau::GpuUploadQueue, IRttiObject)
+    public:
+        using UploadCallback = Functor<void()>;
+
+        static constexpr size_t MaxPositionsPerHint = 16;
+
+        GpuUploadQueue() = default;
+        GpuUploadQueue(const GpuUploadQueue&) = delete;
+        GpuUploadQueue& operator=(const GpuUploadQueue&) = delete;
+
+        /**
+            @brief Schedules the upload. The task is completed (on the render thread) right after the callback is invoked.
+
+            @param priorityKey  Key used to find the priority hints, can be empty.
+            @param bytes        Estimated amount of the uploaded data, used for the byte budget and the stats.
+         */
+        async::Task<> enqueue(eastl::string_view priorityKey, size_t bytes, UploadCallback upload);
+
+        /**
+            @brief Adds world position of the object that uses the resources of the specified key.
+            The hint can be set before the resource is requested. The hints of the key are removed once all its uploads are made,
+            the hints without uploads are removed after a while. Only the positions closest to the viewer are kept (MaxPositionsPerHint).
+         */
+        void addPriorityHint(eastl::string_view priorityKey, const math::vec3& worldPosition);
+
+        void setViewerPosition(const math::vec3& viewerPosition);
+
+        /**
+            @brief Sets the per frame budget. Zero value means that the corresponding limit is not used.
+         */
+        void setFrameBudget(float milliseconds, size_t bytes);
+
+        /**
+            @brief Makes the pending uploads within the frame budget. Must be called from the render thread.
+         */
+        void drain();
+
+        /**
+            @brief Makes all pending uploads regardless of the budget (i.e. before the device is reset or destroyed).
+         */
+        void flush();
+
+        GpuUploadQueueStats getStats() const;
+
+    private:
+        struct UploadRequest
+        {
+            eastl::string priorityKey;
+            size_t bytes = 0;
+            uint64_t sequence = 0;
+            float distanceSq = 0.f;
+            UploadCallback upload;
+            async::TaskSource<> completion;
+        };
+
+        struct PriorityHint
+        {
+            eastl::fixed_vector<math::vec3, MaxPositionsPerHint, false> positions;
+            size_t pendingCount = 0;
+            uint64_t lastHintFrame = 0;
+        };
+
+        /**
+            Hints without pending uploads are kept for a while: usually they are added before the resource is requested.
+         */
+        static constexpr uint64_t UnusedHintLifetimeFrames = 300;
+
+        /**
+            Must be called under m_mutex.
+         */
+        float getDistanceSq(const eastl::string& priorityKey) const;
+
+        /**
+            Must be called under m_mutex.
+         */
+        void pruneUnusedHints();
+
+        void completeRequest(UploadRequest& request);
+
+        mutable std::mutex m_mutex;
+        eastl::vector<UploadRequest> m_pendingRequests;
+        eastl::unordered_map<eastl::string, PriorityHint> m_priorityHints;
+        math::vec3 m_viewerPosition = math::vec3::zero();
+        uint64_t m_nextSequence = 0;
+        uint64_t m_frameIndex = 0;
+        bool m_isDraining = false;
+
+        float m_frameBudgetMs = 2.f;
+        size_t m_frameBudgetBytes = 32 * 1024 * 1024;
+
+        GpuUploadQueueStats m_stats;
+    };
+}  // namespace nau
@@ -4,13 +4,17 @@
 
 #pragma once
 
+#include <EASTL/shared_ptr.h>
 #include <EASTL/unordered_set.h>
+#include <EASTL/vector_map.h>
 
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/asset_view.h"
 #include "nau/assets/material.h"
 #include "nau/async/task_base.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/shaders/shader_globals.h"
+#include "nau/string/name_id.h"
 
 #include "shader_asset.h"
 #include "texture_asset.h"
@@ -82,7 +86,17 @@ namespace nau
          * 
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        virtual void bindPipeline(eastl::string_view pipelineName) = 0;
+        void bindPipeline(eastl::string_view pipelineName)
+        {
+            bindPipeline(NameId{pipelineName});
+        }
+
+        /**
+         * @brief Binds the specified pipeline for use. Does not do any string lookups: preferred for the per draw binds.
+         *
+         * @param [in] pipelineName The interned name of the pipeline to bind.
+         */
+        virtual void bindPipeline(NameId pipelineName) = 0;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline.
@@ -444,6 +458,8 @@ namespace nau
             uint32_t slot;
             bool isOwned;
             bool isDirty;
+
+            eastl::vector<std::byte> data; ///< CPU copy of the property constant buffer contents, uploaded as a whole when the buffer is dirty.
         };
 
         /**
@@ -491,11 +507,13 @@ namespace nau
             BufferCache* parentBuffer;
 
             RuntimeValue::Ptr currentValue;
-            RuntimeValue::Ptr* masterValue; ///< Only for MaterialInstanceView.
+            const ConstantBufferVariable* masterProperty; ///< Only for MaterialInstanceView.
 
             Timestamp timestamp;
 
             bool isMasterValue; ///< Only for MaterialInstanceView.
+            bool isRawValue = false; ///< The value is stored only in the parent buffer data (it was set through the PropertyHandle).
+            bool isValueDirty = true; ///< The value must be written to the parent buffer data on the next update.
         };
 
         /**
@@ -513,6 +531,32 @@ namespace nau
             bool isMasterValue; ///< Only for MaterialInstanceView.
         };
 
+        /**
+         * @brief Shader resource bind of the pipeline, resolved from the shader reflection.
+         */
+        struct ResourceBinding
+        {
+            const ShaderInputBindDescription* reflection;
+            ShaderTarget target;
+        };
+
+        /**
+         * @brief Resource binds of all pipeline shaders grouped by the resource name.
+         *
+         * The table is built once, when the master pipeline is created, and is shared (immutable) between the master material and its instances.
+         */
+        using BindingTable = eastl::unordered_map<eastl::string, eastl::vector<ResourceBinding>>;
+
+        /**
+         * @brief Global constant buffer of the pipeline's shader, packed from the global shader variables.
+         */
+        struct GlobalConstantBuffer
+        {
+            ShaderTarget target;
+            uint32_t bindPoint;
+            shader_globals::PackedConstantBuffer data;
+        };
+
         /**
          * @brief Descriptor for a render pipeline pass.
          *
@@ -525,6 +569,13 @@ namespace nau
         struct Pipeline
         {
             eastl::vector<ShaderAssetView::Ptr> shaders;
+            eastl::shared_ptr<const BindingTable> bindings;
+
+            /**
+             * Layouts are resolved from the shaders reflection on the first bind.
+             */
+            eastl::vector<GlobalConstantBuffer> globalBuffers;
+            bool areGlobalBuffersResolved = false;
             
             eastl::unordered_map<eastl::string, ConstantBufferVariable> properties;
             eastl::unordered_map<eastl::string, SampledTextureProperty> texProperties;
@@ -553,8 +604,107 @@ namespace nau
 
             bool isDirty;
             bool isRenderStateDirty;
+
+            uint64_t propertiesVersion = 0; ///< Is incremented on every change of the constant buffer properties.
+            uint64_t syncedMasterPropertiesVersion = 0; ///< Only for MaterialInstanceView: version of the master properties the inherited values are synced with.
+        };
+
+    public:
+        /**
+         * @brief Pre-resolved reference to a constant buffer property of the pipeline.
+         *
+         * The handle is valid while the material view it was obtained from is alive and can be used only with this view.
+         * Default constructed handle is invalid.
+         */
+        class PropertyHandle
+        {
+        public:
+            PropertyHandle() = default;
+
+            explicit operator bool() const
+            {
+                return m_property != nullptr;
+            }
+
+        private:
+            PropertyHandle(Pipeline* pipeline, ConstantBufferVariable* property) :
+                m_pipeline(pipeline),
+                m_property(property)
+            {
+            }
+
+            Pipeline* m_pipeline = nullptr;
+            ConstantBufferVariable* m_property = nullptr;
+
+            friend class MaterialAssetView;
         };
 
+        /**
+         * @brief Pre-resolved reference to a texture property of the pipeline.
+         *
+         * The handle is valid while the material view it was obtained from is alive and can be used only with this view.
+         * Default constructed handle is invalid.
+         */
+        class TextureHandle
+        {
+        public:
+            TextureHandle() = default;
+
+            explicit operator bool() const
+            {
+                return m_property != nullptr;
+            }
+
+        private:
+            TextureHandle(SampledTextureProperty* property) :
+                m_property(property)
+            {
+            }
+
+            SampledTextureProperty* m_property = nullptr;
+
+            friend class MaterialAssetView;
+        };
+
+        /**
+         * @brief Resolves a property of the specified pipeline.
+         *
+         * @param [in] pipelineName The name of the pipeline.
+         * @param [in] propertyName The name of the property.
+         * @return                  Handle of the property or an invalid handle if the pipeline or the property is not found.
+         */
+        PropertyHandle findProperty(eastl::string_view pipelineName, eastl::string_view propertyName);
+
+        /**
+         * @brief Sets a property value through the pre-resolved handle.
+         *
+         * The value is written directly into the CPU copy of the constant buffer without any lookups or allocations.
+         *
+         * @param [in] property Handle obtained from findProperty of this view.
+         * @param [in] value    The new value to set for the property.
+         */
+        template <typename T>
+        void setProperty(PropertyHandle property, const T& value);
+
+        /**
+         * @brief Resolves a texture property of the specified pipeline.
+         *
+         * @param [in] pipelineName The name of the pipeline.
+         * @param [in] propertyName The name of the texture property.
+         * @return                  Handle of the texture property or an invalid handle if the pipeline or the property is not found.
+         */
+        TextureHandle findTexture(eastl::string_view pipelineName, eastl::string_view propertyName);
+
+        /**
+         * @brief Sets a texture property through the pre-resolved handle. Setting the texture that is already set does nothing.
+         *
+         * @param [in] property Handle obtained from findTexture of this view.
+         * @param [in] texture  A pointer to the texture to assign.
+         */
+        void setTexture(TextureHandle property, BaseTexture* texture);
+
+    protected:
+
         /**
          * @brief Constructs a master render pipeline based on the provided material pipeline and shader data.
          *
@@ -574,6 +724,49 @@ namespace nau
          * @return                      A task that provides the constructed pipeline instance once complete.
          */
         static async::Task<Pipeline> makeInstancePipeline(eastl::string_view pipelineName, const MaterialPipeline& materialPipeline, Pipeline& masterPipeline);
+
+        /**
+         * @brief Builds the resource binding table from the shaders reflection.
+         *
+         * @param [in] shaders  Shaders of the pipeline.
+         * @return              The binding table to share between the master pipeline and the instance pipelines.
+         */
+        static eastl::shared_ptr<const BindingTable> makeBindingTable(eastl::span<const ShaderAssetView::Ptr> shaders);
+
+        /**
+         * @brief Retrieves the resource binds of the pipeline with the specified name.
+         *
+         * @param [in] pipeline The pipeline to search in.
+         * @param [in] name     The name of the resource.
+         * @return              Binds of the resource in all pipeline shaders (empty if the resource is not used).
+         */
+        static eastl::span<const ResourceBinding> findBindings(const Pipeline& pipeline, eastl::string_view name);
+
+        /**
+         * @brief Writes the actual value of the property (own or inherited from the master material) to the constant buffer memory.
+         *
+         * @param [in] property The property to write.
+         * @param [out] data    The memory of the property in the constant buffer.
+         */
+        static void writePropertyValue(const ConstantBufferVariable& property, std::byte* data);
+
+        /**
+         * @brief Marks the constant buffers of the instance pipeline dirty if the inherited properties were changed in the master pipeline.
+         *
+         * The master properties version is checked first: nothing is done if the master properties were not changed since the previous sync.
+         *
+         * @param [in] masterPipeline       The pipeline of the master material.
+         * @param [in, out] instancePipeline The corresponding pipeline of the material instance.
+         */
+        static void syncMasterProperties(const Pipeline& masterPipeline, Pipeline& instancePipeline);
+
+        /**
+         * @brief Assigns the texture (not owned by the material) to the texture property.
+         *
+         * @param [in, out] property    The texture property.
+         * @param [in] texture          A pointer to the texture to assign.
+         */
+        static void assignTexture(SampledTextureProperty& property, BaseTexture* texture);
         
         /**
          * @brief Sets the culling mode for the given render state.
@@ -614,6 +807,8 @@ namespace nau
          */
         void updateBuffers(eastl::string_view pipelineName);
 
+        void updateBuffers(Pipeline& pipeline);
+
         /**
          * @brief Updates the render state for the specified pipeline based on the pipeline's settings.
          *
@@ -621,6 +816,18 @@ namespace nau
          */
         void updateRenderState(eastl::string_view pipelineName);
 
+        void updateRenderState(Pipeline& pipeline);
+
+        /**
+         * @brief Rebuilds the pipelines index by the interned names. Must be called after m_pipelines is filled.
+         */
+        void indexPipelines();
+
+        /**
+         * @return The pipeline with the specified name or nullptr.
+         */
+        Pipeline* findPipeline(NameId pipelineName) const;
+
         /**
          * @brief Checks if any of the pipelines have a compute shader.
          *
@@ -631,6 +838,9 @@ namespace nau
         // Map storing pipeline objects by their names.
         eastl::unordered_map<eastl::string, Pipeline> m_pipelines;
 
+        // Pipelines (owned by m_pipelines) by the interned names.
+        eastl::vector_map<NameId, Pipeline*> m_pipelineIds;
+
         // The name associated with this material asset view.
         eastl::string m_name;
 
@@ -674,7 +884,9 @@ namespace nau
          *
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        void bindPipeline(eastl::string_view pipelineName) override;
+        void bindPipeline(NameId pipelineName) override;
+
+        using MaterialAssetView::bindPipeline;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline.
@@ -686,10 +898,15 @@ namespace nau
 
     private:
         // TODO(MaxWolf): remove this in NAU-2398.
-        void setGlobals(eastl::string_view pipelineName);
+        void setGlobals(Pipeline& pipeline);
+
+        /**
+         * @brief Builds the packed global constant buffers of the pipeline (variable handles and offsets) from the shaders reflection.
+         */
+        void resolveGlobalBuffers(Pipeline& pipeline);
 
         // Stores the name of the default program associated with the first pipeline.
-        eastl::string m_defaultProgram;
+        NameId m_defaultProgram;
     };
 
 
@@ -727,7 +944,9 @@ namespace nau
          *
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        void bindPipeline(eastl::string_view pipelineName) override;
+        void bindPipeline(NameId pipelineName) override;
+
+        using MaterialAssetView::bindPipeline;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline from the master material.
@@ -740,7 +959,6 @@ namespace nau
         PROGRAM getPipelineProgram(eastl::string_view pipelineName) const override;
 
     private:
-        void syncBuffers(const Pipeline& masterPipeline, Pipeline& instancePipeline);
         void syncTextures(const Pipeline& masterPipeline, Pipeline& instancePipeline);
 
         MasterMaterialAssetView::Ptr m_masterMaterial;
@@ -764,9 +982,44 @@ namespace nau
 
         variable.currentValue = makeValueCopy(value);
         variable.timestamp = std::chrono::steady_clock::now();
+        variable.isRawValue = false;
+        variable.isValueDirty = true;
         variable.parentBuffer->isDirty = true;
 
         pipeline.isDirty = true;
+        ++pipeline.propertiesVersion;
+    }
+
+    template <typename T>
+    void MaterialAssetView::setProperty(PropertyHandle property, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        NAU_ASSERT(property);
+
+        ConstantBufferVariable& variable = *property.m_property;
+        BufferCache& buffer = *variable.parentBuffer;
+
+        std::byte* const data = buffer.data.data() + variable.reflection->startOffset;
+        const size_t size = std::min<size_t>(sizeof(T), variable.reflection->size);
+
+        if (variable.isRawValue && memcmp(data, &value, size) == 0)
+        {
+            return;
+        }
+
+        memcpy(data, &value, size);
+
+        variable.currentValue = nullptr;
+        variable.masterProperty = nullptr;
+        variable.isMasterValue = false;
+        variable.isRawValue = true;
+        variable.isValueDirty = false;
+        variable.timestamp = std::chrono::steady_clock::now();
+
+        buffer.isDirty = true;
+        property.m_pipeline->isDirty = true;
+        // the instances of the master material pick up the inherited value on their next bind
+        ++property.m_pipeline->propertiesVersion;
     }
 
     template <typename T>
@@ -778,8 +1031,14 @@ namespace nau
         NAU_ASSERT(pipeline.properties.contains(propertyName));
         auto& variable = pipeline.properties[propertyName.data()];
 
-        return variable.isMasterValue
-            ? runtimeValueCast<T>(*variable.masterValue)
-            : runtimeValueCast<T>(variable.currentValue);
+        const ConstantBufferVariable& source = variable.isMasterValue ? *variable.masterProperty : variable;
+        if (source.isRawValue)
+        {
+            T value{};
+            memcpy(&value, source.parentBuffer->data.data() + source.reflection->startOffset, std::min<size_t>(sizeof(T), source.reflection->size));
+            return value;
+        }
+
+        return *runtimeValueCast<T>(source.currentValue);
     }
 }  // namespace nau
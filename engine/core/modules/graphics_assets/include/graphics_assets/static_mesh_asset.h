@@ -17,7 +17,7 @@ namespace nau
     {
         NAU_CLASS_(nau::StaticMeshAssetView, IAssetView)
     public:
-        static async::Task<nau::Ptr<StaticMeshAssetView>> createFromAssetAccessor(nau::Ptr<> accessor);
+        static async::Task<nau::Ptr<StaticMeshAssetView>> createFromAssetAccessor(nau::Ptr<> accessor, eastl::string uploadPriorityKey = {});
 
         Sbuffer* getPositionsBuffer() const; // todo: NAU-1797 Remove, use getMesh
         Sbuffer* getNormalsBuffer() const; // todo: NAU-1797 Remove, use getMesh
@@ -67,7 +67,10 @@ namespace nau
         }
 
     public:
-        static async::Task<nau::Ptr<StaticMesh>> createFromStaticMeshAccessor(IMeshAssetAccessor& accessor);
+        /**
+            @brief Prepares the geometry on the caller thread, buffers are created and filled through the GpuUploadQueue.
+         */
+        static async::Task<nau::Ptr<StaticMesh>> createFromStaticMeshAccessor(IMeshAssetAccessor& accessor, eastl::string uploadPriorityKey = {});
 
         static bool createFromGeneratedData();
 
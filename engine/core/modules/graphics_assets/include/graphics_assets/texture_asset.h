@@ -13,7 +13,7 @@ namespace nau
     {
         NAU_CLASS_(nau::TextureAssetView, IAssetView)
     public:
-        static async::Task<nau::Ptr<TextureAssetView>> createFromAssetAccessor(nau::Ptr<> accessor);
+        static async::Task<nau::Ptr<TextureAssetView>> createFromAssetAccessor(nau::Ptr<> accessor, eastl::string uploadPriorityKey = {});
 
         inline BaseTexture* getTexture()
         {
@@ -24,9 +24,17 @@ namespace nau
 
     async::Task<IAssetView::Ptr> GraphicsAssetViewFactory::createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType)
     {
+        return createAssetView(std::move(accessor), viewType, AssetPath{});
+    }
+
+    async::Task<IAssetView::Ptr> GraphicsAssetViewFactory::createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType, const AssetPath& assetPath)
+    {
+        // GPU uploads of the asset are prioritized by the hints that are added for the asset path (see GpuUploadQueue).
+        const eastl::string uploadPriorityKey = assetPath ? assetPath.toString() : eastl::string{};
+
         if (viewType == rtti::getTypeInfo<StaticMeshAssetView>())
         {
-            auto meshAssetView = co_await StaticMeshAssetView::createFromAssetAccessor(accessor);
+            auto meshAssetView = co_await StaticMeshAssetView::createFromAssetAccessor(accessor, uploadPriorityKey);
             co_return meshAssetView;
         }
         if (viewType == rtti::getTypeInfo<SkinnedMeshAssetView>())
@@ -36,7 +44,7 @@ namespace nau
         }
         if (viewType == rtti::getTypeInfo<TextureAssetView>())
         {
-            auto textureAssetView = co_await TextureAssetView::createFromAssetAccessor(accessor);
+            auto textureAssetView = co_await TextureAssetView::createFromAssetAccessor(accessor, uploadPriorityKey);
             co_return textureAssetView;
         }
         if (viewType == rtti::getTypeInfo<ShaderAssetView>())
@@ -70,6 +70,175 @@ namespace nau
             return tex;
         }
 
+        bool isSupportedGlobalVariableType(const ShaderVariableTypeDescription& type)
+        {
+            if (type.elements > 0 || type.svc == ShaderVariableClass::Struct)
+            {
+                return true;
+            }
+
+            switch (type.svc)
+            {
+                case ShaderVariableClass::Scalar:
+                    return type.svt == ShaderVariableType::Int || type.svt == ShaderVariableType::Uint || type.svt == ShaderVariableType::Float;
+
+                case ShaderVariableClass::Vector:
+                {
+                    const bool isSupportedType = type.svt == ShaderVariableType::Int || type.svt == ShaderVariableType::Uint || type.svt == ShaderVariableType::Float;
+                    return isSupportedType && type.columns >= 2 && type.columns <= 4;
+                }
+
+                case ShaderVariableClass::MatrixColumns:
+                    NAU_ASSERT(type.columns == type.rows);
+                    return type.svt == ShaderVariableType::Float && (type.columns == 3 || type.columns == 4);
+
+                default:
+                    return false;
+            }
+        }
+
+        void writeRuntimeValue(const ShaderVariableDescription& var, const RuntimeValue::Ptr& runtimeValue, std::byte* data)
+        {
+            switch (var.type.svc)
+            {
+                case ShaderVariableClass::Scalar:
+                {
+                    switch (var.type.svt)
+                    {
+                        case ShaderVariableType::Int:
+                        {
+                            auto value = *runtimeValueCast<int32_t>(runtimeValue);
+
+                            memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                            break;
+                        }
+                        case ShaderVariableType::Uint:
+                        {
+                            auto value = *runtimeValueCast<uint32_t>(runtimeValue);
+
+                            memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                            break;
+                        }
+                        case ShaderVariableType::Float:
+                        {
+                            auto value = *runtimeValueCast<float>(runtimeValue);
+
+                            memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                            break;
+                        }
+                        default:
+                            NAU_FAILURE_ALWAYS("Not implemented");
+                    }
+                    break;
+                }
+                case ShaderVariableClass::Vector:
+                {
+                    switch (var.type.svt)
+                    {
+                        case ShaderVariableType::Float:
+                        {
+                            switch (var.type.columns)
+                            {
+                                case 2:
+                                {
+                                    auto value = *runtimeValueCast<math::Vector2>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                case 3:
+                                {
+                                    auto value = *runtimeValueCast<math::Vector3>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                case 4:
+                                {
+                                    auto value = *runtimeValueCast<math::Vector4>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                default:
+                                    NAU_FAILURE_ALWAYS("Not implemented");
+                            }
+                            break;
+                        }
+                        case ShaderVariableType::Int:
+                        case ShaderVariableType::Uint:
+                        {
+                            switch (var.type.columns)
+                            {
+                                case 2:
+                                {
+                                    auto value = *runtimeValueCast<math::IVector2>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                case 3:
+                                {
+                                    auto value = *runtimeValueCast<math::IVector3>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                case 4:
+                                {
+                                    auto value = *runtimeValueCast<math::IVector4>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                default:
+                                    NAU_FAILURE_ALWAYS("Not implemented");
+                            }
+                            break;
+                        }
+                        default:
+                            NAU_FAILURE_ALWAYS("Not implemented");
+                    }
+                    break;
+                }
+                case ShaderVariableClass::MatrixColumns:
+                {
+                    NAU_ASSERT(var.type.columns == var.type.rows);
+
+                    switch (var.type.svt)
+                    {
+                        case ShaderVariableType::Float:
+                        {
+                            switch (var.type.columns)
+                            {
+                                case 3:
+                                {
+                                    auto value = *runtimeValueCast<math::Matrix3>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                case 4:
+                                {
+                                    auto value = *runtimeValueCast<math::Matrix4>(runtimeValue);
+
+                                    memcpy(data, &value, std::min<size_t>(sizeof(value), var.size));
+                                    break;
+                                }
+                                default:
+                                    NAU_FAILURE_ALWAYS("Not implemented");
+                            }
+                            break;
+                        }
+                        default:
+                            NAU_FAILURE_ALWAYS("Not implemented");
+                    }
+                    break;
+                }
+                default:
+                    NAU_FAILURE_ALWAYS("Not implemented");
+            }
+        }
     }  // anonymous namespace
 
     async::Task<MaterialAssetView::Ptr> MaterialAssetView::createFromAssetAccessor(nau::Ptr<> accessor)
@@ -205,8 +374,42 @@ namespace nau
         auto& pipeline = m_pipelines[pipelineName.data()];
 
         NAU_ASSERT(pipeline.texProperties.contains(propertyName));
-        auto& property = pipeline.texProperties[propertyName.data()];
+        assignTexture(pipeline.texProperties[propertyName.data()], texture);
+    }
+
+    void MaterialAssetView::setTexture(TextureHandle property, BaseTexture* texture)
+    {
+        NAU_ASSERT(property);
+
+        const SampledTextureProperty& variable = *property.m_property;
+        const TextureCache& parentTexture = *variable.parentTexture;
+        if (!variable.isMasterValue && !parentTexture.isOwned && parentTexture.textureView == nullptr && parentTexture.texture == texture)
+        {
+            return;
+        }
+
+        assignTexture(*property.m_property, texture);
+    }
+
+    MaterialAssetView::TextureHandle MaterialAssetView::findTexture(eastl::string_view pipelineName, eastl::string_view propertyName)
+    {
+        auto pipeline = m_pipelines.find_as(pipelineName);
+        if (pipeline == m_pipelines.end())
+        {
+            return {};
+        }
+
+        auto property = pipeline->second.texProperties.find_as(propertyName);
+        if (property == pipeline->second.texProperties.end())
+        {
+            return {};
+        }
 
+        return TextureHandle{&property->second};
+    }
+
+    void MaterialAssetView::assignTexture(SampledTextureProperty& property, BaseTexture* texture)
+    {
         if (property.isMasterValue)
         {
             property.masterValue = nullptr;
@@ -310,55 +513,50 @@ namespace nau
             pipeline.rwBuffers.erase(bufferName.data());
         }
 
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    if (!pipeline.rwBuffers.contains(bufferName))
-                    {
-                        unsigned flags = desc.flags;
-
-                        switch (bind.type)
-                        {
-                            case ShaderInputType::UavRwTyped:
-                                flags |= SBCF_BIND_UNORDERED | SBCF_DYNAMIC;
-                                break;
+            if (bind.dimension != SrvDimension::Buffer)
+            {
+                continue;
+            }
 
-                            case ShaderInputType::UavRwStructured:
-                                flags |= SBCF_UA_STRUCTURED | SBCF_DYNAMIC;
-                                break;
+            if (!pipeline.rwBuffers.contains(bufferName))
+            {
+                unsigned flags = desc.flags;
 
-                                // Currently, DXC returns D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER for ConsumeStructuredBuffer and AppendStructuredBuffer
-                                // in reflection instead of D3D_SIT_UAV_CONSUME_STRUCTURED and D3D_SIT_UAV_APPEND_STRUCTURED, respectively.
-                                // This may be related to the following code: https://github.com/microsoft/DirectXShaderCompiler/blob/9221570027d759bda093ae035a7cc68d6923fa13/lib/HLSL/DxilContainerReflection.cpp#L1690
-                                // TODO: Further investigation is needed.
+                switch (bind.type)
+                {
+                    case ShaderInputType::UavRwTyped:
+                        flags |= SBCF_BIND_UNORDERED | SBCF_DYNAMIC;
+                        break;
 
-                            case ShaderInputType::UavRwStructuredWithCounter:
-                                flags |= SBCF_UA_STRUCTURED | SBCF_BIND_SHADER_RES;
-                                break;
+                    case ShaderInputType::UavRwStructured:
+                        flags |= SBCF_UA_STRUCTURED | SBCF_DYNAMIC;
+                        break;
 
-                            default:
-                                NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
-                        }
+                        // Currently, DXC returns D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER for ConsumeStructuredBuffer and AppendStructuredBuffer
+                        // in reflection instead of D3D_SIT_UAV_CONSUME_STRUCTURED and D3D_SIT_UAV_APPEND_STRUCTURED, respectively.
+                        // This may be related to the following code: https://github.com/microsoft/DirectXShaderCompiler/blob/9221570027d759bda093ae035a7cc68d6923fa13/lib/HLSL/DxilContainerReflection.cpp#L1690
+                        // TODO: Further investigation is needed.
 
-                        pipeline.rwBuffers[bind.name] = {
-                            .buffer = d3d::create_sbuffer(desc.elementSize, desc.elementCount, flags, desc.format, desc.name),
-                            .slot = bind.bindPoint,
-                            .isOwned = true};
-                    }
+                    case ShaderInputType::UavRwStructuredWithCounter:
+                        flags |= SBCF_UA_STRUCTURED | SBCF_BIND_SHADER_RES;
+                        break;
 
-                    pipeline.rwBuffers[bind.name].stages.insert(getStage(shader->target));
-                    return;
+                    default:
+                        NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
                 }
+
+                pipeline.rwBuffers[bind.name] = {
+                    .buffer = d3d::create_sbuffer(desc.elementSize, desc.elementCount, flags, desc.format, desc.name),
+                    .slot = bind.bindPoint,
+                    .isOwned = true};
             }
+
+            pipeline.rwBuffers[bind.name].stages.insert(getStage(binding.target));
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -372,33 +570,28 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.dimension != SrvDimension::Buffer ||
+                bind.type != ShaderInputType::UavRwTyped && bind.type != ShaderInputType::UavRwStructured && bind.type != ShaderInputType::UavRwStructuredWithCounter)
             {
-                if (bind.dimension != SrvDimension::Buffer ||
-                    bind.type != ShaderInputType::UavRwTyped && bind.type != ShaderInputType::UavRwStructured && bind.type != ShaderInputType::UavRwStructuredWithCounter)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
+            NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
 
-                    std::byte* ptr = nullptr;
-                    auto& uav = pipeline.rwBuffers[bind.name];
+            std::byte* ptr = nullptr;
+            auto& uav = pipeline.rwBuffers[bind.name];
 
-                    uav.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_WRITEONLY);
-                    NAU_ASSERT(ptr);
+            uav.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_WRITEONLY);
+            NAU_ASSERT(ptr);
 
-                    memcpy(ptr, data, size);
-                    uav.buffer->unlock();
+            memcpy(ptr, data, size);
+            uav.buffer->unlock();
 
-                    return;
-                }
-            }
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -412,33 +605,28 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.dimension != SrvDimension::Buffer ||
+                bind.type != ShaderInputType::UavRwTyped && bind.type != ShaderInputType::UavRwStructured && bind.type != ShaderInputType::UavRwStructuredWithCounter)
             {
-                if (bind.dimension != SrvDimension::Buffer ||
-                    bind.type != ShaderInputType::UavRwTyped && bind.type != ShaderInputType::UavRwStructured && bind.type != ShaderInputType::UavRwStructuredWithCounter)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
+            NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
 
-                    std::byte* ptr = nullptr;
-                    auto& uav = pipeline.rwBuffers[bind.name];
+            std::byte* ptr = nullptr;
+            auto& uav = pipeline.rwBuffers[bind.name];
 
-                    uav.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_READONLY);
-                    NAU_ASSERT(ptr);
+            uav.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_READONLY);
+            NAU_ASSERT(ptr);
 
-                    memcpy(data, ptr, size);
-                    uav.buffer->unlock();
+            memcpy(data, ptr, size);
+            uav.buffer->unlock();
 
-                    return;
-                }
-            }
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -450,73 +638,68 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.dimension != SrvDimension::Buffer)
             {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    const auto flags = rwBuffer->getFlags();
+            const auto flags = rwBuffer->getFlags();
 
-                    switch (bind.type)
+            switch (bind.type)
+            {
+                case ShaderInputType::UavRwTyped:
+                    if (!(flags & SBCF_BIND_UNORDERED))
                     {
-                        case ShaderInputType::UavRwTyped:
-                            if (!(flags & SBCF_BIND_UNORDERED))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_BIND_UNORDERED flag is missing!");
-                            }
-                            if (!(flags & SBCF_DYNAMIC))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
-                            }
-                            break;
-
-                        case ShaderInputType::UavRwStructured:
-                            if (!(flags & SBCF_UA_STRUCTURED))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_UA_STRUCTURED flag is missing!");
-                            }
-                            if (!(flags & SBCF_DYNAMIC))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
-                            }
-                            break;
-
-                        case ShaderInputType::UavRwStructuredWithCounter:
-                            if (!(flags & SBCF_UA_STRUCTURED))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_UA_STRUCTURED flag is missing!");
-                            }
-                            if (!(flags & SBCF_BIND_SHADER_RES))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
-                            }
-                            break;
+                        NAU_FAILURE_ALWAYS("SBCF_BIND_UNORDERED flag is missing!");
+                    }
+                    if (!(flags & SBCF_DYNAMIC))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
+                    }
+                    break;
 
-                        default:
-                            NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
+                case ShaderInputType::UavRwStructured:
+                    if (!(flags & SBCF_UA_STRUCTURED))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_UA_STRUCTURED flag is missing!");
                     }
+                    if (!(flags & SBCF_DYNAMIC))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
+                    }
+                    break;
 
-                    auto& uav = pipeline.rwBuffers[bind.name];
-                    if (uav.isOwned && uav.buffer != nullptr)
+                case ShaderInputType::UavRwStructuredWithCounter:
+                    if (!(flags & SBCF_UA_STRUCTURED))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_UA_STRUCTURED flag is missing!");
+                    }
+                    if (!(flags & SBCF_BIND_SHADER_RES))
                     {
-                        del_d3dres(uav.buffer);
+                        NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
                     }
+                    break;
 
-                    uav.buffer = rwBuffer;
-                    uav.slot = bind.bindPoint;
-                    uav.stages.insert(getStage(shader->target));
-                    uav.isOwned = false;
+                default:
+                    NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
+            }
 
-                    return;
-                }
+            auto& uav = pipeline.rwBuffers[bind.name];
+            if (uav.isOwned && uav.buffer != nullptr)
+            {
+                del_d3dres(uav.buffer);
             }
+
+            uav.buffer = rwBuffer;
+            uav.slot = bind.bindPoint;
+            uav.stages.insert(getStage(binding.target));
+            uav.isOwned = false;
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -527,22 +710,17 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
-                    return pipeline.rwBuffers[bind.name].buffer;
-                }
+            if (bind.dimension != SrvDimension::Buffer)
+            {
+                continue;
             }
+
+            NAU_ASSERT(pipeline.rwBuffers.contains(bufferName));
+            return pipeline.rwBuffers[bind.name].buffer;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -570,46 +748,41 @@ namespace nau
             pipeline.roBuffers.erase(bufferName.data());
         }
 
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    if (!pipeline.roBuffers.contains(bufferName))
-                    {
-                        unsigned flags = desc.flags;
-
-                        switch (bind.type)
-                        {
-                            case ShaderInputType::Texture:
-                                flags |= SBCF_BIND_SHADER_RES | SBCF_DYNAMIC;
-                                break;
+            if (bind.dimension != SrvDimension::Buffer)
+            {
+                continue;
+            }
 
-                            case ShaderInputType::Structured:
-                                flags |= SBCF_MISC_STRUCTURED | SBCF_BIND_SHADER_RES | SBCF_DYNAMIC;
-                                break;
+            if (!pipeline.roBuffers.contains(bufferName))
+            {
+                unsigned flags = desc.flags;
 
-                            default:
-                                NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
-                        }
+                switch (bind.type)
+                {
+                    case ShaderInputType::Texture:
+                        flags |= SBCF_BIND_SHADER_RES | SBCF_DYNAMIC;
+                        break;
 
-                        pipeline.roBuffers[bind.name] = {
-                            .buffer = d3d::create_sbuffer(desc.elementSize, desc.elementCount, flags, desc.format, desc.name),
-                            .slot = bind.bindPoint,
-                            .isOwned = true};
-                    }
+                    case ShaderInputType::Structured:
+                        flags |= SBCF_MISC_STRUCTURED | SBCF_BIND_SHADER_RES | SBCF_DYNAMIC;
+                        break;
 
-                    pipeline.roBuffers[bind.name].stages.insert(getStage(shader->target));
-                    return;
+                    default:
+                        NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
                 }
+
+                pipeline.roBuffers[bind.name] = {
+                    .buffer = d3d::create_sbuffer(desc.elementSize, desc.elementCount, flags, desc.format, desc.name),
+                    .slot = bind.bindPoint,
+                    .isOwned = true};
             }
+
+            pipeline.roBuffers[bind.name].stages.insert(getStage(binding.target));
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -623,33 +796,28 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.dimension != SrvDimension::Buffer ||
+                bind.type != ShaderInputType::Structured && bind.type != ShaderInputType::Texture)
             {
-                if (bind.dimension != SrvDimension::Buffer ||
-                    bind.type != ShaderInputType::Structured && bind.type != ShaderInputType::Texture)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.roBuffers.contains(bufferName));
+            NAU_ASSERT(pipeline.roBuffers.contains(bufferName));
 
-                    std::byte* ptr = nullptr;
-                    auto& srv = pipeline.roBuffers[bind.name];
+            std::byte* ptr = nullptr;
+            auto& srv = pipeline.roBuffers[bind.name];
 
-                    srv.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_WRITEONLY);
-                    NAU_ASSERT(ptr);
+            srv.buffer->lock(0, size, reinterpret_cast<void**>(&ptr), VBLOCK_WRITEONLY);
+            NAU_ASSERT(ptr);
 
-                    memcpy(ptr, data, size);
-                    srv.buffer->unlock();
+            memcpy(ptr, data, size);
+            srv.buffer->unlock();
 
-                    return;
-                }
-            }
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -661,66 +829,61 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.dimension != SrvDimension::Buffer)
             {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    const auto flags = roBuffer->getFlags();
+            const auto flags = roBuffer->getFlags();
 
-                    switch (bind.type)
+            switch (bind.type)
+            {
+                case ShaderInputType::Texture:
+                    if (!(flags & SBCF_BIND_SHADER_RES))
                     {
-                        case ShaderInputType::Texture:
-                            if (!(flags & SBCF_BIND_SHADER_RES))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
-                            }
-                            if (!(flags & SBCF_DYNAMIC))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
-                            }
-                            break;
-
-                        case ShaderInputType::Structured:
-                            if (!(flags & SBCF_MISC_STRUCTURED))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_MISC_STRUCTURED flag is missing!");
-                            }
-                            if (!(flags & SBCF_BIND_SHADER_RES))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
-                            }
-                            if (!(flags & SBCF_DYNAMIC))
-                            {
-                                NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
-                            }
-                            break;
-
-                        default:
-                            NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
+                        NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
+                    }
+                    if (!(flags & SBCF_DYNAMIC))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
                     }
+                    break;
 
-                    auto& srv = pipeline.roBuffers[bind.name];
-                    if (srv.isOwned && srv.buffer != nullptr)
+                case ShaderInputType::Structured:
+                    if (!(flags & SBCF_MISC_STRUCTURED))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_MISC_STRUCTURED flag is missing!");
+                    }
+                    if (!(flags & SBCF_BIND_SHADER_RES))
                     {
-                        del_d3dres(srv.buffer);
+                        NAU_FAILURE_ALWAYS("SBCF_BIND_SHADER_RES flag is missing!");
                     }
+                    if (!(flags & SBCF_DYNAMIC))
+                    {
+                        NAU_FAILURE_ALWAYS("SBCF_DYNAMIC flag is missing!");
+                    }
+                    break;
 
-                    srv.buffer = roBuffer;
-                    srv.slot = bind.bindPoint;
-                    srv.stages.insert(getStage(shader->target));
-                    srv.isOwned = false;
+                default:
+                    NAU_FAILURE_ALWAYS("Buffer '{}' has an unsupported type: '{}'", bufferName.data(), toString(bind.type));
+            }
 
-                    return;
-                }
+            auto& srv = pipeline.roBuffers[bind.name];
+            if (srv.isOwned && srv.buffer != nullptr)
+            {
+                del_d3dres(srv.buffer);
             }
+
+            srv.buffer = roBuffer;
+            srv.slot = bind.bindPoint;
+            srv.stages.insert(getStage(binding.target));
+            srv.isOwned = false;
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -731,22 +894,17 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.dimension != SrvDimension::Buffer)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.roBuffers.contains(bufferName));
-                    return pipeline.roBuffers[bind.name].buffer;
-                }
+            if (bind.dimension != SrvDimension::Buffer)
+            {
+                continue;
             }
+
+            NAU_ASSERT(pipeline.roBuffers.contains(bufferName));
+            return pipeline.roBuffers[bind.name].buffer;
         }
 
         NAU_FAILURE_ALWAYS("Buffer '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -769,53 +927,48 @@ namespace nau
             pipeline.rwTextures.erase(bufferName.data());
         }
 
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.type != ShaderInputType::UavRwTyped)
             {
-                if (bind.type != ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
+            if (pipeline.rwTextures.contains(bufferName))
+            {
+                switch (bind.dimension)
                 {
-                    if (pipeline.rwTextures.contains(bufferName))
-                    {
-                        switch (bind.dimension)
-                        {
-                            case SrvDimension::Texture1D:
-                            case SrvDimension::Texture1DArray:
-                                NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
-
-                            case SrvDimension::Texture2D:
-                                pipeline.rwTextures[bind.name] = {
-                                    .texture = d3d::create_tex(desc.image, desc.width, desc.height, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            case SrvDimension::Texture2DArray:
-                                pipeline.rwTextures[bind.name] = {
-                                    .texture = d3d::create_array_tex(desc.width, desc.height, desc.depthOrArraySize, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            case SrvDimension::Texture3D:
-                                pipeline.rwTextures[bind.name] = {
-                                    .texture = d3d::create_voltex(desc.width, desc.height, desc.depthOrArraySize, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            default:
-                                NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
-                        }
-                    }
+                    case SrvDimension::Texture1D:
+                    case SrvDimension::Texture1DArray:
+                        NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
+
+                    case SrvDimension::Texture2D:
+                        pipeline.rwTextures[bind.name] = {
+                            .texture = d3d::create_tex(desc.image, desc.width, desc.height, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
+
+                    case SrvDimension::Texture2DArray:
+                        pipeline.rwTextures[bind.name] = {
+                            .texture = d3d::create_array_tex(desc.width, desc.height, desc.depthOrArraySize, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
+
+                    case SrvDimension::Texture3D:
+                        pipeline.rwTextures[bind.name] = {
+                            .texture = d3d::create_voltex(desc.width, desc.height, desc.depthOrArraySize, desc.flags | TEXCF_UNORDERED, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
 
-                    pipeline.rwTextures[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
-                    return;
+                    default:
+                        NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
                 }
             }
+
+            pipeline.rwTextures[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -829,66 +982,61 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.type != ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
-                    auto& uav = pipeline.rwTextures[bind.name];
-
-                    switch (bind.dimension)
-                    {
-                        case SrvDimension::Texture1D:
-                        case SrvDimension::Texture1DArray:
-                            NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
+            if (bind.type != ShaderInputType::UavRwTyped)
+            {
+                continue;
+            }
 
-                        case SrvDimension::Texture2D:
-                        {
-                            int stride;
-                            void* ptr = nullptr;
+            NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
+            auto& uav = pipeline.rwTextures[bind.name];
 
-                            uav.texture->lockimg(&ptr, stride, 0, TEXLOCK_WRITE);
-                            NAU_ASSERT(ptr);
+            switch (bind.dimension)
+            {
+                case SrvDimension::Texture1D:
+                case SrvDimension::Texture1DArray:
+                    NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
 
-                            memcpy(ptr, data, size);
-                            uav.texture->unlockimg();
+                case SrvDimension::Texture2D:
+                {
+                    int stride;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    uav.texture->lockimg(&ptr, stride, 0, TEXLOCK_WRITE);
+                    NAU_ASSERT(ptr);
 
-                        case SrvDimension::Texture2DArray:
-                            NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
+                    memcpy(ptr, data, size);
+                    uav.texture->unlockimg();
 
-                        case SrvDimension::Texture3D:
-                        {
-                            int row;
-                            int slice;
-                            void* ptr = nullptr;
+                    break;
+                }
 
-                            uav.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_WRITE);
-                            NAU_ASSERT(ptr);
+                case SrvDimension::Texture2DArray:
+                    NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
 
-                            memcpy(ptr, data, size);
-                            uav.texture->unlockbox();
+                case SrvDimension::Texture3D:
+                {
+                    int row;
+                    int slice;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    uav.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_WRITE);
+                    NAU_ASSERT(ptr);
 
-                        default:
-                            NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
-                    }
+                    memcpy(ptr, data, size);
+                    uav.texture->unlockbox();
 
-                    return;
+                    break;
                 }
+
+                default:
+                    NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
             }
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -902,66 +1050,61 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.type != ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
-
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
-                    auto& uav = pipeline.rwTextures[bind.name];
+            const auto& bind = *binding.reflection;
 
-                    switch (bind.dimension)
-                    {
-                        case SrvDimension::Texture1D:
-                        case SrvDimension::Texture1DArray:
-                            NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
+            if (bind.type != ShaderInputType::UavRwTyped)
+            {
+                continue;
+            }
 
-                        case SrvDimension::Texture2D:
-                        {
-                            int stride;
-                            void* ptr = nullptr;
+            NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
+            auto& uav = pipeline.rwTextures[bind.name];
 
-                            uav.texture->lockimg(&ptr, stride, 0, TEXLOCK_READ);
-                            NAU_ASSERT(ptr);
+            switch (bind.dimension)
+            {
+                case SrvDimension::Texture1D:
+                case SrvDimension::Texture1DArray:
+                    NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
 
-                            memcpy(data, ptr, size);
-                            uav.texture->unlockimg();
+                case SrvDimension::Texture2D:
+                {
+                    int stride;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    uav.texture->lockimg(&ptr, stride, 0, TEXLOCK_READ);
+                    NAU_ASSERT(ptr);
 
-                        case SrvDimension::Texture2DArray:
-                            NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
+                    memcpy(data, ptr, size);
+                    uav.texture->unlockimg();
 
-                        case SrvDimension::Texture3D:
-                        {
-                            int row;
-                            int slice;
-                            void* ptr = nullptr;
+                    break;
+                }
 
-                            uav.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_READ);
-                            NAU_ASSERT(ptr);
+                case SrvDimension::Texture2DArray:
+                    NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
 
-                            memcpy(data, ptr, size);
-                            uav.texture->unlockbox();
+                case SrvDimension::Texture3D:
+                {
+                    int row;
+                    int slice;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    uav.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_READ);
+                    NAU_ASSERT(ptr);
 
-                        default:
-                            NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
-                    }
+                    memcpy(data, ptr, size);
+                    uav.texture->unlockbox();
 
-                    return;
+                    break;
                 }
+
+                default:
+                    NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
             }
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -973,71 +1116,66 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.type != ShaderInputType::UavRwTyped)
             {
-                if (bind.type != ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    TextureInfo info = {};
-                    rwTexture->getinfo(info);
+            TextureInfo info = {};
+            rwTexture->getinfo(info);
+
+            if (!(info.cflg & TEXCF_UNORDERED))
+            {
+                NAU_FAILURE_ALWAYS("TEXCF_UNORDERED flag is missing!");
+            }
+
+            switch (bind.dimension)
+            {
+                case SrvDimension::Texture1D:
+                case SrvDimension::Texture1DArray:
+                    NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
 
-                    if (!(info.cflg & TEXCF_UNORDERED))
+                case SrvDimension::Texture2D:
+                    if (info.resType != RES3D_TEX)
                     {
-                        NAU_FAILURE_ALWAYS("TEXCF_UNORDERED flag is missing!");
+                        NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_TEX");
                     }
+                    break;
 
-                    switch (bind.dimension)
+                case SrvDimension::Texture2DArray:
+                    if (info.resType != RES3D_ARRTEX)
                     {
-                        case SrvDimension::Texture1D:
-                        case SrvDimension::Texture1DArray:
-                            NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
-
-                        case SrvDimension::Texture2D:
-                            if (info.resType != RES3D_TEX)
-                            {
-                                NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_TEX");
-                            }
-                            break;
-
-                        case SrvDimension::Texture2DArray:
-                            if (info.resType != RES3D_ARRTEX)
-                            {
-                                NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_ARRTEX");
-                            }
-                            break;
-
-                        case SrvDimension::Texture3D:
-                            if (info.resType != RES3D_VOLTEX)
-                            {
-                                NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_VOLTEX");
-                            }
-                            break;
-
-                        default:
-                            NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
+                        NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_ARRTEX");
                     }
+                    break;
 
-                    auto& rwTex = pipeline.rwTextures[bind.name];
-                    if (rwTex.isOwned && rwTex.texture != nullptr)
+                case SrvDimension::Texture3D:
+                    if (info.resType != RES3D_VOLTEX)
                     {
-                        del_d3dres(rwTex.texture);
+                        NAU_FAILURE_ALWAYS("The texture type in the material does not match the provided texture. It should be RES3D_VOLTEX");
                     }
+                    break;
 
-                    rwTex.textureView = nullptr;
-                    rwTex.texture = rwTexture;
-                    rwTex.slot = bind.bindPoint;
-                    rwTex.stages.insert(getStage(shaderAsset->getShader()->target));
+                default:
+                    NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
+            }
 
-                    return;
-                }
+            auto& rwTex = pipeline.rwTextures[bind.name];
+            if (rwTex.isOwned && rwTex.texture != nullptr)
+            {
+                del_d3dres(rwTex.texture);
             }
+
+            rwTex.textureView = nullptr;
+            rwTex.texture = rwTexture;
+            rwTex.slot = bind.bindPoint;
+            rwTex.stages.insert(getStage(shaderAsset->getShader()->target));
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -1048,22 +1186,17 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.type != ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
+            const auto& bind = *binding.reflection;
 
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
-                    return pipeline.rwTextures[bind.name].getTexture();
-                }
+            if (bind.type != ShaderInputType::UavRwTyped)
+            {
+                continue;
             }
+
+            NAU_ASSERT(pipeline.rwTextures.contains(bufferName));
+            return pipeline.rwTextures[bind.name].getTexture();
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -1086,53 +1219,48 @@ namespace nau
             pipeline.roTextures.erase(bufferName.data());
         }
 
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.type == ShaderInputType::UavRwTyped)
             {
-                if (bind.type == ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
+            if (pipeline.roTextures.contains(bufferName))
+            {
+                switch (bind.dimension)
                 {
-                    if (pipeline.roTextures.contains(bufferName))
-                    {
-                        switch (bind.dimension)
-                        {
-                            case SrvDimension::Texture1D:
-                            case SrvDimension::Texture1DArray:
-                                NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
-
-                            case SrvDimension::Texture2D:
-                                pipeline.roTextures[bind.name] = {
-                                    .texture = d3d::create_tex(desc.image, desc.width, desc.height, desc.flags, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            case SrvDimension::Texture2DArray:
-                                pipeline.roTextures[bind.name] = {
-                                    .texture = d3d::create_array_tex(desc.width, desc.height, desc.depthOrArraySize, desc.flags, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            case SrvDimension::Texture3D:
-                                pipeline.roTextures[bind.name] = {
-                                    .texture = d3d::create_voltex(desc.width, desc.height, desc.depthOrArraySize, desc.flags, desc.levels, desc.name),
-                                    .slot = bind.bindPoint};
-                                break;
-
-                            default:
-                                NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
-                        }
-                    }
+                    case SrvDimension::Texture1D:
+                    case SrvDimension::Texture1DArray:
+                        NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
+
+                    case SrvDimension::Texture2D:
+                        pipeline.roTextures[bind.name] = {
+                            .texture = d3d::create_tex(desc.image, desc.width, desc.height, desc.flags, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
+
+                    case SrvDimension::Texture2DArray:
+                        pipeline.roTextures[bind.name] = {
+                            .texture = d3d::create_array_tex(desc.width, desc.height, desc.depthOrArraySize, desc.flags, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
+
+                    case SrvDimension::Texture3D:
+                        pipeline.roTextures[bind.name] = {
+                            .texture = d3d::create_voltex(desc.width, desc.height, desc.depthOrArraySize, desc.flags, desc.levels, desc.name),
+                            .slot = bind.bindPoint};
+                        break;
 
-                    pipeline.roTextures[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
-                    return;
+                    default:
+                        NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
                 }
             }
+
+            pipeline.roTextures[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -1146,66 +1274,61 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
-            {
-                if (bind.type == ShaderInputType::UavRwTyped)
-                {
-                    continue;
-                }
-
-                if (bind.name == bufferName)
-                {
-                    NAU_ASSERT(pipeline.roTextures.contains(bufferName));
-                    auto& srv = pipeline.roTextures[bind.name];
+            const auto& bind = *binding.reflection;
 
-                    switch (bind.dimension)
-                    {
-                        case SrvDimension::Texture1D:
-                        case SrvDimension::Texture1DArray:
-                            NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
+            if (bind.type == ShaderInputType::UavRwTyped)
+            {
+                continue;
+            }
 
-                        case SrvDimension::Texture2D:
-                        {
-                            int stride;
-                            void* ptr = nullptr;
+            NAU_ASSERT(pipeline.roTextures.contains(bufferName));
+            auto& srv = pipeline.roTextures[bind.name];
 
-                            srv.texture->lockimg(&ptr, stride, 0, TEXLOCK_WRITE);
-                            NAU_ASSERT(ptr);
+            switch (bind.dimension)
+            {
+                case SrvDimension::Texture1D:
+                case SrvDimension::Texture1DArray:
+                    NAU_FAILURE_ALWAYS("Not supported in Dagor's render");
 
-                            memcpy(ptr, data, size);
-                            srv.texture->unlockimg();
+                case SrvDimension::Texture2D:
+                {
+                    int stride;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    srv.texture->lockimg(&ptr, stride, 0, TEXLOCK_WRITE);
+                    NAU_ASSERT(ptr);
 
-                        case SrvDimension::Texture2DArray:
-                            NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
+                    memcpy(ptr, data, size);
+                    srv.texture->unlockimg();
 
-                        case SrvDimension::Texture3D:
-                        {
-                            int row;
-                            int slice;
-                            void* ptr = nullptr;
+                    break;
+                }
 
-                            srv.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_WRITE);
-                            NAU_ASSERT(ptr);
+                case SrvDimension::Texture2DArray:
+                    NAU_FAILURE_ALWAYS("No lock function for Texture2DArray");
 
-                            memcpy(ptr, data, size);
-                            srv.texture->unlockbox();
+                case SrvDimension::Texture3D:
+                {
+                    int row;
+                    int slice;
+                    void* ptr = nullptr;
 
-                            break;
-                        }
+                    srv.texture->lockbox(&ptr, row, slice, 0, TEXLOCK_WRITE);
+                    NAU_ASSERT(ptr);
 
-                        default:
-                            NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
-                    }
+                    memcpy(ptr, data, size);
+                    srv.texture->unlockbox();
 
-                    return;
+                    break;
                 }
+
+                default:
+                    NAU_FAILURE_ALWAYS("Texture '{}' has an unsupported dimension: '{}'", bufferName.data(), toString(bind.dimension));
             }
+
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -1217,32 +1340,27 @@ namespace nau
         NAU_ASSERT(m_pipelines.contains(pipelineName));
 
         auto& pipeline = m_pipelines[pipelineName.data()];
-        for (const auto& shaderAsset : pipeline.shaders)
+        for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
         {
-            auto* shader = shaderAsset->getShader();
-            for (const auto& bind : shader->reflection.inputBinds)
+            const auto& bind = *binding.reflection;
+
+            if (bind.type != ShaderInputType::Texture || bind.dimension == SrvDimension::Buffer)
             {
-                if (bind.type != ShaderInputType::Texture || bind.dimension == SrvDimension::Buffer)
-                {
-                    continue;
-                }
+                continue;
+            }
 
-                if (bind.name == bufferName)
-                {
-                    auto& srv = pipeline.roTextures[bind.name];
-                    if (srv.isOwned && srv.texture != nullptr)
-                    {
-                        del_d3dres(srv.texture);
-                    }
+            auto& srv = pipeline.roTextures[bind.name];
+            if (srv.isOwned && srv.texture != nullptr)
+            {
+                del_d3dres(srv.texture);
+            }
 
-                    srv.textureView = nullptr;
-                    srv.texture = roTexture;
-                    srv.slot = bind.bindPoint;
-                    srv.stages.insert(getStage(shaderAsset->getShader()->target));
+            srv.textureView = nullptr;
+            srv.texture = roTexture;
+            srv.slot = bind.bindPoint;
+            srv.stages.insert(getStage(shaderAsset->getShader()->target));
 
-                    return;
-                }
-            }
+            return;
         }
 
         NAU_FAILURE_ALWAYS("Texture '{}' not found in pipeline '{}'", bufferName.data(), pipelineName.data());
@@ -1255,22 +1373,17 @@ namespace nau
         if (m_pipelines.contains(pipelineName))
         {
             auto& pipeline = m_pipelines[pipelineName.data()];
-            for (const auto& shaderAsset : pipeline.shaders)
+            for (const ResourceBinding& binding : findBindings(pipeline, bufferName))
             {
-                auto* shader = shaderAsset->getShader();
-                for (const auto& bind : shader->reflection.inputBinds)
-                {
-                    if (bind.type != ShaderInputType::Texture)
-                    {
-                        continue;
-                    }
+                const auto& bind = *binding.reflection;
 
-                    if (bind.name == bufferName)
-                    {
-                        NAU_ASSERT(pipeline.roTextures.contains(bufferName));
-                        return pipeline.roTextures[bind.name].getTexture();
-                    }
+                if (bind.type != ShaderInputType::Texture)
+                {
+                    continue;
                 }
+
+                NAU_ASSERT(pipeline.roTextures.contains(bufferName));
+                return pipeline.roTextures[bind.name].getTexture();
             }
         }
 
@@ -1283,6 +1396,55 @@ namespace nau
         d3d::dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
     }
 
+    MaterialAssetView::PropertyHandle MaterialAssetView::findProperty(eastl::string_view pipelineName, eastl::string_view propertyName)
+    {
+        auto pipeline = m_pipelines.find_as(pipelineName);
+        if (pipeline == m_pipelines.end())
+        {
+            return {};
+        }
+
+        auto property = pipeline->second.properties.find_as(propertyName);
+        if (property == pipeline->second.properties.end())
+        {
+            return {};
+        }
+
+        return PropertyHandle{&pipeline->second, &property->second};
+    }
+
+    eastl::shared_ptr<const MaterialAssetView::BindingTable> MaterialAssetView::makeBindingTable(eastl::span<const ShaderAssetView::Ptr> shaders)
+    {
+        auto bindings = eastl::make_shared<BindingTable>();
+
+        for (const ShaderAssetView::Ptr& shaderAsset : shaders)
+        {
+            const Shader* shader = shaderAsset->getShader();
+            for (const auto& bind : shader->reflection.inputBinds)
+            {
+                (*bindings)[bind.name].push_back({.reflection = &bind, .target = shader->target});
+            }
+        }
+
+        return bindings;
+    }
+
+    eastl::span<const MaterialAssetView::ResourceBinding> MaterialAssetView::findBindings(const Pipeline& pipeline, eastl::string_view name)
+    {
+        if (pipeline.bindings == nullptr)
+        {
+            return {};
+        }
+
+        auto binds = pipeline.bindings->find_as(name);
+        if (binds == pipeline.bindings->end())
+        {
+            return {};
+        }
+
+        return {binds->second.data(), binds->second.size()};
+    }
+
     async::Task<MaterialAssetView::Pipeline> MaterialAssetView::makeMasterPipeline(eastl::string_view pipelineName, const MaterialPipeline& materialPipeline, eastl::span<ShaderAssetView::Ptr> shaders)
     {
         struct TextureLoadingResult
@@ -1350,7 +1512,8 @@ namespace nau
                                     .reflection = &bind,
                                     .buffer = d3d::create_cb(bind.bufferDesc.size, SBCF_DYNAMIC),
                                     .slot = bind.bindPoint,
-                                    .isDirty = true};
+                                    .isDirty = true,
+                                    .data = eastl::vector<std::byte>(bind.bufferDesc.size)};
                             }
 
                             constantBuffers[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
@@ -1363,7 +1526,7 @@ namespace nau
                                     .reflection = &var,
                                     .parentBuffer = &constantBuffers[bind.name],
                                     .currentValue = eastl::move(materialPipeline.properties.at(var.name)),
-                                    .masterValue = nullptr,
+                                    .masterProperty = nullptr,
                                     .isMasterValue = false};
                             }
                         }
@@ -1498,7 +1661,7 @@ namespace nau
                     .reflection = property.reflection,
                     .parentBuffer = nullptr,
                     .currentValue = eastl::move(materialPipeline.properties.at(name)),
-                    .masterValue = nullptr,
+                    .masterProperty = nullptr,
                     .isMasterValue = false};
             }
             else
@@ -1507,7 +1670,7 @@ namespace nau
                     .reflection = property.reflection,
                     .parentBuffer = nullptr,
                     .currentValue = nullptr,
-                    .masterValue = &property.currentValue,
+                    .masterProperty = &property,
                     .isMasterValue = true};
             }
         }
@@ -1539,7 +1702,8 @@ namespace nau
                 .reflection = cb.reflection,
                 .buffer = d3d::create_cb(cb.reflection->bufferDesc.size, SBCF_DYNAMIC),
                 .slot = cb.slot,
-                .isDirty = true};
+                .isDirty = true,
+                .data = eastl::vector<std::byte>(cb.reflection->bufferDesc.size)};
 
             for (const auto& var : cb.reflection->bufferDesc.variables)
             {
@@ -1596,6 +1760,8 @@ namespace nau
         }
 
         co_return Pipeline{
+            .shaders = masterPipeline.shaders,
+            .bindings = masterPipeline.bindings,
             .properties = eastl::move(properties),
             .constantBuffers = eastl::move(constantBuffers),
             .samplerTextures = eastl::move(textures),
@@ -1737,10 +1903,26 @@ namespace nau
         }
     }
 
+    void MaterialAssetView::writePropertyValue(const ConstantBufferVariable& property, std::byte* data)
+    {
+        const ConstantBufferVariable& source = property.isMasterValue ? *property.masterProperty : property;
+        if (source.isRawValue)
+        {
+            memcpy(data, source.parentBuffer->data.data() + source.reflection->startOffset, source.reflection->size);
+        }
+        else
+        {
+            writeRuntimeValue(*property.reflection, source.currentValue, data);
+        }
+    }
+
     void MaterialAssetView::updateBuffers(eastl::string_view pipelineName)
     {
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        updateBuffers(m_pipelines[pipelineName.data()]);
+    }
 
+    void MaterialAssetView::updateBuffers(Pipeline& pipeline)
+    {
         for (auto& [name, cb] : pipeline.constantBuffers)
         {
             if (!cb.isDirty)
@@ -1748,178 +1930,29 @@ namespace nau
                 continue;
             }
 
-            Sbuffer* buf = cb.buffer;
-
-            std::byte* data = nullptr;
-            buf->lock(0, cb.reflection->bufferDesc.size, reinterpret_cast<void**>(&data), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
-            NAU_ASSERT(buf);
-
             for (const auto& var : cb.reflection->bufferDesc.variables)
             {
                 auto& property = pipeline.properties[var.name];
 
-                switch (var.type.svc)
+                // Values set through the handles are already written to the buffer data.
+                // Values inherited from the master material are always rewritten: the master value could be changed.
+                if (property.isRawValue || (!property.isValueDirty && !property.isMasterValue))
                 {
-                    case ShaderVariableClass::Scalar:
-                    {
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Int:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<int32_t>(*property.masterValue)
-                                                 : *runtimeValueCast<int32_t>(property.currentValue);
+                    continue;
+                }
 
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            case ShaderVariableType::Uint:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<uint32_t>(*property.masterValue)
-                                                 : *runtimeValueCast<uint32_t>(property.currentValue);
+                writePropertyValue(property, cb.data.data() + var.startOffset);
+                property.isValueDirty = false;
+            }
 
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            case ShaderVariableType::Float:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<float>(*property.masterValue)
-                                                 : *runtimeValueCast<float>(property.currentValue);
+            Sbuffer* buf = cb.buffer;
+            NAU_ASSERT(buf);
 
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    case ShaderVariableClass::Vector:
-                    {
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Float:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 2:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector2>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector2>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            case ShaderVariableType::Int:
-                            case ShaderVariableType::Uint:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 2:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector2>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector2>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    case ShaderVariableClass::MatrixColumns:
-                    {
-                        NAU_ASSERT(var.type.columns == var.type.rows);
+            std::byte* data = nullptr;
+            buf->lock(0, cb.data.size(), reinterpret_cast<void**>(&data), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+            NAU_ASSERT(data);
 
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Float:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Matrix3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Matrix3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Matrix4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Matrix4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    default:
-                        NAU_FAILURE_ALWAYS("Not implemented");
-                }
-            }
+            memcpy(data, cb.data.data(), cb.data.size());
 
             buf->unlock();
             cb.isDirty = false;
@@ -1930,8 +1963,11 @@ namespace nau
 
     void MaterialAssetView::updateRenderState(eastl::string_view pipelineName)
     {
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        updateRenderState(m_pipelines[pipelineName.data()]);
+    }
 
+    void MaterialAssetView::updateRenderState(Pipeline& pipeline)
+    {
         shaders::RenderState renderState;
 
         bool needNewRenderState = false;
@@ -1969,6 +2005,23 @@ namespace nau
         pipeline.isRenderStateDirty = false;
     }
 
+    void MaterialAssetView::indexPipelines()
+    {
+        m_pipelineIds.clear();
+        m_pipelineIds.reserve(m_pipelines.size());
+
+        for (auto& [name, pipeline] : m_pipelines)
+        {
+            m_pipelineIds.emplace(NameId{name}, &pipeline);
+        }
+    }
+
+    MaterialAssetView::Pipeline* MaterialAssetView::findPipeline(NameId pipelineName) const
+    {
+        auto iter = m_pipelineIds.find(pipelineName);
+        return iter != m_pipelineIds.end() ? iter->second : nullptr;
+    }
+
     bool MaterialAssetView::hasComputeShader() const
     {
         for (const auto& [name, pipeline] : m_pipelines)
@@ -2075,13 +2128,15 @@ namespace nau
 
             materialAssetView->m_pipelines.emplace(result.name, std::move(result.pipeline));
             materialAssetView->m_pipelines[result.name].programID = ShaderAssetView::makeShaderProgram(result.shaders);
+            materialAssetView->m_pipelines[result.name].bindings = makeBindingTable(result.shaders);
             materialAssetView->m_pipelines[result.name].shaders = eastl::move(result.shaders);
 
             materialAssetView->updateBuffers(result.name);
             materialAssetView->updateRenderState(result.name);
         }
 
-        materialAssetView->m_defaultProgram = materialAssetView->m_pipelines.begin()->first;
+        materialAssetView->indexPipelines();
+        materialAssetView->m_defaultProgram = NameId{materialAssetView->m_pipelines.begin()->first};
         materialAssetView->m_name = eastl::move(material.name);
         materialAssetView->m_nameHash = nau::strings::constHash(materialAssetView->m_name.data());
 
@@ -2093,24 +2148,25 @@ namespace nau
         bindPipeline(m_defaultProgram);
     }
 
-    void MasterMaterialAssetView::bindPipeline(eastl::string_view pipelineName)
+    void MasterMaterialAssetView::bindPipeline(NameId pipelineName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
+        Pipeline* const pipelinePtr = findPipeline(pipelineName);
+        NAU_ASSERT(pipelinePtr, "Unknown pipeline ({})", pipelineName.getString());
 
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = *pipelinePtr;
 
         d3d::set_program(pipeline.programID);
 
-        setGlobals(pipelineName);
+        setGlobals(pipeline);
 
         if (pipeline.isDirty)
         {
-            updateBuffers(pipelineName);
+            updateBuffers(pipeline);
         }
 
         if (pipeline.isRenderStateDirty)
         {
-            updateRenderState(pipelineName);
+            updateRenderState(pipeline);
         }
 
         for (const auto& [name, cb] : pipeline.constantBuffers)
@@ -2195,10 +2251,9 @@ namespace nau
         return m_pipelines.at(pipelineName.data()).programID;
     }
 
-    void MasterMaterialAssetView::setGlobals(eastl::string_view pipelineName)
+    void MasterMaterialAssetView::resolveGlobalBuffers(Pipeline& pipeline)
     {
-        static constexpr auto alignment = 16;
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        pipeline.globalBuffers.clear();
 
         for (const auto& shaderAsset : pipeline.shaders)
         {
@@ -2210,138 +2265,58 @@ namespace nau
                     continue;
                 }
 
-                eastl::vector<std::byte> buffer;
-                buffer.resize(bind.bufferDesc.size);
+                GlobalConstantBuffer& globalBuffer = pipeline.globalBuffers.push_back();
+                globalBuffer.target = shaderAsset->getShader()->target;
+                globalBuffer.bindPoint = bind.bindPoint;
+                globalBuffer.data = shader_globals::PackedConstantBuffer{bind.bufferDesc.size};
 
                 for (const auto& var : bind.bufferDesc.variables)
                 {
-                    if (var.type.elements > 0 || var.type.svc == ShaderVariableClass::Struct)
+                    if (!isSupportedGlobalVariableType(var.type))
                     {
-                        void* value = nullptr;
-                        size_t size = 0;
-                        shader_globals::getVariable(var.name, &size, &value);
-                        memcpy(buffer.data() + var.startOffset, value, size);
-
+                        NAU_FAILURE_ALWAYS("Not implemented");
                         continue;
                     }
 
-                    switch (var.type.svc)
-                    {
-                        case ShaderVariableClass::Scalar:
-                        {
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Int:
-                                case ShaderVariableType::Uint:
-                                case ShaderVariableType::Float:
-                                {
-                                    void* value = nullptr;
-                                    size_t size = 0;
-                                    shader_globals::getVariable(var.name, &size, &value);
-                                    memcpy(buffer.data() + var.startOffset, value, size);
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        case ShaderVariableClass::Vector:
-                        {
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Float:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 2:
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                case ShaderVariableType::Int:
-                                case ShaderVariableType::Uint:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 2:
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        case ShaderVariableClass::MatrixColumns:
-                        {
-                            NAU_ASSERT(var.type.columns == var.type.rows);
+                    const shader_globals::VariableId variableId = shader_globals::findVariable(var.name);
+                    NAU_FATAL(variableId != shader_globals::VariableId::Invalid, "Global shader variable not found: {}", var.name);
 
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Float:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        default:
-                            NAU_FAILURE_ALWAYS("Not implemented");
-                    }
+                    globalBuffer.data.addVariable(variableId, var.startOffset, var.size);
                 }
+            }
+        }
 
-                const ShaderTarget shaderTarget = shaderAsset->getShader()->target;
-                const unsigned regCount = std::max(1U, static_cast<unsigned>(buffer.size() / alignment));
+        pipeline.areGlobalBuffersResolved = true;
+    }
 
-                if (shaderTarget == ShaderTarget::Vertex)
-                {
-                    d3d::set_vs_constbuffer_size(regCount);
-                }
-                else if (shaderTarget == ShaderTarget::Compute)
-                {
-                    d3d::set_cs_constbuffer_size(regCount);
-                }
+    void MasterMaterialAssetView::setGlobals(Pipeline& pipeline)
+    {
+        static constexpr auto alignment = 16;
+
+        if (!pipeline.areGlobalBuffersResolved)
+        {
+            resolveGlobalBuffers(pipeline);
+        }
 
-                d3d::set_const(getStage(shaderTarget), bind.bindPoint, buffer.data(), regCount);
+        for (GlobalConstantBuffer& globalBuffer : pipeline.globalBuffers)
+        {
+            // Only the changed variables are copied, but the whole buffer is set:
+            // the same slot is shared with the other materials.
+            globalBuffer.data.update();
+
+            const eastl::span<const std::byte> data = globalBuffer.data.getData();
+            const unsigned regCount = std::max(1U, static_cast<unsigned>(data.size() / alignment));
+
+            if (globalBuffer.target == ShaderTarget::Vertex)
+            {
+                d3d::set_vs_constbuffer_size(regCount);
             }
+            else if (globalBuffer.target == ShaderTarget::Compute)
+            {
+                d3d::set_cs_constbuffer_size(regCount);
+            }
+
+            d3d::set_const(getStage(globalBuffer.target), globalBuffer.bindPoint, data.data(), regCount);
         }
     }
 
@@ -2415,6 +2390,7 @@ namespace nau
             materialAssetView->updateRenderState(name);
         }
 
+        materialAssetView->indexPipelines();
         materialAssetView->m_name = eastl::move(material.name);
         materialAssetView->m_nameHash = nau::strings::constHash(materialAssetView->m_name.data());
 
@@ -2426,29 +2402,30 @@ namespace nau
         bindPipeline(m_masterMaterial->m_defaultProgram);
     }
 
-    void MaterialInstanceAssetView::bindPipeline(eastl::string_view pipelineName)
+    void MaterialInstanceAssetView::bindPipeline(NameId pipelineName)
     {
-        NAU_ASSERT(m_masterMaterial->m_pipelines.contains(pipelineName));
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
+        Pipeline* const masterPipelinePtr = m_masterMaterial->findPipeline(pipelineName);
+        Pipeline* const instancePipelinePtr = findPipeline(pipelineName);
+        NAU_ASSERT(masterPipelinePtr && instancePipelinePtr, "Unknown pipeline ({})", pipelineName.getString());
 
-        auto& masterPipeline = m_masterMaterial->m_pipelines[pipelineName.data()];
-        auto& instancePipeline = m_pipelines[pipelineName.data()];
+        auto& masterPipeline = *masterPipelinePtr;
+        auto& instancePipeline = *instancePipelinePtr;
 
         d3d::set_program(masterPipeline.programID);
 
-        m_masterMaterial->setGlobals(pipelineName);
+        m_masterMaterial->setGlobals(masterPipeline);
 
-        syncBuffers(masterPipeline, instancePipeline);
+        syncMasterProperties(masterPipeline, instancePipeline);
         syncTextures(masterPipeline, instancePipeline);
 
         if (instancePipeline.isDirty)
         {
-            updateBuffers(pipelineName);
+            updateBuffers(instancePipeline);
         }
 
         if (instancePipeline.isRenderStateDirty)
         {
-            updateRenderState(pipelineName);
+            updateRenderState(instancePipeline);
         }
 
         // Constant buffers, textures, and samplers are always identical to those in the master material.
@@ -2559,8 +2536,15 @@ namespace nau
         return m_masterMaterial->getPipelineProgram(pipelineName);
     }
 
-    void MaterialInstanceAssetView::syncBuffers(const Pipeline& masterPipeline, Pipeline& instancePipeline)
+    void MaterialAssetView::syncMasterProperties(const Pipeline& masterPipeline, Pipeline& instancePipeline)
     {
+        if (instancePipeline.syncedMasterPropertiesVersion == masterPipeline.propertiesVersion)
+        {
+            return;
+        }
+
+        instancePipeline.syncedMasterPropertiesVersion = masterPipeline.propertiesVersion;
+
         for (const auto& [name, property] : masterPipeline.properties)
         {
             auto& instProperty = instancePipeline.properties[name];
@@ -8,7 +8,7 @@
 
 namespace nau
 {
-    async::Task<nau::Ptr<StaticMeshAssetView>> StaticMeshAssetView::createFromAssetAccessor(nau::Ptr<> accessor)
+    async::Task<nau::Ptr<StaticMeshAssetView>> StaticMeshAssetView::createFromAssetAccessor(nau::Ptr<> accessor, eastl::string uploadPriorityKey)
     {
         using namespace nau::async;
 
@@ -19,7 +19,7 @@ namespace nau
         auto& meshAccessor = accessor->as<IMeshAssetAccessor&>();
         auto meshAssetView = rtti::createInstance<StaticMeshAssetView>();
 
-        meshAssetView->m_mesh = co_await StaticMesh::createFromStaticMeshAccessor(meshAccessor);
+        meshAssetView->m_mesh = co_await StaticMesh::createFromStaticMeshAccessor(meshAccessor, std::move(uploadPriorityKey));
 
         co_return meshAssetView;
     }
@@ -4,7 +4,9 @@
 
 #include "graphics_assets/static_meshes/static_mesh.h"
 
+#include "graphics_assets/gpu_upload_queue.h"
 #include "nau/async/task.h"
+#include "nau/service/service_provider.h"
 
 nau::StaticMesh::StaticMesh()
 {
@@ -65,7 +67,20 @@ eastl::span<nau::math::float4> getTangents(const eastl::span<uint16_t>& indices,
     return span;
 }
 
-nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMeshAccessor(IMeshAssetAccessor& meshAccessor)
+namespace
+{
+    Sbuffer* createBufferWithData(Sbuffer* buffer, const void* data, size_t size)
+    {
+        std::byte* mem = nullptr;
+        buffer->lock(0, size, reinterpret_cast<void**>(&mem), VBLOCK_WRITEONLY);
+        memcpy(mem, data, size);
+        buffer->unlock();
+
+        return buffer;
+    }
+}  // namespace
+
+nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMeshAccessor(IMeshAssetAccessor& meshAccessor, eastl::string uploadPriorityKey)
 {
     nau::StaticMesh::Ptr mesh = rtti::createInstance<StaticMesh>();
 
@@ -73,49 +88,22 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
 
     const auto meshDesc = meshAccessor.getDescription();
 
-    d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
-
-    auto indexBufferTask = [](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc) -> nau::async::Task<std::tuple<Sbuffer*, size_t>>
+    // CPU side: geometry is copied from the accessor and the tangents are calculated on the caller (worker) thread,
+    // only the buffers creation and the upload are made through the GPU upload queue.
+    eastl::vector<uint16_t> indices(meshDesc.indexCount);
+    if (!indices.empty())
     {
-        const size_t bufferSize = meshDesc.indexCount * sizeof(uint16_t);
-        if (bufferSize == 0)
-        {
-            co_return std::tuple{nullptr, bufferSize};
-        }
-
-        Sbuffer* ibuf;
-        {
-            ibuf = d3d::create_ib(bufferSize, SBCF_DYNAMIC, u8"IndexBuf");  // (position_float4 + color_float4) * 3
-
-            std::byte* mem = nullptr;
-            ibuf->lock(0, bufferSize, reinterpret_cast<void**>(&mem), VBLOCK_WRITEONLY);  //(0, nullptr, reinterpret_cast<void**>(&mem));
-            scope_on_leave
-            {
-                ibuf->unlock();
-            };
-
-            accessor.copyIndices(mem, bufferSize, ElementFormat::Uint16).ignore();
-        }
+        meshAccessor.copyIndices(indices.data(), indices.size() * sizeof(uint16_t), ElementFormat::Uint16).ignore();
+    }
 
-        co_return std::tuple{std::move(ibuf), bufferSize};
-    }(meshAccessor, meshDesc);
+    eastl::vector<nau::math::float3> positions(meshDesc.vertexCount);
+    eastl::vector<nau::math::float3> normals(meshDesc.vertexCount);
+    eastl::vector<nau::math::float4> tangents(meshDesc.vertexCount);
+    eastl::vector<nau::math::float2> texCoords(meshDesc.vertexCount);
 
-    auto vertexBufferTask = [&](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc) -> nau::async::Task<std::tuple<Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t>>
+    if (meshDesc.vertexCount != 0)
     {
-        const size_t posBufferSize = meshDesc.vertexCount * sizeof(float[3]);
-        const size_t nrmBufferSize = meshDesc.vertexCount * sizeof(float[3]);
-        const size_t tangentBufferSize = meshDesc.vertexCount * sizeof(float[4]);
-        const size_t texBufferSize = meshDesc.vertexCount * sizeof(float[2]);
-
-        if (meshDesc.vertexCount == 0)
-        {
-            co_return std::tuple{nullptr, posBufferSize,
-                                 nullptr, nrmBufferSize,
-                                 nullptr, tangentBufferSize,
-                                 nullptr, texBufferSize};
-        }
-
-        eastl::array<OutputVertAttribDescription,4> outLayout;
+        eastl::array<OutputVertAttribDescription, 4> outLayout;
 
         auto& posDesc = outLayout[0];
         {
@@ -124,6 +112,8 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             posDesc.elementFormat = ElementFormat::Float;
             posDesc.attributeType = AttributeType::Vec3;
             posDesc.byteStride = 0;
+            posDesc.outputBuffer = positions.data();
+            posDesc.outputBufferSize = positions.size() * sizeof(nau::math::float3);
         }
 
         auto& nrmDesc = outLayout[1];
@@ -133,6 +123,8 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             nrmDesc.elementFormat = ElementFormat::Float;
             nrmDesc.attributeType = AttributeType::Vec3;
             nrmDesc.byteStride = 0;
+            nrmDesc.outputBuffer = normals.data();
+            nrmDesc.outputBufferSize = normals.size() * sizeof(nau::math::float3);
         }
 
         auto& tangentDesc = outLayout[2];
@@ -142,6 +134,8 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             tangentDesc.elementFormat = ElementFormat::Float;
             tangentDesc.attributeType = AttributeType::Vec4;
             tangentDesc.byteStride = 0;
+            tangentDesc.outputBuffer = tangents.data();
+            tangentDesc.outputBufferSize = tangents.size() * sizeof(nau::math::float4);
         }
 
         auto& uv0Desc = outLayout[3];
@@ -151,113 +145,72 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             uv0Desc.elementFormat = ElementFormat::Float;
             uv0Desc.attributeType = AttributeType::Vec2;
             uv0Desc.byteStride = 0;
+            uv0Desc.outputBuffer = texCoords.data();
+            uv0Desc.outputBufferSize = texCoords.size() * sizeof(nau::math::float2);
         }
 
-        Sbuffer* pbuf;
-        Sbuffer* nbuf;
-        Sbuffer* tangentbuf;
-        Sbuffer* tbuf;
-        {
-            pbuf = d3d::create_vb(posBufferSize, SBCF_DYNAMIC, u8"posBuf");
-            nbuf = d3d::create_vb(nrmBufferSize, SBCF_DYNAMIC, u8"normBuf");
-            tangentbuf = d3d::create_vb(tangentBufferSize, SBCF_DYNAMIC, u8"tangentBuf");
-            tbuf = d3d::create_vb(texBufferSize, SBCF_DYNAMIC, u8"texBuf");
-
-            std::byte* posMem = nullptr;
-            pbuf->lock(0, posBufferSize, reinterpret_cast<void**>(&posMem), VBLOCK_WRITEONLY);
-
-            std::byte* nrmMem = nullptr;
-            nbuf->lock(0, nrmBufferSize, reinterpret_cast<void**>(&nrmMem), VBLOCK_WRITEONLY);
-
-            std::byte* tangentMem = nullptr;
-            tangentbuf->lock(0, tangentBufferSize, reinterpret_cast<void**>(&tangentMem), VBLOCK_WRITEONLY);
-
-            std::byte* texMem = nullptr;
-            tbuf->lock(0, texBufferSize, reinterpret_cast<void**>(&texMem), VBLOCK_WRITEONLY);
+        meshAccessor.copyVertAttribs(outLayout).ignore();
 
-            scope_on_leave
-            {
-                // Calculate AABB
-                nau::math::AABB aabb = nau::math::AABB();
-                aabb.InitFromVertsSlow(reinterpret_cast<nau::math::float3*>(posMem), meshDesc.vertexCount);
+        // Calculate AABB
+        nau::math::AABB aabb = nau::math::AABB();
+        aabb.InitFromVertsSlow(positions.data(), meshDesc.vertexCount);
 
-                mesh->m_localBSphere = nau::math::BSphere3();
-                mesh->m_localBSphere += nau::math::BBox3(aabb.minBounds, aabb.maxBounds);
+        mesh->m_localBSphere = nau::math::BSphere3();
+        mesh->m_localBSphere += nau::math::BBox3(aabb.minBounds, aabb.maxBounds);
 
-                NAU_ASSERT(mesh->m_localBSphere.r > 0.00001f);
-
-                pbuf->unlock();
-                nbuf->unlock();
-                tangentbuf->unlock();
-                tbuf->unlock();
-            };
+        NAU_ASSERT(mesh->m_localBSphere.r > 0.00001f);
+    }
 
-            posDesc.outputBuffer = posMem;
-            posDesc.outputBufferSize = posBufferSize;
+    if ((meshDesc.indexCount != 0) && (meshDesc.vertexCount != 0))
+    {
+        auto tangs = getTangents({indices.data(), indices.size()},
+                                 {positions.data(), positions.size()},
+                                 {normals.data(), normals.size()},
+                                 {texCoords.data(), texCoords.size()});
+        if (!tangs.empty())
+        {
+            memcpy(tangents.data(), tangs.data(), tangents.size() * sizeof(nau::math::float4));
+            delete[] tangs.data();
+        }
+    }
 
-            nrmDesc.outputBuffer = nrmMem;
-            nrmDesc.outputBufferSize = nrmBufferSize;
+    const size_t indexBufferSize = indices.size() * sizeof(uint16_t);
+    const size_t posBufferSize = positions.size() * sizeof(nau::math::float3);
+    const size_t nrmBufferSize = normals.size() * sizeof(nau::math::float3);
+    const size_t tangentBufferSize = tangents.size() * sizeof(nau::math::float4);
+    const size_t texBufferSize = texCoords.size() * sizeof(nau::math::float2);
+    const size_t uploadSize = indexBufferSize + posBufferSize + nrmBufferSize + tangentBufferSize + texBufferSize;
 
-            tangentDesc.outputBuffer = tangentMem;
-            tangentDesc.outputBufferSize = tangentBufferSize;
+    auto& uploadQueue = getServiceProvider().get<GpuUploadQueue>();
+    co_await uploadQueue.enqueue(uploadPriorityKey, uploadSize, [&]
+    {
+        d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+        scope_on_leave
+        {
+            d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
+        };
 
-            uv0Desc.outputBuffer = texMem;
-            uv0Desc.outputBufferSize = texBufferSize;
+        lod0.m_indexBuffer = indexBufferSize == 0 ? nullptr :
+            createBufferWithData(d3d::create_ib(indexBufferSize, SBCF_DYNAMIC, u8"IndexBuf"), indices.data(), indexBufferSize);
 
-            accessor.copyVertAttribs(outLayout).ignore();
+        if (meshDesc.vertexCount == 0)
+        {
+            lod0.m_positionsBuffer = nullptr;
+            lod0.m_normalsBuffer = nullptr;
+            lod0.m_tangentsBuffer = nullptr;
+            lod0.m_texCoordsBuffer = nullptr;
+            return;
         }
 
-        co_return std::tuple{std::move(pbuf), posBufferSize, std::move(nbuf), nrmBufferSize, std::move(tangentbuf), tangentBufferSize, std::move(tbuf), texBufferSize};
-    }(meshAccessor, meshDesc);
-
-    co_await async::whenAll(Expiration::never(), indexBufferTask, vertexBufferTask);
-
-    auto [indexBuffer, indexBufferSize] = *indexBufferTask;
-    auto [posBuffer, posBufferSize, nrmBuffer, nrmBufferSize, tangentBuffer, tangentBufferSize, texBuffer, texBufferSize] = *vertexBufferTask;
+        lod0.m_positionsBuffer = createBufferWithData(d3d::create_vb(posBufferSize, SBCF_DYNAMIC, u8"posBuf"), positions.data(), posBufferSize);
+        lod0.m_normalsBuffer = createBufferWithData(d3d::create_vb(nrmBufferSize, SBCF_DYNAMIC, u8"normBuf"), normals.data(), nrmBufferSize);
+        lod0.m_tangentsBuffer = createBufferWithData(d3d::create_vb(tangentBufferSize, SBCF_DYNAMIC, u8"tangentBuf"), tangents.data(), tangentBufferSize);
+        lod0.m_texCoordsBuffer = createBufferWithData(d3d::create_vb(texBufferSize, SBCF_DYNAMIC, u8"texBuf"), texCoords.data(), texBufferSize);
+    });
 
     lod0.m_indexCount = meshDesc.indexCount;
     lod0.m_vertexCount = meshDesc.vertexCount;
 
-    lod0.m_indexBuffer = indexBuffer;
-    lod0.m_positionsBuffer = posBuffer;
-    lod0.m_normalsBuffer = nrmBuffer;
-    lod0.m_tangentsBuffer = tangentBuffer;
-    lod0.m_texCoordsBuffer = texBuffer;
-
-    if ((lod0.m_indexCount != 0) && (lod0.m_vertexCount != 0))
-    {
-        std::byte* mem = nullptr;
-        indexBuffer->lock(0, indexBufferSize, reinterpret_cast<void**>(&mem), VBLOCK_READONLY);
-
-        std::byte* posMem = nullptr;
-        posBuffer->lock(0, posBufferSize, reinterpret_cast<void**>(&posMem), VBLOCK_READONLY);
-
-        std::byte* nrmMem = nullptr;
-        nrmBuffer->lock(0, nrmBufferSize, reinterpret_cast<void**>(&nrmMem), VBLOCK_READONLY);
-
-        std::byte* texMem = nullptr;
-        texBuffer->lock(0, texBufferSize, reinterpret_cast<void**>(&texMem), VBLOCK_READONLY);
-
-        std::byte* tangentMem = nullptr;
-        tangentBuffer->lock(0, tangentBufferSize, reinterpret_cast<void**>(&tangentMem), VBLOCK_WRITEONLY);
-
-        auto tangs = getTangents({(uint16_t*)mem, meshDesc.indexCount},
-                                 {(nau::math::float3*)posMem, meshDesc.vertexCount},
-                                 {(nau::math::float3*)nrmMem, meshDesc.vertexCount},
-                                 {(nau::math::float2*)texMem, meshDesc.vertexCount});
-        memcpy(tangentMem, tangs.data(), tangentBufferSize);
-
-        delete[] tangs.data();
-
-        posBuffer->unlock();
-        nrmBuffer->unlock();
-        tangentBuffer->unlock();
-        texBuffer->unlock();
-        indexBuffer->unlock();
-    }
-
-    d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
-
     // load material
     nau::MaterialSlot& slot = lod0.m_materialSlots.emplace_back();
     slot.m_startIndex = 0;
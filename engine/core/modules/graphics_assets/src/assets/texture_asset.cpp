@@ -3,7 +3,9 @@
 
 #include "../../include/graphics_assets/texture_asset.h"
 
+#include "graphics_assets/gpu_upload_queue.h"
 #include "nau/assets/texture_asset_accessor.h"
+#include "nau/service/service_provider.h"
 
 #define LOAD_TEXTURE_ASYNC
 
@@ -61,7 +63,7 @@ namespace nau
         }
     }  // namespace
 
-    async::Task<nau::Ptr<TextureAssetView>> TextureAssetView::createFromAssetAccessor(nau::Ptr<> accessor)
+    async::Task<nau::Ptr<TextureAssetView>> TextureAssetView::createFromAssetAccessor(nau::Ptr<> accessor, eastl::string uploadPriorityKey)
     {
         using namespace nau::async;
 
@@ -77,38 +79,67 @@ namespace nau
         auto textureAssetView = rtti::createInstance<TextureAssetView>();
         const auto& imageDesc = textureAccessor.getDescription();
 
-        BaseTexture* tex = nullptr;
-
         const uint32_t           dagorFormat     = getDagorFormat(imageDesc.format);
         const TextureFormatDesc& dagorFormatDesc = get_tex_format_desc(dagorFormat);
 
-        tex = d3d::create_tex(nullptr, imageDesc.width, imageDesc.height, dagorFormat, imageDesc.numMipmaps);
+        // Mips are decoded into the tightly packed staging memory on the worker thread,
+        // the texture creation and the copy into the locked levels are made through the GPU upload queue.
+        struct MipData
+        {
+            eastl::vector<std::byte> data;
+            size_t rowsCount;
+            size_t rowBytesSize;
+        };
 
+        eastl::vector<MipData> mips(imageDesc.numMipmaps);
+        size_t uploadSize = 0;
 
-        for(int mipLevel = 0; mipLevel < imageDesc.numMipmaps; ++mipLevel)
+        for(uint32_t mipLevel = 0; mipLevel < imageDesc.numMipmaps; ++mipLevel)
         {
-            TextureInfo info;
-            int t = tex->getinfo(info, mipLevel);
+            const uint32_t mipWidth = std::max(1u, imageDesc.width >> mipLevel);
+            const uint32_t mipHeight = std::max(1u, imageDesc.height >> mipLevel);
 
-            void* texDataPtr = nullptr;
-            int stride;
-            tex->lockimg(&texDataPtr, stride, mipLevel, TEXLOCK_WRITE);
+            MipData& mip = mips[mipLevel];
+            mip.rowsCount    = (mipHeight + dagorFormatDesc.elementHeight - 1) / dagorFormatDesc.elementHeight;
+            mip.rowBytesSize = (mipWidth + dagorFormatDesc.elementWidth - 1) / dagorFormatDesc.elementWidth * dagorFormatDesc.bytesPerElement;
+            mip.data.resize(mip.rowsCount * mip.rowBytesSize);
+            uploadSize += mip.data.size();
 
             eastl::vector<DestTextureData> dstData(1);
             DestTextureData& data = dstData[0];
 
-            data.outputBuffer = texDataPtr;
-            data.rowsCount    = std::max(1, info.h / dagorFormatDesc.elementHeight);
-            data.rowPitch     = stride;
-            data.rowBytesSize = 0; // will use format's default row bytes size
+            data.outputBuffer = mip.data.data();
+            data.rowsCount    = mip.rowsCount;
+            data.rowPitch     = mip.rowBytesSize;
+            data.rowBytesSize = mip.rowBytesSize;
             data.slicePitch   = 0;
 
             textureAccessor.copyTextureData(mipLevel, 1, dstData);
-
-            tex->unlockimg();
         }
 
-        textureAssetView->m_Texture = tex;
+        auto& uploadQueue = getServiceProvider().get<GpuUploadQueue>();
+        co_await uploadQueue.enqueue(uploadPriorityKey, uploadSize, [&]
+        {
+            BaseTexture* const tex = d3d::create_tex(nullptr, imageDesc.width, imageDesc.height, dagorFormat, imageDesc.numMipmaps);
+
+            for(uint32_t mipLevel = 0; mipLevel < imageDesc.numMipmaps; ++mipLevel)
+            {
+                const MipData& mip = mips[mipLevel];
+
+                void* texDataPtr = nullptr;
+                int stride;
+                tex->lockimg(&texDataPtr, stride, mipLevel, TEXLOCK_WRITE);
+
+                for (size_t row = 0; row < mip.rowsCount; ++row)
+                {
+                    memcpy(reinterpret_cast<std::byte*>(texDataPtr) + row * stride, mip.data.data() + row * mip.rowBytesSize, mip.rowBytesSize);
+                }
+
+                tex->unlockimg();
+            }
+
+            textureAssetView->m_Texture = tex;
+        });
 
         co_return textureAssetView;
     }
@@ -0,0 +1,287 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "graphics_assets/gpu_upload_queue.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#include <chrono>
+#include <limits>
+#include <utility>
+
+namespace nau
+{
+    async::Task<> GpuUploadQueue::enqueue(eastl::string_view priorityKey, size_t bytes, UploadCallback upload)
+    {
+        NAU_ASSERT(upload);
+
+        UploadRequest request;
+        request.priorityKey = eastl::string{priorityKey};
+        request.bytes = bytes;
+        request.upload = std::move(upload);
+
+        async::Task<> task = request.completion.getTask();
+
+        {
+            lock_(m_mutex);
+            // The graphics is not started to render frames yet: nothing will drain the queue.
+            if (m_isDraining)
+            {
+                request.sequence = m_nextSequence++;
+                if (!request.priorityKey.empty())
+                {
+                    ++m_priorityHints[request.priorityKey].pendingCount;
+                    m_stats.priorityHintsCount = m_priorityHints.size();
+                }
+
+                m_stats.pendingBytes += bytes;
+                m_pendingRequests.emplace_back(std::move(request));
+                m_stats.queueDepth = m_pendingRequests.size();
+
+                return task;
+            }
+        }
+
+        completeRequest(request);
+        {
+            lock_(m_mutex);
+            m_stats.totalUploadBytes += bytes;
+            ++m_stats.totalUploadCount;
+        }
+
+        return task;
+    }
+
+    void GpuUploadQueue::addPriorityHint(eastl::string_view priorityKey, const math::vec3& worldPosition)
+    {
+        if (priorityKey.empty())
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+        PriorityHint& hint = m_priorityHints[eastl::string{priorityKey}];
+        hint.lastHintFrame = m_frameIndex;
+        m_stats.priorityHintsCount = m_priorityHints.size();
+
+        if (hint.positions.size() < MaxPositionsPerHint)
+        {
+            hint.positions.push_back(worldPosition);
+            return;
+        }
+
+        // only the closest position is used for the priority: the farthest one is replaced
+        const auto getDistanceSqToViewer = [this](const math::vec3& position)
+        {
+            return static_cast<float>(math::lengthSqr(position - m_viewerPosition));
+        };
+
+        auto farthest = eastl::max_element(hint.positions.begin(), hint.positions.end(), [&getDistanceSqToViewer](const math::vec3& left, const math::vec3& right)
+        {
+            return getDistanceSqToViewer(left) < getDistanceSqToViewer(right);
+        });
+
+        if (getDistanceSqToViewer(worldPosition) < getDistanceSqToViewer(*farthest))
+        {
+            *farthest = worldPosition;
+        }
+    }
+
+    void GpuUploadQueue::setViewerPosition(const math::vec3& viewerPosition)
+    {
+        lock_(m_mutex);
+        m_viewerPosition = viewerPosition;
+    }
+
+    void GpuUploadQueue::setFrameBudget(float milliseconds, size_t bytes)
+    {
+        NAU_ASSERT(milliseconds >= 0.f);
+
+        lock_(m_mutex);
+        m_frameBudgetMs = milliseconds;
+        m_frameBudgetBytes = bytes;
+    }
+
+    float GpuUploadQueue::getDistanceSq(const eastl::string& priorityKey) const
+    {
+        float distanceSq = std::numeric_limits<float>::max();
+        if (priorityKey.empty())
+        {
+            return distanceSq;
+        }
+
+        if (auto hint = m_priorityHints.find(priorityKey); hint != m_priorityHints.end())
+        {
+            for (const math::vec3& position : hint->second.positions)
+            {
+                distanceSq = std::min(distanceSq, static_cast<float>(math::lengthSqr(position - m_viewerPosition)));
+            }
+        }
+
+        return distanceSq;
+    }
+
+    void GpuUploadQueue::pruneUnusedHints()
+    {
+        for (auto hint = m_priorityHints.begin(); hint != m_priorityHints.end();)
+        {
+            if (hint->second.pendingCount == 0 && m_frameIndex - hint->second.lastHintFrame > UnusedHintLifetimeFrames)
+            {
+                hint = m_priorityHints.erase(hint);
+            }
+            else
+            {
+                ++hint;
+            }
+        }
+
+        m_stats.priorityHintsCount = m_priorityHints.size();
+    }
+
+    void GpuUploadQueue::completeRequest(UploadRequest& request)
+    {
+        request.upload();
+        request.upload = nullptr;
+        request.completion.resolve();
+    }
+
+    void GpuUploadQueue::drain()
+    {
+        using namespace std::chrono;
+
+        const auto startTime = steady_clock::now();
+
+        eastl::vector<UploadRequest> requests;
+        float budgetMs = 0.f;
+        size_t budgetBytes = 0;
+        {
+            lock_(m_mutex);
+            m_isDraining = true;
+            ++m_frameIndex;
+            pruneUnusedHints();
+            budgetMs = m_frameBudgetMs;
+            budgetBytes = m_frameBudgetBytes;
+
+            if (m_pendingRequests.empty())
+            {
+                m_stats.lastFrameUploadMs = 0.f;
+                m_stats.lastFrameUploadBytes = 0;
+                m_stats.lastFrameUploadCount = 0;
+                return;
+            }
+
+            // Priorities are recalculated every frame: the viewer moves and the hints can be added after the request was enqueued.
+            for (UploadRequest& request : m_pendingRequests)
+            {
+                request.distanceSq = getDistanceSq(request.priorityKey);
+            }
+
+            requests = std::move(m_pendingRequests);
+            m_pendingRequests.clear();
+        }
+
+        eastl::sort(requests.begin(), requests.end(), [](const UploadRequest& left, const UploadRequest& right)
+        {
+            if (left.distanceSq != right.distanceSq)
+            {
+                return left.distanceSq < right.distanceSq;
+            }
+
+            return left.sequence < right.sequence;
+        });
+
+        const auto getElapsedMs = [&startTime]
+        {
+            return duration<float, std::milli>(steady_clock::now() - startTime).count();
+        };
+
+        size_t uploadedCount = 0;
+        size_t uploadedBytes = 0;
+
+        for (UploadRequest& request : requests)
+        {
+            if (uploadedCount > 0)
+            {
+                const bool timeBudgetExhausted = budgetMs > 0.f && getElapsedMs() >= budgetMs;
+                const bool byteBudgetExhausted = budgetBytes > 0 && uploadedBytes + request.bytes > budgetBytes;
+                if (timeBudgetExhausted || byteBudgetExhausted)
+                {
+                    break;
+                }
+            }
+
+            completeRequest(request);
+            ++uploadedCount;
+            uploadedBytes += request.bytes;
+        }
+
+        const float uploadMs = getElapsedMs();
+
+        lock_(m_mutex);
+
+        for (size_t i = 0; i < uploadedCount; ++i)
+        {
+            const eastl::string& priorityKey = requests[i].priorityKey;
+            if (priorityKey.empty())
+            {
+                continue;
+            }
+
+            // hints are needed only to order the uploads: they are removed with the last upload of the key
+            if (auto hint = m_priorityHints.find(priorityKey); hint != m_priorityHints.end() && --hint->second.pendingCount == 0)
+            {
+                m_priorityHints.erase(hint);
+            }
+        }
+
+        m_stats.priorityHintsCount = m_priorityHints.size();
+
+        // requests that were enqueued during the drain are kept after the not processed ones
+        eastl::vector<UploadRequest> enqueuedDuringDrain = std::move(m_pendingRequests);
+        m_pendingRequests.clear();
+        m_pendingRequests.reserve(requests.size() - uploadedCount + enqueuedDuringDrain.size());
+
+        for (size_t i = uploadedCount; i < requests.size(); ++i)
+        {
+            m_pendingRequests.emplace_back(std::move(requests[i]));
+        }
+
+        for (UploadRequest& request : enqueuedDuringDrain)
+        {
+            m_pendingRequests.emplace_back(std::move(request));
+        }
+
+        m_stats.queueDepth = m_pendingRequests.size();
+        m_stats.pendingBytes -= uploadedBytes;
+        m_stats.lastFrameUploadMs = uploadMs;
+        m_stats.lastFrameUploadBytes = uploadedBytes;
+        m_stats.lastFrameUploadCount = uploadedCount;
+        m_stats.maxFrameUploadMs = std::max(m_stats.maxFrameUploadMs, uploadMs);
+        m_stats.totalUploadBytes += uploadedBytes;
+        m_stats.totalUploadCount += uploadedCount;
+    }
+
+    void GpuUploadQueue::flush()
+    {
+        float budgetMs = 0.f;
+        size_t budgetBytes = 0;
+        {
+            lock_(m_mutex);
+            budgetMs = std::exchange(m_frameBudgetMs, 0.f);
+            budgetBytes = std::exchange(m_frameBudgetBytes, 0);
+        }
+
+        drain();
+
+        lock_(m_mutex);
+        m_frameBudgetMs = budgetMs;
+        m_frameBudgetBytes = budgetBytes;
+    }
+
+    GpuUploadQueueStats GpuUploadQueue::getStats() const
+    {
+        lock_(m_mutex);
+        return m_stats;
+    }
+}  // namespace nau
@@ -6,6 +6,7 @@
 #include "graphics_assets/shader_asset.h"
 #include "graphics_assets/texture_asset.h"
 #include "graphics_assets/asset_view_factory.h"
+#include "graphics_assets/gpu_upload_queue.h"
 #include "nau/module/module.h"
 
 namespace nau
@@ -22,6 +23,7 @@ namespace nau
             NAU_MODULE_EXPORT_CLASS(StaticMeshAssetView);
             NAU_MODULE_EXPORT_CLASS(TextureAssetView);
             NAU_MODULE_EXPORT_SERVICE(GraphicsAssetViewFactory);
+            NAU_MODULE_EXPORT_SERVICE(GpuUploadQueue);
         }
         void deinitialize() override
         {
@@ -0,0 +1,140 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "graphics_assets/gpu_upload_queue.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            Enqueues the upload that appends the key to the list of the made uploads.
+         */
+        async::Task<> enqueueUpload(GpuUploadQueue& queue, eastl::string_view key, eastl::vector<eastl::string>& uploads)
+        {
+            return queue.enqueue(key, 1, [&uploads, key = eastl::string{key}]
+            {
+                uploads.push_back(key);
+            });
+        }
+
+        bool allReady(const eastl::vector<async::Task<>>& tasks)
+        {
+            return eastl::all_of(tasks.begin(), tasks.end(), [](const async::Task<>& task)
+            {
+                return task.isReady();
+            });
+        }
+    }  // namespace
+
+    /**
+        Test: uploads are made in the order of the distance to the viewer, the uploads without hints are made last in the enqueue order.
+     */
+    TEST(TestGpuUploadQueue, PriorityOrdering)
+    {
+        GpuUploadQueue queue;
+        queue.setFrameBudget(0.f, 0);
+        // before the first drain the uploads are made immediately
+        queue.drain();
+
+        eastl::vector<eastl::string> uploads;
+        eastl::vector<async::Task<>> tasks;
+        tasks.push_back(enqueueUpload(queue, "no_hint_1", uploads));
+        tasks.push_back(enqueueUpload(queue, "far", uploads));
+        tasks.push_back(enqueueUpload(queue, "no_hint_2", uploads));
+        tasks.push_back(enqueueUpload(queue, "near", uploads));
+        tasks.push_back(enqueueUpload(queue, "middle", uploads));
+        ASSERT_TRUE(uploads.empty());
+
+        queue.setViewerPosition(math::vec3{10.f, 0.f, 0.f});
+        queue.addPriorityHint("far", math::vec3{100.f, 0.f, 0.f});
+        queue.addPriorityHint("middle", math::vec3{30.f, 0.f, 0.f});
+        queue.addPriorityHint("near", math::vec3{-50.f, 0.f, 0.f});
+        queue.addPriorityHint("near", math::vec3{11.f, 0.f, 0.f});
+
+        queue.drain();
+
+        const eastl::vector<eastl::string> expected = {"near", "middle", "far", "no_hint_1", "no_hint_2"};
+        ASSERT_EQ(uploads, expected);
+        ASSERT_TRUE(allReady(tasks));
+        ASSERT_EQ(queue.getStats().queueDepth, 0);
+    }
+
+    /**
+        Test: the hints of the key are removed when the last upload of the key is made.
+     */
+    TEST(TestGpuUploadQueue, HintRemovedWhenUploadsCompleted)
+    {
+        GpuUploadQueue queue;
+        queue.setFrameBudget(0.f, 1);
+        queue.drain();
+
+        eastl::vector<eastl::string> uploads;
+        eastl::vector<async::Task<>> tasks;
+        queue.addPriorityHint("asset", math::vec3::zero());
+        tasks.push_back(enqueueUpload(queue, "asset", uploads));
+        tasks.push_back(enqueueUpload(queue, "asset", uploads));
+        ASSERT_EQ(queue.getStats().priorityHintsCount, 1);
+
+        // single upload per frame: the second upload of the key is still pending
+        queue.drain();
+        ASSERT_EQ(uploads.size(), 1);
+        ASSERT_TRUE(tasks[0].isReady());
+        ASSERT_FALSE(tasks[1].isReady());
+        ASSERT_EQ(queue.getStats().priorityHintsCount, 1);
+
+        queue.drain();
+        ASSERT_EQ(uploads.size(), 2);
+        ASSERT_TRUE(allReady(tasks));
+        ASSERT_EQ(queue.getStats().priorityHintsCount, 0);
+    }
+
+    /**
+        Test: the hints that are never used by the uploads are removed after a while.
+     */
+    TEST(TestGpuUploadQueue, UnusedHintRemoved)
+    {
+        GpuUploadQueue queue;
+        queue.drain();
+
+        queue.addPriorityHint("never_requested", math::vec3::zero());
+        ASSERT_EQ(queue.getStats().priorityHintsCount, 1);
+
+        for (size_t i = 0; i < 1000 && queue.getStats().priorityHintsCount > 0; ++i)
+        {
+            queue.drain();
+        }
+
+        ASSERT_EQ(queue.getStats().priorityHintsCount, 0);
+    }
+
+    /**
+        Test: the number of positions per key is bounded, the positions closest to the viewer are kept.
+     */
+    TEST(TestGpuUploadQueue, HintPositionsAreBounded)
+    {
+        GpuUploadQueue queue;
+        queue.setFrameBudget(0.f, 0);
+        queue.drain();
+
+        eastl::vector<eastl::string> uploads;
+        eastl::vector<async::Task<>> tasks;
+        tasks.push_back(enqueueUpload(queue, "many_instances", uploads));
+        tasks.push_back(enqueueUpload(queue, "single_instance", uploads));
+
+        queue.addPriorityHint("single_instance", math::vec3{20.f, 0.f, 0.f});
+        for (size_t i = 0; i < GpuUploadQueue::MaxPositionsPerHint * 10; ++i)
+        {
+            queue.addPriorityHint("many_instances", math::vec3{100.f + static_cast<float>(i), 0.f, 0.f});
+        }
+
+        // the closest instance is added after the limit is reached
+        queue.addPriorityHint("many_instances", math::vec3{10.f, 0.f, 0.f});
+
+        queue.drain();
+
+        const eastl::vector<eastl::string> expected = {"many_instances", "single_instance"};
+        ASSERT_EQ(uploads, expected);
+        ASSERT_TRUE(allReady(tasks));
+    }
+}  // namespace nau::test
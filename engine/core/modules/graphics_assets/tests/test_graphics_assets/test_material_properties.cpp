@@ -0,0 +1,132 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "graphics_assets/material_asset.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            Material view with the hand made pipelines: the "default" pipeline with the single "color" property
+            and the instance pipeline that inherits the property. No device resources are created.
+         */
+        class TestMaterialView final : public MaterialAssetView
+        {
+            NAU_CLASS_(nau::test::TestMaterialView, MaterialAssetView)
+
+        public:
+            TestMaterialView()
+            {
+                m_colorReflection.name = "color";
+                m_colorReflection.startOffset = 0;
+                m_colorReflection.size = sizeof(math::Vector4);
+
+                Pipeline& masterPipeline = m_pipelines["default"];
+                BufferCache& masterBuffer = masterPipeline.constantBuffers["properties"] = makeBuffer();
+                masterPipeline.properties["color"] = {
+                    .reflection = &m_colorReflection,
+                    .parentBuffer = &masterBuffer,
+                    .currentValue = nullptr,
+                    .masterProperty = nullptr,
+                    .isMasterValue = false,
+                    .isRawValue = true,
+                    .isValueDirty = false};
+
+                BufferCache& instanceBuffer = m_instancePipeline.constantBuffers["properties"] = makeBuffer();
+                m_instancePipeline.properties["color"] = {
+                    .reflection = &m_colorReflection,
+                    .parentBuffer = &instanceBuffer,
+                    .currentValue = nullptr,
+                    .masterProperty = &masterPipeline.properties["color"],
+                    .isMasterValue = true};
+            }
+
+            void bind() override
+            {
+            }
+
+            void bindPipeline(NameId) override
+            {
+            }
+
+            PROGRAM getPipelineProgram(eastl::string_view) const override
+            {
+                return BAD_PROGRAM;
+            }
+
+            /**
+                Syncs the instance pipeline with the master one (as the instance does on bind).
+                @return true if the instance constant buffer must be uploaded.
+             */
+            bool syncInstance()
+            {
+                syncMasterProperties(m_pipelines["default"], m_instancePipeline);
+                return m_instancePipeline.isDirty && m_instancePipeline.constantBuffers["properties"].isDirty;
+            }
+
+            void clearInstanceDirty()
+            {
+                m_instancePipeline.isDirty = false;
+                m_instancePipeline.constantBuffers["properties"].isDirty = false;
+            }
+
+            math::Vector4 getInstanceColor() const
+            {
+                math::Vector4 color;
+                writePropertyValue(m_instancePipeline.properties.at("color"), reinterpret_cast<std::byte*>(&color));
+                return color;
+            }
+
+        private:
+            static BufferCache makeBuffer()
+            {
+                return {
+                    .reflection = nullptr,
+                    .buffer = nullptr,
+                    .slot = 0,
+                    .isOwned = false,
+                    .isDirty = false,
+                    .data = eastl::vector<std::byte>(sizeof(math::Vector4))};
+            }
+
+            ShaderVariableDescription m_colorReflection{};
+            Pipeline m_instancePipeline{};
+        };
+    }  // namespace
+
+    TEST(TestMaterialProperties, FindProperty)
+    {
+        auto material = rtti::createInstance<TestMaterialView>();
+
+        ASSERT_TRUE(material->findProperty("default", "color"));
+        ASSERT_FALSE(material->findProperty("default", "unknown"));
+        ASSERT_FALSE(material->findProperty("unknown", "color"));
+    }
+
+    /**
+        Test: the master property that is set through the handle marks the instances that inherit it dirty.
+     */
+    TEST(TestMaterialProperties, MasterHandleMarksInstanceDirty)
+    {
+        auto material = rtti::createInstance<TestMaterialView>();
+        ASSERT_FALSE(material->syncInstance());
+
+        const MaterialAssetView::PropertyHandle color = material->findProperty("default", "color");
+        const math::Vector4 newColor{1.f, 2.f, 3.f, 4.f};
+        material->setProperty(color, newColor);
+
+        ASSERT_TRUE(material->syncInstance());
+        const math::Vector4 instanceColor = material->getInstanceColor();
+        ASSERT_EQ(instanceColor.getX(), newColor.getX());
+        ASSERT_EQ(instanceColor.getW(), newColor.getW());
+
+        // nothing is changed since the previous sync
+        material->clearInstanceDirty();
+        ASSERT_FALSE(material->syncInstance());
+
+        // the same value does not change the master property
+        material->setProperty(color, newColor);
+        ASSERT_FALSE(material->syncInstance());
+    }
+}  // namespace nau::test
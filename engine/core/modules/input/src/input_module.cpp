@@ -34,6 +34,15 @@ namespace nau::input
             m_inputManager->update(secondsDt);
         }
 
+        eastl::optional<GameSystemDataAccess> getPreUpdateDataAccess() const override
+        {
+            using namespace nau::string_literals;
+
+            return GameSystemDataAccess{
+                .writes = {"input"_name}
+            };
+        }
+
         async::Task<> initService() override
         {
             m_inputManager = &getServiceProvider().get<input::InputManagerImpl>();
@@ -202,6 +202,16 @@ namespace nau
         return devices;
     }
 
+    eastl::optional<GameSystemDataAccess> InputSystemImpl::getPreUpdateDataAccess() const
+    {
+        using namespace nau::string_literals;
+
+        // the action callbacks are the game code: they can change the scene and the ui
+        return GameSystemDataAccess{
+            .writes = {"input"_name, "scene"_name, "ui"_name}
+        };
+    }
+
     void InputSystemImpl::gamePreUpdate(std::chrono::milliseconds dtMs)
     {
         const float dt = static_cast<float>(dtMs.count()) / 1000.f;
@@ -45,6 +45,7 @@ namespace nau
         eastl::vector<IInputDevice*> getDevices() override;
 
         void gamePreUpdate(std::chrono::milliseconds dt) override;
+        eastl::optional<GameSystemDataAccess> getPreUpdateDataAccess() const override;
 
         gainput::InputManager& getGainput()
         {
@@ -30,6 +30,26 @@ namespace nau
         {
             getServiceProvider().get<INetSnapshots>().nextFrame();
         }
+
+        // the peer updates are applied to the scene components
+        eastl::optional<GameSystemDataAccess> getPreUpdateDataAccess() const override
+        {
+            using namespace nau::string_literals;
+
+            return GameSystemDataAccess{
+                .writes = {"network"_name, "scene"_name}
+            };
+        }
+
+        eastl::optional<GameSystemDataAccess> getPostUpdateDataAccess() const override
+        {
+            using namespace nau::string_literals;
+
+            return GameSystemDataAccess{
+                .reads = {"scene"_name},
+                .writes = {"network"_name}
+            };
+        }
     };
 
     /**
@@ -94,7 +94,7 @@ namespace nau::physics
         }
     }
 
-    async::Task<bool> PhysicsService::update(std::chrono::milliseconds dt)
+    async::Task<bool> PhysicsService::update(std::chrono::nanoseconds dt)
     {
         m_preUpdateWorkQueue->poll();
 
@@ -106,7 +106,7 @@ namespace nau::physics
         }
 
         constexpr float MaxSimulationStep = 0.1f;
-        const float simulationTimeStep = std::min(static_cast<float>(dt.count()) / 1000.f, MaxSimulationStep);
+        const float simulationTimeStep = std::min(std::chrono::duration<float>(dt).count(), MaxSimulationStep);
 
         for (PhysicsWorldState& physWorld : m_physicsWorlds)
         {
@@ -116,13 +116,12 @@ namespace nau::physics
         co_return true;
     }
 
-    eastl::optional<std::chrono::milliseconds> PhysicsService::getFixedUpdateTimeStep()
+    eastl::optional<std::chrono::nanoseconds> PhysicsService::getFixedUpdateTimeStep()
     {
         // The target refresh rate value can be calculated more intelligently (or at least loaded from global settings)
-        constexpr size_t TargetStepsPerSecond = 75;
-        constexpr size_t SimulationStepTime = 1000.0f / TargetStepsPerSecond;
+        constexpr int64_t TargetStepsPerSecond = 75;
 
-        return std::chrono::milliseconds(SimulationStepTime);
+        return std::chrono::nanoseconds{1'000'000'000 / TargetStepsPerSecond};
     }
 
     void PhysicsService::syncSceneState()
@@ -101,7 +101,7 @@ namespace nau
 
     Result<> WindowsWindowManager::pumpMessageQueue(bool waitForMessage, std::optional<std::chrono::milliseconds> maxProcessingTime)
     {
-        // TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
         if (!checkAppThread())
         {
             return NauMakeError("Invalid thread");
@@ -191,7 +191,7 @@ namespace nau
 
     void WindowsWindowManager::processAsyncInvocations()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
         using namespace nau::async;
 
         eastl::vector<Executor::Invocation> invocations;
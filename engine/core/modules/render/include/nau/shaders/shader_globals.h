@@ -4,12 +4,107 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+#include <EASTL/string_view.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "nau/string/name_id.h"
+
 namespace nau::shader_globals
 {
+    /**
+        Handle of the registered global variable. Handles are never invalidated.
+     */
+    enum class VariableId : uint32_t
+    {
+        Invalid = ~0u
+    };
+
     NAU_RENDER_EXPORT bool containsName(eastl::string_view name);
 
-    NAU_RENDER_EXPORT void addVariable(eastl::string_view name, size_t size, const void* defaultValue = nullptr);
+    /**
+        Registers the variable. Values of all variables are stored in the single contiguous block.
+        If the variable is already registered its handle is returned (the default value, if specified, is applied).
+     */
+    NAU_RENDER_EXPORT VariableId addVariable(eastl::string_view name, size_t size, const void* defaultValue = nullptr);
+
+    /**
+        @return Handle of the registered variable or VariableId::Invalid.
+     */
+    NAU_RENDER_EXPORT VariableId findVariable(eastl::string_view name);
+
+    NAU_RENDER_EXPORT VariableId findVariable(NameId name);
+
+    NAU_RENDER_EXPORT size_t getVariableSize(VariableId id);
+
+    /**
+        Writing the same value does not mark the variable as changed.
+        Can be called concurrently with the reads (readVariable, PackedConstantBuffer::update) and the writes of the same variable.
+     */
+    NAU_RENDER_EXPORT void setVariable(VariableId id, const void* value);
+
+    /**
+        Copies the value (at most size bytes) that is not torn by the concurrent writes.
+        @return Version of the copied value.
+     */
+    NAU_RENDER_EXPORT uint64_t readVariable(VariableId id, void* value, size_t size);
 
+    /**
+        Direct pointer to the value: the reads through it are not synchronized with the concurrent writes, use readVariable() instead.
+     */
+    NAU_RENDER_EXPORT const void* getVariableData(VariableId id);
+
+    /**
+        Change counter of the variable: is updated with every (actual) value change.
+     */
+    NAU_RENDER_EXPORT uint64_t getVariableVersion(VariableId id);
+
+    /**
+        Name based access: requires a lookup per call, prefer handles for the code that is executed per draw.
+     */
     NAU_RENDER_EXPORT void setVariable(eastl::string_view name, const void* value);
     NAU_RENDER_EXPORT void getVariable(eastl::string_view name, size_t* size, void** value);
-} // namespace nau::shaderGlobals
+
+    /**
+        Constant buffer image made from the global variables with the given layout (i.e. shader's global cbuffer).
+        update() copies only the variables that were changed since the previous update and tracks the changed byte range.
+        The values are copied consistently even if the variables are written concurrently, the buffer itself is not thread safe.
+     */
+    class NAU_RENDER_EXPORT PackedConstantBuffer
+    {
+    public:
+        PackedConstantBuffer(size_t size = 0);
+
+        void addVariable(VariableId id, size_t offset, size_t size);
+
+        /**
+            @return true if any of the variables was changed since the previous call.
+         */
+        bool update();
+
+        eastl::span<const std::byte> getData() const;
+
+        /**
+            Byte range [begin, end) that was changed by the last update() call (empty if nothing was changed).
+         */
+        eastl::pair<size_t, size_t> getDirtyRange() const;
+
+    private:
+        struct Entry
+        {
+            VariableId id;
+            uint32_t offset;
+            uint32_t size;
+            uint64_t version = 0;
+        };
+
+        eastl::vector<Entry> m_entries;
+        eastl::vector<std::byte> m_data;
+        size_t m_dirtyBegin = 0;
+        size_t m_dirtyEnd = 0;
+    };
+}  // namespace nau::shader_globals
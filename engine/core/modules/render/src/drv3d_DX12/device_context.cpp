@@ -1408,7 +1408,7 @@ void DeviceContext::destroyImage(Image *img)
 
 void DeviceContext::present(OutputMode mode)
 {
-// TODO Tracy    NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+  NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
 #if DX12_RECORD_TIMING_DATA
   auto now = ref_time_ticks();
 #endif
@@ -6,57 +6,280 @@
 
 #include <EASTL/unordered_map.h>
 
+#include <atomic>
+#include <shared_mutex>
+#include <thread>
+
 namespace nau::shader_globals
 {
     namespace detail
     {
-        eastl::unordered_map<eastl::string, eastl::vector<std::byte>> g_shaderDataTable;
+        constexpr size_t MaxVariablesCount = 4096;
+        constexpr size_t MaxDataBlockSize = 256 * 1024;
+        constexpr size_t VariableAlignment = 16;
+
+        /**
+            Descriptors and the data block are never reallocated:
+            handles and value pointers stay valid while new variables are registered from the loading threads.
+
+            The value is guarded by the sequence lock: the sequence is odd while the value is written (writers are serialized by it),
+            readers copy the value and retry if the sequence was changed meanwhile. The even sequence is used as the variable version.
+         */
+        struct VariableDesc
+        {
+            uint32_t offset = 0;
+            uint32_t size = 0;
+            std::atomic<uint64_t> sequence = 0;
+        };
+
+        VariableDesc g_variables[MaxVariablesCount];
+        alignas(VariableAlignment) std::byte g_dataBlock[MaxDataBlockSize];
+
+        size_t g_variablesCount = 0;
+        size_t g_dataBlockUsed = 0;
+
+        eastl::unordered_map<NameId, VariableId> g_variableIds;
 
         std::shared_mutex g_mutex;
+
+        inline VariableDesc& getDesc(VariableId id)
+        {
+            const auto index = static_cast<uint32_t>(id);
+            NAU_FATAL(id != VariableId::Invalid && index < MaxVariablesCount, "Invalid global shader variable");
+
+            return g_variables[index];
+        }
+
+        inline void writeVariable(VariableDesc& desc, const void* value, size_t size)
+        {
+            // take the write ownership: even -> odd
+            uint64_t sequence = desc.sequence.load(std::memory_order_relaxed);
+            while ((sequence & 1) != 0 || !desc.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                if ((sequence & 1) != 0)
+                {
+                    std::this_thread::yield();
+                    sequence = desc.sequence.load(std::memory_order_relaxed);
+                }
+            }
+
+            std::byte* const data = g_dataBlock + desc.offset;
+            if (memcmp(data, value, size) == 0)
+            {
+                // value is not changed: the version is kept
+                desc.sequence.store(sequence, std::memory_order_release);
+                return;
+            }
+
+            // the odd sequence must be visible before the value is modified
+            std::atomic_thread_fence(std::memory_order_release);
+            memcpy(data, value, size);
+            desc.sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        /**
+            Copies the consistent value of the variable.
+            @return The version of the copied value.
+         */
+        inline uint64_t readVariable(const VariableDesc& desc, void* value, size_t size)
+        {
+            const std::byte* const data = g_dataBlock + desc.offset;
+
+            for (;;)
+            {
+                const uint64_t sequence = desc.sequence.load(std::memory_order_acquire);
+                if ((sequence & 1) != 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                memcpy(value, data, size);
+
+                // the copy must be completed before the sequence is checked again
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (desc.sequence.load(std::memory_order_relaxed) == sequence)
+                {
+                    return sequence;
+                }
+            }
+        }
+
+        inline VariableId findVariableNoLock(NameId name)
+        {
+            auto iter = g_variableIds.find(name);
+            return iter != g_variableIds.end() ? iter->second : VariableId::Invalid;
+        }
     } // namespace detail
 
     using namespace detail;
 
     bool containsName(eastl::string_view name)
     {
-        shared_lock_(g_mutex);
-        return detail::g_shaderDataTable.contains(name);
+        return findVariable(name) != VariableId::Invalid;
     }
 
-    void addVariable(eastl::string_view name, size_t size, const void* defaultValue /* = nullptr */)
+    VariableId addVariable(eastl::string_view name, size_t size, const void* defaultValue /* = nullptr */)
     {
         NAU_ASSERT(size);
 
-        lock_(g_mutex);
+        const NameId nameId{name};
 
-        g_shaderDataTable[name.data()] = {};
-        g_shaderDataTable[name.data()].resize(size);
+        VariableId id = VariableId::Invalid;
+        {
+            lock_(g_mutex);
+
+            id = findVariableNoLock(nameId);
+            if (id != VariableId::Invalid)
+            {
+                // Variable can be registered from the shader reflection with the padded size.
+                NAU_ASSERT(getDesc(id).size >= size, "Global shader variable ({}) is already registered with smaller size", name);
+            }
+            else
+            {
+                const size_t offset = (g_dataBlockUsed + VariableAlignment - 1) & ~(VariableAlignment - 1);
+                NAU_FATAL(g_variablesCount < MaxVariablesCount, "Too many global shader variables");
+                NAU_FATAL(offset + size <= MaxDataBlockSize, "Global shader variables block overflow ({})", name);
+
+                id = static_cast<VariableId>(g_variablesCount++);
+
+                VariableDesc& desc = g_variables[static_cast<uint32_t>(id)];
+                desc.offset = static_cast<uint32_t>(offset);
+                desc.size = static_cast<uint32_t>(size);
+                memset(g_dataBlock + offset, 0, size);
+                // the handle is published under g_mutex, the non-zero version makes the packed buffers copy the initial value
+                desc.sequence.store(2, std::memory_order_relaxed);
+
+                g_dataBlockUsed = offset + size;
+                g_variableIds[nameId] = id;
+            }
+        }
 
         if (defaultValue != nullptr)
         {
-            memcpy(g_shaderDataTable[name.data()].data(), defaultValue, size);
+            VariableDesc& desc = getDesc(id);
+            writeVariable(desc, defaultValue, std::min<size_t>(size, desc.size));
         }
+
+        return id;
     }
 
-    void setVariable(eastl::string_view name, const void* value)
+    VariableId findVariable(eastl::string_view name)
+    {
+        // the name that was never interned can't be registered
+        const NameId nameId = NameId::find(name);
+        return nameId ? findVariable(nameId) : VariableId::Invalid;
+    }
+
+    VariableId findVariable(NameId name)
+    {
+        shared_lock_(g_mutex);
+        return findVariableNoLock(name);
+    }
+
+    size_t getVariableSize(VariableId id)
+    {
+        return getDesc(id).size;
+    }
+
+    void setVariable(VariableId id, const void* value)
     {
-        NAU_FATAL(g_shaderDataTable.contains(name), "Global shader variable not found: {}", name.data());
+        NAU_ASSERT(value);
 
+        VariableDesc& desc = getDesc(id);
+        writeVariable(desc, value, desc.size);
+    }
+
+    uint64_t readVariable(VariableId id, void* value, size_t size)
+    {
         NAU_ASSERT(value);
 
-        auto& buf = g_shaderDataTable[name.data()];
-        memcpy(buf.data(), value, buf.size());
+        const VariableDesc& desc = getDesc(id);
+        NAU_ASSERT(size <= desc.size);
+
+        return detail::readVariable(desc, value, std::min<size_t>(size, desc.size));
+    }
+
+    const void* getVariableData(VariableId id)
+    {
+        return g_dataBlock + getDesc(id).offset;
+    }
+
+    uint64_t getVariableVersion(VariableId id)
+    {
+        // the odd sequence (value is being written) is not a valid version: the write is not completed yet
+        return getDesc(id).sequence.load(std::memory_order_acquire) & ~uint64_t{1};
+    }
+
+    void setVariable(eastl::string_view name, const void* value)
+    {
+        const VariableId id = findVariable(name);
+        NAU_FATAL(id != VariableId::Invalid, "Global shader variable not found: {}", name);
+
+        setVariable(id, value);
     }
 
     void getVariable(eastl::string_view name, size_t* size, void** value)
     {
-        NAU_FATAL(g_shaderDataTable.contains(name), "Global shader variable not found: {}", name.data());
+        const VariableId id = findVariable(name);
+        NAU_FATAL(id != VariableId::Invalid, "Global shader variable not found: {}", name);
 
         NAU_ASSERT(size);
         NAU_ASSERT(value);
 
-        auto& buf = g_shaderDataTable[name.data()];
-        *size = buf.size();
-        *value = buf.data();
+        const VariableDesc& desc = getDesc(id);
+        *size = desc.size;
+        *value = g_dataBlock + desc.offset;
+    }
+
+    PackedConstantBuffer::PackedConstantBuffer(size_t size) :
+        m_data(size)
+    {
+    }
+
+    void PackedConstantBuffer::addVariable(VariableId id, size_t offset, size_t size)
+    {
+        NAU_ASSERT(id != VariableId::Invalid);
+
+        size = std::min(size, getVariableSize(id));
+        NAU_ASSERT(offset + size <= m_data.size());
+
+        m_entries.push_back({id, static_cast<uint32_t>(offset), static_cast<uint32_t>(size)});
+    }
+
+    bool PackedConstantBuffer::update()
+    {
+        size_t dirtyBegin = m_data.size();
+        size_t dirtyEnd = 0;
+
+        for (Entry& entry : m_entries)
+        {
+            const VariableDesc& desc = getDesc(entry.id);
+            if (desc.sequence.load(std::memory_order_acquire) == entry.version)
+            {
+                continue;
+            }
+
+            entry.version = detail::readVariable(desc, m_data.data() + entry.offset, entry.size);
+
+            dirtyBegin = std::min<size_t>(dirtyBegin, entry.offset);
+            dirtyEnd = std::max<size_t>(dirtyEnd, entry.offset + entry.size);
+        }
+
+        const bool isChanged = dirtyBegin < dirtyEnd;
+        m_dirtyBegin = isChanged ? dirtyBegin : 0;
+        m_dirtyEnd = isChanged ? dirtyEnd : 0;
+
+        return isChanged;
+    }
+
+    eastl::span<const std::byte> PackedConstantBuffer::getData() const
+    {
+        return {m_data.data(), m_data.size()};
+    }
+
+    eastl::pair<size_t, size_t> PackedConstantBuffer::getDirtyRange() const
+    {
+        return {m_dirtyBegin, m_dirtyEnd};
     }
 } // namespace nau::shaderGlobals
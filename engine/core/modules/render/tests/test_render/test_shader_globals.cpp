@@ -0,0 +1,104 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <algorithm>
+
+#include "nau/shaders/shader_globals.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            Value that is torn if it is read while written: all components are expected to be equal.
+         */
+        struct TestValue
+        {
+            uint32_t components[16];
+
+            explicit TestValue(uint32_t value = 0)
+            {
+                std::fill(std::begin(components), std::end(components), value);
+            }
+
+            bool isConsistent() const
+            {
+                return std::all_of(std::begin(components), std::end(components), [this](uint32_t component)
+                {
+                    return component == components[0];
+                });
+            }
+        };
+    }  // namespace
+
+    TEST(TestShaderGlobals, UnchangedValueKeepsVersion)
+    {
+        const TestValue initialValue{1};
+        const auto id = shader_globals::addVariable("test_unchanged_value", sizeof(TestValue), &initialValue);
+        const uint64_t version = shader_globals::getVariableVersion(id);
+
+        shader_globals::setVariable(id, &initialValue);
+        ASSERT_EQ(shader_globals::getVariableVersion(id), version);
+
+        const TestValue newValue{2};
+        shader_globals::setVariable(id, &newValue);
+        ASSERT_NE(shader_globals::getVariableVersion(id), version);
+    }
+
+    /**
+        Test: the packed buffer never sees the partially written value while the variable is written from other threads.
+     */
+    TEST(TestShaderGlobals, ConcurrentWriteAndPackedUpdate)
+    {
+        constexpr size_t WritersCount = 2;
+        constexpr uint32_t WritesCount = 20000;
+
+        const auto id = shader_globals::addVariable("test_concurrent_value", sizeof(TestValue));
+
+        shader_globals::PackedConstantBuffer buffer{sizeof(TestValue) + 16};
+        buffer.addVariable(id, 16, sizeof(TestValue));
+
+        std::atomic<size_t> activeWriters = WritersCount;
+        std::vector<std::thread> writers;
+        for (size_t i = 0; i < WritersCount; ++i)
+        {
+            writers.emplace_back([id, &activeWriters]
+            {
+                for (uint32_t value = 1; value <= WritesCount; ++value)
+                {
+                    const TestValue testValue{value};
+                    shader_globals::setVariable(id, &testValue);
+                }
+
+                --activeWriters;
+            });
+        }
+
+        size_t updatesCount = 0;
+        bool isConsistent = true;
+        while (activeWriters > 0 && isConsistent)
+        {
+            if (buffer.update())
+            {
+                ++updatesCount;
+                isConsistent = reinterpret_cast<const TestValue*>(buffer.getData().data() + 16)->isConsistent();
+            }
+
+            TestValue copy;
+            shader_globals::readVariable(id, &copy, sizeof(copy));
+            isConsistent = isConsistent && copy.isConsistent();
+        }
+
+        for (std::thread& writer : writers)
+        {
+            writer.join();
+        }
+
+        ASSERT_TRUE(isConsistent);
+        ASSERT_GT(updatesCount, 0);
+
+        buffer.update();
+        ASSERT_EQ(reinterpret_cast<const TestValue*>(buffer.getData().data() + 16)->components[0], WritesCount);
+    }
+}  // namespace nau::test
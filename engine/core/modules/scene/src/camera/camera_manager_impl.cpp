@@ -294,6 +294,16 @@ namespace nau::scene
         checkCameras();
     }
 
+    eastl::optional<GameSystemDataAccess> CameraManagerImpl::getPreUpdateDataAccess() const
+    {
+        using namespace nau::string_literals;
+
+        return GameSystemDataAccess{
+            .reads = {"scene"_name},
+            .writes = {"cameras"_name}
+        };
+    }
+
     void CameraManagerImpl::checkCameras()
     {
         using namespace std::chrono;
@@ -313,27 +323,32 @@ namespace nau::scene
 
         eastl::unordered_set<Uid> worldsWithCameras;
 
-        m_detachedCameras.remove_if([&worldsWithCameras](nau::WeakPtr<ICameraControl>& cameraWeakPtr) -> bool
         {
-            if (nau::Ptr<ICameraControl> camera = cameraWeakPtr.lock(); camera)
+            // the check runs on the worker thread (see getPreUpdateDataAccess)
+            lock_(m_mutex);
+
+            m_detachedCameras.remove_if([&worldsWithCameras](nau::WeakPtr<ICameraControl>& cameraWeakPtr) -> bool
             {
-                worldsWithCameras.emplace(camera->getWorldUid());
-                return false;
-            }
+                if (nau::Ptr<ICameraControl> camera = cameraWeakPtr.lock(); camera)
+                {
+                    worldsWithCameras.emplace(camera->getWorldUid());
+                    return false;
+                }
 
-            return true;  // remove
-        });
+                return true;  // remove
+            });
 
-        m_sceneCameras.remove_if([&worldsWithCameras](ObjectWeakRef<ICameraControl>& sceneCameraRef) -> bool
-        {
-            if (sceneCameraRef)
+            m_sceneCameras.remove_if([&worldsWithCameras](ObjectWeakRef<ICameraControl>& sceneCameraRef) -> bool
             {
-                worldsWithCameras.emplace(sceneCameraRef->getWorldUid());
-                return false;
-            }
+                if (sceneCameraRef)
+                {
+                    worldsWithCameras.emplace(sceneCameraRef->getWorldUid());
+                    return false;
+                }
 
-            return true;  // remove
-        });
+                return true;  // remove
+            });
+        }
 
         auto& sceneManger = getServiceProvider().get<ISceneManager>();
         auto worlds = sceneManger.getWorlds();
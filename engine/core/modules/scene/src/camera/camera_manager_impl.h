@@ -32,6 +32,7 @@ namespace nau::scene
         Result<> activateComponents(Uid worldUid, eastl::span<Component*> components) override;
         void deactivateComponents(Uid worldUid, eastl::span<Component*> components) override;
         void gamePreUpdate(std::chrono::milliseconds dt) override;
+        eastl::optional<GameSystemDataAccess> getPreUpdateDataAccess() const override;
 
         void checkCameras();
 
@@ -17,6 +17,16 @@ namespace nau::scene
         m_sceneRoot->setScene(this);
     }
 
+    SceneImpl::~SceneImpl()
+    {
+        if (const AssetDependencyRecordingId recordingId = takeDependencyRecording(); recordingId != AssetDependencyRecordingId::None)
+        {
+            if (IAssetPrefetcher* const prefetcher = getServiceProvider().find<IAssetPrefetcher>())
+            {
+                prefetcher->endDependencyRecording(recordingId).detach();
+            }
+        }
+    }
 
     eastl::string_view SceneImpl::getName() const
     {
@@ -46,4 +56,15 @@ namespace nau::scene
         return *m_sceneRoot;
     }
 
+    void SceneImpl::setDependencyRecording(AssetDependencyRecordingId recordingId)
+    {
+        NAU_ASSERT(m_dependencyRecordingId == AssetDependencyRecordingId::None);
+        m_dependencyRecordingId = recordingId;
+    }
+
+    AssetDependencyRecordingId SceneImpl::takeDependencyRecording()
+    {
+        return std::exchange(m_dependencyRecordingId, AssetDependencyRecordingId::None);
+    }
+
 }  // namespace nau
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "nau/assets/asset_prefetcher.h"
 #include "nau/scene/scene.h"
 #include "nau/scene/scene_object.h"
 
@@ -16,6 +17,8 @@ namespace nau::scene
     public:
         SceneImpl();
 
+        ~SceneImpl();
+
         eastl::string_view getName() const override;
 
         void setName(eastl::string_view name) override;
@@ -24,12 +27,21 @@ namespace nau::scene
 
         SceneObject& getRoot() const override;
 
+        /**
+            @brief Keeps the prefetch manifest recording started by openScene: the recording is continued while the scene is activated
+            (the components can load assets). The recording that is not taken by the activation is finished when the scene is destroyed.
+         */
+        void setDependencyRecording(AssetDependencyRecordingId recordingId);
+
     private:
         void setWorld(class WorldImpl&);
 
+        AssetDependencyRecordingId takeDependencyRecording();
+
         eastl::string m_name;
         const SceneObject::Ptr m_sceneRoot;
         mutable ObjectWeakRef<WorldImpl> m_world;
+        AssetDependencyRecordingId m_dependencyRecordingId = AssetDependencyRecordingId::None;
 
         friend class SceneManagerImpl;
     };
@@ -7,6 +7,7 @@
 #include "nau/memory/stack_allocator.h"
 #include "nau/scene/scene_processor.h"
 #include "scene_impl.h"
+#include <nau/assets/asset_prefetcher.h>
 #include <nau/assets/asset_ref.h>
 #include <nau/assets/scene_asset.h>
 #include <nau/scene/scene_factory.h>
@@ -237,7 +238,7 @@ namespace nau::scene
         // 3. waiting for all asynchronous activation operations
 
         {  // Process IComponentsActivator. IComponentsActivator accept non constant components collection
-            auto componentActivators = getServiceProvider().getAll<IComponentsActivator>();
+            auto componentActivators = getServiceProvider().getAllCached<IComponentsActivator>();
 
             for (IComponentsActivator* componentActivator : componentActivators)
             {
@@ -251,7 +252,7 @@ namespace nau::scene
         {  // Process IComponentsAsyncActivator. IComponentsAsyncActivator accept constant components collection.
             // Mutable components can not be used, because async activation can be performed in concurrent fashion (in background threads)
             const eastl::span componentsConstSpan{const_cast<const Component**>(components.data()), components.size()};
-            auto componentAsyncActivators = getServiceProvider().getAll<IComponentsAsyncActivator>();
+            auto componentAsyncActivators = getServiceProvider().getAllCached<IComponentsAsyncActivator>();
 
             activationTasks.reserve(componentAsyncActivators.size() + components.size());
 
@@ -477,7 +478,7 @@ namespace nau::scene
             // must call IComponentsActivator::deactivateComponents prior detaching components from scene.
             const eastl::span componentsSpan{components.data(), components.size()};
 
-            for (IComponentsActivator* componentActivator : getServiceProvider().getAll<IComponentsActivator>())
+            for (IComponentsActivator* componentActivator : getServiceProvider().getAllCached<IComponentsActivator>())
             {
                 componentActivator->deactivateComponents(worldUid, componentsSpan);
             }
@@ -545,7 +546,7 @@ namespace nau::scene
 
         {
             // all scene processors will be notified through ISceneProcessor/IComponentsActivator or ISceneProcessor/IComponentsAsyncActivator
-            auto componentAsyncActivators = getServiceProvider().getAll<IComponentsAsyncActivator>();
+            auto componentAsyncActivators = getServiceProvider().getAllCached<IComponentsAsyncActivator>();
             Vector<Task<>> deactivationTasks;
             deactivationTasks.reserve(components.size() + componentAsyncActivators.size());
 
@@ -606,11 +607,30 @@ namespace nau::scene
 
         NAU_FATAL(getSceneIter(scene.get()) == m_scenes.end());
 
+        // the loads of the activating components are recorded to the scene's prefetch manifest (if openScene started the recording)
+        SceneImpl* const sceneImpl = scene->as<SceneImpl*>();
+        const AssetDependencyRecordingId recordingId = sceneImpl ? sceneImpl->takeDependencyRecording() : AssetDependencyRecordingId::None;
+        scope_on_leave
+        {
+            if (recordingId != AssetDependencyRecordingId::None)
+            {
+                getServiceProvider().get<IAssetPrefetcher>().endDependencyRecording(recordingId).detach();
+            }
+        };
+
         m_scenes.emplace_back(std::move(scene));
         ObjectWeakRef sceneRef = *m_scenes.back().scene;
         sceneRef->setWorld(*world);
 
-        co_await activateSceneObject(sceneRef->getRoot());
+        if (recordingId != AssetDependencyRecordingId::None)
+        {
+            AssetDependencyRecordingScope recordingScope{getServiceProvider().get<IAssetPrefetcher>(), recordingId};
+            co_await activateSceneObject(sceneRef->getRoot());
+        }
+        else
+        {
+            co_await activateSceneObject(sceneRef->getRoot());
+        }
 
         co_return sceneRef;
     }
@@ -915,6 +935,28 @@ namespace nau::scene
 
     async::Task<IScene::Ptr> openScene(const eastl::string& path)
     {
+        // When the scene has a prefetch manifest all its containers are loaded up front and in parallel.
+        // The manifest is recorded each time the scene is loading and activating (see SceneImpl::setDependencyRecording):
+        // the recorded manifest replaces the one that is out of date, so the next opening uses the actual one.
+        IAssetPrefetcher& prefetcher = getServiceProvider().get<IAssetPrefetcher>();
+        const AssetPath sceneAssetPath{path};
+
+        async::Task<> prefetchTask;
+        if (prefetcher.findPrefetchManifest(sceneAssetPath).has_value())
+        {
+            prefetchTask = prefetcher.prefetchDependencies(sceneAssetPath);
+        }
+
+        AssetDependencyRecordingId recordingId = prefetcher.beginDependencyRecording(sceneAssetPath);
+
+        scope_on_leave
+        {
+            if (recordingId != AssetDependencyRecordingId::None)
+            {
+                prefetcher.endDependencyRecording(recordingId).detach();
+            }
+        };
+
         AssetRef<> sceneAssetRef{path};
 
         if (!sceneAssetRef)
@@ -923,8 +965,24 @@ namespace nau::scene
             co_return nullptr;
         }
 
-        nau::SceneAsset::Ptr sceneAsset = co_await sceneAssetRef.getAssetViewTyped<SceneAsset>();
-        nau::scene::IScene::Ptr scene = getServiceProvider().get<scene::ISceneFactory>().createSceneFromAsset(*sceneAsset);
+        // only the loads requested by this scene are recorded: the recording is carried by the async context across co_await
+        nau::scene::IScene::Ptr scene;
+        {
+            AssetDependencyRecordingScope recordingScope{prefetcher, recordingId};
+
+            nau::SceneAsset::Ptr sceneAsset = co_await sceneAssetRef.getAssetViewTyped<SceneAsset>();
+            scene = getServiceProvider().get<scene::ISceneFactory>().createSceneFromAsset(*sceneAsset);
+        }
+
+        if (prefetchTask)
+        {
+            co_await prefetchTask;
+        }
+
+        if (SceneImpl* const sceneImpl = scene ? scene->as<SceneImpl*>() : nullptr)
+        {
+            sceneImpl->setDependencyRecording(std::exchange(recordingId, AssetDependencyRecordingId::None));
+        }
 
         co_return scene;
     }
@@ -1,8 +1,13 @@
 // Copyright 2024 N-GINN LLC. All rights reserved.
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
+#include "nau/app/global_properties.h"
+#include "nau/app/main_loop/game_system.h"
+#include "nau/rtti/rtti_impl.h"
 #include "nau/scene/camera/camera_manager.h"
 #include "nau/scene/components/camera_component.h"
+#include "nau/service/service.h"
+#include "nau/threading/snapshot_buffer.h"
 #include "scene_test_base.h"
 
 namespace nau::test
@@ -492,4 +497,135 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    namespace
+    {
+        /**
+            The concurrent system with the pipelined scene sync (as the graphics does):
+            the cameras are captured on the host thread (publishSceneState) and consumed on the system thread (update).
+         */
+        class PipelinedCamerasSystem final : public IGameSceneUpdate,
+                                             public IGameScenePipelinedSync,
+                                             public IServiceShutdown
+        {
+            NAU_RTTI_CLASS(nau::test::PipelinedCamerasSystem, IGameSceneUpdate, IGameScenePipelinedSync, IServiceShutdown)
+
+            NAU_CLASS_ATTRIBUTES(
+                CLASS_ATTRIBUTE(PreferredExecutionMode, ExecutionMode::Concurrent))
+
+        public:
+            struct CameraState
+            {
+                Uid cameraUid;
+                float fov = 0.f;
+            };
+
+            static inline std::thread::id hostThreadId;
+            static inline std::atomic<bool> isPublishedOnHostThread = true;
+            static inline std::atomic<float> consumedFov = 0.f;
+
+        private:
+            async::Task<bool> update([[maybe_unused]] std::chrono::nanoseconds dt) override
+            {
+                if (auto* const snapshot = m_cameras.acquire())
+                {
+                    for (const CameraState& camera : snapshot->value)
+                    {
+                        consumedFov = camera.fov;
+                    }
+                }
+
+                co_return !m_isShutdownRequested;
+            }
+
+            eastl::optional<std::chrono::nanoseconds> getFixedUpdateTimeStep() override
+            {
+                return eastl::nullopt;
+            }
+
+            void syncSceneState() override
+            {
+                NAU_FAILURE("The pipelined sync is expected");
+            }
+
+            void publishSceneState(uint64_t frameIndex) override
+            {
+                if (std::this_thread::get_id() != hostThreadId)
+                {
+                    isPublishedOnHostThread = false;
+                    return;
+                }
+
+                auto& snapshot = m_cameras.getWriteSnapshot();
+                snapshot.value.clear();
+
+                // must be called on the main thread only
+                scene::ICameraManager::CamerasSnapshot cameras = getServiceProvider().get<scene::ICameraManager>().getCameras();
+                for (const auto& camera : cameras.getWorldAllCameras())
+                {
+                    snapshot.value.push_back(CameraState{camera->getCameraUid(), camera->getFov()});
+                }
+
+                m_cameras.publish(frameIndex);
+            }
+
+            async::Task<> shutdownService() override
+            {
+                m_isShutdownRequested = true;
+                return async::makeResolvedTask();
+            }
+
+            threading::SnapshotBuffer<eastl::vector<CameraState>> m_cameras;
+            std::atomic<bool> m_isShutdownRequested = false;
+        };
+    }  // namespace
+
+    /**
+     */
+    class TestCameraManagerPipelinedSync : public TestCameraManager
+    {
+    private:
+        void initializeApp() override
+        {
+            getServiceProvider().get<GlobalProperties>().setValue("/app/pipelinedSceneSync", true).ignore();
+
+            PipelinedCamerasSystem::hostThreadId = std::this_thread::get_id();
+            PipelinedCamerasSystem::isPublishedOnHostThread = true;
+            PipelinedCamerasSystem::consumedFov = 0.f;
+
+            registerClasses<PipelinedCamerasSystem>();
+            TestCameraManager::initializeApp();
+        }
+    };
+
+    /**
+        Test:
+            With the pipelined scene sync the cameras are read (on the host thread) when the scene state is published,
+            the system thread gets the camera properties only through the published snapshot.
+     */
+    TEST_F(TestCameraManagerPipelinedSync, CamerasCapturedOnHostThread)
+    {
+        using namespace nau::async;
+        using namespace ::testing;
+
+        const AssertionResult testResult = runTestApp([this]() -> Task<AssertionResult>
+        {
+            constexpr unsigned MaxFramesCount = 100;
+            constexpr float CameraFov = 40.f;
+
+            auto camera = getCameraManager().createDetachedCamera();
+            camera->setFov(CameraFov);
+
+            for (unsigned i = 0; i < MaxFramesCount && PipelinedCamerasSystem::consumedFov != CameraFov; ++i)
+            {
+                co_await skipFrames(1);
+            }
+
+            ASSERT_ASYNC(PipelinedCamerasSystem::isPublishedOnHostThread);
+            ASSERT_ASYNC(PipelinedCamerasSystem::consumedFov == CameraFov);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
 }  // namespace nau::test
@@ -27,11 +27,18 @@ namespace nau::vfx::modfx
         , m_quadIndexBuffer(nullptr)
         , m_instanceData(nullptr)
         , m_material(material)
+        , m_viewVariable(shader_globals::addVariable("view", sizeof(nau::math::Matrix4)))
+        , m_projectionVariable(shader_globals::addVariable("projection", sizeof(nau::math::Matrix4)))
         , m_actualParticlePoolSize(0)
         , m_transform(nau::math::Matrix4::identity())
         , m_offset(nau::math::Vector3::zero())
         , m_isPause(false)
     {
+        if (m_material)
+        {
+            m_textureProperty = m_material->findTexture("default", "tex");
+        }
+
         prepareQuadBuffer();
         prepareInstanceBuffer();
 
@@ -355,8 +362,8 @@ namespace nau::vfx::modfx
 
         d3d::set_buffer(STAGE_VS, 1, m_instanceBuffer);
 
-        shader_globals::setVariable("view", &view);
-        shader_globals::setVariable("projection", &projection);
+        shader_globals::setVariable(m_viewVariable, &view);
+        shader_globals::setVariable(m_projectionVariable, &projection);
 
         //shader_globals::setVariable("frames_y", &m_texture.frames_y);
         //shader_globals::setVariable("frames_x", &m_texture.frames_x);
@@ -364,9 +371,9 @@ namespace nau::vfx::modfx
         nau::Ptr<TextureAssetView> textureView;
         m_assetTexture->getTyped<TextureAssetView>(textureView);
 
-        m_material->setTexture("default", "tex", textureView->getTexture());
+        m_material->setTexture(m_textureProperty, textureView->getTexture());
 
-        m_material->bindPipeline("default");
+        m_material->bindPipeline(NAU_NAME("default"));
         
         d3d::setvsrc(0, m_positionBuffer, sizeof(nau::math::float3));
         d3d::setvsrc(1, m_normalBuffer, sizeof(nau::math::float3));
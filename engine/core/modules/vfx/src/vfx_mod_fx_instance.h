@@ -22,6 +22,7 @@
 #include "modfx/settings/fx_velocity.h"
 
 #include "nau/math/math.h"
+#include "nau/shaders/shader_globals.h"
 
 
 namespace nau::vfx::modfx
@@ -115,8 +116,12 @@ namespace nau::vfx::modfx
         Sbuffer* m_instanceBuffer;
 
         MaterialAssetView::Ptr m_material;
+        MaterialAssetView::TextureHandle m_textureProperty;
         ReloadableAssetView::Ptr m_assetTexture;
 
+        shader_globals::VariableId m_viewVariable;
+        shader_globals::VariableId m_projectionVariable;
+
         struct InstanceData
         {
             nau::math::Matrix4 worldMatrix;
@@ -11,6 +11,7 @@
 #include "nau/assets/asset_container_builder.h"
 #include "nau/assets/asset_manager.h"
 #include "nau/assets/asset_ref.h"
+#include "nau/assets/import_settings_provider.h"
 #include "nau/assets/texture_asset_accessor.h"
 #include "nau/diag/logging.h"
 #include "nau/io/file_system.h"
@@ -19,15 +20,102 @@
 #include "nau/io/stream.h"
 #include "nau/io/stream_utils.h"
 #include "nau/io/virtual_file_system.h"
+#include "nau/serialization/json.h"
 #include "nau/service/service.h"
 #include "nau/service/service_provider.h"
 #include "nau/shared/file_system.h"
 #include "nau/shared/logger.h"
+#include "nau/utils/dag_hash.h"
+
+#include <fstream>
 
 namespace nau
 {
     namespace compilers
     {
+        namespace
+        {
+            /**
+                Must be incremented when the texture import output changes (compression, mips generation, import settings),
+                so textures compiled by the previous version are not taken from the cache.
+             */
+            constexpr uint32_t TextureImportVersion = 1;
+
+            /**
+                The hash of everything the compiled texture depends on: the source content, its kind and the import settings.
+             */
+            uint64_t computeTextureContentHash(io::IStreamReader& stream, std::string_view extension, const RuntimeReadonlyDictionary::Ptr& importSettings)
+            {
+                constexpr size_t ChunkSize = 64 * 1024;
+
+                uint64_t hash = mem_hash_fnv1<64>(extension.data(), extension.size());
+                hash = fnv1_step<64>(TextureImportVersion, hash);
+
+                if (importSettings)
+                {
+                    eastl::string settingsJson;
+                    io::InplaceStringWriter<char> writer{settingsJson};
+                    serialization::jsonWrite(writer, importSettings).ignore();
+
+                    hash = mem_hash_fnv1<64>(settingsJson.data(), settingsJson.size(), hash);
+                }
+
+                eastl::vector<std::byte> buffer(ChunkSize);
+                while (true)
+                {
+                    const auto readResult = stream.read(buffer.data(), buffer.size());
+                    if (!readResult || *readResult == 0)
+                    {
+                        break;
+                    }
+
+                    hash = mem_hash_fnv1<64>(reinterpret_cast<const char*>(buffer.data()), *readResult, hash);
+                }
+
+                stream.setPosition(io::OffsetOrigin::Begin, 0);
+                return hash;
+            }
+
+            std::filesystem::path getContentHashPath(const std::string& output)
+            {
+                return std::filesystem::path(output + ".hash");
+            }
+
+            bool isTextureUpToDate(const std::string& output, uint64_t contentHash)
+            {
+                if (!std::filesystem::exists(output))
+                {
+                    return false;
+                }
+
+                std::ifstream hashFile(getContentHashPath(output));
+                uint64_t cachedHash = 0;
+                return hashFile && (hashFile >> cachedHash) && cachedHash == contentHash;
+            }
+
+            void storeTextureContentHash(const std::string& output, uint64_t contentHash)
+            {
+                std::ofstream hashFile(getContentHashPath(output), std::ios::trunc);
+                hashFile << contentHash;
+            }
+
+            /**
+                The per-asset import settings (if any provider has them), otherwise the loader's defaults.
+             */
+            RuntimeReadonlyDictionary::Ptr getTextureImportSettings(const std::string& sourcePath, const IAssetContainerLoader& textureLoader)
+            {
+                for (IImportSettingsProvider* const provider : getServiceProvider().getAll<IImportSettingsProvider>())
+                {
+                    if (RuntimeReadonlyDictionary::Ptr importSettings = provider->getAssetImportSettings(io::FsPath{sourcePath}, textureLoader))
+                    {
+                        return importSettings;
+                    }
+                }
+
+                return textureLoader.getDefaultImportSettings();
+            }
+        }  // namespace
+
         IAssetContainerLoader* getTextureLoader(eastl::string_view extension)
         {
             for (auto* const loader : getServiceProvider().getAll<IAssetContainerLoader>())
@@ -42,9 +130,19 @@ namespace nau
             return nullptr;
         }
 
-        bool saveDdsTexture(nau::Ptr<nau::io::IFile> file, IAssetContainerLoader* textureLoader, std::string& out, const char* extension)
+        bool saveDdsTexture(nau::Ptr<nau::io::IFile> file, IAssetContainerLoader* textureLoader, std::string& out, const char* extension, RuntimeReadonlyDictionary::Ptr importSettings)
         {
-            auto originalAssetContainerTask = textureLoader->loadFromStream(file->createStream(), {extension, "", textureLoader->getDefaultImportSettings()});
+            std::replace(out.begin(), out.end(), '\\', '/');
+
+            io::IStreamReader::Ptr sourceStream = file->createStream();
+            const uint64_t contentHash = computeTextureContentHash(*sourceStream, extension, importSettings);
+            if (isTextureUpToDate(out, contentHash))
+            {
+                LOG_INFO("Texture {} is up to date, skipping", out);
+                return true;
+            }
+
+            auto originalAssetContainerTask = textureLoader->loadFromStream(sourceStream, {extension, "", std::move(importSettings)});
             async::wait(originalAssetContainerTask);
             auto originalAssetContainer = *originalAssetContainerTask;
 
@@ -53,11 +151,15 @@ namespace nau
 
             IAssetContainerBuilder& builder = getServiceProvider().get<IAssetContainerBuilder>();
 
-            std::replace(out.begin(), out.end(), '\\', '/');
-
-            io::IStreamWriter::Ptr stream = io::createNativeFileStream(out.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
-            builder.writeAssetToStream(stream, asset).ignore();
+            {
+                io::IStreamWriter::Ptr stream = io::createNativeFileStream(out.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+                if (!builder.writeAssetToStream(stream, asset))
+                {
+                    return false;
+                }
+            }
 
+            storeTextureContentHash(out, contentHash);
             return true;
         }
 
@@ -86,7 +188,7 @@ namespace nau
 
             std::string output = subPath.string();
 
-            if (!saveDdsTexture(file, loader, output, textureSourceExtension))
+            if (!saveDdsTexture(file, loader, output, textureSourceExtension, getTextureImportSettings(fileRelativePath, *loader)))
             {
                 return NauMakeError("Failed to save texture {}", output);
             }